@@ -0,0 +1,601 @@
+#include "bdos.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iterator>
+
+#include "sram.h"
+
+// read by zpi_write() on core1 as the Z80 sends a call
+__zx_data const BdosArgs BdosRequestArgs[BdosFunctions] = {
+    BdosNone, BdosNone, BdosByte, BdosNone, BdosByte, BdosByte, BdosByte, BdosNone,  // 0x00
+    BdosByte, BdosBl, BdosNone, BdosNone, BdosNone, BdosNone, BdosByte, BdosBl,      // 0x08
+    BdosBl, BdosBl, BdosBl, BdosBl, BdosBl, BdosBlBl, BdosBl, BdosBl,                // 0x10
+    BdosNone, BdosNone, BdosNone, BdosNone, BdosNone, BdosNone, BdosBl, BdosNone,    // 0x18
+    BdosByte, BdosBl, BdosBlBl, BdosBl, BdosBl, BdosBl, BdosNone, BdosNone,          // 0x20
+    BdosBlBl,                                                                        // 0x28
+};
+
+__zx_data const bool BdosHasReply[BdosFunctions] = {
+    true, true, false, true, false, false, true, true,      // 0x00
+    false, false, true, true, true, false, false, true,     // 0x08
+    true, true, true, true, true, true, true, true,         // 0x10
+    true, true, false, true, false, true, true, true,       // 0x18
+    true, true, true, true, true, false, false, false,      // 0x20
+    true,                                                   // 0x28
+};
+
+namespace {
+constexpr uint16_t RecordSize = 128;
+constexpr uint32_t ExtentRecords = 128;
+constexpr uint8_t CpmEof = 0x1a;
+constexpr uint8_t NotFound = 0xff;
+
+// FCB layout
+constexpr int FcbName = 1;      // 8 + 3 bytes, attributes in the high bits
+constexpr int FcbEx = 12;
+constexpr int FcbS2 = 14;
+constexpr int FcbRc = 15;
+constexpr int FcbD0 = 16;       // d0/d1: the open file handle, see file_for()
+constexpr int FcbCr = 32;
+constexpr int FcbR0 = 33;
+constexpr int FcbSize = 36;
+
+// A fixed 4M disk with 2K blocks and 512 directory entries, it only matters
+// to programs that compute the free space
+constexpr uint16_t DpbBlocks = 2040;
+constexpr uint16_t DpbBlockSize = 2048;
+constexpr uint16_t DpbDirBlocks = 8;
+constexpr uint8_t Dpb[15] = {
+    64, 0,                          // SPT
+    4, 15, 0,                       // BSH, BLM, EXM
+    (DpbBlocks - 1) & 0xff, (DpbBlocks - 1) >> 8,
+    511 & 0xff, 511 >> 8,           // DRM
+    0xff, 0x00,                     // AL0, AL1: the directory blocks
+    0, 0,                           // CKS
+    0, 0,                           // OFF
+};
+
+struct OpenFile
+{
+    int file = -1;
+    uint8_t tag = 0;
+    char name[13];
+};
+
+struct Reply
+{
+    uint8_t *data;
+    uint16_t size = 0;
+
+    void byte(uint8_t value) { data[size++] = value; }
+    void word(uint16_t value)
+    {
+        byte(value >> 8);
+        byte(value);
+    }
+    void block(const uint8_t *bytes, uint8_t count)
+    {
+        byte(count);
+        memcpy(data + size, bytes, count);
+        size += count;
+    }
+};
+
+FileSystem *Fs = nullptr;
+const BdosConsole *Console = nullptr;
+BdosStats Stats;
+
+uint8_t CurrentDisk = 0;
+uint8_t UserCode = 0;
+uint8_t IoByte = 0;
+int Lookahead = -1;
+uint8_t Line[127];
+uint8_t LineSize = 0;
+
+OpenFile Open[FileSystem::MaxFiles];
+uint8_t NextTag = 1;
+uint8_t SearchPattern[11];
+uint32_t SearchCursor = 0;
+
+uint8_t Request[BdosMaxRequest];
+
+int console_get()
+{
+    if (Lookahead >= 0) {
+        const int c = Lookahead;
+        Lookahead = -1;
+        return c;
+    }
+    return Console ? Console->read() : -1;
+}
+
+bool console_ready()
+{
+    if (Lookahead < 0 && Console)
+        Lookahead = Console->read();
+    return Lookahead >= 0;
+}
+
+void console_put(uint8_t c)
+{
+    if (Console)
+        Console->write(c);
+}
+
+// 11 bytes name to "NAME.EXT"
+void file_name(const uint8_t *name, char *out)
+{
+    for (int i = 0; i < 8 && (name[i] & 0x7f) != ' '; ++i)
+        *out++ = toupper(name[i] & 0x7f);
+    if ((name[8] & 0x7f) != ' ') {
+        *out++ = '.';
+        for (int i = 8; i < 11 && (name[i] & 0x7f) != ' '; ++i)
+            *out++ = toupper(name[i] & 0x7f);
+    }
+    *out = 0;
+}
+
+// "NAME.EXT" to 11 bytes
+void fcb_name(const char *name, uint8_t *out)
+{
+    memset(out, ' ', 11);
+    for (int i = 0; *name && *name != '.' && i < 8; ++name)
+        out[i++] = *name;
+    if (*name == '.') {
+        ++name;
+        for (int i = 8; *name && i < 11; ++name)
+            out[i++] = *name;
+    }
+}
+
+bool matches(const uint8_t *pattern, const uint8_t *name)
+{
+    for (int i = 0; i < 11; ++i) {
+        if ((pattern[i] & 0x7f) != '?' && (pattern[i] & 0x7f) != (name[i] & 0x7f))
+            return false;
+    }
+    return true;
+}
+
+bool has_wildcard(const uint8_t *name)
+{
+    return std::any_of(name, name + 11, [](uint8_t c) { return (c & 0x7f) == '?'; });
+}
+
+uint32_t records(uint32_t bytes)
+{
+    return (bytes + RecordSize - 1) / RecordSize;
+}
+
+uint32_t sequential_record(const uint8_t *fcb)
+{
+    return ((fcb[FcbS2] & 0x3f) * 32 + (fcb[FcbEx] & 0x1f)) * ExtentRecords + (fcb[FcbCr] & 0x7f);
+}
+
+uint32_t random_record(const uint8_t *fcb)
+{
+    return fcb[FcbR0] | (fcb[FcbR0 + 1] << 8) | (fcb[FcbR0 + 2] << 16);
+}
+
+// records held by the extent the FCB points to
+uint8_t extent_records(const uint8_t *fcb, uint32_t size)
+{
+    const uint32_t first = ((fcb[FcbS2] & 0x3f) * 32 + (fcb[FcbEx] & 0x1f)) * ExtentRecords;
+    const uint32_t total = records(size);
+    return total <= first ? 0 : std::min(total - first, ExtentRecords);
+}
+
+void close_all()
+{
+    for (OpenFile &open : Open) {
+        if (open.file >= 0)
+            Fs->close(open.file);
+        open.file = -1;
+    }
+}
+
+void close_named(const char *name)
+{
+    for (OpenFile &open : Open) {
+        if (open.file >= 0 && !strcmp(open.name, name)) {
+            Fs->close(open.file);
+            open.file = -1;
+        }
+    }
+}
+
+// The open file of an FCB. Open stores the slot and a tag in d0/d1, so the
+// following calls find it without a name lookup; files that were never opened
+// (or dropped by a reset) are opened on the fly.
+OpenFile *file_for(uint8_t *fcb, bool create)
+{
+    char name[13];
+    file_name(fcb + FcbName, name);
+
+    const uint8_t slot = fcb[FcbD0] - 1;
+    if (!create && slot < FileSystem::MaxFiles && Open[slot].file >= 0 && Open[slot].tag == fcb[FcbD0 + 1]
+        && !strcmp(Open[slot].name, name))
+        return &Open[slot];
+
+    if (create)
+        close_named(name);
+    OpenFile *open = nullptr;
+    for (OpenFile &o : Open) {
+        if (o.file >= 0 && !strcmp(o.name, name))
+            open = &o;
+    }
+    if (!open) {
+        open = std::find_if(std::begin(Open), std::end(Open), [](const OpenFile &o) { return o.file < 0; });
+        if (open == std::end(Open))
+            return nullptr;
+        open->file = Fs->open(name, create);
+        if (open->file < 0)
+            return nullptr;
+        strcpy(open->name, name);
+        open->tag = NextTag++;
+    }
+    fcb[FcbD0] = open - Open + 1;
+    fcb[FcbD0 + 1] = open->tag;
+    return open;
+}
+
+// Directory entry of the next file matching SearchPattern
+bool search_next(Reply &reply)
+{
+    FsEntry entry;
+    while (Fs && Fs->list(SearchCursor, entry)) {
+        uint8_t dir[32] = {};
+        fcb_name(entry.name, dir + 1);
+        if (!matches(SearchPattern, dir + 1))
+            continue;
+        dir[0] = UserCode;
+        if (entry.readOnly)
+            dir[9] |= 0x80;
+        // one entry for the whole file, pointing at its last extent
+        const uint32_t total = records(entry.size);
+        const uint32_t extent = total ? (total - 1) / ExtentRecords : 0;
+        dir[FcbEx] = extent & 0x1f;
+        dir[FcbS2] = extent >> 5;
+        dir[FcbRc] = total - extent * ExtentRecords;
+        reply.byte(0);
+        reply.block(dir, sizeof(dir));
+        return true;
+    }
+    reply.byte(NotFound);
+    reply.block(nullptr, 0);
+    return false;
+}
+
+uint8_t read_record(uint8_t *fcb, uint32_t record, Reply &reply, uint8_t eofCode)
+{
+    OpenFile *open = file_for(fcb, false);
+    if (!open)
+        return NotFound;
+    uint8_t data[RecordSize];
+    const int32_t read = Fs->read(open->file, record * RecordSize, data, RecordSize);
+    if (read <= 0)
+        return eofCode;
+    std::fill(data + read, data + RecordSize, CpmEof);
+    reply.byte(0);
+    reply.block(data, RecordSize);
+    ++Stats.records;
+    return 0;
+}
+
+uint8_t write_record(uint8_t *fcb, uint32_t record, const uint8_t *data, uint8_t size, bool zeroFill)
+{
+    OpenFile *open = file_for(fcb, false);
+    if (!open)
+        return NotFound;
+    const uint32_t offset = record * RecordSize;
+    if (zeroFill) {
+        static const uint8_t Zero[RecordSize] = {};
+        for (uint32_t pos = Fs->size(open->file); pos < offset; pos += RecordSize) {
+            if (Fs->write(open->file, pos, Zero, std::min<uint32_t>(RecordSize, offset - pos)) <= 0)
+                return 2;
+        }
+    }
+    if (Fs->write(open->file, offset, data, size) != size)
+        return 2; // disk full
+    ++Stats.records;
+    return 0;
+}
+
+// 0x0a: line editing, the call stays pending until return
+bool read_line(Reply &reply)
+{
+    for (int c = console_get(); c >= 0; c = console_get()) {
+        if (c == '\r' || c == '\n') {
+            console_put('\r');
+            console_put('\n');
+            reply.block(Line, LineSize);
+            LineSize = 0;
+            return true;
+        }
+        if (c == 0x08 || c == 0x7f) {
+            if (LineSize) {
+                --LineSize;
+                console_put(0x08);
+                console_put(' ');
+                console_put(0x08);
+            }
+        } else if (LineSize < sizeof(Line)) {
+            Line[LineSize++] = c;
+            console_put(c);
+        }
+    }
+    return false;
+}
+
+void alloc_vector(Reply &reply)
+{
+    uint32_t used = DpbDirBlocks;
+    FsEntry entry;
+    uint32_t cursor = 0;
+    while (Fs && Fs->list(cursor, entry))
+        used += (entry.size + DpbBlockSize - 1) / DpbBlockSize;
+    used = std::min<uint32_t>(used, DpbBlocks);
+
+    uint8_t vector[DpbBlocks / 8] = {};
+    for (uint32_t block = 0; block < used; ++block)
+        vector[block / 8] |= 0x80 >> (block % 8);
+    reply.block(vector, sizeof(vector));
+}
+} // namespace {
+
+void bdos_init(FileSystem *fs, const BdosConsole *console)
+{
+    Fs = fs;
+    Console = console;
+}
+
+int bdos_call(const uint8_t *request, uint16_t size, uint8_t *reply)
+{
+    if (!size)
+        return 0;
+    const uint8_t function = request[0];
+
+    // calls waiting for the console leave the request alone
+    if (function == 0x01 && !console_ready())
+        return BdosPending;
+    if (function == 0x0a) {
+        Reply out{reply};
+        if (!read_line(out))
+            return BdosPending;
+        ++Stats.calls;
+        return out.size;
+    }
+
+    size = std::min(size, BdosMaxRequest);
+    memcpy(Request, request, size);
+    memset(Request + size, 0, sizeof(Request) - size);
+    ++Stats.calls;
+
+    const uint8_t arg = Request[1];
+    uint8_t fcb[FcbSize] = {};
+    memcpy(fcb, Request + 2, std::min<uint8_t>(Request[1], FcbSize));
+    const uint8_t *data = Request + 2 + Request[1] + 1;
+    const uint8_t dataSize = Request[2 + Request[1]];
+
+    Reply out{reply};
+    const bool files = Fs != nullptr;
+    uint8_t code = 0;
+    auto fcb_reply = [&](uint8_t result) {
+        code = result;
+        out.byte(code);
+        out.block(fcb, code == NotFound ? 0 : FcbSize);
+    };
+    switch (function) {
+    case 0x00: // system reset: no B4 GUI to send, an empty JAB jumping to 0
+        if (files)
+            close_all();
+        for (int i = 0; i < 6; ++i)
+            out.byte(0);
+        break;
+    case 0x01: {
+        const uint8_t c = console_get();
+        console_put(c);
+        out.byte(c);
+        break;
+    }
+    case 0x02:
+    case 0x04:
+    case 0x05:
+        console_put(arg);
+        break;
+    case 0x03:
+        out.byte(CpmEof);
+        break;
+    case 0x06:
+        if (arg == 0xff) {
+            const int c = console_get();
+            out.byte(c < 0 ? 0 : c);
+        } else if (arg == 0xfe) {
+            out.byte(console_ready() ? 0xff : 0);
+        } else {
+            console_put(arg);
+            out.byte(0);
+        }
+        break;
+    case 0x07:
+        out.byte(IoByte);
+        break;
+    case 0x08:
+        IoByte = arg;
+        break;
+    case 0x09:
+        for (uint8_t i = 0; i < Request[1] && Request[2 + i] != '$'; ++i)
+            console_put(Request[2 + i]);
+        break;
+    case 0x0b:
+        out.byte(console_ready() ? 0xff : 0);
+        break;
+    case 0x0c:
+        out.word(0x0022);
+        break;
+    case 0x0d:
+        if (files)
+            close_all();
+        CurrentDisk = 0;
+        break;
+    case 0x0e:
+        CurrentDisk = arg;
+        break;
+
+    case 0x0f: { // open
+        if (files && has_wildcard(fcb + FcbName)) {
+            memcpy(SearchPattern, fcb + FcbName, 11);
+            SearchCursor = 0;
+            uint8_t scratch[BdosMaxReply];
+            Reply found{scratch};
+            if (search_next(found))
+                memcpy(fcb + FcbName, scratch + 3, 11);
+        }
+        OpenFile *open = files ? file_for(fcb, false) : nullptr;
+        if (open)
+            fcb[FcbRc] = extent_records(fcb, Fs->size(open->file));
+        fcb_reply(open ? 0 : NotFound);
+        break;
+    }
+    case 0x10: { // close
+        char name[13];
+        file_name(fcb + FcbName, name);
+        code = NotFound;
+        if (files) {
+            uint32_t cursor = 0;
+            FsEntry entry;
+            while (code && Fs->list(cursor, entry)) {
+                if (!strcmp(entry.name, name))
+                    code = 0;
+            }
+            close_named(name);
+        }
+        out.byte(code);
+        break;
+    }
+    case 0x11: // search first
+        memcpy(SearchPattern, fcb + FcbName, 11);
+        SearchCursor = 0;
+        search_next(out);
+        break;
+    case 0x12:
+        search_next(out);
+        break;
+    case 0x13: { // delete
+        code = NotFound;
+        uint32_t cursor = 0;
+        FsEntry entry;
+        while (files && Fs->list(cursor, entry)) {
+            uint8_t name[11];
+            fcb_name(entry.name, name);
+            if (!matches(fcb + FcbName, name))
+                continue;
+            close_named(entry.name);
+            if (Fs->remove(entry.name))
+                code = 0;
+        }
+        out.byte(code);
+        break;
+    }
+    case 0x14: // read sequential
+        code = files ? read_record(fcb, sequential_record(fcb), out, 1) : NotFound;
+        if (code) {
+            out.byte(code);
+            out.block(nullptr, 0);
+        }
+        break;
+    case 0x15: // write sequential
+        code = files ? write_record(fcb, sequential_record(fcb), data, dataSize, false) : NotFound;
+        out.byte(code);
+        break;
+    case 0x16: { // make
+        OpenFile *open = files ? file_for(fcb, true) : nullptr;
+        fcb[FcbRc] = 0;
+        fcb_reply(open ? 0 : NotFound);
+        break;
+    }
+    case 0x17: { // rename, the new name is in d0..
+        char from[13];
+        char to[13];
+        file_name(fcb + FcbName, from);
+        file_name(fcb + FcbD0 + 1, to);
+        if (files)
+            close_named(from);
+        fcb_reply(files && Fs->rename(from, to) ? 0 : NotFound);
+        break;
+    }
+    case 0x18:
+        out.word(0x0001);
+        break;
+    case 0x19:
+        out.byte(CurrentDisk);
+        break;
+    case 0x1b:
+        alloc_vector(out);
+        break;
+    case 0x1d:
+        out.word(0x0000);
+        break;
+    case 0x1e: { // set attributes: only checks the file is there
+        OpenFile *open = files ? file_for(fcb, false) : nullptr;
+        fcb_reply(open ? 0 : NotFound);
+        break;
+    }
+    case 0x1f:
+        out.block(Dpb, sizeof(Dpb));
+        break;
+    case 0x20:
+        if (arg == 0xff) {
+            out.byte(UserCode);
+        } else {
+            UserCode = arg & 0x0f;
+            out.byte(0);
+        }
+        break;
+    case 0x21: { // read random
+        const uint32_t record = random_record(fcb);
+        code = !files ? NotFound : record > 0xffff ? 6 : read_record(fcb, record, out, 1);
+        if (code) {
+            out.byte(code);
+            out.block(nullptr, 0);
+        }
+        break;
+    }
+    case 0x22:
+    case 0x28: { // write random
+        const uint32_t record = random_record(fcb);
+        code = !files ? NotFound : record > 0xffff ? 6 : write_record(fcb, record, data, dataSize, function == 0x28);
+        out.byte(code);
+        break;
+    }
+    case 0x23: { // compute file size
+        OpenFile *open = files ? file_for(fcb, false) : nullptr;
+        const uint32_t size = open ? records(Fs->size(open->file)) : 0;
+        out.byte(size);
+        out.byte(size >> 8);
+        out.byte(size >> 16);
+        break;
+    }
+    case 0x24: { // set random record
+        const uint32_t record = sequential_record(fcb);
+        out.byte(0);
+        out.byte(record);
+        out.byte(record >> 8);
+        out.byte(record >> 16);
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (code == NotFound)
+        ++Stats.errors;
+    return out.size;
+}
+
+const BdosStats &bdos_stats()
+{
+    return Stats;
+}
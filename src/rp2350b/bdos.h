@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+
+#include "fs.h"
+
+// B4/BDOS, the CP/M function calls of zpi.md served on core0.
+//
+// The Z80 sends the whole call in one go: the function number followed by
+// its arguments (see BdosArgs). The bus side in zpi.cpp only frames the bytes
+// using BdosRequestArgs and hands them to bdos_call(), the answer is streamed
+// back with the same handshake as a page transfer. Functions without an
+// answer (BdosHasReply false) do not make the Z80 wait at all.
+
+constexpr uint8_t BdosCommand = 0x02;
+constexpr uint8_t BdosFunctions = 0x29;
+constexpr int BdosPending = -1;       // bdos_call() needs to be called again
+constexpr uint16_t BdosMaxRequest = 1 + 2 * (1 + 255);
+constexpr uint16_t BdosMaxReply = 1 + 1 + 255;
+
+enum BdosArgs : uint8_t {
+    BdosNone,
+    BdosByte,
+    BdosBl,     // one BL block
+    BdosBlBl,   // two BL blocks: FCB and data
+};
+
+extern const BdosArgs BdosRequestArgs[BdosFunctions];
+extern const bool BdosHasReply[BdosFunctions];
+
+// Console of the CP/M side, read() returns -1 when no character is waiting
+struct BdosConsole
+{
+    int (*read)();
+    void (*write)(uint8_t c);
+};
+
+// Call on core0. Without a file system every file function fails with 0xff.
+void bdos_init(FileSystem *fs, const BdosConsole *console);
+
+// Serves one call, request holds the function number and its arguments.
+// Returns the reply size, or BdosPending when it waits for the console; the
+// request is left untouched then. request and reply may be the same buffer.
+int bdos_call(const uint8_t *request, uint16_t size, uint8_t *reply);
+
+struct BdosStats
+{
+    uint32_t calls = 0;
+    uint32_t records = 0;   // 128 byte records read or written
+    uint32_t errors = 0;
+};
+
+const BdosStats &bdos_stats();
@@ -0,0 +1,183 @@
+#include "blockcache.h"
+
+#include <algorithm>
+#include <cstring>
+
+BlockCache::BlockCache(BlockDevice &device)
+    : m_device(device)
+{
+}
+
+bool BlockCache::submit(BlockRequest *request)
+{
+    if (m_queueTail - m_queueHead == QueueSize)
+        return false;
+    if (!request->count || request->lba + request->count > m_device.sectorCount())
+        return false;
+    m_queue[m_queueTail++ % QueueSize] = request;
+    return true;
+}
+
+void BlockCache::task()
+{
+    while (step())
+        ;
+}
+
+BlockCache::Line *BlockCache::find(uint32_t lineLba)
+{
+    for (Line &line : m_lines) {
+        if (line.lba == lineLba)
+            return &line;
+    }
+    return nullptr;
+}
+
+BlockCache::Line *BlockCache::victim()
+{
+    Line *oldest = &m_lines[0];
+    for (Line &line : m_lines) {
+        if (line.lba == UINT32_MAX)
+            return &line;
+        if (line.used < oldest->used)
+            oldest = &line;
+    }
+    return oldest;
+}
+
+void BlockCache::finish(bool ok)
+{
+    BlockRequest *request = m_current;
+    m_current = nullptr;
+    if (!ok)
+        ++m_stats.errors;
+    if (request->done)
+        request->done(request, ok);
+}
+
+// One step of the request in progress, false when there is nothing to do
+// until the device makes progress or a new request is queued.
+bool BlockCache::step()
+{
+    bool filled = false;
+    if (m_filling || m_writing) {
+        const BlockStatus status = m_device.poll();
+        if (status == BlockStatus::Busy)
+            return false;
+
+        if (m_writing) {
+            m_writing = false;
+            if (status == BlockStatus::Done) {
+                // write-through: refresh the cached copies
+                const BlockRequest &req = *m_current;
+                for (Line &line : m_lines) {
+                    if (line.lba == UINT32_MAX || line.lba >= req.lba + req.count || line.lba + LineSectors <= req.lba)
+                        continue;
+                    const uint32_t first = std::max(line.lba, req.lba);
+                    const uint32_t last = std::min(line.lba + LineSectors, req.lba + req.count);
+                    memcpy(line.data + (first - line.lba) * SectorSize, req.data + (first - req.lba) * SectorSize,
+                           (last - first) * SectorSize);
+                }
+            }
+            finish(status == BlockStatus::Done);
+            return true;
+        }
+
+        Line *line = m_filling;
+        m_filling = nullptr;
+        if (status != BlockStatus::Done) {
+            line->lba = UINT32_MAX;
+            finish(false);
+            return true;
+        }
+        filled = true;
+    }
+
+    if (!m_current) {
+        if (m_queueHead == m_queueTail)
+            return false;
+        m_current = m_queue[m_queueHead++ % QueueSize];
+        m_done = 0;
+        if (m_current->write) {
+            if (!m_device.startWrite(m_current->lba, m_current->data, m_current->count)) {
+                finish(false);
+                return true;
+            }
+            ++m_stats.deviceWrites;
+            m_writing = true;
+            return true;
+        }
+    }
+
+    BlockRequest &req = *m_current;
+    while (m_done < req.count) {
+        const uint32_t lba = req.lba + m_done;
+        const uint32_t offset = lba % LineSectors;
+        Line *line = find(lba - offset);
+        if (!line) {
+            line = victim();
+            line->lba = lba - offset;
+            line->used = ++m_clock;
+            const uint32_t count = std::min(LineSectors, m_device.sectorCount() - line->lba);
+            if (!m_device.startRead(line->lba, line->data, count)) {
+                line->lba = UINT32_MAX;
+                finish(false);
+                return true;
+            }
+            ++m_stats.misses;
+            ++m_stats.deviceReads;
+            m_filling = line;
+            return true;
+        }
+        if (!filled)
+            ++m_stats.hits;
+        filled = false;
+        line->used = ++m_clock;
+        const uint32_t count = std::min(LineSectors - offset, req.count - m_done);
+        memcpy(req.data + m_done * SectorSize, line->data + offset * SectorSize, count * SectorSize);
+        m_done += count;
+    }
+    finish(true);
+    return true;
+}
+
+namespace {
+void sync_done(BlockRequest *request, bool ok)
+{
+    *static_cast<int *>(request->user) = ok ? 1 : 0;
+}
+} // namespace {
+
+bool BlockCache::read(uint32_t lba, uint8_t *data, uint32_t count)
+{
+    int result = -1;
+    BlockRequest req{lba, count, data, false, sync_done, &result};
+    while (!submit(&req)) {
+        if (lba + count > m_device.sectorCount())
+            return false;
+        task();
+    }
+    while (result < 0)
+        task();
+    return result == 1;
+}
+
+bool BlockCache::write(uint32_t lba, const uint8_t *data, uint32_t count)
+{
+    int result = -1;
+    BlockRequest req{lba, count, const_cast<uint8_t *>(data), true, sync_done, &result};
+    while (!submit(&req)) {
+        if (lba + count > m_device.sectorCount())
+            return false;
+        task();
+    }
+    while (result < 0)
+        task();
+    return result == 1;
+}
+
+void BlockCache::invalidate()
+{
+    for (Line &line : m_lines)
+        line.lba = UINT32_MAX;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+
+#include "blockdev.h"
+
+struct BlockRequest;
+using BlockCallback = void (*)(BlockRequest *request, bool ok);
+
+struct BlockRequest
+{
+    uint32_t lba = 0;
+    uint32_t count = 0;
+    uint8_t *data = nullptr;
+    bool write = false;
+    BlockCallback done = nullptr; // called from BlockCache::task()
+    void *user = nullptr;
+};
+
+struct BlockCacheStats
+{
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t deviceReads = 0;  // line fills
+    uint32_t deviceWrites = 0;
+    uint32_t errors = 0;
+};
+
+// Sector cache and request queue in front of a BlockDevice, run by core0.
+//
+// The cache holds CacheLines lines of LineSectors consecutive sectors each and
+// evicts the least recently used line. A miss fills a whole line with one
+// multi-block read, so sequential reads get read-ahead for free. Writes go
+// straight to the device and update the cached copies (write-through).
+class BlockCache
+{
+public:
+    static constexpr uint32_t LineSectors = 4;
+    static constexpr uint32_t CacheLines = 16;
+    static constexpr uint32_t QueueSize = 16;
+
+    explicit BlockCache(BlockDevice &device);
+
+    BlockDevice &device() { return m_device; }
+
+    // Queues a request, false if the queue is full. The request must live
+    // until its callback is called.
+    bool submit(BlockRequest *request);
+
+    // Moves the queue forward, never blocks.
+    void task();
+    bool idle() const { return !m_current && m_queueHead == m_queueTail; }
+
+    // Blocking helpers for code that can wait (e.g. the file system layer)
+    bool read(uint32_t lba, uint8_t *data, uint32_t count);
+    bool write(uint32_t lba, const uint8_t *data, uint32_t count);
+
+    void invalidate();
+    const BlockCacheStats &stats() const { return m_stats; }
+
+private:
+    struct Line
+    {
+        uint32_t lba = UINT32_MAX; // first sector of the line
+        uint32_t used = 0;         // LRU stamp
+        uint8_t data[LineSectors * SectorSize];
+    };
+
+    Line *find(uint32_t lineLba);
+    Line *victim();
+    void finish(bool ok);
+    bool step();
+
+    BlockDevice &m_device;
+    Line m_lines[CacheLines];
+    uint32_t m_clock = 0;
+
+    BlockRequest *m_queue[QueueSize];
+    uint32_t m_queueHead = 0;
+    uint32_t m_queueTail = 0;
+
+    BlockRequest *m_current = nullptr;
+    uint32_t m_done = 0;        // sectors of m_current already served
+    Line *m_filling = nullptr;  // line being read from the device
+    bool m_writing = false;     // m_current is being written to the device
+
+    BlockCacheStats m_stats;
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+constexpr uint32_t SectorSize = 512;
+
+enum class BlockStatus : uint8_t {
+    Idle,
+    Busy,
+    Done,
+    Error,
+};
+
+// An asynchronous sector device. startRead()/startWrite() start one transfer
+// and return at once, poll() moves it forward without blocking and reports
+// Done or Error once. Only one transfer is in flight at a time, queueing is
+// done by BlockCache.
+class BlockDevice
+{
+public:
+    virtual ~BlockDevice() = default;
+
+    virtual bool init() = 0;
+    virtual uint32_t sectorCount() const = 0;
+
+    virtual bool startRead(uint32_t lba, uint8_t *data, uint32_t count) = 0;
+    virtual bool startWrite(uint32_t lba, const uint8_t *data, uint32_t count) = 0;
+    virtual BlockStatus poll() = 0;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+#include <pico.h>
+
+#if defined(__arm__)
+#include <hardware/structs/m33.h>
+#elif !defined(__riscv)
+#include "sim.h"
+#endif
+
+// Cycle counter of the calling core: mcycle on the Hazard3 cores, DWT CYCCNT
+// on the Cortex-M33 ones, the modelled cycles on the host. It wraps every
+// ~14 s at 300 MHz, differences are fine.
+
+// enables the counter on the calling core, both reset with it stopped
+inline void cycles_init()
+{
+#if defined(__riscv)
+    // mcountinhibit.CY
+    pico_default_asm_volatile("csrc 0x320, %0" : : "r"(1u));
+#elif defined(__arm__)
+    m33_hw->demcr |= M33_DEMCR_TRCENA_BITS;
+    m33_hw->dwt_cyccnt = 0;
+    m33_hw->dwt_ctrl |= M33_DWT_CTRL_CYCCNTENA_BITS;
+#endif
+}
+
+__force_inline uint32_t cycles_now()
+{
+#if defined(__riscv)
+    uint32_t cycles;
+    pico_default_asm_volatile("csrr %0, mcycle" : "=r"(cycles));
+    return cycles;
+#elif defined(__arm__)
+    return m33_hw->dwt_cyccnt;
+#else
+    return uint32_t(sim::Cycles);
+#endif
+}
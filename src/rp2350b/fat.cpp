@@ -0,0 +1,447 @@
+#include "fat.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iterator>
+
+namespace {
+constexpr uint32_t DirEntrySize = 32;
+constexpr uint8_t AttrReadOnly = 0x01;
+constexpr uint8_t AttrVolume = 0x08;
+constexpr uint8_t AttrDirectory = 0x10;
+constexpr uint8_t AttrArchive = 0x20;
+constexpr uint8_t AttrLongName = 0x0f;
+constexpr uint8_t Deleted = 0xe5;
+
+uint16_t le16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+uint32_t le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (uint32_t(p[3]) << 24);
+}
+
+void put16(uint8_t *p, uint16_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+}
+
+void put32(uint8_t *p, uint32_t value)
+{
+    put16(p, value);
+    put16(p + 2, value >> 16);
+}
+
+// "name.ext" to the space padded directory form
+bool to_fat_name(const char *name, uint8_t out[11])
+{
+    memset(out, ' ', 11);
+    int pos = 0;
+    for (; *name && *name != '.'; ++name) {
+        if (pos == 8)
+            return false;
+        out[pos++] = toupper(*name);
+    }
+    if (!pos)
+        return false;
+    if (*name == '.') {
+        pos = 8;
+        for (++name; *name; ++name) {
+            if (pos == 11)
+                return false;
+            out[pos++] = toupper(*name);
+        }
+    }
+    return true;
+}
+
+bool is_file(const uint8_t *entry)
+{
+    return entry[0] != Deleted && entry[11] != AttrLongName && !(entry[11] & (AttrVolume | AttrDirectory));
+}
+} // namespace {
+
+FatFileSystem::FatFileSystem(BlockCache &cache)
+    : m_cache(cache)
+{
+}
+
+uint8_t *FatFileSystem::load(uint32_t lba)
+{
+    if (lba == m_bufferLba)
+        return m_buffer;
+    if (!m_cache.read(lba, m_buffer, 1)) {
+        m_bufferLba = UINT32_MAX;
+        return nullptr;
+    }
+    m_bufferLba = lba;
+    return m_buffer;
+}
+
+bool FatFileSystem::store()
+{
+    return m_cache.write(m_bufferLba, m_buffer, 1);
+}
+
+bool FatFileSystem::mount()
+{
+    m_clusterCount = 0;
+    m_bufferLba = UINT32_MAX;
+    for (File &file : m_files)
+        file = {};
+
+    const uint8_t *p = load(0);
+    if (!p || le16(p + 510) != 0xaa55)
+        return false;
+
+    // a superfloppy starts with the boot sector, otherwise use the first
+    // partition of the MBR
+    uint32_t partLba = 0;
+    if ((p[0] != 0xeb && p[0] != 0xe9) || le16(p + 11) != SectorSize) {
+        partLba = le32(p + 0x1be + 8);
+        p = load(partLba);
+        if (!p || le16(p + 510) != 0xaa55 || le16(p + 11) != SectorSize)
+            return false;
+    }
+
+    m_sectorsPerCluster = p[13];
+    const uint32_t reserved = le16(p + 14);
+    m_fatCount = p[16];
+    m_rootEntries = le16(p + 17);
+    const uint32_t totalSectors = le16(p + 19) ? le16(p + 19) : le32(p + 32);
+    m_fatSectors = le16(p + 22) ? le16(p + 22) : le32(p + 36);
+    if (!m_sectorsPerCluster || !m_fatCount || !m_fatSectors)
+        return false;
+
+    const uint32_t rootSectors = (m_rootEntries * DirEntrySize + SectorSize - 1) / SectorSize;
+    m_fatLba = partLba + reserved;
+    m_rootLba = m_fatLba + m_fatCount * m_fatSectors;
+    m_dataLba = m_rootLba + rootSectors;
+    const uint32_t clusters = (totalSectors - (m_dataLba - partLba)) / m_sectorsPerCluster;
+    if (clusters < 4085)
+        return false; // FAT12
+    m_fat32 = clusters >= 65525;
+    m_rootCluster = m_fat32 ? le32(p + 44) : 0;
+    m_freeHint = 2;
+    m_clusterCount = clusters;
+    return true;
+}
+
+uint32_t FatFileSystem::fat(uint32_t cluster)
+{
+    const uint32_t offset = cluster * (m_fat32 ? 4 : 2);
+    const uint8_t *p = load(m_fatLba + offset / SectorSize);
+    if (!p)
+        return m_fat32 ? 0x0fffffff : 0xffff;
+    p += offset % SectorSize;
+    return m_fat32 ? le32(p) & 0x0fffffff : le16(p);
+}
+
+bool FatFileSystem::setFat(uint32_t cluster, uint32_t value)
+{
+    const uint32_t offset = cluster * (m_fat32 ? 4 : 2);
+    for (uint32_t i = 0; i < m_fatCount; ++i) {
+        uint8_t *p = load(m_fatLba + i * m_fatSectors + offset / SectorSize);
+        if (!p)
+            return false;
+        p += offset % SectorSize;
+        if (m_fat32)
+            put32(p, (le32(p) & 0xf0000000) | (value & 0x0fffffff));
+        else
+            put16(p, value);
+        if (!store())
+            return false;
+    }
+    return true;
+}
+
+bool FatFileSystem::endOfChain(uint32_t value) const
+{
+    return value < 2 || value >= (m_fat32 ? 0x0ffffff8 : 0xfff8);
+}
+
+uint32_t FatFileSystem::allocate(uint32_t previous)
+{
+    for (uint32_t i = 0; i < m_clusterCount; ++i) {
+        const uint32_t cluster = 2 + (m_freeHint - 2 + i) % m_clusterCount;
+        if (fat(cluster))
+            continue;
+        if (!setFat(cluster, m_fat32 ? 0x0fffffff : 0xffff))
+            return 0;
+        if (previous && !setFat(previous, cluster))
+            return 0;
+        m_freeHint = cluster + 1;
+        return cluster;
+    }
+    return 0;
+}
+
+void FatFileSystem::freeChain(uint32_t cluster)
+{
+    while (!endOfChain(cluster) && cluster < m_clusterCount + 2) {
+        const uint32_t next = fat(cluster);
+        if (!setFat(cluster, 0))
+            return;
+        m_freeHint = std::min(m_freeHint, cluster);
+        cluster = next;
+    }
+}
+
+uint32_t FatFileSystem::clusterLba(uint32_t cluster) const
+{
+    return m_dataLba + (cluster - 2) * m_sectorsPerCluster;
+}
+
+// Moves the cursor of file to the cluster at index of its chain, growing the
+// chain when extend is set.
+bool FatFileSystem::seek(File &file, uint32_t index, bool extend)
+{
+    if (!file.first) {
+        if (!extend || !(file.first = allocate(0)))
+            return false;
+        file.dirty = true;
+        file.cluster = 0;
+    }
+    if (!file.cluster || index < file.index) {
+        file.cluster = file.first;
+        file.index = 0;
+    }
+    while (file.index < index) {
+        uint32_t next = fat(file.cluster);
+        if (endOfChain(next)) {
+            if (!extend || !(next = allocate(file.cluster)))
+                return false;
+        }
+        file.cluster = next;
+        ++file.index;
+    }
+    return true;
+}
+
+bool FatFileSystem::dirEntry(uint32_t n, uint32_t &lba, uint16_t &offset)
+{
+    offset = (n * DirEntrySize) % SectorSize;
+    if (!m_fat32) {
+        if (n >= m_rootEntries)
+            return false;
+        lba = m_rootLba + n * DirEntrySize / SectorSize;
+        return true;
+    }
+    const uint32_t perCluster = clusterBytes() / DirEntrySize;
+    uint32_t cluster = m_rootCluster;
+    for (uint32_t i = n / perCluster; i; --i) {
+        cluster = fat(cluster);
+        if (endOfChain(cluster))
+            return false;
+    }
+    lba = clusterLba(cluster) + (n % perCluster) * DirEntrySize / SectorSize;
+    return true;
+}
+
+// Looks name up in the root directory. freeN gets the first reusable entry
+// when the name is not there, or UINT32_MAX if the directory is full.
+bool FatFileSystem::find(const uint8_t name[11], uint32_t &lba, uint16_t &offset, uint32_t *freeN)
+{
+    if (freeN)
+        *freeN = UINT32_MAX;
+    for (uint32_t n = 0; dirEntry(n, lba, offset); ++n) {
+        const uint8_t *p = load(lba);
+        if (!p)
+            return false;
+        p += offset;
+        if (!p[0]) {
+            if (freeN && *freeN == UINT32_MAX)
+                *freeN = n;
+            return false;
+        }
+        if (p[0] == Deleted) {
+            if (freeN && *freeN == UINT32_MAX)
+                *freeN = n;
+            continue;
+        }
+        if (is_file(p) && !memcmp(p, name, 11))
+            return true;
+    }
+    return false;
+}
+
+bool FatFileSystem::writeEntry(const File &file)
+{
+    uint8_t *p = load(file.dirLba);
+    if (!p)
+        return false;
+    p += file.dirOffset;
+    put16(p + 20, file.first >> 16);
+    put16(p + 26, file.first);
+    put32(p + 28, file.size);
+    return store();
+}
+
+int FatFileSystem::open(const char *name, bool create)
+{
+    uint8_t fatName[11];
+    if (!mounted() || !to_fat_name(name, fatName))
+        return -1;
+    const auto slot = std::find_if(std::begin(m_files), std::end(m_files), [](const File &f) { return !f.used; });
+    if (slot == std::end(m_files))
+        return -1;
+
+    File file;
+    uint32_t freeN;
+    if (find(fatName, file.dirLba, file.dirOffset, &freeN)) {
+        const uint8_t *p = load(file.dirLba) + file.dirOffset;
+        file.first = (uint32_t(le16(p + 20)) << 16) | le16(p + 26);
+        file.size = le32(p + 28);
+        if (create) {
+            freeChain(file.first);
+            file.first = 0;
+            file.size = 0;
+            if (!writeEntry(file))
+                return -1;
+        }
+    } else {
+        if (!create || freeN == UINT32_MAX || !dirEntry(freeN, file.dirLba, file.dirOffset))
+            return -1;
+        uint8_t *p = load(file.dirLba);
+        if (!p)
+            return -1;
+        p += file.dirOffset;
+        memset(p, 0, DirEntrySize);
+        memcpy(p, fatName, 11);
+        p[11] = AttrArchive;
+        if (!store())
+            return -1;
+    }
+    file.used = true;
+    *slot = file;
+    return slot - std::begin(m_files);
+}
+
+void FatFileSystem::close(int file)
+{
+    File &f = m_files[file];
+    if (f.dirty)
+        writeEntry(f);
+    f = {};
+}
+
+int32_t FatFileSystem::read(int file, uint32_t offset, uint8_t *data, uint32_t size)
+{
+    File &f = m_files[file];
+    if (offset >= f.size)
+        return 0;
+    size = std::min(size, f.size - offset);
+    const uint32_t bytes = clusterBytes();
+    uint32_t done = 0;
+    while (done < size) {
+        const uint32_t pos = offset + done;
+        if (!seek(f, pos / bytes, false))
+            return -1;
+        const uint8_t *p = load(clusterLba(f.cluster) + (pos % bytes) / SectorSize);
+        if (!p)
+            return -1;
+        const uint32_t count = std::min(SectorSize - pos % SectorSize, size - done);
+        memcpy(data + done, p + pos % SectorSize, count);
+        done += count;
+    }
+    return done;
+}
+
+int32_t FatFileSystem::write(int file, uint32_t offset, const uint8_t *data, uint32_t size)
+{
+    File &f = m_files[file];
+    const uint32_t bytes = clusterBytes();
+    uint32_t done = 0;
+    while (done < size) {
+        const uint32_t pos = offset + done;
+        if (!seek(f, pos / bytes, true))
+            break;
+        uint8_t *p = load(clusterLba(f.cluster) + (pos % bytes) / SectorSize);
+        if (!p)
+            break;
+        const uint32_t count = std::min(SectorSize - pos % SectorSize, size - done);
+        memcpy(p + pos % SectorSize, data + done, count);
+        if (!store())
+            break;
+        done += count;
+        if (pos + count > f.size) {
+            f.size = pos + count;
+            f.dirty = true;
+        }
+    }
+    return done ? int32_t(done) : -1;
+}
+
+uint32_t FatFileSystem::size(int file)
+{
+    return m_files[file].size;
+}
+
+bool FatFileSystem::remove(const char *name)
+{
+    uint8_t fatName[11];
+    uint32_t lba;
+    uint16_t offset;
+    if (!mounted() || !to_fat_name(name, fatName) || !find(fatName, lba, offset, nullptr))
+        return false;
+    for (File &f : m_files) {
+        if (f.used && f.dirLba == lba && f.dirOffset == offset)
+            f = {};
+    }
+    uint8_t *p = load(lba) + offset;
+    const uint32_t first = (uint32_t(le16(p + 20)) << 16) | le16(p + 26);
+    p[0] = Deleted;
+    if (!store())
+        return false;
+    freeChain(first);
+    return true;
+}
+
+bool FatFileSystem::rename(const char *from, const char *to)
+{
+    uint8_t fromName[11];
+    uint8_t toName[11];
+    uint32_t lba;
+    uint16_t offset;
+    if (!mounted() || !to_fat_name(from, fromName) || !to_fat_name(to, toName))
+        return false;
+    if (find(toName, lba, offset, nullptr) || !find(fromName, lba, offset, nullptr))
+        return false;
+    memcpy(load(lba) + offset, toName, 11);
+    return store();
+}
+
+bool FatFileSystem::list(uint32_t &cursor, FsEntry &entry)
+{
+    uint32_t lba;
+    uint16_t offset;
+    for (uint32_t n = cursor; mounted() && dirEntry(n, lba, offset); ++n) {
+        const uint8_t *p = load(lba);
+        if (!p)
+            return false;
+        p += offset;
+        if (!p[0])
+            return false;
+        if (!is_file(p))
+            continue;
+
+        char *out = entry.name;
+        for (int i = 0; i < 8 && p[i] != ' '; ++i)
+            *out++ = p[i];
+        if (p[8] != ' ') {
+            *out++ = '.';
+            for (int i = 8; i < 11 && p[i] != ' '; ++i)
+                *out++ = p[i];
+        }
+        *out = 0;
+        entry.size = le32(p + 28);
+        entry.readOnly = p[11] & AttrReadOnly;
+        cursor = n + 1;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "blockcache.h"
+#include "fs.h"
+
+// FAT16/FAT32 on the SD card, root directory and 8.3 names only.
+//
+// This is all B4/BDOS needs: CP/M has a single flat directory per drive and
+// 8.3 names. Long file name entries, subdirectories and volume labels are
+// skipped. Data goes through BlockCache one sector at a time, the directory
+// entry of a file that grew is written back by close().
+class FatFileSystem : public FileSystem
+{
+public:
+    explicit FatFileSystem(BlockCache &cache);
+
+    bool mount();
+    bool mounted() const { return m_clusterCount; }
+    uint32_t clusterBytes() const { return m_sectorsPerCluster * SectorSize; }
+    uint32_t clusterCount() const { return m_clusterCount; }
+
+    int open(const char *name, bool create) override;
+    void close(int file) override;
+    int32_t read(int file, uint32_t offset, uint8_t *data, uint32_t size) override;
+    int32_t write(int file, uint32_t offset, const uint8_t *data, uint32_t size) override;
+    uint32_t size(int file) override;
+
+    bool remove(const char *name) override;
+    bool rename(const char *from, const char *to) override;
+
+    bool list(uint32_t &cursor, FsEntry &entry) override;
+
+private:
+    struct File
+    {
+        bool used = false;
+        bool dirty = false;     // size or first cluster changed
+        uint32_t dirLba = 0;    // sector and offset of the directory entry
+        uint16_t dirOffset = 0;
+        uint32_t first = 0;
+        uint32_t size = 0;
+        uint32_t cluster = 0;   // cursor: the index-th cluster of the chain
+        uint32_t index = 0;
+    };
+
+    uint8_t *load(uint32_t lba);
+    bool store();
+
+    uint32_t fat(uint32_t cluster);
+    bool setFat(uint32_t cluster, uint32_t value);
+    bool endOfChain(uint32_t value) const;
+    uint32_t allocate(uint32_t previous);
+    void freeChain(uint32_t cluster);
+    uint32_t clusterLba(uint32_t cluster) const;
+    bool seek(File &file, uint32_t index, bool extend);
+
+    bool dirEntry(uint32_t n, uint32_t &lba, uint16_t &offset);
+    bool find(const uint8_t name[11], uint32_t &lba, uint16_t &offset, uint32_t *freeN);
+    bool writeEntry(const File &file);
+
+    BlockCache &m_cache;
+    uint8_t m_buffer[SectorSize];
+    uint32_t m_bufferLba = UINT32_MAX;
+
+    bool m_fat32 = false;
+    uint32_t m_sectorsPerCluster = 0;
+    uint32_t m_fatLba = 0;
+    uint32_t m_fatSectors = 0;
+    uint32_t m_fatCount = 0;
+    uint32_t m_rootLba = 0;      // FAT16 fixed root directory
+    uint32_t m_rootEntries = 0;
+    uint32_t m_rootCluster = 0;  // FAT32 root directory chain
+    uint32_t m_dataLba = 0;
+    uint32_t m_clusterCount = 0;
+    uint32_t m_freeHint = 2;
+
+    File m_files[MaxFiles];
+};
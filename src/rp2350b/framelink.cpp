@@ -0,0 +1,323 @@
+#include "framelink.h"
+
+#include <hardware/timer.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "utils.h"
+
+namespace {
+
+constexpr uint32_t HeaderSize = 3;
+constexpr uint32_t CrcSize = 4;
+
+// the encoded size, without the zero that ends the frame
+uint32_t cobs_encode(const uint8_t *data, uint32_t size, uint8_t *out)
+{
+    uint32_t code = 0;      // where the code byte of the block goes
+    uint32_t pos = 1;
+    uint8_t run = 1;
+    for (uint32_t i = 0; i < size; ++i) {
+        if (data[i]) {
+            out[pos++] = data[i];
+            ++run;
+        }
+        if (!data[i] || run == 0xff) {
+            out[code] = run;
+            run = 1;
+            code = pos;
+            // a full block at the end needs no empty one after it
+            if (!data[i] || i + 1 < size)
+                ++pos;
+        }
+    }
+    out[code] = run;
+    return pos;
+}
+
+// decodes in place, -1 for a code byte running past the end
+int32_t cobs_decode(uint8_t *data, uint32_t size)
+{
+    uint32_t out = 0;
+    for (uint32_t pos = 0; pos < size;) {
+        const uint8_t code = data[pos++];
+        if (!code || code - 1u > size - pos)
+            return -1;
+        for (uint32_t i = 1; i < code; ++i)
+            data[out++] = data[pos++];
+        if (code != 0xff && pos < size)
+            data[out++] = 0;
+    }
+    return out;
+}
+
+// free running counters of a window: a is in [from, to)
+bool in_window(uint8_t a, uint8_t from, uint8_t to)
+{
+    return uint8_t(a - from) < uint8_t(to - from);
+}
+
+} // namespace {
+
+FrameLink::FrameLink(SerialPort &port, uint32_t rtoUs)
+    : m_port(port)
+    , m_rtoUs(rtoUs)
+{}
+
+void FrameLink::setHandler(LinkHandler handler, void *user)
+{
+    m_handler = handler;
+    m_user = user;
+}
+
+void FrameLink::start(uint16_t epoch)
+{
+    for (Queue &queue : m_queues)
+        queue.head = queue.tail = 0;
+    dropState();
+    m_synced = false;
+    m_epoch = epoch ? epoch : 1;
+    // the first Reset right away
+    m_resetUs = time_us_32() - LinkResetUs;
+}
+
+void FrameLink::dropState()
+{
+    m_base = m_next = m_end = m_sentEnd = 0;
+    m_expect = 0;
+    m_ackDue = m_rejectDue = m_rejected = false;
+}
+
+bool FrameLink::send(uint8_t channel, const uint8_t *data, uint32_t size)
+{
+    if (channel >= LinkChannels || !size || size > space(channel))
+        return false;
+    Queue &queue = m_queues[channel];
+    const uint8_t length[2] = {uint8_t(size), uint8_t(size >> 8)};
+    for (uint32_t i = 0; i < 2 + size; ++i)
+        queue.data[queue.head++ % LinkQueueBytes] = i < 2 ? length[i] : data[i - 2];
+    return true;
+}
+
+uint32_t FrameLink::space(uint8_t channel) const
+{
+    const Queue &queue = m_queues[channel];
+    const uint32_t free = LinkQueueBytes - (queue.head - queue.tail);
+    return free > 2 ? std::min(free - 2, LinkMaxPayload) : 0;
+}
+
+bool FrameLink::idle() const
+{
+    for (const Queue &queue : m_queues) {
+        if (queue.head != queue.tail)
+            return false;
+    }
+    return m_base == m_end;
+}
+
+bool FrameLink::takeMessage()
+{
+    const uint32_t used = uint8_t(m_end - m_base);
+    for (uint32_t channel = 0; channel < LinkChannels; ++channel) {
+        Queue &queue = m_queues[channel];
+        if (queue.head == queue.tail || used >= (channel ? LinkWindow - LinkControlSlots : LinkWindow))
+            continue;
+        Slot &slot = m_window[m_end % LinkWindow];
+        slot.channel = channel;
+        slot.size = queue.data[queue.tail % LinkQueueBytes] | queue.data[(queue.tail + 1) % LinkQueueBytes] << 8;
+        queue.tail += 2;
+        for (uint32_t i = 0; i < slot.size; ++i)
+            slot.payload[i] = queue.data[queue.tail++ % LinkQueueBytes];
+        ++m_end;
+        return true;
+    }
+    return false;
+}
+
+bool FrameLink::sendFrame(Kind kind, uint8_t channel, uint8_t seq, uint8_t ack, const uint8_t *payload,
+                          uint32_t size)
+{
+    const uint32_t frameSize = HeaderSize + size + CrcSize;
+    // what the encoding takes at most, checked before doing it
+    if (m_port.space() < frameSize + frameSize / 254 + 2)
+        return false;
+    uint8_t frame[LinkMaxFrame];
+    frame[0] = kind << 4 | channel;
+    frame[1] = seq;
+    frame[2] = ack;
+    if (size)
+        memcpy(frame + HeaderSize, payload, size);
+    const uint32_t crc = crc32(frame, HeaderSize + size);
+    for (uint32_t i = 0; i < CrcSize; ++i)
+        frame[HeaderSize + size + i] = crc >> (8 * i);
+    const uint32_t encoded = cobs_encode(frame, frameSize, m_tx);
+    m_tx[encoded] = 0;
+    m_port.write(m_tx, encoded + 1);
+    return true;
+}
+
+void FrameLink::receive(const uint8_t *data, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; ++i) {
+        const uint8_t byte = data[i];
+        if (!byte) {
+            if (m_rxOverflow)
+                ++m_stats.badFrames;
+            else if (m_rxSize)
+                frame(m_rx, m_rxSize);
+            m_rxSize = 0;
+            m_rxOverflow = false;
+        } else if (m_rxSize == sizeof(m_rx)) {
+            m_rxOverflow = true;
+        } else {
+            m_rx[m_rxSize++] = byte;
+        }
+    }
+}
+
+void FrameLink::acked(uint8_t ack)
+{
+    // acks for frames not sent yet are stale or corrupt
+    if (!in_window(ack, m_base, m_sentEnd + 1) || ack == m_base)
+        return;
+    m_base = ack;
+    if (!in_window(m_next, m_base, m_end + 1))
+        m_next = m_base;
+    m_timerUs = time_us_32();
+}
+
+void FrameLink::frame(uint8_t *frame, uint32_t size)
+{
+    const int32_t decoded = cobs_decode(frame, size);
+    if (decoded < int32_t(HeaderSize + CrcSize)) {
+        ++m_stats.badFrames;
+        return;
+    }
+    const uint32_t payloadSize = decoded - HeaderSize - CrcSize;
+    const uint8_t *crc = frame + HeaderSize + payloadSize;
+    if (crc32(frame, HeaderSize + payloadSize) != uint32_t(crc[0] | crc[1] << 8 | crc[2] << 16 | crc[3] << 24)) {
+        ++m_stats.badFrames;
+        return;
+    }
+
+    const uint8_t kind = frame[0] >> 4;
+    const uint8_t channel = frame[0] & 15;
+    const uint8_t seq = frame[1];
+    const uint8_t ack = frame[2];
+    const uint16_t epoch = seq | ack << 8;
+    switch (kind) {
+    case Reset:
+        if (epoch != m_peerEpoch) {
+            m_peerEpoch = epoch;
+            ++m_stats.resets;
+            dropState();
+        }
+        m_resetAckDue = true;
+        m_resetAckEpoch = epoch;
+        return;
+    case ResetAck:
+        m_synced = m_synced || epoch == m_epoch;
+        return;
+    case Data:
+    case Ack:
+    case Reject:
+        break;
+    default:
+        ++m_stats.badFrames;
+        return;
+    }
+    if (!m_synced)
+        return;
+
+    acked(ack);
+    if (kind == Reject) {
+        ++m_stats.rejects;
+        if (m_sentEnd != m_base)
+            m_next = m_base;
+        return;
+    }
+    if (kind != Data)
+        return;
+    if (channel >= LinkChannels || payloadSize > LinkMaxPayload || !payloadSize) {
+        ++m_stats.badFrames;
+        return;
+    }
+    m_ackDue = true;
+    if (seq != m_expect) {
+        if (in_window(seq, m_expect - LinkWindow, m_expect)) {
+            ++m_stats.duplicates;
+        } else {
+            ++m_stats.outOfOrder;
+            m_rejectDue = m_rejectDue || !m_rejected;
+            m_rejected = true;
+        }
+        return;
+    }
+    ++m_expect;
+    m_rejected = false;
+    ++m_stats.received;
+    m_stats.bytesReceived += payloadSize;
+    if (m_handler)
+        m_handler(m_user, channel, frame + HeaderSize, payloadSize);
+}
+
+void FrameLink::task()
+{
+    uint8_t buffer[64];
+    for (;;) {
+        const uint32_t size = m_port.read(buffer, sizeof(buffer));
+        receive(buffer, size);
+        if (size < sizeof(buffer))
+            break;
+    }
+
+    const uint32_t now = time_us_32();
+    if (m_synced && m_sentEnd != m_base && now - m_timerUs >= m_rtoUs) {
+        ++m_stats.timeouts;
+        m_next = m_base;
+        m_timerUs = now;
+    }
+
+    for (;;) {
+        if (m_resetAckDue) {
+            if (!sendFrame(ResetAck, 0, m_resetAckEpoch, m_resetAckEpoch >> 8))
+                break;
+            m_resetAckDue = false;
+            continue;
+        }
+        if (!m_synced) {
+            if (now - m_resetUs >= LinkResetUs && sendFrame(Reset, 0, m_epoch, m_epoch >> 8))
+                m_resetUs = now;
+            break;
+        }
+        if (m_rejectDue) {
+            if (!sendFrame(Reject, 0, 0, m_expect))
+                break;
+            m_rejectDue = m_ackDue = false;
+            continue;
+        }
+        if (m_next == m_end)
+            takeMessage();
+        if (m_next != m_end) {
+            const Slot &slot = m_window[m_next % LinkWindow];
+            if (!sendFrame(Data, slot.channel, m_next, m_expect, slot.payload, slot.size))
+                break;
+            if (in_window(m_next, m_base, m_sentEnd)) {
+                ++m_stats.resent;
+            } else {
+                ++m_stats.sent;
+                m_stats.bytesSent += slot.size;
+                m_sentEnd = m_next + 1;
+            }
+            if (m_next == m_base)
+                m_timerUs = now;
+            ++m_next;
+            m_ackDue = false;
+            continue;
+        }
+        if (m_ackDue && sendFrame(Ack, 0, 0, m_expect))
+            m_ackDue = false;
+        break;
+    }
+}
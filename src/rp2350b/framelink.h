@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstdint>
+
+#include "serial.h"
+
+// Reliable messages over a SerialPort, the link to the ESP32-C3 on UART0.
+//
+// A frame is COBS encoded and ends with a zero byte, so a receiver that lost
+// bytes finds the next frame at the next zero. Before the encoding:
+//
+//   u8  kind << 4 | channel
+//   u8  seq         Data; low byte of the epoch for Reset and ResetAck
+//   u8  ack         next Data seq the sender expects; epoch high byte
+//   payload         Data only, LinkMaxPayload bytes at most
+//   u32 crc32()     of all of the above, little endian
+//
+// Data frames of all channels share one sequence, up to LinkWindow of them
+// wait for their ack, the oldest sent again after rtoUs (go back N). A
+// receiver takes them in order only, the first out of order frame gets a
+// Reject with what it expects and the sender goes back there without waiting
+// for the timeout. Every frame carries the ack of the other direction, an Ack
+// frame goes out alone when there is no Data to carry it.
+//
+// Each channel queues its messages on its own, the lowest channel with one
+// waiting gets the next free slot of the window. Channel 0 is for short
+// control messages: LinkControlSlots of the window are left to it, so they
+// never wait for the bulk transfers of the higher channels to be acked, only
+// for the frames already in the port. Frames go to the port whole, it should
+// hold little more than a couple of them.
+//
+// start() sends Reset with a new epoch until the peer answers ResetAck. The
+// peer drops what it had in flight when it sees an epoch it did not see
+// before, so a side that boots again never gets frames of the one before.
+// Data is neither sent nor taken before that. The same code runs on the
+// peer, it builds on the host as it is.
+
+constexpr uint32_t LinkChannels = 4;
+constexpr uint32_t LinkMaxPayload = 256;
+constexpr uint32_t LinkWindow = 16;         // divides 256
+constexpr uint32_t LinkControlSlots = 4;
+constexpr uint32_t LinkQueueBytes = 1024;   // of a channel, 2 bytes a message on top of it
+constexpr uint32_t LinkDefaultRtoUs = 10000;
+constexpr uint32_t LinkResetUs = 100000;    // between two Reset frames
+
+// the header, the payload and the crc32(), then the COBS code bytes and the
+// zero at the end
+constexpr uint32_t LinkMaxFrame = 3 + LinkMaxPayload + 4;
+constexpr uint32_t LinkMaxEncoded = LinkMaxFrame + (LinkMaxFrame + 253) / 254 + 1;
+
+// called from FrameLink::task() for every message in order
+using LinkHandler = void (*)(void *user, uint8_t channel, const uint8_t *data, uint32_t size);
+
+struct LinkStats
+{
+    uint32_t sent = 0;          // Data frames, new ones
+    uint32_t resent = 0;
+    uint32_t received = 0;      // messages handed to the handler
+    uint32_t duplicates = 0;    // Data frames received twice
+    uint32_t outOfOrder = 0;    // after a frame lost
+    uint32_t badFrames = 0;     // failed the crc32() or the framing
+    uint32_t rejects = 0;       // received, each one a go back
+    uint32_t timeouts = 0;
+    uint32_t resets = 0;        // peer epochs seen
+    uint64_t bytesSent = 0;     // payload of new Data frames
+    uint64_t bytesReceived = 0;
+};
+
+class FrameLink
+{
+public:
+    explicit FrameLink(SerialPort &port, uint32_t rtoUs = LinkDefaultRtoUs);
+
+    void setHandler(LinkHandler handler, void *user);
+
+    // drops what is queued and in flight and synchronises with the peer,
+    // epoch a random number, never the one of the start before
+    void start(uint16_t epoch);
+    bool synced() const { return m_synced; }
+
+    // queues a message, false when it is too big or the channel is full
+    bool send(uint8_t channel, const uint8_t *data, uint32_t size);
+    // the biggest message send() takes on channel now, 0 when it is full
+    uint32_t space(uint8_t channel) const;
+    // nothing queued and nothing waiting for an ack
+    bool idle() const;
+
+    // reads what arrived, hands the messages over and sends what the port
+    // takes, never blocks
+    void task();
+
+    const LinkStats &stats() const { return m_stats; }
+
+private:
+    enum Kind : uint8_t {
+        Data,
+        Ack,
+        Reject,
+        Reset,
+        ResetAck,
+    };
+
+    struct Queue
+    {
+        uint8_t data[LinkQueueBytes];
+        uint32_t head = 0;      // free running, written
+        uint32_t tail = 0;      // free running, taken into the window
+    };
+
+    struct Slot
+    {
+        uint8_t channel;
+        uint16_t size;
+        uint8_t payload[LinkMaxPayload];
+    };
+
+    void receive(const uint8_t *data, uint32_t size);
+    // decodes the frame in place
+    void frame(uint8_t *frame, uint32_t size);
+    void acked(uint8_t ack);
+    void dropState();
+    bool sendFrame(Kind kind, uint8_t channel, uint8_t seq, uint8_t ack, const uint8_t *payload = nullptr,
+                   uint32_t size = 0);
+    bool takeMessage();
+
+    SerialPort &m_port;
+    const uint32_t m_rtoUs;
+    LinkHandler m_handler = nullptr;
+    void *m_user = nullptr;
+
+    // synchronisation
+    bool m_synced = false;
+    uint16_t m_epoch = 0;
+    uint16_t m_peerEpoch = 0;   // 0 for none seen yet
+    uint32_t m_resetUs = 0;     // last Reset sent
+    bool m_resetAckDue = false;
+    uint16_t m_resetAckEpoch = 0;   // of the peer's last Reset
+
+    // sending: m_base oldest not acked, m_next next to send, m_end next free
+    Queue m_queues[LinkChannels];
+    Slot m_window[LinkWindow];
+    uint8_t m_base = 0;
+    uint8_t m_next = 0;
+    uint8_t m_end = 0;
+    uint8_t m_sentEnd = 0;      // sent at least once up to here
+    uint32_t m_timerUs = 0;     // last ack progress or send of m_base
+
+    // receiving
+    uint8_t m_expect = 0;
+    bool m_ackDue = false;
+    bool m_rejectDue = false;
+    bool m_rejected = false;    // since the last frame in order
+    uint8_t m_rx[LinkMaxEncoded];
+    uint32_t m_rxSize = 0;
+    bool m_rxOverflow = false;
+
+    uint8_t m_tx[LinkMaxEncoded];
+
+    LinkStats m_stats;
+};
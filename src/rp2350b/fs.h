@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+// A directory entry, names are 8.3 upper case "NAME.EXT"
+struct FsEntry
+{
+    char name[13];
+    uint32_t size;
+    bool readOnly;
+};
+
+// The flat file store behind B4/BDOS: one directory of 8.3 files. Files are
+// addressed by handle and every transfer gives its offset, which is what CP/M
+// records need.
+class FileSystem
+{
+public:
+    static constexpr int MaxFiles = 8;
+
+    virtual ~FileSystem() = default;
+
+    // handle or -1, create truncates an existing file
+    virtual int open(const char *name, bool create) = 0;
+    virtual void close(int file) = 0;
+    // bytes transferred or -1
+    virtual int32_t read(int file, uint32_t offset, uint8_t *data, uint32_t size) = 0;
+    virtual int32_t write(int file, uint32_t offset, const uint8_t *data, uint32_t size) = 0;
+    virtual uint32_t size(int file) = 0;
+
+    virtual bool remove(const char *name) = 0;
+    virtual bool rename(const char *from, const char *to) = 0;
+
+    // next entry after cursor, start with cursor 0
+    virtual bool list(uint32_t &cursor, FsEntry &entry) = 0;
+};
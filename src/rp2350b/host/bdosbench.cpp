@@ -0,0 +1,413 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Drives B4/BDOS calls through port 3 exactly like the Z80 side does: every
+// byte goes through the IO decode table into zpi.cpp, zpi_task() plays core0
+// between the polls of the reply handshake. The file calls run against a
+// directory of the Linux file system, or with --image against a FAT disk
+// image through the same FAT driver and sector cache as the firmware.
+//
+// Reports records per second on the host and the port accesses per record,
+// which is what bounds the real Z80 (one unrolled INI/OUTI per access).
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bdos.h"
+#include "blockcache.h"
+#include "fat.h"
+#include "fileblockdev.h"
+#include "io.h"
+#include "posixfs.h"
+#include "zpi.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint8_t Port = 0x03;
+constexpr int RecordSize = 128;
+
+struct Options
+{
+    const char *dir = nullptr;
+    const char *image = nullptr;
+    uint32_t records = 2048;
+    uint32_t random = 2048;
+};
+
+uint64_t PortAccesses = 0;
+uint64_t Polls = 0;
+std::string ConsoleOut;
+
+int console_read()
+{
+    return -1;
+}
+
+void console_write(uint8_t c)
+{
+    ConsoleOut += char(c);
+}
+
+const BdosConsole Console{console_read, console_write};
+
+// the Z80 side of the port
+void out(uint8_t value)
+{
+    ++PortAccesses;
+    IoWriteTable[Port](Port, value);
+}
+
+uint8_t in()
+{
+    ++PortAccesses;
+    return IoReadTable[Port](Port);
+}
+
+struct Call
+{
+    std::vector<uint8_t> request;
+
+    explicit Call(uint8_t function) { request = {BdosCommand, function}; }
+    Call &byte(uint8_t value)
+    {
+        request.push_back(value);
+        return *this;
+    }
+    Call &block(const uint8_t *data, uint8_t size)
+    {
+        request.push_back(size);
+        request.insert(request.end(), data, data + size);
+        return *this;
+    }
+
+    // sends the call, then waits for the reply when there is one
+    void send()
+    {
+        for (uint8_t b : request)
+            out(b);
+        if (!BdosHasReply[request[1]]) {
+            zpi_task();
+            return;
+        }
+        while (in() == BdosCommand) {
+            ++Polls;
+            zpi_task();
+        }
+    }
+};
+
+// reads a BL block of the reply
+uint8_t read_block(uint8_t *data)
+{
+    const uint8_t size = in();
+    for (int i = 0; i < size; ++i) {
+        const uint8_t b = in();
+        if (data)
+            data[i] = b;
+    }
+    return size;
+}
+
+// what the CP/M side keeps: the FCB, 36 bytes with the random record
+struct Fcb
+{
+    uint8_t bytes[36] = {};
+
+    explicit Fcb(const char *name)
+    {
+        memset(bytes + 1, ' ', 11);
+        const char *dot = strchr(name, '.');
+        memcpy(bytes + 1, name, dot ? dot - name : strlen(name));
+        if (dot)
+            memcpy(bytes + 9, dot + 1, strlen(dot + 1));
+    }
+
+    // the Z80 moves the sequential position itself, as the CP/M BDOS does
+    void next()
+    {
+        if (++bytes[32] == 128) {
+            bytes[32] = 0;
+            if (++bytes[12] == 32) {
+                bytes[12] = 0;
+                ++bytes[14];
+            }
+        }
+    }
+
+    void setRandom(uint32_t record)
+    {
+        bytes[33] = record;
+        bytes[34] = record >> 8;
+        bytes[35] = 0;
+    }
+};
+
+// calls answering a directory code and the updated FCB
+uint8_t fcb_call(uint8_t function, Fcb &fcb)
+{
+    Call(function).block(fcb.bytes, sizeof(fcb.bytes)).send();
+    const uint8_t code = in();
+    read_block(fcb.bytes);
+    return code;
+}
+
+uint8_t code_call(uint8_t function, const Fcb &fcb, const uint8_t *data = nullptr)
+{
+    Call call(function);
+    call.block(fcb.bytes, sizeof(fcb.bytes));
+    if (data)
+        call.block(data, RecordSize);
+    call.send();
+    return in();
+}
+
+uint8_t read_call(uint8_t function, const Fcb &fcb, uint8_t *data)
+{
+    Call(function).block(fcb.bytes, sizeof(fcb.bytes)).send();
+    const uint8_t code = in();
+    read_block(data);
+    return code;
+}
+
+struct Phase
+{
+    const char *name;
+    Clock::time_point start = Clock::now();
+    uint64_t accesses = PortAccesses;
+    uint64_t polls = Polls;
+
+    explicit Phase(const char *phaseName)
+        : name(phaseName)
+    {
+    }
+
+    void report(uint32_t records)
+    {
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        const double perRecord = double(PortAccesses - accesses) / records;
+        const double zxRecords = double(ZxFrameTStates) * 50 / (perRecord * ZxBlockIoTStates);
+        printf("%-12s %7" PRIu32 " records %10.0f records/s  %6.1f port accesses/record (%.1f polls)"
+               "  Z80 bound %5.0f records/s\n",
+               name, records, records / seconds, perRecord, double(Polls - polls) / records, zxRecords);
+    }
+};
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options] directory\n"
+           "  --image FILE     use a FAT16/32 disk image instead of a directory\n"
+           "  --records N      records of the sequential test file (default 2048)\n"
+           "  --random N       random record reads (default 2048)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--image")
+            opts.image = value();
+        else if (arg == "--records")
+            opts.records = strtoul(value(), nullptr, 0);
+        else if (arg == "--random")
+            opts.random = strtoul(value(), nullptr, 0);
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg[0] != '-' && !opts.dir)
+            opts.dir = argv[i];
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return (opts.dir || opts.image) && opts.records;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::unique_ptr<FileBlockDevice> device;
+    std::unique_ptr<BlockCache> cache;
+    std::unique_ptr<FileSystem> fs;
+    if (opts.image) {
+        device = std::make_unique<FileBlockDevice>(opts.image);
+        cache = std::make_unique<BlockCache>(*device);
+        auto fat = std::make_unique<FatFileSystem>(*cache);
+        if (!device->init() || !fat->mount()) {
+            fprintf(stderr, "%s: not a FAT16/32 image\n", opts.image);
+            return 1;
+        }
+        fs = std::move(fat);
+    } else {
+        fs = std::make_unique<PosixFileSystem>(opts.dir);
+    }
+
+    zpi_init(nullptr);
+    io_build();
+    bdos_init(fs.get(), &Console);
+
+    int failures = 0;
+    auto check = [&](bool ok, const char *what) {
+        if (!ok) {
+            printf("FAIL: %s\n", what);
+            ++failures;
+        }
+    };
+
+    Call(0x0c).send();
+    uint16_t version = in() << 8;
+    version |= in();
+    const char hello[] = "B4/BDOS bench$";
+    Call(0x09).block(reinterpret_cast<const uint8_t *>(hello), sizeof(hello) - 1).send();
+    Call(0x0b).send(); // flushes the print string before it is checked
+    in();
+    check(ConsoleOut == "B4/BDOS bench", "print string");
+    printf("BDOS version %04x, %s\n\n", version, opts.image ? opts.image : opts.dir);
+
+    // sequential write of a file with a known pattern
+    Fcb fcb("BENCH.DAT");
+    code_call(0x13, fcb);
+    check(fcb_call(0x16, fcb) == 0, "make file");
+    uint8_t record[RecordSize];
+    {
+        Phase phase("write seq");
+        for (uint32_t r = 0; r < opts.records; ++r) {
+            for (int i = 0; i < RecordSize; ++i)
+                record[i] = uint8_t(r * 7 + i);
+            if (code_call(0x15, fcb, record)) {
+                check(false, "write sequential");
+                break;
+            }
+            fcb.next();
+        }
+        phase.report(opts.records);
+    }
+    check(code_call(0x10, fcb) == 0, "close file");
+
+    Fcb reader("bench.dat");
+    check(fcb_call(0x0f, reader) == 0, "open file");
+    {
+        Phase phase("read seq");
+        uint32_t r = 0;
+        bool same = true;
+        while (read_call(0x14, reader, record) == 0) {
+            for (int i = 0; i < RecordSize; ++i)
+                same &= record[i] == uint8_t(r * 7 + i);
+            reader.next();
+            ++r;
+        }
+        phase.report(r);
+        check(r == opts.records, "read sequential record count");
+        check(same, "read sequential data");
+    }
+
+    {
+        Phase phase("read random");
+        std::mt19937 rng(3);
+        bool same = true;
+        for (uint32_t i = 0; i < opts.random; ++i) {
+            const uint32_t r = rng() % opts.records;
+            reader.setRandom(r);
+            if (read_call(0x21, reader, record)) {
+                same = false;
+                break;
+            }
+            for (int b = 0; b < RecordSize; ++b)
+                same &= record[b] == uint8_t(r * 7 + b);
+        }
+        phase.report(opts.random);
+        check(same, "read random data");
+    }
+
+    {
+        Phase phase("write random");
+        for (uint32_t i = 0; i < opts.random; ++i) {
+            reader.setRandom(i % opts.records);
+            memset(record, uint8_t(i), sizeof(record));
+            if (code_call(0x22, reader, record)) {
+                check(false, "write random");
+                break;
+            }
+        }
+        phase.report(opts.random);
+    }
+
+    Call(0x23).block(reader.bytes, sizeof(reader.bytes)).send();
+    uint32_t size = in();
+    size |= in() << 8;
+    size |= in() << 16;
+    check(size == opts.records, "compute file size");
+    code_call(0x10, reader);
+
+    // rename, search and delete
+    Fcb renamed("BENCH.DAT");
+    memcpy(renamed.bytes + 17, Fcb("BENCH2.DAT").bytes + 1, 11);
+    check(fcb_call(0x17, renamed) == 0, "rename");
+    Fcb pattern("????????.???");
+    uint8_t dir[32];
+    auto search = [&](uint8_t function) {
+        Call(function).block(pattern.bytes, sizeof(pattern.bytes)).send();
+        const uint8_t code = in();
+        read_block(dir);
+        return code == 0;
+    };
+    uint32_t files = 0;
+    bool seen = false;
+    for (bool found = search(0x11); found; found = search(0x12)) {
+        seen |= !memcmp(dir + 1, "BENCH2  DAT", 11);
+        ++files;
+    }
+    check(seen, "search first/next");
+    printf("\n%" PRIu32 " files in the directory\n", files);
+    check(code_call(0x13, Fcb("BENCH2.DAT")) == 0, "delete");
+    check(fcb_call(0x0f, reader) == 0xff, "open deleted file");
+
+    const BdosStats &stats = bdos_stats();
+    printf("%" PRIu32 " calls, %" PRIu32 " records, %" PRIu32 " errors, %" PRIu32 " overruns\n", stats.calls,
+           stats.records, stats.errors, zpi_stats().overruns);
+    if (failures) {
+        printf("\nFAIL: %d checks failed\n", failures);
+        return 1;
+    }
+    printf("\nOK\n");
+    return 0;
+}
@@ -0,0 +1,392 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Streams the screen of a busy Z80 through a link of --link-kbs.
+//
+// Three workloads: a few sprites a frame, the whole pixel area scrolled by a
+// byte a frame and every byte of the display file rewritten with noise each
+// frame, the worst a game can do. The writes are spread over the frame, go
+// through zx_mreq() like on the bus and land in the snoop FIFO as the
+// zx_snoop state machine would push them. core0 calls screencast_task()
+// every --task-us and the link takes --link-kbs worth of bytes each time.
+//
+// The stream is decoded with the CastReader of zxcast: every frame has to
+// show the screen as it was when it was taken. Prints the bytes a frame took
+// and the time from the first write a frame carries to its last byte on the
+// link, and checks the full redraw gets a frame every tick when the link is
+// fast enough for it.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "castfile.h"
+#include "mailbox.h"
+#include "ramshadow.h"
+#include "rombank.h"
+#include "screencast.h"
+#include "sim.h"
+#include "zpi.h"
+#include "zx.h"
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int MreqSm = 0;
+constexpr int IorqSm = 1;
+constexpr int SnoopSm = 2;
+constexpr uint32_t CyclesPerUs = 150;
+constexpr uint32_t FrameT = 69888;
+constexpr uint64_t NoWrite = ~0ull;
+
+enum class Workload { Sprites, Scroll, Redraw, Count };
+const char *const WorkloadNames[] = {"sprites", "scroll", "redraw"};
+
+struct Options
+{
+    int workload = -1;          // all of them
+    uint32_t seed = 1;
+    uint32_t frames = 250;
+    uint32_t sprites = 8;
+    uint32_t taskUs = 20;
+    uint32_t linkKBs = 1000;
+    double zxMHz = 3.5469;
+    const char *out = nullptr;  // keeps the stream of the last workload run
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+struct Take
+{
+    std::vector<uint8_t> screen;
+    uint64_t firstWrite;        // cycles, NoWrite for a key frame of nothing new
+};
+
+int Failures = 0;
+uint8_t Ram[0xc000];            // what the Z80 wrote, 0x4000 on
+uint64_t FirstWrite = NoWrite;  // to the screen since the last take
+
+// the link: what the task budget lets through ends up in Stream, Arrived
+// keeps the end of each write and the cycle it happened at
+std::vector<uint8_t> Stream;
+std::vector<std::pair<size_t, uint64_t>> Arrived;
+uint32_t Budget = 0;
+
+uint32_t link_space()
+{
+    return Budget;
+}
+
+void link_write(const uint8_t *data, uint32_t size)
+{
+    Stream.insert(Stream.end(), data, data + size);
+    Arrived.emplace_back(Stream.size(), sim::Cycles);
+    Budget -= size;
+}
+
+const TraceSink Link{link_space, link_write};
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+// a memory write as the Z80 does it: the mreq word, then the snoop one
+void write(uint16_t addr, uint8_t data)
+{
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE) | data;
+    bus &= ~(1u << I_MREQ_L);
+    sim::pio_rx_push(MreqSm, bus);
+    sim::pio_rx_push(SnoopSm, (bus & ~(1u << I_WR_L)) | 1u << I_ZXRDWR);
+    zx_poll();
+    uint32_t word;
+    uint64_t cycle;
+    sim::pio_tx_pop(MreqSm, word, cycle);
+
+    Ram[addr - 0x4000] = data;
+    if (uint32_t(addr - ScreenBase) < ScreenBytes)
+        FirstWrite = std::min(FirstWrite, sim::Cycles);
+}
+
+void port3(uint8_t data)
+{
+    uint32_t bus = ControlIdle | (0x0003u << I_ADDR_BASE) | data;
+    bus &= ~((1u << I_IORQ_L) | (1u << I_WR_L));
+    bus |= 1u << I_ZXRDWR;
+    sim::pio_rx_push(IorqSm, bus);
+    zx_poll();
+    uint32_t word;
+    uint64_t cycle;
+    sim::pio_tx_pop(IorqSm, word, cycle);
+    mailbox_task();
+}
+
+// the address of pixel row y, byte x of the display file
+uint16_t pixel_addr(uint32_t x, uint32_t y)
+{
+    return ScreenBase | (y & 0xc0) << 5 | (y & 0x07) << 8 | (y & 0x38) << 2 | x;
+}
+
+// the writes of a frame, in the order the Z80 does them
+void frame_writes(Workload workload, const Options &opts, Rng &rng, std::vector<std::pair<uint16_t, uint8_t>> &out)
+{
+    out.clear();
+    switch (workload) {
+    case Workload::Sprites:
+        for (uint32_t s = 0; s < opts.sprites; ++s) {
+            const uint32_t x = rng.next() % 31;
+            const uint32_t y = rng.next() % (192 - 16);
+            for (uint32_t row = 0; row < 16; ++row) {
+                out.emplace_back(pixel_addr(x, y + row), rng.next());
+                out.emplace_back(pixel_addr(x + 1, y + row), rng.next());
+            }
+            out.emplace_back(ScreenBase + 6144 + (y / 8) * 32 + x, rng.next());
+        }
+        break;
+    case Workload::Scroll:
+        for (uint32_t y = 0; y < 192; ++y) {
+            for (uint32_t x = 0; x < 32; ++x)
+                out.emplace_back(pixel_addr(x, y), Ram[pixel_addr((x + 1) % 32, y) - 0x4000]);
+        }
+        break;
+    case Workload::Redraw:
+        for (uint32_t i = 0; i < ScreenBytes; ++i)
+            out.emplace_back(ScreenBase + i, rng.next());
+        break;
+    case Workload::Count:
+        break;
+    }
+}
+
+struct Result
+{
+    uint64_t frames = 0;
+    uint64_t bytes = 0;
+    uint32_t maxFrame = 0;
+    uint32_t lateTicks = 0;
+    uint32_t ticks = 0;
+    uint64_t writes = 0;
+    double avgUs = 0;
+    double worstUs = 0;
+    uint32_t wrong = 0;         // decoded frames not showing their take
+};
+
+Result run(const Options &opts, Workload workload)
+{
+    Stream.clear();
+    Arrived.clear();
+    std::vector<Take> takes;
+    Rng rng{opts.seed};
+    const uint32_t taskBytes = uint64_t(opts.linkKBs) * 1000 * opts.taskUs / 1000000;
+    const double cyclesPerT = CyclesPerUs / opts.zxMHz;
+    const uint64_t start = sim::Cycles;
+    uint64_t core0 = sim::Cycles;
+    Result r;
+
+    // core0 up to cycle, recording the screen at each take
+    auto run_core0 = [&](uint64_t cycle) {
+        while (core0 <= cycle) {
+            sim::Cycles = std::max(sim::Cycles, core0);
+            Budget = taskBytes;
+            const uint32_t frames = screencast_stats().frames;
+            screencast_task();
+            if (screencast_stats().frames != frames) {
+                takes.push_back({std::vector<uint8_t>(Ram, Ram + ScreenBytes), FirstWrite});
+                FirstWrite = NoWrite;
+            }
+            core0 += opts.taskUs * CyclesPerUs;
+        }
+        sim::Cycles = std::max(sim::Cycles, cycle);
+    };
+
+    FirstWrite = NoWrite;
+    port3(0x55);
+    check("streaming", screencast_running());
+    std::vector<std::pair<uint16_t, uint8_t>> writes;
+    for (uint32_t frame = 0; frame < opts.frames; ++frame) {
+        frame_writes(workload, opts, rng, writes);
+        for (size_t i = 0; i < writes.size(); ++i) {
+            const uint64_t t = uint64_t(frame) * FrameT + i * FrameT / writes.size();
+            run_core0(start + uint64_t(t * cyclesPerT));
+            write(writes[i].first, writes[i].second);
+        }
+        r.writes += writes.size();
+    }
+    port3(0x54);
+    while (screencast_running())
+        run_core0(core0);
+
+    const ScreencastStats &stats = screencast_stats();
+    r.lateTicks = stats.lateTicks;
+    r.ticks = stats.ticks;
+    check("every frame taken went out", stats.frames == takes.size());
+
+    CastReader reader(Stream.data(), Stream.size());
+    CastFrame frame;
+    size_t arrived = 0;
+    double totalUs = 0;
+    uint64_t timed = 0;
+    while (reader.next(frame)) {
+        const size_t at = reader.frames() - 1;
+        if (at >= takes.size() || memcmp(reader.screen(), takes[at].screen.data(), ScreenBytes)) {
+            ++r.wrong;
+            continue;
+        }
+        while (Arrived[arrived].first < frame.end)
+            ++arrived;
+        if (takes[at].firstWrite != NoWrite) {
+            const double us = double(Arrived[arrived].second - takes[at].firstWrite) / CyclesPerUs;
+            totalUs += us;
+            r.worstUs = std::max(r.worstUs, us);
+            ++timed;
+        }
+        r.bytes += frame.size;
+        r.maxFrame = std::max(r.maxFrame, frame.size);
+    }
+    r.frames = reader.frames();
+    r.avgUs = timed ? totalUs / timed : 0;
+    check("every frame decoded", r.frames == takes.size() && !reader.badFrames() && !reader.waited());
+    check("every frame shows its take", !r.wrong);
+    check("the last frame shows the RAM", r.frames && !memcmp(reader.screen(), Ram, ScreenBytes));
+
+    if (opts.out) {
+        FILE *f = fopen(opts.out, "wb");
+        check("stream saved", f && fwrite(Stream.data(), 1, Stream.size(), f) == Stream.size() && fclose(f) == 0);
+    }
+    return r;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --workload NAME   sprites, scroll or redraw (default: all of them)\n"
+           "  --seed N          workload (default 1)\n"
+           "  --frames N        Spectrum frames to run (default 250)\n"
+           "  --sprites N       16x16 sprites redrawn a frame (default 8)\n"
+           "  --task-us N       time between two screencast_task() calls (default 20)\n"
+           "  --link-kbs N      link throughput in KB/s (default 1000)\n"
+           "  --zx-clock MHZ    Z80 clock (default 3.5469)\n"
+           "  --out FILE        keep the stream of the last workload, for zxcast\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--workload") {
+            const std::string name = value();
+            const auto found = std::find(std::begin(WorkloadNames), std::end(WorkloadNames), name);
+            if (found == std::end(WorkloadNames)) {
+                fprintf(stderr, "Unknown workload %s\n", name.c_str());
+                return false;
+            }
+            opts.workload = found - std::begin(WorkloadNames);
+        } else if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--frames")
+            opts.frames = strtoul(value(), nullptr, 0);
+        else if (arg == "--sprites")
+            opts.sprites = strtoul(value(), nullptr, 0);
+        else if (arg == "--task-us")
+            opts.taskUs = strtoul(value(), nullptr, 0);
+        else if (arg == "--link-kbs")
+            opts.linkKBs = strtoul(value(), nullptr, 0);
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--out")
+            opts.out = value();
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.frames && opts.taskUs;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    sim::pio_reset();
+    rombank_select(rombank_add(BuiltinRoms[0]));
+    zpi_init(nullptr);
+    zx_init();
+    screencast_init(&Link);
+    // the ROM clears the screen at reset
+    for (uint32_t i = 0; i < ScreenBytes; ++i)
+        write(ScreenBase + i, i < 6144 ? 0 : 0x38);
+
+    printf("link %u KB/s, core0 task every %u us, a tick every %u us\n\n", opts.linkKBs, opts.taskUs,
+           ScreencastTickUs);
+    printf("%-8s %8s %8s %10s %8s %8s %10s %10s\n", "workload", "writes/f", "frames", "bytes/f", "max", "late",
+           "avg us", "worst us");
+    bool redrawChecked = false;
+    for (int w = 0; w < int(Workload::Count); ++w) {
+        if (opts.workload >= 0 && opts.workload != w)
+            continue;
+        const Result r = run(opts, Workload(w));
+        printf("%-8s %8" PRIu64 " %8" PRIu64 " %10.0f %8u %4u/%-4u %10.0f %10.0f\n", WorkloadNames[w],
+               r.writes / opts.frames, r.frames, r.frames ? double(r.bytes) / r.frames : 0, r.maxFrame, r.lateTicks,
+               r.ticks, r.avgUs, r.worstUs);
+        // a frame every tick is the link's to give
+        const bool linkFits = uint64_t(r.maxFrame) * 1000000 / ScreencastTickUs <= uint64_t(opts.linkKBs) * 1000;
+        if (Workload(w) == Workload::Redraw && linkFits) {
+            check("the full redraw gets a frame every tick", !r.lateTicks);
+            redrawChecked = true;
+        }
+    }
+
+    if (Failures) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: every frame decoded to its screen%s\n", redrawChecked ? ", full redraws at 50 Hz" : "");
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include "castfile.h"
+
+#include <bit>
+#include <cstring>
+
+namespace {
+
+uint32_t get16(const uint8_t *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+uint32_t get32(const uint8_t *p)
+{
+    return get16(p) | get16(p + 2) << 16;
+}
+
+// the payload size of a frame header at p that checks out, -1 otherwise
+long frame_at(const uint8_t *p, const uint8_t *end)
+{
+    if (end - p < long(ScreencastHeaderSize) || get32(p) != ScreencastMagic)
+        return -1;
+    const uint32_t bytes = get16(p + 14);
+    if (end - p - ScreencastHeaderSize < bytes || bytes < ScreencastBitmapSize)
+        return -1;
+    if (trace_check(p + ScreencastHeaderSize, bytes) != get16(p + 16))
+        return -1;
+    if (p[7] > ScreenLines || (p[6] & ~ScreencastKey))
+        return -1;
+    return bytes;
+}
+
+} // namespace
+
+CastReader::CastReader(const uint8_t *data, size_t size)
+    : m_begin(data)
+    , m_pos(data)
+    , m_end(data + size)
+{}
+
+bool CastReader::apply(const uint8_t *payload, uint32_t bytes, uint32_t lines, bool key)
+{
+    uint32_t dirty[ScreenDirtyWords];
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < ScreenDirtyWords; ++i) {
+        dirty[i] = get32(payload + i * 4);
+        count += std::popcount(dirty[i]);
+    }
+    if (dirty[ScreenDirtyWords - 1] >> (ScreenLines % 32) || count != lines)
+        return false;
+    const uint32_t size = lines * ScreenLineBytes;
+    if (screencast_unpack(payload + ScreencastBitmapSize, bytes - ScreencastBitmapSize, m_delta, size) !=
+        int32_t(size))
+        return false;
+
+    if (key)
+        memset(m_screen, 0, sizeof(m_screen));
+    const uint8_t *delta = m_delta;
+    for (uint32_t line = 0; line < ScreenLines; ++line) {
+        if (!(dirty[line / 32] & 1u << (line % 32)))
+            continue;
+        uint8_t *out = m_screen + line * ScreenLineBytes;
+        for (uint32_t i = 0; i < ScreenLineBytes; ++i)
+            out[i] ^= *delta++;
+    }
+    return true;
+}
+
+bool CastReader::next(CastFrame &frame)
+{
+    while (m_pos < m_end) {
+        const long bytes = frame_at(m_pos, m_end);
+        if (bytes < 0) {
+            if (get32(m_pos) == ScreencastMagic && m_end - m_pos >= long(ScreencastHeaderSize))
+                ++m_badFrames;
+            ++m_pos;
+            ++m_skipped;
+            continue;
+        }
+
+        const uint8_t *h = m_pos;
+        m_pos += ScreencastHeaderSize + bytes;
+        frame.seq = get16(h + 4);
+        frame.key = h[6] & ScreencastKey;
+        frame.lines = h[7];
+        frame.stamp = get32(h + 8);
+        frame.ticks = get16(h + 12);
+        frame.size = ScreencastHeaderSize + bytes;
+        frame.end = m_pos - m_begin;
+
+        // a stream started again begins with a key frame at seq 0
+        if (m_synced && frame.seq != (m_seq & 0xffff) && frame.seq) {
+            m_badFrames += (frame.seq - m_seq) & 0xffff;
+            m_synced = false;
+        }
+        m_seq = frame.seq + 1;
+        if (!m_synced && !frame.key) {
+            ++m_waited;
+            continue;
+        }
+        if (!apply(h + ScreencastHeaderSize, bytes, frame.lines, frame.key)) {
+            ++m_badFrames;
+            m_synced = false;
+            continue;
+        }
+        m_synced = true;
+        ++m_frames;
+        m_keyFrames += frame.key;
+        return true;
+    }
+    return false;
+}
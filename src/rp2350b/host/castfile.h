@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "screencast.h"
+
+// Screen streams for the host tools: the frames screencast.cpp sends over
+// USB, found by their magic among the console output and the bus trace
+// frames sharing the link.
+
+struct CastFrame
+{
+    uint32_t seq = 0;
+    bool key = false;
+    uint32_t lines = 0;
+    uint32_t stamp = 0;     // time_us_32() of the take
+    uint32_t ticks = 0;     // frame periods since the frame before
+    uint32_t size = 0;      // header and payload
+    size_t end = 0;         // offset in the capture right after the frame
+};
+
+class CastReader
+{
+public:
+    CastReader(const uint8_t *data, size_t size);
+
+    // applies the next frame to screen(), false at the end of the capture.
+    // After a frame lost or bad the frames up to the next key frame are
+    // skipped, the screen would be wrong.
+    bool next(CastFrame &frame);
+
+    // the display file, ScreenBytes, as of the last frame
+    const uint8_t *screen() const { return m_screen; }
+
+    uint64_t frames() const { return m_frames; }
+    uint64_t keyFrames() const { return m_keyFrames; }
+    uint64_t badFrames() const { return m_badFrames; }     // failed the check, or lost
+    uint64_t waited() const { return m_waited; }           // skipped for a key frame
+    uint64_t skipped() const { return m_skipped; }         // bytes between the frames
+
+private:
+    bool apply(const uint8_t *payload, uint32_t bytes, uint32_t lines, bool key);
+
+    const uint8_t *m_begin;
+    const uint8_t *m_pos;
+    const uint8_t *m_end;
+    bool m_synced = false;
+    uint32_t m_seq = 0;
+
+    uint8_t m_screen[ScreenBytes] = {};
+    uint8_t m_delta[ScreenBytes];
+
+    uint64_t m_frames = 0;
+    uint64_t m_keyFrames = 0;
+    uint64_t m_badFrames = 0;
+    uint64_t m_waited = 0;
+    uint64_t m_skipped = 0;
+};
@@ -0,0 +1,66 @@
+#include "fileblockdev.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FileBlockDevice::FileBlockDevice(const char *path)
+    : m_path(path)
+{
+}
+
+FileBlockDevice::~FileBlockDevice()
+{
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+bool FileBlockDevice::init()
+{
+    m_fd = open(m_path, O_RDWR);
+    if (m_fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(m_fd, &st))
+        return false;
+    m_sectors = uint32_t(st.st_size / SectorSize);
+    return m_sectors;
+}
+
+bool FileBlockDevice::startRead(uint32_t lba, uint8_t *data, uint32_t count)
+{
+    if (m_status == BlockStatus::Busy || lba + count > m_sectors)
+        return false;
+    const size_t size = size_t(count) * SectorSize;
+    m_status = pread(m_fd, data, size, off_t(lba) * SectorSize) == ssize_t(size) ? BlockStatus::Busy
+                                                                                : BlockStatus::Error;
+    return true;
+}
+
+bool FileBlockDevice::startWrite(uint32_t lba, const uint8_t *data, uint32_t count)
+{
+    if (m_status == BlockStatus::Busy || lba + count > m_sectors)
+        return false;
+    const size_t size = size_t(count) * SectorSize;
+    m_status = pwrite(m_fd, data, size, off_t(lba) * SectorSize) == ssize_t(size) ? BlockStatus::Busy
+                                                                                 : BlockStatus::Error;
+    return true;
+}
+
+BlockStatus FileBlockDevice::poll()
+{
+    // Busy once, like a card that needs at least one more look
+    const BlockStatus status = m_status;
+    switch (status) {
+    case BlockStatus::Busy:
+        m_status = BlockStatus::Done;
+        break;
+    case BlockStatus::Done:
+    case BlockStatus::Error:
+        m_status = BlockStatus::Idle;
+        break;
+    default:
+        break;
+    }
+    return status;
+}
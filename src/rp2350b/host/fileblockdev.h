@@ -0,0 +1,26 @@
+#pragma once
+
+#include "blockdev.h"
+
+// Host stand-in for the SD card: a disk image file. Every transfer is done in
+// startRead()/startWrite() and reported by the next poll(), so BlockCache sees
+// the same start/poll sequence as with the card.
+class FileBlockDevice : public BlockDevice
+{
+public:
+    explicit FileBlockDevice(const char *path);
+    ~FileBlockDevice() override;
+
+    bool init() override;
+    uint32_t sectorCount() const override { return m_sectors; }
+
+    bool startRead(uint32_t lba, uint8_t *data, uint32_t count) override;
+    bool startWrite(uint32_t lba, const uint8_t *data, uint32_t count) override;
+    BlockStatus poll() override;
+
+private:
+    const char *m_path;
+    int m_fd = -1;
+    uint32_t m_sectors = 0;
+    BlockStatus m_status = BlockStatus::Idle;
+};
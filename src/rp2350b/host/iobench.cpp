@@ -0,0 +1,121 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Checks how io_build() resolves the ports several devices decode.
+//
+// A passive monitor decoding every port is registered first, ahead of the
+// 0x7ffd paging latch rombank_add() registers and the devices of zx_init().
+// Then a ZxMachine runs IN and OUT on the ports they share, as bus words:
+// writes to 0xfc must reach both the ULA and the paging latch, the Kempston
+// must answer 0x1e over the passive ULA, the ULA port must stay undriven, and
+// the monitor must see every access whatever answered it.
+
+#include <algorithm>
+#include <cstdio>
+
+#include "io.h"
+#include "rombank.h"
+#include "sim.h"
+#include "zx.h"
+#include "zxmachine.h"
+
+namespace {
+
+uint32_t MonitorReads = 0;
+uint32_t MonitorWrites = 0;
+
+uint8_t monitor_read(uint16_t)
+{
+    ++MonitorReads;
+    return 0x5a;
+}
+
+void monitor_write(uint16_t, uint8_t)
+{
+    ++MonitorWrites;
+}
+
+const IoDevice Monitor{"monitor", 0x00, 0x00, monitor_read, monitor_write, true};
+
+// two ROM banks telling apart which one is paged in
+uint8_t Rom[2 * RomBankSize];
+const RomImage Rom128{"two banks", RomModel::Zx128, Rom, sizeof(Rom)};
+
+int Failures = 0;
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+} // namespace
+
+int main()
+{
+    std::fill_n(Rom, RomBankSize, 0xa0);
+    std::fill_n(Rom + RomBankSize, RomBankSize, 0xb1);
+
+    sim::pio_reset();
+    io_register(&Monitor);
+    rombank_select(rombank_add(&Rom128));
+    zx_init();
+
+    static ZxMachine m;
+    m.reset(true);
+    uint32_t reads = 0;
+    uint32_t writes = 0;
+
+    // ULA (A0) and paging (A1 A15) both decode 0x00fc, the same write sets
+    // the border and pages ROM 1 in
+    m.out(0x00fc, 0x13);
+    ++writes;
+    check("0xfc write reaches the ULA", zx_border() == 3);
+    check("0xfc write reaches the paging latch", m.read(0x0000) == 0xb1);
+    m.out(0x00fe, 0x05);
+    ++writes;
+    check("0xfe write is the ULA's only", zx_border() == 5 && m.read(0x0000) == 0xb1);
+    m.out(0x7ffd, 0x00);
+    ++writes;
+    check("0x7ffd write is the paging latch's only", zx_border() == 5 && m.read(0x0000) == 0xa0);
+
+    // Kempston (A5) and the passive ULA (A0) tie on 0x1e: the Kempston answers
+    check("0x1e read answered by the Kempston", m.in(0x001e) == 0x00);
+    ++reads;
+    check("0x1f read answered by the Kempston", m.in(0x001f) == 0x00);
+    ++reads;
+    // the ULA answers 0xfe itself, IFp leaves the bus alone
+    check("0xfe read left undriven", m.in(0x00fe) == 0xff);
+    ++reads;
+    check("unclaimed read left undriven", m.in(0xffff) == 0xff);
+    ++reads;
+
+    check("the monitor saw every read", MonitorReads == reads);
+    check("the monitor saw every write", MonitorWrites == writes);
+
+    if (Failures) {
+        printf("\nFAIL: %d checks\n", Failures);
+        return 1;
+    }
+    printf("OK: shared ports decoded as on the bus, %u reads and %u writes seen by a passive monitor\n", reads,
+           writes);
+    return 0;
+}
@@ -0,0 +1,313 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Measures the DE9 joystick from the switch to the Z80.
+//
+// A ZxMachine polls the Kempston and Fuller ports in a tight loop while the
+// bench bounces the joystick lines like worn microswitches do. core0 is the
+// main loop calling joystick_task() every --loop-us, with the occasional
+// --stall-us for an SD transfer. For every press and release it reports the
+// time from the first edge to the first IN that returns it, and fails when a
+// bounce reaches the bus, the two ports disagree or the bus path reads GPIO.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "joystick.h"
+#include "sim.h"
+#include "zx.h"
+#include "zxmachine.h"
+
+namespace {
+
+constexpr uint16_t PollLoop = 0x8000;
+constexpr uint32_t CyclesPerUs = 150;
+
+struct Options
+{
+    uint32_t seed = 1;
+    uint32_t events = 400;
+    uint32_t loopUs = 20;       // core0 main loop period
+    uint32_t stallUs = 1000;    // an SD transfer holding up the loop
+    uint32_t stallEvery = 50;   // loops between stalls, 0 for none
+    uint32_t bounceUs = 1500;   // contact bounce after each edge
+    double zxMHz = 3.5469;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+// a level change of one line, the bench edges are sorted by time
+struct Edge
+{
+    uint64_t cycle;
+    uint32_t line;
+    bool pressed;
+};
+
+// one press or release: its first edge and when the Z80 saw it
+struct Event
+{
+    uint64_t cycle;
+    uint8_t kempston;   // the port value once it took effect
+    uint64_t seen = 0;
+};
+
+class Poller : public ZxMachine
+{
+public:
+    uint8_t in(uint16_t port) override
+    {
+        const uint8_t value = ZxMachine::in(port);
+        this->port = port & 0xff;
+        if ((port & 0xff) == 0x1f)
+            kempston = value;
+        else
+            fuller = value;
+        ++reads;
+        return value;
+    }
+
+    uint8_t port = 0;
+    uint8_t kempston = 0;
+    uint8_t fuller = 0xff;
+    uint64_t reads = 0;
+};
+
+// the Fuller byte for a Kempston one
+uint8_t fuller_of(uint8_t kempston)
+{
+    const bool right = kempston & 0x01;
+    const bool left = kempston & 0x02;
+    const bool down = kempston & 0x04;
+    const bool up = kempston & 0x08;
+    const bool fire = kempston & 0x10;
+    return ~(up | down << 1 | left << 2 | right << 3 | fire << 7);
+}
+
+uint8_t kempston_bit(uint32_t line)
+{
+    switch (line) {
+    case JoyRight: return 0x01;
+    case JoyLeft: return 0x02;
+    case JoyDown: return 0x04;
+    case JoyUp: return 0x08;
+    default: return 0x10;
+    }
+}
+
+// Random presses and releases, one line at a time, far enough apart for the
+// lockout to expire. Each one bounces for up to bounceUs and settles.
+void make_edges(const Options &opts, Rng &rng, std::vector<Edge> &edges, std::vector<Event> &events)
+{
+    const double cyclesPerUs = CyclesPerUs;
+    uint64_t cycle = 5000 * CyclesPerUs;
+    uint8_t kempston = 0;
+    for (uint32_t i = 0; i < opts.events; ++i) {
+        const uint32_t line = JoyFire + rng.next() % 5;
+        const uint8_t bit = kempston_bit(line);
+        const bool pressed = !(kempston & bit);
+        kempston ^= bit;
+        events.push_back({cycle, kempston});
+
+        edges.push_back({cycle, line, pressed});
+        const uint32_t bounces = opts.bounceUs ? rng.next() % 8 : 0;
+        uint64_t at = cycle;
+        for (uint32_t b = 0; b < bounces; ++b) {
+            at += uint64_t((rng.next() % (opts.bounceUs / 8 + 1) + 1) * cyclesPerUs);
+            edges.push_back({at, line, b % 2 != 0 ? pressed : !pressed});
+        }
+        if (bounces % 2)
+            edges.push_back({at + 10 * CyclesPerUs, line, pressed});
+
+        cycle += uint64_t((JoystickLockoutUs + opts.bounceUs + 2000 + rng.next() % 20000) * cyclesPerUs);
+    }
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --seed N          seed of the joystick moves (default 1)\n"
+           "  --events N        presses and releases (default 400)\n"
+           "  --loop-us N       core0 main loop period (default 20)\n"
+           "  --stall-us N      length of a core0 stall (default 1000)\n"
+           "  --stall-every N   loops between stalls, 0 for none (default 50)\n"
+           "  --bounce-us N     contact bounce after an edge (default 1500)\n"
+           "  --zx-clock MHZ    Z80 clock (default 3.5469)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--events")
+            opts.events = strtoul(value(), nullptr, 0);
+        else if (arg == "--loop-us")
+            opts.loopUs = std::max(1ul, strtoul(value(), nullptr, 0));
+        else if (arg == "--stall-us")
+            opts.stallUs = strtoul(value(), nullptr, 0);
+        else if (arg == "--stall-every")
+            opts.stallEvery = strtoul(value(), nullptr, 0);
+        else if (arg == "--bounce-us")
+            opts.bounceUs = strtoul(value(), nullptr, 0);
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (opts.bounceUs >= JoystickLockoutUs) {
+        fprintf(stderr, "--bounce-us must stay under the %" PRIu32 " us lockout\n", JoystickLockoutUs);
+        return 2;
+    }
+
+    sim::pio_reset();
+    zx_init();
+    joystick_init();
+
+    Rng rng{opts.seed};
+    std::vector<Edge> edges;
+    std::vector<Event> events;
+    make_edges(opts, rng, edges, events);
+    std::stable_sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) { return a.cycle < b.cycle; });
+
+    static Poller m;
+    m.reset(false);
+    const uint8_t loop[] = {0xdb, 0x1f, 0xdb, 0x7f, 0x18, 0xfa}; // in a, (0x1f); in a, (0x7f); jr $-4
+    std::copy(std::begin(loop), std::end(loop), m.ram(PollLoop));
+    m.pc = PollLoop;
+
+    const double cyclesPerT = CyclesPerUs / opts.zxMHz;
+    const uint64_t startCycles = sim::Cycles;
+    const uint64_t end = edges.back().cycle + 30000 * CyclesPerUs;
+    uint64_t core0 = sim::Cycles;
+    uint32_t loops = 0;
+    size_t edge = 0;
+    size_t pending = 0; // the next event the Z80 has to see
+    uint8_t lastKempston = 0;
+    uint32_t glitches = 0;
+    uint32_t mismatches = 0;
+    bool suspect = false;
+    uint64_t busGpioReads = 0;
+
+    while (sim::Cycles < end) {
+        while (edge < edges.size() && edges[edge].cycle <= sim::Cycles) {
+            const uint64_t bit = 1ull << edges[edge].line;
+            if (edges[edge].pressed)
+                sim::GpioIn &= ~bit;
+            else
+                sim::GpioIn |= bit;
+            ++edge;
+        }
+        if (sim::Cycles >= core0) {
+            joystick_task();
+            ++loops;
+            core0 = sim::Cycles + opts.loopUs * CyclesPerUs;
+            if (opts.stallEvery && !(loops % opts.stallEvery))
+                core0 += opts.stallUs * CyclesPerUs;
+        }
+
+        const uint64_t gpioReads = sim::GpioReads;
+        const uint64_t reads = m.reads;
+        m.step();
+        busGpioReads += sim::GpioReads - gpioReads;
+        sim::Cycles = std::max(sim::Cycles, startCycles + uint64_t(m.tstates * cyclesPerT));
+        if (m.reads == reads)
+            continue;
+
+        // a move between the two INs is fine, the Fuller byte must match
+        // either the Kempston one before it or the one after it
+        if (m.port == 0x7f) {
+            if (m.fuller != fuller_of(m.kempston))
+                suspect = true;
+        } else if (suspect) {
+            suspect = false;
+            if (m.fuller != fuller_of(m.kempston))
+                ++mismatches;
+        }
+        if (m.kempston == lastKempston)
+            continue;
+        lastKempston = m.kempston;
+        if (pending < events.size() && events[pending].cycle <= sim::Cycles && m.kempston == events[pending].kempston)
+            events[pending++].seen = sim::Cycles;
+        else
+            ++glitches;
+    }
+
+    double sum = 0;
+    double worst = 0;
+    for (size_t i = 0; i < pending; ++i) {
+        const double us = double(events[i].seen - events[i].cycle) / CyclesPerUs;
+        sum += us;
+        worst = std::max(worst, us);
+    }
+    const JoystickStats &stats = joystick_stats();
+    printf("%zu of %zu presses and releases seen, %" PRIu32 " bounces swallowed\n",
+           pending, events.size(), stats.bounces);
+    printf("input to bus: avg %.1f us, worst %.1f us (core0 loop %" PRIu32 " us, stalls of %" PRIu32 " us)\n",
+           pending ? sum / pending : 0, worst, opts.loopUs, opts.stallEvery ? opts.stallUs : 0);
+    printf("joystick_stats: %" PRIu32 " changes, last %" PRIu32 " us, worst %" PRIu32 " us\n",
+           stats.changes, stats.lastUs, stats.worstUs);
+    printf("%" PRIu64 " port reads, %" PRIu64 " GPIO reads on the bus path\n", m.reads, busGpioReads);
+
+    const bool ok = pending == events.size() && !glitches && !mismatches && !busGpioReads
+                    && stats.changes == events.size();
+    if (!ok) {
+        printf("FAIL: %u glitches, %u Fuller/Kempston mismatches\n", glitches, mismatches);
+        return 1;
+    }
+    printf("OK: worst input to bus %.1f us\n", worst);
+    return 0;
+}
@@ -0,0 +1,274 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Checks the PSRAM library and the ROM prefetch of rombank.cpp.
+//
+// Dozens of synthetic ROM images and snapshots go into the simulated PSRAM
+// through library_add(). Then the ROM bank is switched around in a few
+// patterns, with a number of rombank_task() calls between two switches, the
+// time the Z80 would run between two port 3 commands. The Z80 keeps fetching
+// during every switch, each byte has to be the new image's.
+//
+// For each pattern the table shows the share of lines found in SRAM at the
+// switch, the reads held on /WAIT and the switch time the remaining lines
+// would take at --psram-kbs, the copy rate psram_bench() reports on the board.
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "library.h"
+#include "psram.h"
+#include "rombank.h"
+#include "sim.h"
+#include "snapshot.h"
+#include "zpi.h"
+#include "zx.h"
+
+extern const unsigned char __48_rom[];
+extern const unsigned char testrom_bin[];
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int MreqSm = 0;
+constexpr uint32_t SnaHeaderSize = 27;
+constexpr uint32_t Sna48Size = SnaHeaderSize + 48 * 1024;
+
+struct Options
+{
+    uint32_t seed = 1;
+    uint32_t roms = 40;
+    uint32_t snapshots = 12;
+    uint32_t switches = 60;     // per pattern
+    double psramKBs = 20000;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+struct Result
+{
+    uint32_t lines = 0;
+    uint32_t prefetched = 0;
+    uint32_t held = 0;
+    uint32_t wrong = 0;
+};
+
+int Failures = 0;
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+// one ROM read, false when the answer is not the expected byte
+bool fetch(uint16_t addr, uint8_t expected, bool &held)
+{
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE);
+    bus &= ~((1u << I_MREQ_L) | (1u << I_RD_L));
+    bus |= 1u << I_ZXRDWR;
+    sim::pio_rx_push(MreqSm, bus);
+    zx_poll();
+
+    uint32_t word;
+    uint64_t cycle;
+    held = false;
+    if (!sim::pio_tx_pop(MreqSm, word, cycle))
+        return false;
+    if (word == 1) {
+        held = true;
+        if (!sim::pio_tx_pop(MreqSm, word, cycle))
+            return false;
+    }
+    return (word >> 1) == (0xff00u | expected);
+}
+
+// switches to image with the Z80 fetching 4 bytes between two lines copied,
+// then gives rombank_task() its turns
+void run_switch(int image, uint32_t tasks, Rng &rng, Result &result)
+{
+    const RomImage *rom = rombank_image(image);
+    check("begin", rombank_begin(image));
+    result.lines += rom->size / RomFillLine;
+    result.prefetched += rombank_last_prefetched();
+    bool done = false;
+    while (!done) {
+        for (int i = 0; i < 4; ++i) {
+            const uint16_t addr = rng.next() & 0x3fff;
+            bool held;
+            result.wrong += !fetch(addr, rom->data[addr], held);
+            result.held += held;
+        }
+        done = rombank_fill(1);
+    }
+    for (uint32_t i = 0; i < tasks; ++i)
+        rombank_task();
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --seed N          image contents and switch order (default 1)\n"
+           "  --roms N          synthetic ROM images (default 40)\n"
+           "  --snapshots N     synthetic 48K snapshots (default 12)\n"
+           "  --switches N      switches per pattern (default 60)\n"
+           "  --psram-kbs KBS   PSRAM copy rate (default 20000)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--roms")
+            opts.roms = strtoul(value(), nullptr, 0);
+        else if (arg == "--snapshots")
+            opts.snapshots = strtoul(value(), nullptr, 0);
+        else if (arg == "--switches")
+            opts.switches = strtoul(value(), nullptr, 0);
+        else if (arg == "--psram-kbs")
+            opts.psramKBs = atof(value());
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    sim::pio_reset();
+    check("PSRAM found", psram_init() == sim::PsramBytes);
+    const RomImage rom48{"48K", RomModel::Zx48, __48_rom, RomBankSize};
+    const RomImage test{"test", RomModel::Diagnostic, testrom_bin, RomBankSize};
+    rombank_add(&rom48);
+    rombank_add(&test);
+
+    // the files: ROMs of the three sizes and 48K .SNA snapshots
+    Rng rng{opts.seed};
+    std::vector<std::vector<uint8_t>> files;
+    std::vector<int> roms;
+    for (uint32_t i = 0; i < opts.roms + opts.snapshots; ++i) {
+        const bool rom = i < opts.roms;
+        std::vector<uint8_t> data(rom ? RomBankSize << (rng.next() % 3) : Sna48Size);
+        for (auto &byte : data)
+            byte = rng.next();
+        char name[13];
+        snprintf(name, sizeof(name), rom ? "GAME%02u.ROM" : "SNAP%02u.SNA", unsigned(i));
+        const int index = library_add(name, data.data(), data.size());
+        check("file added", index >= 0);
+        if (index < 0)
+            continue;
+        const LibraryEntry *entry = library_entry(index);
+        check("stored in PSRAM", psram_contains(entry->data) && psram_contains(entry->data + entry->size - 1));
+        check("stored as given", entry->size == data.size() && !memcmp(entry->data, data.data(), data.size()));
+        if (rom)
+            roms.push_back(entry->rom);
+        files.push_back(std::move(data));
+    }
+    check("not a library file", library_add("README.TXT", files[0].data(), 100) < 0);
+    printf("%d files in %" PRIu32 "K of PSRAM, %d ROM images\n", library_count(), library_used() / 1024,
+           rombank_count());
+
+    rombank_select(roms[0]);
+    zpi_init(nullptr);
+    zx_init();
+
+    // a run per pattern, each one starting from the first image
+    struct Pattern
+    {
+        const char *name;
+        uint32_t tasks;
+        int period;     // images cycled through, 0 for random picks
+    };
+    const Pattern patterns[] = {
+        {"toggle", 0, 2},   {"toggle", 64, 2},  {"cycle 3", 0, 3}, {"cycle 3", 8, 3},
+        {"cycle 3", 64, 3}, {"cycle 5", 64, 5}, {"random", 64, 0},
+    };
+    printf("\n%-8s %6s %9s %11s %8s %11s\n", "pattern", "tasks", "switches", "prefetched", "held",
+           "us/switch");
+    for (const Pattern &pattern : patterns) {
+        Result result;
+        const ZxWaitStats before = zx_wait_stats(ZxWaitSource::Psram);
+        const ZxWaitStats flash = zx_wait_stats(ZxWaitSource::Flash);
+        for (uint32_t i = 1; i <= opts.switches; ++i) {
+            const int image = pattern.period ? roms[i % pattern.period] : roms[rng.next() % roms.size()];
+            run_switch(image, pattern.tasks, rng, result);
+        }
+        const ZxWaitStats after = zx_wait_stats(ZxWaitSource::Psram);
+        const double copyUs = (result.lines - result.prefetched) * RomFillLine / 1.024 / opts.psramKBs;
+        printf("%-8s %6u %9u %10.1f%% %8u %11.1f\n", pattern.name, pattern.tasks, opts.switches,
+               100.0 * result.prefetched / result.lines, result.held, copyUs * 1000 / opts.switches);
+        check("every byte from the new image", !result.wrong);
+        check("held reads counted as PSRAM waits", after.waits - before.waits == result.held);
+        check("no flash waits", zx_wait_stats(ZxWaitSource::Flash).waits == flash.waits);
+        // switching back, or ahead with time to prefetch, after the first round
+        if (pattern.period == 2 || (pattern.period && pattern.tasks >= 64))
+            check("prefetched", result.prefetched * 10 >= result.lines * 9);
+        rombank_select(roms[0]);
+    }
+
+    // a snapshot straight from PSRAM, the first one of the library
+    check("no such snapshot", !library_snapshot(opts.snapshots));
+    const std::vector<uint8_t> &sna = files[files.size() - opts.snapshots];
+    check("snapshot loads", library_snapshot(0));
+    check("snapshot decoded", snapshot_last().hl == (sna[9] | sna[10] << 8)
+                                  && !memcmp(snapshot_ram() + 0x100, sna.data() + SnaHeaderSize + 0x100, 0x1000));
+
+    if (Failures) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: library stored whole, switches back or ahead found in SRAM, every byte from the new image\n");
+    return 0;
+}
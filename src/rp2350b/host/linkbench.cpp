@@ -0,0 +1,453 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Runs two FrameLink ends over a pseudo-terminal, for throughput and loss.
+//
+// The ends sit on the master and the slave side of one pty in raw mode, each
+// behind a port that lets --baud worth of bytes through, 10 bits a byte, and
+// holds as much as the TX ring of UartPort. Both send --kbytes of bulk data
+// on channel 1 at once, A pings B on channel 0 every --ping-us and B echoes
+// the pings back. The simulated clock follows the real one, the time the
+// kernel takes to move the bytes is part of the round trips.
+//
+// A clean pass, then one with --loss of the bytes written corrupted or lost:
+// the bulk data has to arrive whole and in order both ways, every ping has to
+// come back. Then B starts again as after a reboot and the link has to come
+// back. Prints the throughput against the line rate and the ping round trips.
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "framelink.h"
+#include "sim.h"
+#include "uartport.h"
+
+namespace {
+
+constexpr uint32_t CyclesPerUs = 150;
+constexpr uint8_t ControlChannel = 0;
+constexpr uint8_t BulkChannel = 1;
+constexpr double TimeoutS = 60;
+
+using Clock = std::chrono::steady_clock;
+
+struct Options
+{
+    uint32_t baud = 3000000;
+    uint32_t kbytes = 512;
+    uint32_t pingUs = 2000;
+    double loss = 1e-4;
+    uint32_t rtoUs = LinkDefaultRtoUs;
+    uint32_t seed = 1;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+int Failures = 0;
+Clock::time_point Start;
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+uint64_t now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - Start).count();
+}
+
+// a pty end as fast as a UART: bytes leave at the baud rate, the rest waits
+// in a ring as big as the one of UartPort
+class PtyPort : public SerialPort
+{
+public:
+    PtyPort(int fd, uint32_t baud)
+        : m_fd(fd)
+        , m_baud(baud)
+    {}
+
+    void setLoss(double loss, uint32_t seed)
+    {
+        m_loss = loss;
+        m_rng.seed = seed;
+    }
+
+    uint32_t read(uint8_t *data, uint32_t size) override
+    {
+        const ssize_t got = ::read(m_fd, data, size);
+        return got > 0 ? got : 0;
+    }
+
+    uint32_t space() override
+    {
+        flush();
+        return UartPort::TxRingSize - m_out.size();
+    }
+
+    void write(const uint8_t *data, uint32_t size) override
+    {
+        for (uint32_t i = 0; i < size; ++i) {
+            uint8_t byte = data[i];
+            if (m_loss && m_rng.next() % 1000000 < m_loss * 1000000) {
+                ++m_damaged;
+                // half of them lost, half of them with a bit flipped
+                if (m_rng.next() & 1)
+                    continue;
+                byte ^= 1u << (m_rng.next() % 8);
+            }
+            m_out.push_back(byte);
+        }
+        flush();
+    }
+
+    void flush()
+    {
+        const uint64_t us = now_us();
+        m_credit = std::min(m_credit + double(us - m_lastUs) * m_baud / 10 / 1000000, double(UartPort::TxRingSize));
+        m_lastUs = us;
+        const size_t size = std::min(m_out.size(), size_t(m_credit));
+        if (!size)
+            return;
+        const ssize_t written = ::write(m_fd, m_out.data(), size);
+        if (written <= 0)
+            return;
+        m_out.erase(m_out.begin(), m_out.begin() + written);
+        m_credit -= written;
+    }
+
+    uint64_t damaged() const { return m_damaged; }
+
+private:
+    int m_fd;
+    uint32_t m_baud;
+    double m_loss = 0;
+    Rng m_rng{1};
+    std::vector<uint8_t> m_out;
+    double m_credit = 0;
+    uint64_t m_lastUs = 0;
+    uint64_t m_damaged = 0;
+};
+
+struct End
+{
+    End(const char *name, int fd, const Options &opts)
+        : name(name)
+        , port(fd, opts.baud)
+        , link(port, opts.rtoUs)
+    {
+        link.setHandler(message, this);
+    }
+
+    static void message(void *user, uint8_t channel, const uint8_t *data, uint32_t size);
+
+    const char *name;
+    PtyPort port;
+    FrameLink link;
+    bool echo = false;
+
+    // bulk data, both ends draw the same bytes from their own Rng
+    Rng txData{0};
+    Rng rxData{0};
+    uint64_t toSend = 0;
+    uint64_t sent = 0;
+    uint64_t received = 0;
+    uint64_t wrong = 0;
+
+    // pings: the send time in the payload
+    uint32_t pings = 0;
+    uint32_t pongs = 0;
+    uint64_t rttTotal = 0;
+    uint64_t rttWorst = 0;
+};
+
+void End::message(void *user, uint8_t channel, const uint8_t *data, uint32_t size)
+{
+    End &end = *static_cast<End *>(user);
+    if (channel == ControlChannel && end.echo) {
+        end.link.send(ControlChannel, data, size);
+    } else if (channel == ControlChannel) {
+        uint64_t sentUs;
+        memcpy(&sentUs, data, sizeof(sentUs));
+        const uint64_t rtt = now_us() - sentUs;
+        ++end.pongs;
+        end.rttTotal += rtt;
+        end.rttWorst = std::max(end.rttWorst, rtt);
+    } else {
+        for (uint32_t i = 0; i < size; ++i)
+            end.wrong += data[i] != uint8_t(end.rxData.next());
+        end.received += size;
+    }
+}
+
+void step(End &a, End &b)
+{
+    sim::Cycles = now_us() * CyclesPerUs;
+    for (End *end : {&a, &b}) {
+        while (end->sent < end->toSend) {
+            const uint32_t size = std::min<uint64_t>(end->link.space(BulkChannel), end->toSend - end->sent);
+            if (!size)
+                break;
+            uint8_t chunk[LinkMaxPayload];
+            for (uint32_t i = 0; i < size; ++i)
+                chunk[i] = end->txData.next();
+            end->link.send(BulkChannel, chunk, size);
+            end->sent += size;
+        }
+        end->link.task();
+        end->port.flush();
+    }
+}
+
+// until both ends are synced, false after TimeoutS
+bool sync(End &a, End &b)
+{
+    const uint64_t until = now_us() + uint64_t(TimeoutS * 1000000);
+    while (!a.link.synced() || !b.link.synced()) {
+        if (now_us() > until)
+            return false;
+        step(a, b);
+    }
+    return true;
+}
+
+struct Pass
+{
+    double seconds = 0;
+    uint64_t damaged = 0;
+    LinkStats a;
+    LinkStats b;
+};
+
+Pass run(const Options &opts, End &a, End &b, double loss, uint32_t seed)
+{
+    a.port.setLoss(loss, seed);
+    b.port.setLoss(loss, seed + 1);
+    for (End *end : {&a, &b}) {
+        end->txData.seed = end->rxData.seed = seed;
+        end->toSend = uint64_t(opts.kbytes) * 1024;
+        end->sent = end->received = end->wrong = 0;
+        end->pings = end->pongs = 0;
+        end->rttTotal = end->rttWorst = 0;
+    }
+    const LinkStats beforeA = a.link.stats();
+    const LinkStats beforeB = b.link.stats();
+
+    const uint64_t start = now_us();
+    uint64_t nextPing = start;
+    const uint64_t until = start + uint64_t(TimeoutS * 1000000);
+    while (now_us() < until) {
+        const bool bulkDone = a.received == b.toSend && b.received == a.toSend;
+        if (bulkDone && a.pongs == a.pings && a.link.idle() && b.link.idle())
+            break;
+        if (!bulkDone && now_us() >= nextPing) {
+            const uint64_t sentUs = now_us();
+            if (a.link.send(ControlChannel, reinterpret_cast<const uint8_t *>(&sentUs), sizeof(sentUs)))
+                ++a.pings;
+            nextPing += opts.pingUs;
+        }
+        step(a, b);
+    }
+
+    Pass pass;
+    pass.seconds = (now_us() - start) / 1e6;
+    pass.damaged = a.port.damaged() + b.port.damaged();
+    pass.a = a.link.stats();
+    pass.b = b.link.stats();
+    // only this pass
+    for (auto [stats, before] : {std::pair{&pass.a, &beforeA}, std::pair{&pass.b, &beforeB}}) {
+        stats->sent -= before->sent;
+        stats->resent -= before->resent;
+        stats->badFrames -= before->badFrames;
+        stats->rejects -= before->rejects;
+        stats->timeouts -= before->timeouts;
+        stats->outOfOrder -= before->outOfOrder;
+        stats->duplicates -= before->duplicates;
+    }
+    return pass;
+}
+
+void report(const char *name, const Options &opts, const End &a, const End &b, const Pass &pass)
+{
+    const double lineKBs = opts.baud / 10.0 / 1024;
+    const double kbs = a.received / 1024.0 / pass.seconds;
+    printf("%-6s %7.2f s %8.1f KB/s each way (%4.1f%% of the line) %6" PRIu64 " bytes damaged\n", name,
+           pass.seconds, kbs, kbs * 100 / lineKBs, pass.damaged);
+    printf("       ping %u: %.2f ms average, %.2f ms worst\n", a.pongs,
+           a.pongs ? a.rttTotal / 1000.0 / a.pongs : 0.0, a.rttWorst / 1000.0);
+    for (auto [end, stats] : {std::pair{&a, &pass.a}, std::pair{&b, &pass.b}})
+        printf("       %s sent %u frames, %u again, %u bad received, %u out of order, %u rejects, %u timeouts\n",
+               end->name, stats->sent, stats->resent, stats->badFrames, stats->outOfOrder, stats->rejects,
+               stats->timeouts);
+    check("bulk data whole and in order both ways",
+          a.received == b.toSend && b.received == a.toSend && !a.wrong && !b.wrong);
+    check("every ping came back", a.pings && a.pongs == a.pings);
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --baud N          line rate (default 3000000)\n"
+           "  --kbytes N        bulk data each way and pass (default 512)\n"
+           "  --ping-us N       between two pings (default 2000)\n"
+           "  --loss P          bytes damaged in the lossy pass (default 0.0001)\n"
+           "  --rto-us N        retransmission timeout (default %u)\n"
+           "  --seed N          data and damage (default 1)\n",
+           name, LinkDefaultRtoUs);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--baud")
+            opts.baud = strtoul(value(), nullptr, 0);
+        else if (arg == "--kbytes")
+            opts.kbytes = strtoul(value(), nullptr, 0);
+        else if (arg == "--ping-us")
+            opts.pingUs = strtoul(value(), nullptr, 0);
+        else if (arg == "--loss")
+            opts.loss = atof(value());
+        else if (arg == "--rto-us")
+            opts.rtoUs = strtoul(value(), nullptr, 0);
+        else if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.baud && opts.kbytes && opts.pingUs;
+}
+
+// both ends of a pty in raw mode, without blocking
+bool open_pty(int &master, int &slave)
+{
+    master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (master < 0 || grantpt(master) || unlockpt(master)) {
+        perror("posix_openpt");
+        return false;
+    }
+    slave = open(ptsname(master), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (slave < 0) {
+        perror(ptsname(master));
+        return false;
+    }
+    termios tio;
+    tcgetattr(slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+    int master;
+    int slave;
+    if (!open_pty(master, slave))
+        return 2;
+
+    Start = Clock::now();
+    End a("A", master, opts);
+    End b("B", slave, opts);
+    b.echo = true;
+    Rng epochs{opts.seed};
+    a.link.start(epochs.next());
+    b.link.start(epochs.next());
+    check("synced", sync(a, b));
+
+    printf("pty at %u baud, %u KB each way, window %u frames of %u bytes, RTO %u us\n\n", opts.baud, opts.kbytes,
+           LinkWindow, LinkMaxPayload, opts.rtoUs);
+    const Pass clean = run(opts, a, b, 0, opts.seed);
+    report("clean", opts, a, b, clean);
+    // frames can still go again when the kernel holds the bench back past a timeout
+    check("no frame lost on a clean line", !clean.a.badFrames && !clean.b.badFrames && !clean.a.outOfOrder
+                                               && !clean.b.outOfOrder);
+    report("lossy", opts, a, b, run(opts, a, b, opts.loss, opts.seed + 4));
+
+    // B boots again in the middle of a transfer
+    for (End *end : {&a, &b}) {
+        end->toSend = uint64_t(opts.kbytes) * 1024;
+        end->sent = 0;
+    }
+    for (int i = 0; i < 1000; ++i)
+        step(a, b);
+    const uint32_t resets = a.link.stats().resets;
+    b.link.start(epochs.next());
+    const uint64_t restartUs = now_us();
+    for (End *end : {&a, &b})
+        end->toSend = end->sent;
+    check("synced again after B starts again", sync(a, b) && a.link.stats().resets == resets + 1);
+    const double backMs = (now_us() - restartUs) / 1000.0;
+    uint64_t sentUs = now_us();
+    a.pings = 1;
+    a.pongs = 0;
+    a.link.send(ControlChannel, reinterpret_cast<const uint8_t *>(&sentUs), sizeof(sentUs));
+    while (!a.pongs && now_us() - sentUs < TimeoutS * 1000000)
+        step(a, b);
+    check("a ping across after that", a.pongs == 1);
+    printf("\nrestart: B back in %.2f ms\n", backMs);
+
+    close(slave);
+    close(master);
+    if (Failures) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: bulk data whole both ways with %g of the bytes damaged, pings through the bulk traffic\n",
+           opts.loss);
+    return 0;
+}
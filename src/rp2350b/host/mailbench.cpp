@@ -0,0 +1,308 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Checks the inter-core mailboxes of mailbox.h.
+//
+// Two host threads play core1 and core0 over a mailbox: --messages tagged
+// messages of 1..MailMaxPayload words, first with a producer that retries
+// until its post goes in, then with one that never waits, as core1 does.
+// Every message must arrive whole and in order, the dropped counter
+// accounting for the rest. Then the boot handshake zx_boot() serves and the
+// port 3 commands on their way to core0, /NMI included.
+//
+// What a post costs is printed in ns for the host; the firmware times it on
+// core1 at boot, in cycles, see report_mail_bench() in main.cpp.
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "mailbox.h"
+#include "rombank.h"
+#include "sim.h"
+#include "zpi.h"
+#include "zx.h"
+
+extern const unsigned char __48_rom[];
+extern const unsigned char testrom_bin[];
+
+namespace {
+
+constexpr int IorqSm = 1;
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+
+struct Options
+{
+    uint32_t messages = 1000000;
+    uint32_t seed = 1;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+int Failures = 0;
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+uint32_t payload_word(uint32_t seq, uint32_t i)
+{
+    return (seq * 2654435761u) ^ (i << 24);
+}
+
+struct Run
+{
+    uint64_t received = 0;
+    uint64_t dropped = 0;   // or posts retried, for a retrying producer
+    uint64_t bad = 0;       // out of order or mangled
+    double seconds = 0;
+};
+
+// core1 posts messages seq 0..count-1, core0 checks them
+Run run_threads(const Options &opts, bool retry)
+{
+    static Mailbox box;
+    box.head.store(0);
+    box.tail.store(0);
+    box.dropped.store(0);
+    std::atomic<bool> done{false};
+    Run run;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        Rng rng{opts.seed};
+        uint32_t payload[MailMaxPayload];
+        for (uint32_t seq = 0; seq < opts.messages; ++seq) {
+            const uint8_t words = 1 + rng.next() % MailMaxPayload;
+            payload[0] = seq;
+            for (uint32_t i = 1; i < words; ++i)
+                payload[i] = payload_word(seq, i);
+            const MailTag tag = MailTag(seq % (uint32_t(MailTag::Trap) + 1));
+            // yield, the host may have a single CPU for both threads
+            while (!mailbox_post(box, tag, seq, payload, words) && retry)
+                std::this_thread::yield();
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    Rng rng{opts.seed};
+    uint32_t expected = 0;
+    uint8_t expectedWords = 1 + rng.next() % MailMaxPayload;
+    MailMessage message;
+    while (true) {
+        if (!mailbox_fetch(box, message)) {
+            if (done.load(std::memory_order_acquire) && box.head.load() == box.tail.load())
+                break;
+            std::this_thread::yield();
+            continue;
+        }
+        // payload[0] carries the seq in full, messages may have been dropped
+        const uint32_t seq = message.words ? message.payload[0] : expected;
+        while (expected < seq && expected < opts.messages) {
+            ++expected;
+            expectedWords = 1 + rng.next() % MailMaxPayload;
+        }
+        bool ok = message.arg == uint16_t(expected) && message.words == expectedWords
+            && message.tag == MailTag(expected % (uint32_t(MailTag::Trap) + 1));
+        for (uint32_t i = 1; ok && i < message.words; ++i)
+            ok = message.payload[i] == payload_word(expected, i);
+        run.bad += !ok;
+        ++run.received;
+        ++expected;
+        expectedWords = 1 + rng.next() % MailMaxPayload;
+    }
+    producer.join();
+    run.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    run.dropped = box.dropped.load();
+    return run;
+}
+
+// host ns for a post of words, the consumer draining between batches
+double post_ns(uint8_t words)
+{
+    static Mailbox box;
+    const uint32_t payload[MailMaxPayload] = {};
+    const uint32_t batch = MailboxWords / (1 + words);
+    constexpr uint32_t Batches = 20000;
+    MailMessage message;
+    std::chrono::duration<double> spent{0};
+    for (uint32_t b = 0; b < Batches; ++b) {
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < batch; ++i)
+            mailbox_post(box, MailTag::Trap, i, payload, words);
+        spent += std::chrono::steady_clock::now() - start;
+        while (mailbox_fetch(box, message)) {
+        }
+    }
+    return spent.count() * 1e9 / (double(batch) * Batches);
+}
+
+// core1's side of the boot handshake, played in order on one thread
+void check_boot()
+{
+    mailbox_post(MailToCore1, MailTag::Bench, 7);
+    const uint32_t cycles = 100;
+    mailbox_post(MailToCore1, MailTag::Measure, 8, &cycles, 1);
+    mailbox_post(MailToCore1, MailTag::Start);
+    zx_boot();
+
+    MailMessage message;
+    check("bench reply", mailbox_fetch(MailToCore0, message) && message.tag == MailTag::Benched
+                             && message.arg == 7 && message.words == 2 * MailboxBench::Sizes);
+    check("measure reply", mailbox_fetch(MailToCore0, message) && message.tag == MailTag::Measured
+                               && message.arg == 8 && message.words == 2);
+    check("nothing else", !mailbox_fetch(MailToCore0, message));
+    check("start consumed", !mailbox_fetch(MailToCore1, message));
+
+    // nobody plays core1 any more: the request gives up
+    check("measure unanswered", zx_measure_request(1000).reads == 0);
+    mailbox_fetch(MailToCore1, message);
+}
+
+// out 3, value: posted by the IO handler on core1
+void zpi_out(uint8_t value)
+{
+    uint32_t bus = ControlIdle | (0x0003u << I_ADDR_BASE);
+    bus &= ~((1u << I_IORQ_L) | (1u << I_WR_L));
+    bus |= (1u << I_ZXRDWR) | value;
+    sim::pio_rx_push(IorqSm, bus);
+    zx_poll();
+    uint32_t out;
+    uint64_t cycle;
+    sim::pio_tx_pop(IorqSm, out, cycle);
+}
+
+void check_commands()
+{
+    zpi_out(0x31);
+    check("command waits for core0", rombank_active() != rombank_image(1));
+    mailbox_task();
+    check("ROM image selected", rombank_active() == rombank_image(1));
+
+    // commands core0 is too late for are dropped, never reordered
+    const uint32_t before = MailToCore0.dropped.load();
+    for (uint32_t i = 0; i < MailboxWords + 10; ++i)
+        zpi_out(0x30 | (i & 1));
+    check("flood dropped", MailToCore0.dropped.load() - before == 10);
+    MailMessage message;
+    uint32_t count = 0;
+    bool inOrder = true;
+    while (mailbox_fetch(MailToCore0, message))
+        inOrder &= message.tag == MailTag::RomImage && message.arg == (count++ & 1);
+    check("flood in order", inOrder && count == MailboxWords);
+
+    // out 3,14 asks core0 for the /NMI pulse
+    zpi_out(ZpiNmiCommand);
+    check("NMI posted", mailbox_fetch(MailToCore0, message) && message.tag == MailTag::Nmi);
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --messages N     messages per threaded run (default 1000000)\n"
+           "  --seed N         payload sizes (default 1)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--messages")
+            opts.messages = strtoul(value(), nullptr, 0);
+        else if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    printf("%u messages, up to %u payload words, %u word rings\n\n", opts.messages, MailMaxPayload, MailboxWords);
+    printf("%-10s %10s %10s %6s %10s\n", "producer", "received", "full", "bad", "Mmsg/s");
+    for (const bool retry : {true, false}) {
+        const Run run = run_threads(opts, retry);
+        printf("%-10s %10" PRIu64 " %10" PRIu64 " %6" PRIu64 " %10.2f\n", retry ? "retrying" : "dropping",
+               run.received, run.dropped, run.bad, run.received / run.seconds / 1e6);
+        check("messages whole and in order", !run.bad);
+        if (retry)
+            check("every message received", run.received == opts.messages);
+        else
+            check("received and dropped add up", run.received + run.dropped == opts.messages);
+    }
+
+    printf("\npost on the host:");
+    for (int i = 0; i < MailboxBench::Sizes; ++i)
+        printf(" %u words %.1f ns%s", unsigned(MailboxBench::Words[i]), post_ns(MailboxBench::Words[i]),
+               i + 1 < MailboxBench::Sizes ? "," : "\n");
+
+    sim::pio_reset();
+    const RomImage rom48{"48K", RomModel::Zx48, __48_rom, RomBankSize};
+    const RomImage test{"test", RomModel::Diagnostic, testrom_bin, RomBankSize};
+    rombank_select(rombank_add(&rom48));
+    rombank_add(&test);
+    zpi_init(nullptr);
+    zx_init();
+    check_boot();
+    check_commands();
+
+    if (Failures) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: every message arrived whole and in order, drops accounted\n");
+    return 0;
+}
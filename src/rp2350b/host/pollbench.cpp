@@ -0,0 +1,389 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Compares the two bus loops, zx_poll_split() which reads FSTAT for each state
+// machine in turn and zx_poll() which reads it once, under the same mixed
+// MREQ/IORQ load. The memory writes also land in the snoop FIFO, see
+// screen.h.
+//
+// Unlike zxsim, the words do not wait for the loop: a crude Z80 runs
+// instructions on its own clock (M1 and refresh, operand reads, RAM writes,
+// IN and OUT) and every word lands in its RX FIFO at the T state the PIO would
+// push it, wherever the loop is at that moment. zx_iorq holds /WAIT until its
+// answer, a MREQ read is only held for a hold word (see zx_wait_read()) and one
+// served after the data is sampled is a wrong byte. Either way the T states a
+// transaction came late by are counted as wait states, and the crude Z80 waits
+// them out so both loops see the same bus. Latency is from the word landing to the data pushed, plus the fixed
+// PIO overhead. Both loops are charged for their calls into the hot code as
+// well as for the register accesses, so the dispatch to the handlers counts,
+// see sim.h; the instructions inside a call are not.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <string>
+
+#include "rombank.h"
+#include "sim.h"
+#include "zpi.h"
+#include "zx.h"
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int MreqSm = 0;
+constexpr int IorqSm = 1;
+constexpr int SnoopSm = 2;
+
+enum Kind : uint8_t {
+    MemRead,    // M1 and operand reads
+    MemWrite,
+    Refresh,
+    IoRead,
+    IoWrite,
+    KindCount
+};
+
+const char *const KindNames[KindCount] = {"mreq rd", "mreq wr", "refresh", "iorq rd", "iorq wr"};
+
+struct Options
+{
+    uint32_t instructions = 200000;
+    uint32_t seed = 1;
+    double sysMHz = 150;
+    double zxMHz = 3.5469;
+    double budgetT = 1.5;   // word pushed to data sampled, or /WAIT sampled
+    uint32_t pioCycles = 6; // input synchronizers, in + push, pull + out
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+struct Stats
+{
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t max = 0;
+
+    void add(uint64_t cycles)
+    {
+        ++count;
+        total += cycles;
+        max = std::max(max, cycles);
+    }
+};
+
+struct Run
+{
+    Stats latency[KindCount];
+    uint64_t waitStates = 0;
+    uint64_t lost = 0;
+    uint64_t zxCycles = 0;  // T states the instructions took, waits included
+};
+
+struct Outstanding
+{
+    Kind kind;
+    uint64_t arrival;
+};
+
+uint32_t bus_word(Kind kind, uint16_t addr, uint8_t data)
+{
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE);
+    switch (kind) {
+    case MemRead:
+        bus &= ~((1u << I_MREQ_L) | (1u << I_RD_L));
+        bus |= 1u << I_ZXRDWR;
+        break;
+    case MemWrite:
+    case Refresh:
+        // sampled on /MREQ, /WR is still high and refresh never has it
+        bus &= ~(1u << I_MREQ_L);
+        bus |= data;
+        break;
+    case IoRead:
+        bus &= ~((1u << I_IORQ_L) | (1u << I_RD_L));
+        bus |= 1u << I_ZXRDWR;
+        break;
+    case IoWrite:
+        bus &= ~((1u << I_IORQ_L) | (1u << I_WR_L));
+        bus |= (1u << I_ZXRDWR) | data;
+        break;
+    default:
+        break;
+    }
+    return bus;
+}
+
+class Bench
+{
+public:
+    Bench(const Options &opts, void (*poll)())
+        : m_opts(opts)
+        , m_poll(poll)
+        , m_tCycles(opts.sysMHz / opts.zxMHz)
+        , m_budget(uint64_t(opts.budgetT * m_tCycles))
+        , m_rng{opts.seed}
+        , m_phase{opts.seed ^ 0x5eed}
+    {}
+
+    Run run()
+    {
+        sim::pio_reset();
+        m_t = 1000;
+        uint16_t pc = 0;
+        uint8_t r = 0;
+        const uint8_t ports[] = {0xfe, 0x1f, 0x7f, 0x03};
+        for (uint32_t i = 0; i < m_opts.instructions; ++i) {
+            // M1, the refresh 2T after it, the next M cycle 4T after it
+            const uint64_t m1 = at(0);
+            transaction(MemRead, bus_word(MemRead, pc, 0), m1);
+            transaction(Refresh, bus_word(Refresh, 0x3f00 | r++, 0), m1 + uint64_t(2 * m_tCycles));
+            advance(m1, 4);
+            pc = (pc + 1 + m_rng.next() % 3) & 0x3fff;
+
+            const uint32_t mix = m_rng.next() % 100;
+            if (mix < 40)
+                continue;
+            if (mix < 75 || mix >= 85) {
+                // operand
+                const uint64_t read = at(0);
+                transaction(MemRead, bus_word(MemRead, pc, 0), read);
+                advance(read, 3);
+            }
+            if (mix >= 75 && mix < 85) {
+                const uint64_t write = at(0);
+                const uint32_t bus = bus_word(MemWrite, 0x4000 + m_rng.next() % 0xc000, m_rng.next());
+                transaction(MemWrite, bus, write);
+                // the snoop state machine samples it again with /WR low, 1T on
+                sim::pio_rx_push_at(SnoopSm, (bus & ~(1u << I_WR_L)) | 1u << I_ZXRDWR, write + uint64_t(m_tCycles));
+                advance(write, 3);
+            } else if (mix >= 85) {
+                // IN A,(n) / OUT (n),A: /IORQ with /RD or /WR on T2, T1 T2 TW T3
+                const uint16_t port = uint16_t(m_rng.next() << 8) | ports[m_rng.next() % 4];
+                const Kind kind = mix < 95 ? IoRead : IoWrite;
+                const uint64_t io = at(0.5);
+                transaction(kind, bus_word(kind, port, m_rng.next()), io);
+                advance(at(0), 4);
+            }
+        }
+        finish();
+        m_result.zxCycles = uint64_t(m_t / m_tCycles);
+        return m_result;
+    }
+
+private:
+    // cycle of T state offset from now on the Z80 clock
+    uint64_t at(double offsetT) const
+    {
+        return uint64_t(m_t + offsetT * m_tCycles);
+    }
+
+    void advance(uint64_t start, uint32_t tStates)
+    {
+        m_t = std::max(m_t, double(start) + tStates * m_tCycles);
+    }
+
+    void transaction(Kind kind, uint32_t bus, uint64_t arrival)
+    {
+        const int sm = (kind == IoRead || kind == IoWrite) ? IorqSm : MreqSm;
+        // nothing for the loop to do until then, skip most of the idle
+        // trips but land at any point of one
+        const uint64_t lead = 64 + m_phase.next() % 32;
+        if (m_outstanding[MreqSm].empty() && m_outstanding[IorqSm].empty() && sim::Cycles + lead < arrival)
+            sim::Cycles = arrival - lead;
+        sim::pio_rx_push_at(sm, bus, arrival);
+        m_outstanding[sm].push_back({kind, arrival});
+        if (kind == Refresh)
+            return;
+
+        // the Z80 goes on once this one is served, see the top
+        uint64_t served = 0;
+        for (uint32_t polls = 0; !served && polls < 10000; ++polls) {
+            m_poll();
+            served = collect(sm, m_outstanding[sm].size() == 1);
+        }
+        if (!served) {
+            ++m_result.lost;
+            m_outstanding[sm].clear();
+            return;
+        }
+        const uint64_t deadline = arrival + m_budget;
+        if (served + m_opts.pioCycles > deadline) {
+            const uint32_t waits = uint32_t(std::ceil((served + m_opts.pioCycles - deadline) / m_tCycles));
+            m_result.waitStates += waits;
+            m_t += waits * m_tCycles;
+        }
+    }
+
+    // pops what the loop pushed, returns the push cycle of the last word of sm
+    // when it was the one waited for
+    uint64_t collect(int waitedSm, bool last)
+    {
+        uint64_t served = 0;
+        for (int sm : {MreqSm, IorqSm}) {
+            uint32_t data;
+            uint64_t pushed;
+            while (sim::pio_tx_pop(sm, data, pushed)) {
+                if (m_outstanding[sm].empty())
+                    continue;
+                const Outstanding o = m_outstanding[sm].front();
+                m_outstanding[sm].pop_front();
+                m_result.latency[o.kind].add(pushed - o.arrival + m_opts.pioCycles);
+                if (sm == waitedSm && (last || m_outstanding[sm].empty()))
+                    served = pushed;
+            }
+        }
+        return served;
+    }
+
+    void finish()
+    {
+        for (uint32_t polls = 0; polls < 100; ++polls) {
+            m_poll();
+            collect(-1, false);
+        }
+        m_result.lost += m_outstanding[MreqSm].size() + m_outstanding[IorqSm].size();
+    }
+
+    const Options &m_opts;
+    void (*m_poll)();
+    const double m_tCycles;
+    const uint64_t m_budget;
+    Rng m_rng;
+    Rng m_phase;
+    double m_t = 0;     // cycle the Z80 is at
+    std::deque<Outstanding> m_outstanding[2];
+    Run m_result;
+};
+
+void print_run(const char *name, const Run &run)
+{
+    printf("%s\n", name);
+    printf("  %-8s %10s %8s %8s\n", "kind", "count", "avg", "worst");
+    for (int k = 0; k < KindCount; ++k) {
+        const Stats &s = run.latency[k];
+        if (s.count)
+            printf("  %-8s %10" PRIu64 " %8.1f %8" PRIu64 "\n", KindNames[k], s.count, double(s.total) / s.count,
+                   s.max);
+    }
+    printf("  %" PRIu64 " wait states in %" PRIu64 " T states\n", run.waitStates, run.zxCycles);
+    if (run.lost)
+        printf("  %" PRIu64 " transactions were never answered\n", run.lost);
+}
+
+uint64_t worst_iorq(const Run &run)
+{
+    return std::max(run.latency[IoRead].max, run.latency[IoWrite].max);
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --instructions N Z80 instructions to run (default 200000)\n"
+           "  --seed N         workload (default 1)\n"
+           "  --clock MHZ      RP2350 system clock (default 150)\n"
+           "  --zx-clock MHZ   Z80 clock (default 3.5469)\n"
+           "  --budget T       T-states from the word pushed to data sampled (default 1.5)\n"
+           "  --pio CYCLES     fixed PIO overhead per transaction (default 6)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--instructions")
+            opts.instructions = strtoul(value(), nullptr, 0);
+        else if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--clock")
+            opts.sysMHz = atof(value());
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--budget")
+            opts.budgetT = atof(value());
+        else if (arg == "--pio")
+            opts.pioCycles = strtoul(value(), nullptr, 0);
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    sim::pio_reset();
+    rombank_select(rombank_add(BuiltinRoms[0]));
+    zpi_init(nullptr);
+    zx_init();
+
+    printf("%u instructions, %.1f MHz system clock, %.4f MHz Z80, budget %.2f T = %" PRIu64 " cycles\n",
+           opts.instructions, opts.sysMHz, opts.zxMHz, opts.budgetT, uint64_t(opts.budgetT / opts.zxMHz * opts.sysMHz));
+    printf("cost model: FSTAT %u, FIFO %u/%u, hot call %u cycles\n\n", unsigned(sim::Costs.fstat),
+           unsigned(sim::Costs.rxf), unsigned(sim::Costs.txf), unsigned(sim::Costs.call));
+
+    const Run split = Bench(opts, zx_poll_split).run();
+    print_run("zx_poll_split(), FSTAT per state machine", split);
+    const Run single = Bench(opts, zx_poll).run();
+    print_run("zx_poll(), one FSTAT", single);
+
+    const uint64_t before = worst_iorq(split);
+    const uint64_t after = worst_iorq(single);
+    printf("\nworst IORQ %" PRIu64 " -> %" PRIu64 " cycles, worst MREQ read %" PRIu64 " -> %" PRIu64 " cycles\n",
+           before, after, split.latency[MemRead].max, single.latency[MemRead].max);
+
+    if (single.lost || split.lost || after > before || single.latency[MemRead].max > split.latency[MemRead].max
+        || single.waitStates > split.waitStates) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: worst IORQ %" PRIu64 " -> %" PRIu64 " cycles with one FSTAT, dispatch calls included\n", before,
+           after);
+    return 0;
+}
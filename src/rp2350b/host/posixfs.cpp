@@ -0,0 +1,131 @@
+#include "posixfs.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+namespace {
+bool is_83(const char *name)
+{
+    const char *dot = strchr(name, '.');
+    const size_t base = dot ? size_t(dot - name) : strlen(name);
+    return base && base <= 8 && (!dot || (strlen(dot + 1) <= 3 && !strchr(dot + 1, '.')));
+}
+} // namespace {
+
+PosixFileSystem::PosixFileSystem(std::string dir)
+    : m_dir(std::move(dir))
+{
+    std::fill(std::begin(m_fds), std::end(m_fds), -1);
+}
+
+PosixFileSystem::~PosixFileSystem()
+{
+    for (int fd : m_fds) {
+        if (fd >= 0)
+            ::close(fd);
+    }
+}
+
+std::string PosixFileSystem::lookup(const char *name)
+{
+    DIR *dir = opendir(m_dir.c_str());
+    if (!dir)
+        return {};
+    std::string path;
+    while (const dirent *entry = readdir(dir)) {
+        if (!strcasecmp(entry->d_name, name)) {
+            path = m_dir + '/' + entry->d_name;
+            break;
+        }
+    }
+    closedir(dir);
+    return path;
+}
+
+int PosixFileSystem::open(const char *name, bool create)
+{
+    const auto slot = std::find(std::begin(m_fds), std::end(m_fds), -1);
+    if (slot == std::end(m_fds) || !is_83(name))
+        return -1;
+    std::string path = lookup(name);
+    if (path.empty()) {
+        if (!create)
+            return -1;
+        path = m_dir + '/' + name;
+    }
+    const int fd = ::open(path.c_str(), O_RDWR | (create ? O_CREAT | O_TRUNC : 0), 0644);
+    if (fd < 0)
+        return -1;
+    *slot = fd;
+    return slot - std::begin(m_fds);
+}
+
+void PosixFileSystem::close(int file)
+{
+    ::close(m_fds[file]);
+    m_fds[file] = -1;
+}
+
+int32_t PosixFileSystem::read(int file, uint32_t offset, uint8_t *data, uint32_t size)
+{
+    return pread(m_fds[file], data, size, offset);
+}
+
+int32_t PosixFileSystem::write(int file, uint32_t offset, const uint8_t *data, uint32_t size)
+{
+    return pwrite(m_fds[file], data, size, offset);
+}
+
+uint32_t PosixFileSystem::size(int file)
+{
+    struct stat st;
+    return fstat(m_fds[file], &st) ? 0 : uint32_t(st.st_size);
+}
+
+bool PosixFileSystem::remove(const char *name)
+{
+    const std::string path = lookup(name);
+    return !path.empty() && !unlink(path.c_str());
+}
+
+bool PosixFileSystem::rename(const char *from, const char *to)
+{
+    const std::string path = lookup(from);
+    if (path.empty() || !is_83(to) || !lookup(to).empty())
+        return false;
+    return !::rename(path.c_str(), (m_dir + '/' + to).c_str());
+}
+
+bool PosixFileSystem::list(uint32_t &cursor, FsEntry &entry)
+{
+    DIR *dir = opendir(m_dir.c_str());
+    if (!dir)
+        return false;
+    uint32_t n = 0;
+    bool found = false;
+    while (const dirent *e = readdir(dir)) {
+        if (!is_83(e->d_name) || n++ < cursor)
+            continue;
+        struct stat st;
+        if (stat((m_dir + '/' + e->d_name).c_str(), &st) || !S_ISREG(st.st_mode))
+            continue;
+        for (int i = 0; i <= int(strlen(e->d_name)); ++i)
+            entry.name[i] = toupper(e->d_name[i]);
+        entry.size = uint32_t(st.st_size);
+        entry.readOnly = !(st.st_mode & S_IWUSR);
+        cursor = n;
+        found = true;
+        break;
+    }
+    closedir(dir);
+    return found;
+}
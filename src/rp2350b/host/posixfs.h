@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+#include "fs.h"
+
+// Host stand-in for the FAT volume: a directory of the Linux file system.
+// Only regular files with 8.3 names are seen, names match case insensitively.
+class PosixFileSystem : public FileSystem
+{
+public:
+    explicit PosixFileSystem(std::string dir);
+    ~PosixFileSystem() override;
+
+    int open(const char *name, bool create) override;
+    void close(int file) override;
+    int32_t read(int file, uint32_t offset, uint8_t *data, uint32_t size) override;
+    int32_t write(int file, uint32_t offset, const uint8_t *data, uint32_t size) override;
+    uint32_t size(int file) override;
+
+    bool remove(const char *name) override;
+    bool rename(const char *from, const char *to) override;
+
+    bool list(uint32_t &cursor, FsEntry &entry) override;
+
+private:
+    // path of the existing file called name, empty if there is none
+    std::string lookup(const char *name);
+
+    std::string m_dir;
+    int m_fds[MaxFiles];
+};
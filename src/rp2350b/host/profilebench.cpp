@@ -0,0 +1,295 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Runs the clock profile calibration on the simulated bus.
+//
+// First the margin maths of margin.cpp is checked against hand computed cases.
+// Then zx_measure(), the very function core1 runs at boot, times bursts of
+// MREQ reads fed to the simulated PIO, and the worst read is turned into a
+// margin for every clock profile the way profile.cpp does. Prints the table
+// and the profile Auto would pick. Last, profile selection through ZPI is
+// stored in the simulated flash with the Z80 held, and applied at the next
+// boot, never under the running bus.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <hardware/clocks.h>
+
+#include "mailbox.h"
+#include "margin.h"
+#include "profile.h"
+#include "rombank.h"
+#include "sim.h"
+#include "zpi.h"
+#include "zx.h"
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int MreqSm = 0;
+constexpr int IorqSm = 1;
+
+struct Options
+{
+    uint32_t seed = 1;
+    uint32_t bursts = 20000;
+    uint32_t headroomPct = BusBudget{}.headroomPct;
+    bool verbose = false;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+uint32_t mreq_read(uint16_t addr)
+{
+    return (ControlIdle & ~((1u << I_MREQ_L) | (1u << I_RD_L))) | (1u << I_ZXRDWR) | uint32_t(addr) << I_ADDR_BASE;
+}
+
+uint32_t iorq_read(uint16_t port)
+{
+    return (ControlIdle & ~((1u << I_IORQ_L) | (1u << I_RD_L))) | (1u << I_ZXRDWR) | uint32_t(port) << I_ADDR_BASE;
+}
+
+uint32_t iorq_write(uint16_t port, uint8_t data)
+{
+    return (ControlIdle & ~((1u << I_IORQ_L) | (1u << I_WR_L))) | (1u << I_ZXRDWR) | uint32_t(port) << I_ADDR_BASE |
+           data;
+}
+
+int Failures = 0;
+
+void check(bool ok, const char *what, long got, long expected)
+{
+    if (ok)
+        return;
+    printf("FAIL: %s: got %ld, expected %ld\n", what, got, expected);
+    ++Failures;
+}
+
+void check_eq(const char *what, long got, long expected)
+{
+    check(got == expected, what, got, expected);
+}
+
+void check_maths()
+{
+    const BusBudget budget;
+    const ClockProfile p150{"150", 150000, 1100, 1, 0};
+    const ClockProfile p300{"300", 300000, 1350, 1, 0};
+    const ClockProfile slowPio{"150/2.5", 150000, 1100, 2, 128};
+
+    // 1.5 T at 3.5469 MHz, rounded down
+    check_eq("budget", margin_budget_ns(budget), 422);
+    // 1 T for a hold word
+    check_eq("hold budget", margin_hold_budget_ns(budget), 281);
+    // (21 + 6) / 150 MHz
+    check_eq("latency", margin_latency_ns(p150, 21, budget), 180);
+    // the PIO part runs 2.5 times slower: 21 + 6 * 2.5 cycles
+    check_eq("latency, PIO divider", margin_latency_ns(slowPio, 21, budget), 240);
+    // 63 / 300 MHz = 210 ns, 64 / 300 MHz rounds up to 214 ns
+    check_eq("latency, rounding", margin_latency_ns(p300, 58, budget), 214);
+    check_eq("margin", margin_ns(p150, 21, budget), 242);
+    check_eq("margin, late", margin_ns(p150, 60, budget), -18);
+
+    BusBudget half;
+    half.headroomPct = 50;  // 211 ns
+    check_eq("fits, at the headroom", margin_fits(p300, 57, half), true);
+    check_eq("fits, past the headroom", margin_fits(p300, 58, half), false);
+
+    const uint32_t worst[] = {0, 90, 40, 30};
+    check_eq("pick, skip unmeasured and late", margin_pick(ClockProfiles, worst, ClockProfileCount, budget), 2);
+    const uint32_t slow[] = {200, 200, 200, 200};
+    check_eq("pick, none fits", margin_pick(ClockProfiles, slow, ClockProfileCount, budget), -1);
+    const uint32_t none[ClockProfileCount] = {};
+    check_eq("pick, nothing measured", margin_pick(ClockProfiles, none, ClockProfileCount, budget), -1);
+}
+
+// out 3, value, then one trip around the core0 main loop
+void zpi_profile(uint8_t value)
+{
+    sim::pio_rx_push(IorqSm, iorq_write(0x0003, value));
+    zx_poll();
+    mailbox_task();
+    profile_task();
+}
+
+void check_settings()
+{
+    // no bus behind the host multicore FIFO: Auto finds nothing to calibrate
+    profile_boot();
+    check_eq("first boot profile", profile_active(), 0);
+
+    // never a clock change under the running bus, only the choice is stored
+    zpi_profile(0x22);
+    check_eq("requested profile waits for the next boot", profile_active(), 0);
+    check_eq("clock kept on the running bus", sim::SysKhz, ClockProfiles[0].sysKhz);
+    check_eq("flash written with the Z80 held", sim::FlashWritesLive, 0);
+    check_eq("Z80 released after the store", sim::GpioForcedLow, 0);
+
+    profile_boot();
+    check_eq("stored profile", profile_active(), 2);
+    check_eq("stored mode", int(profile_settings().mode), int(ProfileMode::Fixed));
+    check_eq("stored clock", sim::SysKhz, ClockProfiles[2].sysKhz);
+    check_eq("stored voltage", sim::CoreMillivolts, ClockProfiles[2].millivolts);
+
+    zpi_profile(0x20 | ProfileAuto);
+    check_eq("auto keeps the profile until the next boot", profile_active(), 2);
+    profile_boot();
+    check_eq("stored auto", int(profile_settings().mode), int(ProfileMode::Auto));
+    check_eq("auto profile", profile_active(), 0);
+
+    zpi_profile(0x2e);
+    check_eq("no such profile", profile_active(), 0);
+}
+
+// zx_measure() over bursts of up to a FIFO full of reads, as a Z80 running
+// from ROM and RAM does it, with the odd IN in between
+ZxMargin measure_bus(const Options &opts)
+{
+    Rng rng{opts.seed};
+    ZxMargin total;
+    for (uint32_t b = 0; b < opts.bursts; ++b) {
+        const uint32_t words = 1 + rng.next() % sim::PioFifoDepth;
+        for (uint32_t w = 0; w < words; ++w) {
+            const uint32_t r = rng.next() % 100;
+            uint16_t addr = rng.next() & 0x3fff;
+            if (r < 3)
+                addr = 0x0066;
+            else if (r < 30)
+                addr = 0x4000 + rng.next() % 0xc000;
+            sim::pio_rx_push(MreqSm, mreq_read(addr));
+        }
+        if (rng.next() % 8 == 0)
+            sim::pio_rx_push(IorqSm, iorq_read((rng.next() & 0xff00) | 0x1f));
+
+        // long enough for the whole burst
+        const ZxMargin margin = zx_measure(400);
+        uint32_t data;
+        uint64_t cycle;
+        while (sim::pio_tx_pop(MreqSm, data, cycle) || sim::pio_tx_pop(IorqSm, data, cycle)) {
+        }
+        if (opts.verbose)
+            printf("%6u  %u reads, worst %u cycles\n", b, margin.reads, margin.worstCycles);
+        total.worstCycles = std::max(total.worstCycles, margin.worstCycles);
+        total.reads += margin.reads;
+    }
+    return total;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --seed N         workload seed (default 1)\n"
+           "  --bursts N       bursts of MREQ reads to time (default 20000)\n"
+           "  --headroom PCT   margin to keep, in percent of the budget (default 25)\n"
+           "  --verbose        print every burst\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--bursts")
+            opts.bursts = strtoul(value(), nullptr, 0);
+        else if (arg == "--headroom")
+            opts.headroomPct = strtoul(value(), nullptr, 0);
+        else if (arg == "--verbose")
+            opts.verbose = true;
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.headroomPct <= 100;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    check_maths();
+
+    sim::pio_reset();
+    rombank_select(rombank_add(BuiltinRoms[0]));
+    zpi_init(nullptr);
+    zx_init();
+
+    check_settings();
+    const ZxMargin margin = measure_bus(opts);
+    check(margin.reads > opts.bursts, "reads timed", margin.reads, opts.bursts);
+
+    BusBudget budget;
+    budget.headroomPct = opts.headroomPct;
+    const uint32_t budgetNs = margin_budget_ns(budget);
+    printf("%u MREQ reads, worst %u cycles, PIO overhead %u cycles\n", margin.reads, margin.worstCycles,
+           budget.pioCycles);
+    printf("MREQ read budget %u ns, headroom %u%% = %u ns\n\n", budgetNs, budget.headroomPct,
+           budgetNs * budget.headroomPct / 100);
+    printf("%-8s %8s %10s %10s  %s\n", "profile", "mV", "latency", "margin", "fits");
+
+    uint32_t worst[ClockProfileCount];
+    for (int i = 0; i < ClockProfileCount; ++i) {
+        const ClockProfile &p = ClockProfiles[i];
+        worst[i] = margin.worstCycles;
+        printf("%-8s %8u %7u ns %7d ns  %s\n", p.name, p.millivolts, margin_latency_ns(p, margin.worstCycles, budget),
+               margin_ns(p, margin.worstCycles, budget), margin_fits(p, margin.worstCycles, budget) ? "yes" : "no");
+    }
+    const int pick = margin_pick(ClockProfiles, worst, ClockProfileCount, budget);
+
+    if (Failures) {
+        printf("\nFAIL: %d checks\n", Failures);
+        return 1;
+    }
+    if (pick < 0) {
+        printf("\nFAIL: no clock profile keeps %u%% headroom\n", budget.headroomPct);
+        return 1;
+    }
+    printf("\nOK: auto picks %s, %d ns margin\n", ClockProfiles[pick].name,
+           margin_ns(ClockProfiles[pick], margin.worstCycles, budget));
+    return 0;
+}
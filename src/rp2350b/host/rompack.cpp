@@ -0,0 +1,261 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Turns a ROM image into a C++ source, the build step behind ifp_rom() in
+// rompack.cmake.
+//
+//   rompack [--name NAME] [--model MODEL] [--traps TRAP,..] IMAGE SYMBOL OUTPUT.cpp
+//   rompack --raw IMAGE SYMBOL OUTPUT.cpp
+//
+// The first form defines the constexpr RomImage SYMBOL of rombank.h: the
+// image packed as an LZ4 block (see lz4.h), its CRC-32, the RomModel and the
+// traps. A trap is ADDR[-LAST][:in|out|notify], the RomTrap of the fetches
+// of ADDR to LAST, a page in by default. --raw defines SYMBOL[] and SYMBOL_len with the image as it
+// is, the way xxd -i does, for the host benches which read it directly.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "lz4.h"
+#include "rombank.h"
+#include "utils.h"
+
+namespace {
+
+struct Options
+{
+    bool raw = false;
+    std::string name;
+    std::string model = "Zx48";
+    std::vector<RomTrapRange> traps;
+    const char *image = nullptr;
+    const char *symbol = nullptr;
+    const char *output = nullptr;
+};
+
+// the models and the size of their images
+struct Model
+{
+    const char *name;
+    uint32_t size;  // 0 for any
+};
+
+constexpr Model Models[] = {
+    {"Zx48", RomBankSize},
+    {"Zx128", 2 * RomBankSize},
+    {"Plus3", 4 * RomBankSize},
+    {"Diagnostic", 0},
+    {"Shadow", 0},
+};
+
+constexpr const char *TrapActions[] = {nullptr, "in", "out", "notify"};
+constexpr const char *TrapNames[] = {"None", "PageIn", "PageOut", "Notify"};
+
+// ADDR[-LAST][:in|out|notify],.. the action defaults to in
+bool parse_traps(const char *text, std::vector<RomTrapRange> &traps)
+{
+    for (const char *p = text; *p;) {
+        char *end;
+        const unsigned long first = strtoul(p, &end, 0);
+        unsigned long last = first;
+        if (end == p)
+            return false;
+        if (*end == '-') {
+            p = end + 1;
+            last = strtoul(p, &end, 0);
+            if (end == p)
+                return false;
+        }
+        if (first > last || last >= RomBankSize)
+            return false;
+        RomTrapRange trap{uint16_t(first), uint16_t(last), RomTrap::PageIn};
+        if (*end == ':') {
+            p = end + 1;
+            const std::string name(p, strcspn(p, ","));
+            end = const_cast<char *>(p + name.size());
+            int action = 1;
+            while (action < 4 && name != TrapActions[action])
+                ++action;
+            if (action == 4)
+                return false;
+            trap.action = RomTrap(action);
+        }
+        if ((*end && *end != ',') || traps.size() == 255)
+            return false;
+        traps.push_back(trap);
+        p = *end ? end + 1 : end;
+    }
+    return true;
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] == '-'; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--raw") {
+            opts.raw = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+            return false;
+        const char *value = argv[++i];
+        if (arg == "--name") {
+            opts.name = value;
+        } else if (arg == "--model") {
+            opts.model = value;
+        } else if (arg == "--traps") {
+            if (!parse_traps(value, opts.traps)) {
+                fprintf(stderr, "Bad trap list %s\n", value);
+                return false;
+            }
+        } else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    if (argc - i != 3)
+        return false;
+    opts.image = argv[i];
+    opts.symbol = argv[i + 1];
+    opts.output = argv[i + 2];
+    if (opts.name.empty())
+        opts.name = opts.symbol;
+    return true;
+}
+
+void write_bytes(FILE *file, const std::vector<uint8_t> &data)
+{
+    for (size_t i = 0; i < data.size(); ++i)
+        fprintf(file, "%s0x%02x%s", i % 12 ? " " : "\n  ", data[i], i + 1 < data.size() ? "," : "");
+    fprintf(file, "\n};\n");
+}
+
+bool read_file(const char *name, std::vector<uint8_t> &data)
+{
+    FILE *file = fopen(name, "rb");
+    if (!file)
+        return false;
+    uint8_t buffer[4096];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        data.insert(data.end(), buffer, buffer + size);
+    const bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+bool write_raw(const Options &opts, const std::vector<uint8_t> &data)
+{
+    FILE *file = fopen(opts.output, "w");
+    if (!file)
+        return false;
+    fprintf(file, "// Generated by rompack from %s\n\n", opts.image);
+    fprintf(file, "extern const unsigned char %s[] = {", opts.symbol);
+    write_bytes(file, data);
+    fprintf(file, "unsigned int %s_len = %zu;\n", opts.symbol, data.size());
+    return fclose(file) == 0;
+}
+
+bool write_descriptor(const Options &opts, const std::vector<uint8_t> &packed, uint32_t size, uint32_t crc)
+{
+    FILE *file = fopen(opts.output, "w");
+    if (!file)
+        return false;
+    fprintf(file, "// Generated by rompack from %s: %u bytes packed into an LZ4 block of %zu\n\n", opts.image,
+            unsigned(size), packed.size());
+    fprintf(file, "#include \"rombank.h\"\n\nnamespace {\n\nalignas(4) constexpr uint8_t Data[] = {");
+    write_bytes(file, packed);
+    if (!opts.traps.empty()) {
+        fprintf(file, "constexpr RomTrapRange Traps[] = {\n");
+        for (const RomTrapRange &trap : opts.traps)
+            fprintf(file, "    {0x%04x, 0x%04x, RomTrap::%s},\n", trap.first, trap.last, TrapNames[int(trap.action)]);
+        fprintf(file, "};\n");
+    }
+    fprintf(file, "\n} // namespace {\n\n");
+    std::string name;
+    for (const char c : opts.name) {
+        if (c == '"' || c == '\\')
+            name += '\\';
+        name += c;
+    }
+    fprintf(file, "extern constexpr RomImage %s{\"%s\", RomModel::%s, Data, %u, %zu, 0x%08x, %s, %zu};\n",
+            opts.symbol, name.c_str(), opts.model.c_str(), unsigned(size), packed.size(), unsigned(crc),
+            opts.traps.empty() ? "nullptr" : "Traps", opts.traps.size());
+    return fclose(file) == 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        fprintf(stderr,
+                "Usage: %s [--name NAME] [--model MODEL] [--traps TRAP,..] IMAGE SYMBOL OUTPUT.cpp\n"
+                "       %s --raw IMAGE SYMBOL OUTPUT.cpp\n",
+                argv[0], argv[0]);
+        return 2;
+    }
+
+    std::vector<uint8_t> data;
+    if (!read_file(opts.image, data) || data.empty()) {
+        fprintf(stderr, "Cannot read %s\n", opts.image);
+        return 1;
+    }
+    if (opts.raw) {
+        if (!write_raw(opts, data)) {
+            fprintf(stderr, "Cannot write %s\n", opts.output);
+            return 1;
+        }
+        return 0;
+    }
+
+    const uint32_t size = data.size();
+    const Model *model = nullptr;
+    for (const Model &m : Models) {
+        if (opts.model == m.name)
+            model = &m;
+    }
+    if (!model) {
+        fprintf(stderr, "Unknown model %s\n", opts.model.c_str());
+        return 1;
+    }
+    if (model->size ? size != model->size : size % RomBankSize || size > MaxRomBanks * RomBankSize) {
+        fprintf(stderr, "%s: %u bytes do not make a %s image\n", opts.image, unsigned(size), model->name);
+        return 1;
+    }
+
+    std::vector<uint8_t> packed(lz4_bound(size));
+    packed.resize(lz4_pack(data.data(), size, packed.data()));
+    // what the firmware will do with it
+    std::vector<uint8_t> check(size);
+    if (lz4_unpack(packed.data(), packed.size(), check.data(), check.size()) != int32_t(size) || check != data) {
+        fprintf(stderr, "%s does not unpack to itself\n", opts.image);
+        return 1;
+    }
+    if (!write_descriptor(opts, packed, size, crc32(data.data(), size))) {
+        fprintf(stderr, "Cannot write %s\n", opts.output);
+        return 1;
+    }
+    return 0;
+}
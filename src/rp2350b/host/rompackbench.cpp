@@ -0,0 +1,317 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Checks the ROM descriptors rompack builds and times their unpacking.
+//
+// The built in images of the build must unpack to the raw ones and carry
+// their CRC-32, model and traps, a damaged block
+// must be refused without writing past the bank, and a packed image selected
+// through rombank.cpp must be served whole from the first fetch: with nothing
+// to read a missing byte from, a packed switch never holds the Z80.
+//
+// The unpack runs at boot before core1 starts serving the bus, so it delays
+// the first fetch IFp answers. Its time on the RP2350 is estimated from the
+// sequences of each block, each one costing --seq-cycles plus a cycle per
+// byte written, and from reading the block out of flash at --flash-mbs. It
+// has to fit in --budget-us.
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "lz4.h"
+#include "rombank.h"
+#include "sim.h"
+#include "utils.h"
+#include "zpi.h"
+#include "zx.h"
+
+extern const unsigned char __48_rom[];
+extern const unsigned char testrom_bin[];
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int MreqSm = 0;
+
+struct Options
+{
+    uint32_t seed = 1;
+    double sysMHz = 150;
+    double seqCycles = 40;      // token, lengths, offset and two memcpy() calls
+    double flashMBs = 20;       // XIP streaming the block in
+    double budgetUs = 2000;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+// a built in image and what it should unpack to
+struct Builtin
+{
+    const RomImage *image;
+    const uint8_t *raw;
+    RomModel model;
+    uint16_t firstTrap;
+    uint8_t trapCount;
+};
+
+int Failures = 0;
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+// sequences in a block, which the unpack time goes with
+uint32_t count_sequences(const uint8_t *p, uint32_t size)
+{
+    const uint8_t *end = p + size;
+    uint32_t sequences = 0;
+    while (p < end) {
+        const uint8_t token = *p++;
+        uint32_t literals = token >> 4;
+        if (literals == 15) {
+            while (*p == 255)
+                literals += *p++;
+            literals += *p++;
+        }
+        p += literals;
+        ++sequences;
+        if (p >= end)
+            break;
+        p += 2;
+        if ((token & 15) == 15) {
+            while (*p == 255)
+                ++p;
+            ++p;
+        }
+    }
+    return sequences;
+}
+
+// one ROM read, false when the answer is not the expected byte
+bool fetch(uint16_t addr, uint8_t expected, bool &held)
+{
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE);
+    bus &= ~((1u << I_MREQ_L) | (1u << I_RD_L));
+    bus |= 1u << I_ZXRDWR;
+    sim::pio_rx_push(MreqSm, bus);
+    zx_poll();
+
+    uint32_t word;
+    uint64_t cycle;
+    held = false;
+    if (!sim::pio_tx_pop(MreqSm, word, cycle))
+        return false;
+    if (word == 1) {
+        held = true;
+        if (!sim::pio_tx_pop(MreqSm, word, cycle))
+            return false;
+    }
+    return (word >> 1) == (0xff00u | expected);
+}
+
+// a damaged block is refused or unpacks to something, never past the bank
+void check_damage(const Builtin &image, Rng &rng)
+{
+    std::vector<uint8_t> block(image.image->data, image.image->data + image.image->packed);
+    std::vector<uint8_t> out(RomBankSize + 64);
+    constexpr uint8_t Guard = 0xa5;
+    bool overrun = false;
+    bool truncatedRefused = true;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        uint32_t size = block.size();
+        std::vector<uint8_t> damaged = block;
+        if (i % 2)
+            size = rng.next() % block.size();
+        else
+            damaged[rng.next() % block.size()] ^= 1 << (rng.next() % 8);
+        memset(out.data(), Guard, out.size());
+        const int32_t unpacked = lz4_unpack(damaged.data(), size, out.data(), RomBankSize);
+        for (uint32_t j = RomBankSize; j < out.size(); ++j)
+            overrun |= out[j] != Guard;
+        if (i % 2 && unpacked == int32_t(RomBankSize) && memcmp(out.data(), image.raw, RomBankSize))
+            truncatedRefused = false;
+    }
+    check("damaged blocks stay in the bank", !overrun);
+    check("truncated blocks never unpack to a whole wrong bank", truncatedRefused);
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --seed N           damage and fetch pattern (default 1)\n"
+           "  --sys-mhz MHZ      RP2350 clock at boot (default 150)\n"
+           "  --seq-cycles N     cycles an LZ4 sequence costs on top of its bytes (default 40)\n"
+           "  --flash-mbs MBS    flash read rate through XIP (default 20)\n"
+           "  --budget-us US     time the unpack may take at boot (default 2000)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--sys-mhz")
+            opts.sysMHz = atof(value());
+        else if (arg == "--seq-cycles")
+            opts.seqCycles = atof(value());
+        else if (arg == "--flash-mbs")
+            opts.flashMBs = atof(value());
+        else if (arg == "--budget-us")
+            opts.budgetUs = atof(value());
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    // as given to ifp_rom() in CMakeLists.txt
+    check("two built in images", BuiltinRomCount == 2);
+    const Builtin images[] = {
+        {BuiltinRoms[0], __48_rom, RomModel::Zx48, 0x0066, 3},
+        {BuiltinRoms[1], testrom_bin, RomModel::Diagnostic, 0, 0},
+    };
+    Rng rng{opts.seed};
+    printf("%-10s %7s %7s %6s %6s %10s %12s\n", "image", "raw", "packed", "ratio", "seqs", "host MB/s",
+           "RP2350 us");
+    double worstUs = 0;
+    uint32_t raw = 0;
+    uint32_t packed = 0;
+    for (const Builtin &builtin : images) {
+        const RomImage &image = *builtin.image;
+        check("descriptor size", image.size == RomBankSize);
+        check("descriptor CRC-32", image.crc == crc32(builtin.raw, RomBankSize));
+        check("descriptor model", image.model == builtin.model);
+        check("descriptor traps", image.trapCount == builtin.trapCount
+                                      && (!image.trapCount || image.traps[0].first == builtin.firstTrap));
+        check("aligned", !(uintptr_t(image.data) % 4));
+
+        std::vector<uint8_t> out(RomBankSize);
+        check("unpacks whole", lz4_unpack(image.data, image.packed, out.data(), out.size()) == int32_t(RomBankSize));
+        check("unpacks to the image", !memcmp(out.data(), builtin.raw, RomBankSize));
+        check("refuses a bank too small", lz4_unpack(image.data, image.packed, out.data(), RomBankSize - 1) < 0);
+        check_damage(builtin, rng);
+
+        constexpr int Rounds = 2000;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < Rounds; ++i)
+            lz4_unpack(image.data, image.packed, out.data(), out.size());
+        const double hostNs =
+            std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / Rounds;
+
+        const uint32_t sequences = count_sequences(image.data, image.packed);
+        const double us =
+            (sequences * opts.seqCycles + RomBankSize) / opts.sysMHz + image.packed / opts.flashMBs;
+        worstUs = std::max(worstUs, us);
+        raw += RomBankSize;
+        packed += image.packed;
+        printf("%-10s %7u %7u %5.1f%% %6u %10.0f %12.1f\n", image.name, RomBankSize, image.packed,
+               100.0 * image.packed / RomBankSize, sequences, RomBankSize * 1000.0 / hostNs, us);
+    }
+    printf("flash saved: %u of %u bytes\n", raw - packed, raw);
+    check("unpack fits the boot budget", worstUs <= opts.budgetUs);
+
+    // packed images through the ROM bank, with a raw one in the rotation
+    sim::pio_reset();
+    static uint8_t inverted[RomBankSize];
+    for (uint32_t i = 0; i < RomBankSize; ++i)
+        inverted[i] = ~__48_rom[i];
+    const RomImage rom48Inverted{"48K inverted", RomModel::Diagnostic, inverted, RomBankSize};
+    const int bank[] = {rombank_add(BuiltinRoms[0]), rombank_add(BuiltinRoms[1]), rombank_add(&rom48Inverted)};
+    const uint8_t *const bytes[] = {__48_rom, testrom_bin, inverted};
+    check("boot select", rombank_select(bank[0]));
+    zpi_init(nullptr);
+    zx_init();
+
+    RomImage broken = *BuiltinRoms[0];
+    broken.packed /= 2;
+    const int brokenBank = rombank_add(&broken);
+    check("a corrupt image is not selected", !rombank_begin(brokenBank) && rombank_active() == BuiltinRoms[0]);
+
+    uint32_t wrong = 0;
+    uint32_t held = 0;
+    uint32_t prefetched = 0;
+    for (int round = 0; round < 30; ++round) {
+        const int next = (round + 1) % 3;
+        check("begin", rombank_begin(bank[next]));
+        prefetched += round >= 3 && rombank_last_prefetched() == RomBankSize / RomFillLine;
+        bool done = false;
+        while (!done) {
+            for (int i = 0; i < 4; ++i) {
+                const uint16_t addr = rng.next() & 0x3fff;
+                bool h;
+                wrong += !fetch(addr, bytes[next][addr], h);
+                held += h && next != 2;
+            }
+            done = rombank_fill(1);
+        }
+        for (int i = 0; i < 64; ++i)
+            rombank_task();
+    }
+    check("every byte from the new image", !wrong);
+    check("packed images never hold the Z80", !held);
+    check("packed images prefetched by rombank_task()", prefetched == 27);
+
+    if (Failures) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: packed ROMs unpack in %.0f us at %.0f MHz, within %.0f us before the first fetch\n", worstUs,
+           opts.sysMHz, opts.budgetUs);
+    return 0;
+}
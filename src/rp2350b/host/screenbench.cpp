@@ -0,0 +1,295 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Checks the screen of screen.cpp, out of the RAM shadow, and the screenshots
+// taken from it.
+//
+// A game-like Z80 redraws a few sprites a frame, scrolls a band of the screen
+// now and then and writes the rest of the RAM in between. Every write goes
+// through zx_mreq() like on the bus and lands in the snoop FIFO as the
+// zx_snoop state machine would push it. At the end of each frame the mirror
+// has to match the RAM of the Z80, and the dirty lines taken have to be the
+// lines written during the frame, no more and no less.
+//
+// Then port 3 command 0b01010010 saves screenshots into DIR through the same
+// path as the firmware, next to an older SHOT0007.SCR. The Z80 time a
+// screenshot over the ZPI screen transfer would have cost is shown next to it.
+// Last, the capture stopped and started, and a write lost to a full snoop
+// FIFO, both leave the screen incomplete.
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "mailbox.h"
+#include "posixfs.h"
+#include "ramshadow.h"
+#include "rombank.h"
+#include "screen.h"
+#include "sim.h"
+#include "zpi.h"
+#include "zx.h"
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int MreqSm = 0;
+constexpr int IorqSm = 1;
+constexpr int SnoopSm = 2;
+constexpr double OtirT = 21;    // T states a byte of the ZPI screen transfer
+
+struct Options
+{
+    const char *dir = nullptr;
+    uint32_t seed = 1;
+    uint32_t frames = 500;
+    uint32_t sprites = 8;       // 16x16 redrawn each frame
+    double zxMHz = 3.5469;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+int Failures = 0;
+uint8_t Ram[0xc000];        // what the Z80 wrote, 0x4000 on
+uint32_t Written[ScreenDirtyWords];
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+// a memory write as the Z80 does it: the mreq word, then the snoop one
+void write(uint16_t addr, uint8_t data, bool snoop = true)
+{
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE) | data;
+    bus &= ~(1u << I_MREQ_L);
+    sim::pio_rx_push(MreqSm, bus);
+    if (snoop)
+        sim::pio_rx_push(SnoopSm, (bus & ~(1u << I_WR_L)) | 1u << I_ZXRDWR);
+    zx_poll();
+    uint32_t word;
+    uint64_t cycle;
+    sim::pio_tx_pop(MreqSm, word, cycle);
+
+    Ram[addr - 0x4000] = data;
+    const uint32_t offset = addr - ScreenBase;
+    if (offset < ScreenBytes)
+        Written[offset / ScreenLineBytes / 32] |= 1u << (offset / ScreenLineBytes % 32);
+}
+
+void port3(uint8_t data)
+{
+    uint32_t bus = ControlIdle | (0x0003u << I_ADDR_BASE) | data;
+    bus &= ~((1u << I_IORQ_L) | (1u << I_WR_L));
+    bus |= 1u << I_ZXRDWR;
+    sim::pio_rx_push(IorqSm, bus);
+    zx_poll();
+    uint32_t word;
+    uint64_t cycle;
+    sim::pio_tx_pop(IorqSm, word, cycle);
+    mailbox_task();
+}
+
+// the address of pixel row y, byte x of the display file
+uint16_t pixel_addr(uint32_t x, uint32_t y)
+{
+    return ScreenBase | (y & 0xc0) << 5 | (y & 0x07) << 8 | (y & 0x38) << 2 | x;
+}
+
+bool read_file(const std::string &path, uint8_t *data, uint32_t size)
+{
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f)
+        return false;
+    const bool ok = fread(data, 1, size, f) == size && fgetc(f) == EOF;
+    fclose(f);
+    return ok;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options] DIR\n"
+           "  --seed N          workload (default 1)\n"
+           "  --frames N        frames to run (default 500)\n"
+           "  --sprites N       16x16 sprites redrawn a frame (default 8)\n"
+           "  --zx-clock MHZ    Z80 clock (default 3.5469)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--frames")
+            opts.frames = strtoul(value(), nullptr, 0);
+        else if (arg == "--sprites")
+            opts.sprites = strtoul(value(), nullptr, 0);
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg[0] != '-' && !opts.dir)
+            opts.dir = argv[i];
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.dir;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    sim::pio_reset();
+    rombank_select(rombank_add(BuiltinRoms[0]));
+    zpi_init(nullptr);
+    zx_init();
+    PosixFileSystem fs(opts.dir);
+    for (const char *name : {"SHOT0007.SCR", "SHOT0008.SCR", "SHOT0009.SCR"})
+        fs.remove(name);
+    screen_init(&fs);
+    check("capturing from boot, nothing seen", ramshadow_capturing() && !screen_complete());
+
+    // the ROM clears the screen at reset
+    for (uint32_t i = 0; i < ScreenBytes; ++i)
+        write(ScreenBase + i, i < 6144 ? 0 : 0x38);
+    check("complete once written", screen_complete());
+
+    Rng rng{opts.seed};
+    static uint8_t mirror[ScreenBytes];
+    uint32_t dirty[ScreenDirtyWords];
+    screen_take(mirror, dirty);
+    memset(Written, 0, sizeof(Written));
+
+    uint32_t wrongMirror = 0;
+    uint32_t wrongDirty = 0;
+    uint64_t dirtyLines = 0;
+    uint64_t writes = 0;
+    for (uint32_t frame = 0; frame < opts.frames; ++frame) {
+        for (uint32_t s = 0; s < opts.sprites; ++s) {
+            const uint32_t x = rng.next() % 31;
+            const uint32_t y = rng.next() % (192 - 16);
+            for (uint32_t row = 0; row < 16; ++row) {
+                write(pixel_addr(x, y + row), rng.next());
+                write(pixel_addr(x + 1, y + row), rng.next());
+            }
+            write(ScreenBase + 6144 + (y / 8) * 32 + x, rng.next());
+            writes += 33;
+        }
+        // a band of 8 character rows scrolled every 16 frames
+        if (frame % 16 == 0) {
+            const uint32_t top = rng.next() % 16 * 8;
+            for (uint32_t y = top; y < top + 64; ++y) {
+                for (uint32_t x = 0; x < 32; ++x)
+                    write(pixel_addr(x, y), Ram[pixel_addr((x + 1) % 32, y) - 0x4000]);
+            }
+            writes += 64 * 32;
+        }
+        // the game's own variables, stack and buffers
+        for (uint32_t i = 0; i < 200; ++i)
+            write(0x5b00 + rng.next() % (0xc000 - 0x1b00), rng.next());
+        writes += 200;
+
+        const uint32_t lines = screen_take(mirror, dirty);
+        dirtyLines += lines;
+        wrongMirror += memcmp(mirror, Ram, ScreenBytes) != 0;
+        wrongDirty += memcmp(dirty, Written, sizeof(dirty)) != 0;
+        memset(Written, 0, sizeof(Written));
+    }
+    check("the mirror matches the RAM after each frame", !wrongMirror);
+    check("the dirty lines are the lines written", !wrongDirty);
+    printf("%u frames, %" PRIu64 " writes, %.1f of %u lines dirty a frame\n", opts.frames, writes,
+           double(dirtyLines) / opts.frames, ScreenLines);
+
+    // screenshots through port 3, after an older one
+    FILE *old = fopen((std::string(opts.dir) + "/SHOT0007.SCR").c_str(), "wb");
+    check("older screenshot", old && fclose(old) == 0);
+    static uint8_t shot[ScreenBytes];
+    port3(0x52);
+    check("SHOT0008.SCR holds the screen",
+          read_file(std::string(opts.dir) + "/SHOT0008.SCR", shot, ScreenBytes) && !memcmp(shot, Ram, ScreenBytes));
+    write(ScreenBase + 100, Ram[100] ^ 0xff);
+    port3(0x52);
+    check("SHOT0009.SCR holds the screen",
+          read_file(std::string(opts.dir) + "/SHOT0009.SCR", shot, ScreenBytes) && !memcmp(shot, Ram, ScreenBytes));
+    check("a screenshot leaves the dirty lines", screen_take(mirror, dirty) == 1);
+
+    // stopped, the writes are missing until the capture is started again
+    port3(0x50);
+    check("stopped", !ramshadow_capturing());
+    write(ScreenBase + 200, Ram[200] ^ 0xff, false);
+    port3(0x51);
+    check("started again, not complete", ramshadow_capturing() && !screen_complete());
+    check("a write missed while stopped", screen_take(mirror, dirty) == 0 && mirror[200] != Ram[200]);
+
+    // a burst of writes core1 does not keep up with: the one the full FIFO
+    // stalls on is lost, the capture starts over
+    for (uint32_t i = 0; i < ScreenBytes; ++i)
+        write(ScreenBase + i, Ram[i]);
+    ramshadow_task();
+    check("no stall, nothing forgotten", screen_complete() && ramshadow_restarts() == 0);
+    bool lost = false;
+    for (uint32_t i = 0; i <= sim::PioFifoDepth; ++i) {
+        const uint32_t bus = ControlIdle | (uint32_t(ScreenBase + i) << I_ADDR_BASE) | 0x55;
+        lost |= !sim::pio_rx_push(SnoopSm, (bus & ~((1u << I_MREQ_L) | (1u << I_WR_L))) | 1u << I_ZXRDWR);
+    }
+    for (uint32_t i = 0; i < sim::PioFifoDepth; ++i)
+        zx_poll();
+    ramshadow_task();
+    check("a write lost to a full FIFO invalidates the shadow",
+          lost && !screen_complete() && ramshadow_restarts() == 1 && !zx_snoop_lost());
+
+    const double transferMs = ScreenBytes * OtirT / opts.zxMHz / 1000;
+    if (Failures) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: screenshots from the mirror, %.1f ms of Z80 time a screenshot saved\n", transferMs);
+    return 0;
+}
@@ -0,0 +1,243 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Throughput and latency of the BlockCache request path against a disk image,
+// the host stand-in for the SD card:
+//
+//   random      512 byte reads at random sectors, one request in flight
+//   sequential  multi-block reads walking the image from the start
+//
+// The host numbers measure the cache and queue code. The SPI1 line adds what
+// the same pattern costs on the wire at the card clock, which bounds what the
+// firmware can reach whatever the card does.
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "blockcache.h"
+#include "fileblockdev.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options
+{
+    const char *image = nullptr;
+    uint32_t createMb = 0;
+    uint32_t reads = 20000;
+    uint32_t seqSectors = 32;
+    double spiMHz = 25;
+};
+
+struct Latency
+{
+    uint64_t count = 0;
+    double total = 0;
+    double max = 0;
+
+    void add(double us)
+    {
+        ++count;
+        total += us;
+        max = std::max(max, us);
+    }
+};
+
+struct Pending
+{
+    Clock::time_point start;
+    Latency *latency;
+    bool done = false;
+    bool ok = false;
+};
+
+void request_done(BlockRequest *request, bool ok)
+{
+    auto *pending = static_cast<Pending *>(request->user);
+    pending->latency->add(std::chrono::duration<double, std::micro>(Clock::now() - pending->start).count());
+    pending->done = true;
+    pending->ok = ok;
+}
+
+bool run(BlockCache &cache, uint32_t lba, uint8_t *data, uint32_t count, Latency &latency)
+{
+    Pending pending{Clock::now(), &latency};
+    BlockRequest req{lba, count, data, false, request_done, &pending};
+    if (!cache.submit(&req))
+        return false;
+    while (!pending.done)
+        cache.task();
+    return pending.ok;
+}
+
+// bytes on the SPI wire: command + R1, then token + data + CRC per sector,
+// plus CMD12 for multi-block reads
+double wire_us(uint32_t sectors, double spiMHz)
+{
+    uint32_t bytes = 8 + sectors * (1 + SectorSize + 2);
+    if (sectors > 1)
+        bytes += 8;
+    return bytes * 8 / spiMHz;
+}
+
+void report(const char *name, const Latency &latency, uint64_t bytes, double seconds)
+{
+    printf("%-10s %8" PRIu64 " req %10.0f req/s %9.2f MB/s   latency avg %7.2f us  max %8.2f us\n", name,
+           latency.count, latency.count / seconds, bytes / seconds / 1e6, latency.total / latency.count,
+           latency.max);
+}
+
+void report_stats(const BlockCache &cache)
+{
+    const BlockCacheStats &s = cache.stats();
+    const uint32_t lookups = s.hits + s.misses;
+    printf("%-10s hits %" PRIu32 " misses %" PRIu32 " (%.1f%% hit), %" PRIu32 " line fills, %" PRIu32 " errors\n", "",
+           s.hits, s.misses, lookups ? 100.0 * s.hits / lookups : 0.0, s.deviceReads, s.errors);
+}
+
+bool create_image(const char *path, uint32_t mb)
+{
+    const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return false;
+    std::mt19937 rng(1);
+    std::vector<uint32_t> chunk(1024 * 1024 / sizeof(uint32_t));
+    bool ok = true;
+    for (uint32_t i = 0; i < mb && ok; ++i) {
+        for (uint32_t &w : chunk)
+            w = rng();
+        ok = write(fd, chunk.data(), 1024 * 1024) == 1024 * 1024;
+    }
+    close(fd);
+    return ok;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options] image\n"
+           "  --create MB      create a random image of MB megabytes first\n"
+           "  --reads N        random 512 byte reads (default 20000)\n"
+           "  --seq SECTORS    sectors per sequential request (default 32)\n"
+           "  --spi MHZ        SD card SPI clock for the wire estimate (default 25)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--create")
+            opts.createMb = strtoul(value(), nullptr, 0);
+        else if (arg == "--reads")
+            opts.reads = strtoul(value(), nullptr, 0);
+        else if (arg == "--seq")
+            opts.seqSectors = strtoul(value(), nullptr, 0);
+        else if (arg == "--spi")
+            opts.spiMHz = atof(value());
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg[0] != '-' && !opts.image)
+            opts.image = argv[i];
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.image && opts.seqSectors;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (opts.createMb && !create_image(opts.image, opts.createMb)) {
+        perror(opts.image);
+        return 1;
+    }
+
+    FileBlockDevice device(opts.image);
+    if (!device.init()) {
+        fprintf(stderr, "%s: cannot open or empty\n", opts.image);
+        return 1;
+    }
+    printf("%s: %" PRIu32 " sectors, cache %" PRIu32 " lines of %" PRIu32 " sectors\n\n", opts.image,
+           device.sectorCount(), BlockCache::CacheLines, BlockCache::LineSectors);
+
+    std::vector<uint8_t> buffer(size_t(opts.seqSectors) * SectorSize);
+    int failures = 0;
+
+    {
+        BlockCache cache(device);
+        std::mt19937 rng(2);
+        std::uniform_int_distribution<uint32_t> pick(0, device.sectorCount() - 1);
+        Latency latency;
+        const auto start = Clock::now();
+        for (uint32_t i = 0; i < opts.reads; ++i)
+            failures += !run(cache, pick(rng), buffer.data(), 1, latency);
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        report("random", latency, uint64_t(latency.count) * SectorSize, seconds);
+        report_stats(cache);
+    }
+
+    {
+        BlockCache cache(device);
+        const uint32_t requests = device.sectorCount() / opts.seqSectors;
+        Latency latency;
+        const auto start = Clock::now();
+        for (uint32_t i = 0; i < requests; ++i)
+            failures += !run(cache, i * opts.seqSectors, buffer.data(), opts.seqSectors, latency);
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        report("sequential", latency, uint64_t(latency.count) * opts.seqSectors * SectorSize, seconds);
+        report_stats(cache);
+    }
+
+    // every random miss and every sequential line is one multi-block read
+    const double lineUs = wire_us(BlockCache::LineSectors, opts.spiMHz);
+    printf("\nSPI1 at %.1f MHz, wire time of a line fill %.1f us: random misses <= %.0f req/s, "
+           "sequential <= %.2f MB/s\n",
+           opts.spiMHz, lineUs, 1e6 / lineUs, BlockCache::LineSectors * SectorSize / lineUs);
+
+    if (failures) {
+        printf("\nFAIL: %d requests failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <pico.h>
+
+#include "sim.h"
+
+// the system clock only moves sim::SysKhz, the cycle model does not follow it
+
+enum clock_index {
+    clk_sys,
+    clk_peri,
+};
+
+#define CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB 0x2u
+#define USB_CLK_HZ 48000000u
+
+inline uint32_t clock_get_hz(clock_index clock)
+{
+    return clock == clk_sys ? sim::SysKhz * 1000 : USB_CLK_HZ;
+}
+
+inline bool set_sys_clock_khz(uint32_t khz, bool)
+{
+    sim::SysKhz = khz;
+    return true;
+}
+
+inline void clock_configure_undivided(clock_index, uint32_t, uint32_t, uint32_t) {}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstring>
+
+#include <pico.h>
+
+#include "sim.h"
+
+// sim::Flash stands in for the flash behind XIP
+
+#define FLASH_PAGE_SIZE (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+#define XIP_BASE uintptr_t(sim::Flash)
+
+inline void flash_range_erase(uint32_t offset, size_t count)
+{
+    sim::FlashWritesLive += !sim::GpioForcedLow;
+    memset(sim::Flash + offset, 0xff, count);
+}
+
+inline void flash_range_program(uint32_t offset, const uint8_t *data, size_t count)
+{
+    sim::FlashWritesLive += !sim::GpioForcedLow;
+    for (size_t i = 0; i < count; ++i)
+        sim::Flash[offset + i] &= data[i];
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "sim.h"
+
+enum gpio_dir { GPIO_IN = 0, GPIO_OUT = 1 };
+enum gpio_override { GPIO_OVERRIDE_NORMAL = 0, GPIO_OVERRIDE_INVERT = 1, GPIO_OVERRIDE_LOW = 2, GPIO_OVERRIDE_HIGH = 3 };
+
+inline void gpio_init(uint) {}
+inline void gpio_set_dir(uint, bool) {}
+inline void gpio_pull_up(uint) {}
+inline void gpio_pull_down(uint) {}
+
+inline void gpio_put(uint gpio, bool value)
+{
+    sim::Cycles += sim::Costs.sio;
+    if (value)
+        sim::GpioOut |= 1ull << gpio;
+    else
+        sim::GpioOut &= ~(1ull << gpio);
+}
+
+inline void gpio_set_mask(uint32_t mask)
+{
+    sim::Cycles += sim::Costs.sio;
+    sim::GpioOut |= mask;
+}
+
+inline void gpio_clr_mask(uint32_t mask)
+{
+    sim::Cycles += sim::Costs.sio;
+    sim::GpioOut &= ~uint64_t(mask);
+}
+
+// only forcing a pin low is modelled, see sim::GpioForcedLow
+inline void gpio_set_outover(uint gpio, uint value)
+{
+    sim::Cycles += sim::Costs.sio;
+    if (value == GPIO_OVERRIDE_LOW)
+        sim::GpioForcedLow |= 1ull << gpio;
+    else
+        sim::GpioForcedLow &= ~(1ull << gpio);
+}
+
+inline void gpio_set_oeover(uint, uint) {}
+
+inline uint32_t gpio_get_all()
+{
+    sim::Cycles += sim::Costs.sio;
+    ++sim::GpioReads;
+    return uint32_t(sim::GpioIn);
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <pico.h>
+
+inline void irq_set_mask_enabled(uint32_t, bool) {}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "sim.h"
+
+#include <hardware/gpio.h>
+
+#define PIO_FSTAT_RXEMPTY_LSB 8
+#define PIO_FSTAT_TXFULL_LSB 16
+#define PIO_FDEBUG_RXSTALL_LSB 0
+
+// Register block of a simulated PIO. fstat, rxf[] and txf[] behave like the
+// real registers (reading rxf pops, writing txf pushes) and every access is
+// charged to sim::Cycles. fdebug is core0's, it costs nothing.
+struct pio_hw_t
+{
+    struct Fstat
+    {
+        operator uint32_t() const { return sim::pio_fstat(); }
+    } fstat;
+
+    struct Fdebug
+    {
+        operator uint32_t() const { return sim::PioFdebug; }
+        // write 1 to clear, like the hardware
+        void operator=(uint32_t value) const { sim::PioFdebug &= ~value; }
+    } fdebug;
+
+    struct Rxf
+    {
+        uint32_t operator[](int sm) const { return sim::pio_rx_pop(sm); }
+    } rxf;
+
+    struct Txf
+    {
+        struct Reg
+        {
+            int sm;
+            void operator=(uint32_t value) const { sim::pio_tx_push(sm, value); }
+        };
+        Reg operator[](int sm) const { return {sm}; }
+    } txf;
+};
+
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t sim_pio2;
+#define pio2 (&sim_pio2)
+
+struct pio_program_t
+{
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+};
+
+struct pio_sm_config
+{
+    uint32_t clkdiv;
+};
+
+enum pio_fifo_join { PIO_FIFO_JOIN_NONE, PIO_FIFO_JOIN_TX, PIO_FIFO_JOIN_RX };
+
+inline void pio_set_gpio_base(PIO, uint) {}
+inline void pio_gpio_init(PIO, uint) {}
+inline void pio_sm_set_consecutive_pindirs(PIO, uint, uint, uint, bool) {}
+inline void pio_sm_init(PIO, uint, uint, const pio_sm_config *) {}
+inline void pio_sm_set_enabled(PIO, uint sm, bool enabled)
+{
+    sim::PioEnabled = enabled ? sim::PioEnabled | 1u << sm : sim::PioEnabled & ~(1u << sm);
+}
+inline void pio_sm_drain_tx_fifo(PIO, uint) {}
+inline void pio_sm_set_clkdiv(PIO, uint, float) {}
+inline void pio_sm_clear_fifos(PIO, uint) {}
+inline void pio_sm_restart(PIO, uint) {}
+inline void pio_sm_exec(PIO, uint, uint) {}
+inline uint pio_encode_jmp(uint addr) { return addr; }
+inline int pio_claim_unused_sm(PIO, bool) { return sim::pio_claim_sm(); }
+inline uint pio_add_program(PIO, const pio_program_t *) { return 0; }
+
+inline void sm_config_set_clkdiv(pio_sm_config *, float) {}
+inline void sm_config_set_sideset_pins(pio_sm_config *, uint) {}
+inline void sm_config_set_in_pin_base(pio_sm_config *, uint) {}
+inline void sm_config_set_in_shift(pio_sm_config *, bool, bool, uint) {}
+inline void sm_config_set_out_pin_base(pio_sm_config *, uint) {}
+inline void sm_config_set_out_pin_count(pio_sm_config *, uint) {}
+inline void sm_config_set_out_shift(pio_sm_config *, bool, bool, uint) {}
+inline void sm_config_set_jmp_pin(pio_sm_config *, uint) {}
+inline void sm_config_set_fifo_join(pio_sm_config *, pio_fifo_join) {}
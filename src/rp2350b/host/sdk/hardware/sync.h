@@ -0,0 +1,6 @@
+#pragma once
+
+#include <pico.h>
+
+inline uint32_t save_and_disable_interrupts() { return 0; }
+inline void restore_interrupts(uint32_t) {}
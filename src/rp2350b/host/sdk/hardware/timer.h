@@ -0,0 +1,8 @@
+#pragma once
+
+#include "sim.h"
+
+// simulated time follows the cycle counter at 150 MHz
+inline uint32_t time_us_32() { return uint32_t(sim::Cycles / 150); }
+inline uint64_t time_us_64() { return sim::Cycles / 150; }
+inline void busy_wait_us(uint32_t us) { sim::Cycles += uint64_t(us) * 150; }
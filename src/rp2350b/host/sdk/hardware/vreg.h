@@ -0,0 +1,11 @@
+#pragma once
+
+#include <pico.h>
+
+#include "sim.h"
+
+// 0.55 V and up in 50 mV steps, like the RP2350 regulator
+enum vreg_voltage : uint32_t {};
+
+inline void vreg_set_voltage(vreg_voltage voltage) { sim::CoreMillivolts = 550 + 50 * uint32_t(voltage); }
+inline void vreg_disable_voltage_limit() {}
@@ -0,0 +1,24 @@
+#pragma once
+
+// Host stand-in for the bits of the Raspberry Pi Pico SDK used by the bus
+// engine. Only what zx.cpp needs is provided, everything else is a no-op.
+
+#include <cstdint>
+
+typedef unsigned int uint;
+
+#define PICO_FLASH_SIZE_BYTES (4 * 1024 * 1024)
+
+// the bus engine's code goes to a section of its own, sim.cpp charges every
+// call into it, see sim::CostModel
+#define __time_critical_func(func_name) __attribute__((section("zx_hot"))) func_name
+#define __not_in_flash_func(func_name) func_name
+#define __force_inline inline __attribute__((always_inline))
+#define __scratch_x(group) __attribute__((section("zx_hot")))
+#define __scratch_y(group)
+
+enum pico_error_codes {
+    PICO_OK = 0,
+    PICO_ERROR_GENERIC = -1,
+    PICO_ERROR_TIMEOUT = -2,
+};
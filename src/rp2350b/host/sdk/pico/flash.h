@@ -0,0 +1,13 @@
+#pragma once
+
+#include <pico.h>
+
+// nothing runs next to the host bus loop, the function just runs
+
+inline bool flash_safe_execute_core_init() { return true; }
+
+inline int flash_safe_execute(void (*func)(void *), void *param, uint32_t)
+{
+    func(param);
+    return PICO_OK;
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <hardware/irq.h>
+
+inline void multicore_fifo_push_blocking(uint32_t) {}
+inline uint32_t multicore_fifo_pop_blocking() { return 0; }
@@ -0,0 +1,181 @@
+#include "sim.h"
+
+#include <hardware/pio.h>
+
+#include <deque>
+
+pio_hw_t sim_pio2;
+
+namespace sim {
+
+CostModel Costs;
+uint64_t Cycles = 0;
+uint64_t GpioOut = 0;
+uint64_t GpioForcedLow = 0;
+uint64_t GpioIn = ~0ull;
+uint64_t GpioReads = 0;
+uint32_t PioEnabled = 0;
+uint32_t PioFdebug = 0;
+uint32_t SysKhz = 150000;
+uint32_t CoreMillivolts = 1100;
+uint8_t Flash[PICO_FLASH_SIZE_BYTES];
+uint32_t FlashWritesLive = 0;
+uint8_t Psram[PsramBytes];
+
+namespace {
+
+struct Fifo
+{
+    uint32_t data[PioFifoDepth];
+    uint64_t stamp[PioFifoDepth];
+    int head = 0;
+    int count = 0;
+
+    bool push(uint32_t value, uint64_t cycle)
+    {
+        if (count == PioFifoDepth)
+            return false;
+        const int pos = (head + count++) % PioFifoDepth;
+        data[pos] = value;
+        stamp[pos] = cycle;
+        return true;
+    }
+
+    bool pop(uint32_t &value, uint64_t &cycle)
+    {
+        if (!count)
+            return false;
+        value = data[head];
+        cycle = stamp[head];
+        head = (head + 1) % PioFifoDepth;
+        --count;
+        return true;
+    }
+};
+
+struct Arrival
+{
+    uint32_t value;
+    uint64_t cycle;
+};
+
+Fifo RxFifo[PioSmCount];
+Fifo TxFifo[PioSmCount];
+std::deque<Arrival> Pending[PioSmCount];   // pio_rx_push_at() words not due yet
+int ClaimedSms = 0;
+
+// a word the state machine pushes, a full FIFO stalls it: the word is lost
+// and FDEBUG tells
+bool rx_push(int sm, uint32_t value, uint64_t cycle)
+{
+    if (RxFifo[sm].push(value, cycle))
+        return true;
+    PioFdebug |= 1u << (PIO_FDEBUG_RXSTALL_LSB + sm);
+    return false;
+}
+
+// moves the words due by now into their RX FIFO, the bench keeps them in order
+void deliver()
+{
+    for (int sm = 0; sm < PioSmCount; ++sm) {
+        while (!Pending[sm].empty() && Pending[sm].front().cycle <= Cycles) {
+            const Arrival &arrival = Pending[sm].front();
+            rx_push(sm, arrival.value, arrival.cycle);
+            Pending[sm].pop_front();
+        }
+    }
+}
+
+} // namespace
+
+uint32_t pio_fstat()
+{
+    deliver();
+    Cycles += Costs.fstat;
+    uint32_t fstat = 0;
+    for (int sm = 0; sm < PioSmCount; ++sm) {
+        if (!RxFifo[sm].count)
+            fstat |= 1u << (PIO_FSTAT_RXEMPTY_LSB + sm);
+        if (TxFifo[sm].count == PioFifoDepth)
+            fstat |= 1u << (PIO_FSTAT_TXFULL_LSB + sm);
+    }
+    return fstat;
+}
+
+uint32_t pio_rx_pop(int sm)
+{
+    deliver();
+    Cycles += Costs.rxf;
+    uint32_t value = 0;
+    uint64_t cycle;
+    // like the hardware, reading an empty FIFO returns garbage (here 0)
+    RxFifo[sm].pop(value, cycle);
+    return value;
+}
+
+void pio_tx_push(int sm, uint32_t value)
+{
+    Cycles += Costs.txf;
+    // like the hardware, writing a full FIFO drops the data
+    TxFifo[sm].push(value, Cycles);
+}
+
+int pio_claim_sm()
+{
+    return ClaimedSms++;
+}
+
+bool pio_rx_push(int sm, uint32_t value)
+{
+    return rx_push(sm, value, Cycles);
+}
+
+void pio_rx_push_at(int sm, uint32_t value, uint64_t cycle)
+{
+    Pending[sm].push_back({value, cycle});
+}
+
+bool pio_tx_pop(int sm, uint32_t &value, uint64_t &cycle)
+{
+    return TxFifo[sm].pop(value, cycle);
+}
+
+void pio_reset()
+{
+    for (int sm = 0; sm < PioSmCount; ++sm) {
+        RxFifo[sm] = {};
+        TxFifo[sm] = {};
+        Pending[sm].clear();
+    }
+    ClaimedSms = 0;
+    PioEnabled = 0;
+    PioFdebug = 0;
+    Cycles = 0;
+    GpioOut = 0;
+    GpioForcedLow = 0;
+}
+
+} // namespace sim
+
+// -finstrument-functions hook of the firmware sources, see sim.h
+extern "C" {
+
+// the linker's bounds of zx_hot, which the anchor keeps in every binary
+extern const char __start_zx_hot[] __attribute__((visibility("hidden")));
+extern const char __stop_zx_hot[] __attribute__((visibility("hidden")));
+
+__attribute__((section("zx_hot"), used)) void sim_zx_hot_anchor()
+{
+}
+
+__attribute__((no_instrument_function)) void __cyg_profile_func_enter(void *func, void *)
+{
+    if (func >= __start_zx_hot && func < __stop_zx_hot)
+        sim::Cycles += sim::Costs.call;
+}
+
+__attribute__((no_instrument_function)) void __cyg_profile_func_exit(void *, void *)
+{
+}
+
+} // extern "C"
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <pico.h>
+
+// Cycle model of the bus fabric seen by core1.
+//
+// The simulated PIO charges every register access to sim::Cycles, so the time
+// a code path spends talking to the hardware is what gets measured. That is
+// the part of the hot loop that dominates on the RP2350: a PIO register access
+// goes through the APB bridge and costs a few cycles, a SIO access costs one.
+//
+// The firmware sources are built with -finstrument-functions and the hot code,
+// __time_critical_func() and __zx_code(), lands in the zx_hot section: every
+// call into it is charged as well, inlined ones included. That is all the CPU
+// work the model sees, the instructions inside a call are free. A hot path
+// that grows a call shows up, a loop that grows inside one function does not.
+namespace sim {
+
+struct CostModel
+{
+    uint32_t fstat = 3; // read PIO FSTAT
+    uint32_t rxf = 3;   // pop from a PIO RX FIFO
+    uint32_t txf = 3;   // push into a PIO TX FIFO
+    uint32_t sio = 1;   // gpio_put() and friends
+    uint32_t call = 6;  // call and return of a hot function, a few loads
+};
+
+constexpr int PioSmCount = 4;
+constexpr int PioFifoDepth = 4;
+constexpr uint32_t PsramBytes = 8 * 1024 * 1024;   // what psram_init() finds on CS1
+
+extern CostModel Costs;
+extern uint64_t Cycles;
+extern uint64_t GpioOut;
+extern uint64_t GpioForcedLow; // pads gpio_set_outover() drives low
+extern uint64_t GpioIn;     // levels the bench puts on the input pins
+extern uint64_t GpioReads;  // gpio_get_all() calls
+extern uint32_t PioEnabled; // a bit for each state machine left running
+extern uint32_t PioFdebug;  // RXSTALL of a state machine pushing to a full RX FIFO
+extern uint32_t SysKhz;     // set_sys_clock_khz()
+extern uint32_t CoreMillivolts;
+extern uint8_t Flash[PICO_FLASH_SIZE_BYTES];
+extern uint32_t FlashWritesLive;  // erases and programs with the Z80 not held
+extern uint8_t Psram[PsramBytes];
+
+// register side, used by the fake SDK headers
+uint32_t pio_fstat();
+uint32_t pio_rx_pop(int sm);
+void pio_tx_push(int sm, uint32_t value);
+int pio_claim_sm();
+
+// bench side, used by the simulator to play the role of the state machines;
+// false with the FIFO full, which sets RXSTALL in PioFdebug
+bool pio_rx_push(int sm, uint32_t value);
+// the word shows up in the RX FIFO once Cycles reaches cycle, as seen by the
+// next register access; words of one state machine go in arrival order
+void pio_rx_push_at(int sm, uint32_t value, uint64_t cycle);
+bool pio_tx_pop(int sm, uint32_t &value, uint64_t &cycle);
+void pio_reset();
+
+} // namespace sim
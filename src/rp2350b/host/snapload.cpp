@@ -0,0 +1,409 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Loads snapshots through the shadow ROM loader of snapshot.cpp and checks
+// the machine state the Z80 ends up with.
+//
+// The host Z80 of zxmachine.h plays the Spectrum: every ROM fetch and port
+// access goes through zx_poll() as a bus word, RAM is local. The simulated clock follows the Z80 T states, so the
+// load time snapshot_task() reports is the one the real machine would see
+// without contention. Synthetic 48K/128K .SNA and .Z80 files are generated
+// with random registers and RAM, or a real snapshot can be given.
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "rombank.h"
+#include "sim.h"
+#include "snapshot.h"
+#include "zpi.h"
+#include "zx.h"
+#include "zxmachine.h"
+
+extern const unsigned char __48_rom[];
+extern const unsigned char testrom_bin[];
+
+namespace {
+
+struct Options
+{
+    const char *file = nullptr;
+    uint32_t seed = 1;
+    double sysMHz = 150;
+    double zxMHz = 3.5469;
+};
+
+// --- snapshot files ---------------------------------------------------------
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+// random RAM with long runs, so the .Z80 compression has something to do
+void fill_ram(Rng &rng, uint8_t *data, uint32_t size)
+{
+    for (uint32_t pos = 0; pos < size;) {
+        const uint32_t run = rng.next() % 3 ? 1 : 1 + rng.next() % 600;
+        const uint8_t value = rng.next() % 8 ? rng.next() : 0xed;
+        for (uint32_t i = 0; i < run && pos < size; ++i)
+            data[pos++] = value;
+    }
+}
+
+Snapshot random_state(Rng &rng, bool zx128)
+{
+    Snapshot s;
+    s.af = rng.next();
+    s.bc = rng.next();
+    s.de = rng.next();
+    s.hl = rng.next();
+    s.af2 = rng.next();
+    s.bc2 = rng.next();
+    s.de2 = rng.next();
+    s.hl2 = rng.next();
+    s.ix = rng.next();
+    s.iy = rng.next();
+    s.sp = 0x8000 + rng.next() % 0x7000;
+    s.pc = 0x5d00 + rng.next() % 0x2000;
+    s.i = rng.next();
+    s.r = rng.next();
+    s.im = 1 + rng.next() % 2;
+    s.border = rng.next() % 8;
+    s.iff1 = s.iff2 = rng.next() & 1;
+    s.zx128 = zx128;
+    s.port7ffd = zx128 ? 0x10 | rng.next() % 8 : 0;
+    return s;
+}
+
+void put16(std::vector<uint8_t> &out, uint16_t value)
+{
+    out.push_back(value);
+    out.push_back(value >> 8);
+}
+
+// banks in 128K numbering, 48K uses 5, 2 and 0
+std::vector<uint8_t> make_sna(const Snapshot &s, uint8_t banks[][SnapshotBankSize])
+{
+    std::vector<uint8_t> out;
+    out.push_back(s.i);
+    put16(out, s.hl2);
+    put16(out, s.de2);
+    put16(out, s.bc2);
+    put16(out, s.af2);
+    put16(out, s.hl);
+    put16(out, s.de);
+    put16(out, s.bc);
+    put16(out, s.iy);
+    put16(out, s.ix);
+    out.push_back(s.iff2 ? 0x04 : 0);
+    out.push_back(s.r);
+    put16(out, s.af);
+    uint16_t sp = s.sp;
+    if (!s.zx128) {
+        // the PC goes on the stack
+        sp -= 2;
+        uint8_t *stack = &banks[sp < 0x8000 ? 5 : sp < 0xc000 ? 2 : 0][sp & 0x3fff];
+        stack[0] = s.pc;
+        stack[1] = s.pc >> 8;
+    }
+    put16(out, sp);
+    out.push_back(s.im);
+    out.push_back(s.border);
+    const int paged = s.zx128 ? s.port7ffd & 7 : 0;
+    for (int n : {5, 2, paged})
+        out.insert(out.end(), banks[n], banks[n] + SnapshotBankSize);
+    if (!s.zx128)
+        return out;
+    put16(out, s.pc);
+    out.push_back(s.port7ffd);
+    out.push_back(0);
+    for (int n = 0; n < int(SnapshotMaxBanks); ++n) {
+        if (n != 2 && n != 5 && n != paged)
+            out.insert(out.end(), banks[n], banks[n] + SnapshotBankSize);
+    }
+    return out;
+}
+
+void pack(std::vector<uint8_t> &out, const uint8_t *data, uint32_t size)
+{
+    for (uint32_t pos = 0; pos < size;) {
+        const uint8_t value = data[pos];
+        uint32_t run = 1;
+        while (pos + run < size && data[pos + run] == value && run < 255)
+            ++run;
+        if (run >= 5 || (value == 0xed && run >= 2)) {
+            out.insert(out.end(), {0xed, 0xed, uint8_t(run), value});
+            pos += run;
+            continue;
+        }
+        out.push_back(value);
+        ++pos;
+        // the byte after a single ED is never part of a run
+        if (value == 0xed && pos < size)
+            out.push_back(data[pos++]);
+    }
+}
+
+// 48K: version 1, compressed; 128K: version 3 with compressed pages
+std::vector<uint8_t> make_z80(const Snapshot &s, uint8_t banks[][SnapshotBankSize])
+{
+    std::vector<uint8_t> out;
+    out.push_back(s.af >> 8);
+    out.push_back(s.af);
+    put16(out, s.bc);
+    put16(out, s.hl);
+    put16(out, s.zx128 ? 0 : s.pc);
+    put16(out, s.sp);
+    out.push_back(s.i);
+    out.push_back(s.r & 0x7f);
+    out.push_back((s.r >> 7) | s.border << 1 | (s.zx128 ? 0 : 0x20));
+    put16(out, s.de);
+    put16(out, s.bc2);
+    put16(out, s.de2);
+    put16(out, s.hl2);
+    out.push_back(s.af2 >> 8);
+    out.push_back(s.af2);
+    put16(out, s.iy);
+    put16(out, s.ix);
+    out.push_back(s.iff1);
+    out.push_back(s.iff2);
+    out.push_back(s.im);
+    if (!s.zx128) {
+        for (int n : {5, 2, 0})
+            pack(out, banks[n], SnapshotBankSize);
+        out.insert(out.end(), {0x00, 0xed, 0xed, 0x00});
+        return out;
+    }
+    put16(out, 54);
+    put16(out, s.pc);
+    out.push_back(4);
+    out.push_back(s.port7ffd);
+    out.resize(out.size() + 54 - 4, 0);
+    for (int n = 0; n < int(SnapshotMaxBanks); ++n) {
+        std::vector<uint8_t> page;
+        pack(page, banks[n], SnapshotBankSize);
+        put16(out, page.size());
+        out.push_back(n + 3);
+        out.insert(out.end(), page.begin(), page.end());
+    }
+    return out;
+}
+
+bool load_file(const char *name, std::vector<uint8_t> &data)
+{
+    FILE *f = fopen(name, "rb");
+    if (!f) {
+        perror(name);
+        return false;
+    }
+    uint8_t buffer[4096];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), f)) > 0)
+        data.insert(data.end(), buffer, buffer + size);
+    fclose(f);
+    return true;
+}
+
+// --- the test ---------------------------------------------------------------
+
+int Rom48 = -1;
+int Rom128 = -1;
+uint8_t Rom128Data[2 * RomBankSize];
+
+// runs the loader, compares the registers with expected and the RAM with banks
+bool run(const Options &opts, const char *name, const std::vector<uint8_t> &file, const Snapshot *expected,
+         uint8_t banks[][SnapshotBankSize])
+{
+    static ZxMachine m;
+    const bool zx128 = expected ? expected->zx128 : file.size() > 100000 || strstr(name, "128");
+    rombank_select(zx128 ? Rom128 : Rom48);
+    m.reset(zx128);
+    m.sp = 0xfff0;
+    m.pc = 0x1234;
+
+    if (!snapshot_load(name, file.data(), file.size())) {
+        printf("%-12s FAIL: rejected\n", name);
+        return false;
+    }
+
+    // the clock follows the Z80 from the NMI on
+    const double cyclesPerT = opts.sysMHz / opts.zxMHz;
+    const uint64_t nmiCycles = sim::Cycles;
+    m.nmi();
+    uint64_t steps = 0;
+    while (snapshot_busy()) {
+        if (!m.step() || ++steps > 10000000) {
+            printf("%-12s FAIL: loader stuck at %04x\n", name, m.pc);
+            return false;
+        }
+        sim::Cycles = std::max(sim::Cycles, nmiCycles + uint64_t(m.tstates * cyclesPerT));
+        snapshot_task();
+    }
+
+    const Snapshot &s = expected ? *expected : snapshot_last();
+    int bad = 0;
+    auto check = [&](const char *what, uint32_t got, uint32_t want) {
+        if (got == want)
+            return;
+        printf("  %s is %04x, expected %04x\n", what, got, want);
+        ++bad;
+    };
+    check("AF", m.af, s.af);
+    check("BC", m.bc, s.bc);
+    check("DE", m.de, s.de);
+    check("HL", m.hl, s.hl);
+    check("AF'", m.af2, s.af2);
+    check("BC'", m.bc2, s.bc2);
+    check("DE'", m.de2, s.de2);
+    check("HL'", m.hl2, s.hl2);
+    check("IX", m.ix, s.ix);
+    check("IY", m.iy, s.iy);
+    check("SP", m.sp, s.sp);
+    check("PC", m.pc, s.pc);
+    check("I", m.i, s.i);
+    check("R", m.r, s.r);
+    check("IM", m.im, s.im);
+    check("IFF1", m.iff1, s.iff1);
+    check("border", m.border, s.border);
+    if (zx128)
+        check("0x7ffd", m.port7ffd, s.port7ffd);
+    else if (m.port7ffd)
+        check("0x7ffd", m.port7ffd, 0);
+    check("undriven ROM reads", m.undriven, 0);
+
+    // the next fetch must come from the machine ROM again
+    const uint8_t *rom = zx128 ? Rom128Data + ((s.port7ffd >> 4) & 1) * RomBankSize : __48_rom;
+    check("ROM after the loader", m.read(0x0066), rom[0x0066]);
+    check("ROM after the loader", m.read(0x0556), rom[0x0556]);
+
+    if (banks) {
+        const int count = zx128 ? SnapshotMaxBanks : 3;
+        for (int k = 0; k < count; ++k) {
+            const int n = zx128 ? k : (k == 0 ? 5 : k == 1 ? 2 : 0);
+            if (memcmp(m.banks[n], banks[n], SnapshotBankSize)) {
+                printf("  RAM bank %d differs\n", n);
+                ++bad;
+            }
+        }
+    }
+
+    const SnapshotStats &stats = snapshot_stats();
+    printf("%-12s %s: %7zu bytes, %6" PRIu64 " T states, %6.1f ms measured, %4.0f KB/s\n", name,
+           bad ? "FAIL" : "OK  ", file.size(), m.tstates, stats.lastUs / 1000.0,
+           stats.lastUs ? stats.lastBytes * 1000.0 / stats.lastUs : 0.0);
+    return !bad;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options] [snapshot]\n"
+           "  --seed N         seed of the synthetic snapshots (default 1)\n"
+           "  --clock MHZ      RP2350 system clock (default 150)\n"
+           "  --zx-clock MHZ   Z80 clock (default 3.5469)\n"
+           "Without a snapshot, synthetic 48K and 128K .SNA and .Z80 files are loaded.\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--clock")
+            opts.sysMHz = atof(value());
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg[0] != '-' && !opts.file)
+            opts.file = argv[i];
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    sim::pio_reset();
+    memcpy(Rom128Data, testrom_bin, RomBankSize);
+    memcpy(Rom128Data + RomBankSize, __48_rom, RomBankSize);
+    static const RomImage rom48{"48K", RomModel::Zx48, __48_rom, RomBankSize};
+    static const RomImage rom128{"128K", RomModel::Zx128, Rom128Data, 2 * RomBankSize};
+    Rom48 = rombank_add(&rom48);
+    Rom128 = rombank_add(&rom128);
+    zpi_init(nullptr);
+    zx_init();
+
+    if (opts.file) {
+        std::vector<uint8_t> file;
+        if (!load_file(opts.file, file))
+            return 2;
+        const char *name = strrchr(opts.file, '/');
+        return run(opts, name ? name + 1 : opts.file, file, nullptr, nullptr) ? 0 : 1;
+    }
+
+    Rng rng{opts.seed};
+    static uint8_t banks[SnapshotMaxBanks][SnapshotBankSize];
+    bool ok = true;
+    for (bool zx128 : {false, true}) {
+        for (bool z80 : {false, true}) {
+            for (auto &bank : banks)
+                fill_ram(rng, bank, SnapshotBankSize);
+            const Snapshot s = random_state(rng, zx128);
+            const std::vector<uint8_t> file = z80 ? make_z80(s, banks) : make_sna(s, banks);
+            const char *name = zx128 ? (z80 ? "TEST128.Z80" : "TEST128.SNA") : (z80 ? "TEST48.Z80" : "TEST48.SNA");
+            ok &= run(opts, name, file, &s, banks);
+        }
+    }
+    if (!ok) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK\n");
+    return 0;
+}
@@ -0,0 +1,398 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Saves snapshots out of the RAM shadow of ramshadow.cpp and checks them
+// against the machine they were taken from.
+//
+// The host Z80 of zxmachine.h runs the 48K ROM from reset until its RAM test
+// wrote every byte, which has to leave the whole shadow valid and equal to
+// the RAM. Then a program keeps rewriting the lower RAM while snapshot_save()
+// is asked for now and then with random registers. core0 only gets to run
+// snapshot_task() every --task-us, like in a busy main loop.
+//
+// Every .SNA written to DIR must hold the registers and the RAM the Z80 had
+// at the NMI, the stub must hand the program back with nothing changed, and
+// the last snapshot must load back through snapshot_load().
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "mailbox.h"
+#include "posixfs.h"
+#include "ramshadow.h"
+#include "rombank.h"
+#include "sim.h"
+#include "snapshot.h"
+#include "zpi.h"
+#include "zx.h"
+#include "zxmachine.h"
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int SnoopSm = 2;
+constexpr uint32_t SnaSize = 27 + RamShadowSize;
+constexpr double PageInT = 16;  // T states a byte of the ZPI page transfer, unrolled INI
+
+struct Options
+{
+    const char *dir = nullptr;
+    uint32_t seed = 1;
+    uint32_t saves = 8;
+    uint32_t taskUs = 100;      // core0 runs snapshot_task() this often
+    double sysMHz = 150;
+    double zxMHz = 3.5469;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+// rewrites 0x4000..0x7fff for ever, after setting the border
+constexpr uint16_t ProgramAddr = 0x8000;
+constexpr uint8_t Program[] = {
+    0x3e, 0x02,         // ld a, 2
+    0xd3, 0xfe,         // out (0xfe), a
+    0x21, 0x00, 0x40,   // ld hl, 0x4000
+    0x7e,               // loop: ld a, (hl)
+    0x85,               // add a, l
+    0xac,               // xor h
+    0x77,               // ld (hl), a
+    0x23,               // inc hl
+    0x7c,               // ld a, h
+    0xfe, 0x80,         // cp 0x80
+    0x38, 0xf6,         // jr c, loop
+    0x26, 0x40,         // ld h, 0x40
+    0x18, 0xf2,         // jr loop
+};
+
+int Failures = 0;
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+// a byte the Z80 writes, through the snoop like any other
+void poke(ZxMachine &m, uint16_t addr, uint8_t value)
+{
+    *m.ram(addr) = value;
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE) | value;
+    bus &= ~((1u << I_MREQ_L) | (1u << I_WR_L));
+    sim::pio_rx_push(SnoopSm, bus | 1u << I_ZXRDWR);
+    zx_poll();
+}
+
+struct Machine
+{
+    Snapshot regs;
+    uint8_t ram[RamShadowSize];
+};
+
+Machine state_of(ZxMachine &m)
+{
+    Machine s;
+    s.regs.af = m.af;
+    s.regs.bc = m.bc;
+    s.regs.de = m.de;
+    s.regs.hl = m.hl;
+    s.regs.af2 = m.af2;
+    s.regs.bc2 = m.bc2;
+    s.regs.de2 = m.de2;
+    s.regs.hl2 = m.hl2;
+    s.regs.ix = m.ix;
+    s.regs.iy = m.iy;
+    s.regs.sp = m.sp;
+    s.regs.pc = m.pc;
+    s.regs.i = m.i;
+    s.regs.r = m.r;
+    s.regs.im = m.im;
+    s.regs.iff1 = m.iff1;
+    s.regs.iff2 = m.iff2;
+    s.regs.border = m.border;
+    for (uint32_t i = 0; i < RamShadowSize; ++i)
+        s.ram[i] = *m.ram(RamShadowBase + i);
+    return s;
+}
+
+// the registers both ways, the ones the program runs on only
+bool same_registers(const ZxMachine &m, const Snapshot &s)
+{
+    return m.af == s.af && m.bc == s.bc && m.de == s.de && m.hl == s.hl && m.af2 == s.af2 && m.bc2 == s.bc2
+           && m.de2 == s.de2 && m.hl2 == s.hl2 && m.ix == s.ix && m.iy == s.iy && m.sp == s.sp && m.pc == s.pc
+           && m.i == s.i && m.iff1 == s.iff1 && m.iff2 == s.iff2;
+}
+
+uint16_t word(const uint8_t *data)
+{
+    return data[0] | data[1] << 8;
+}
+
+// the .SNA against the machine at the NMI: the PC pushed on its stack, the
+// bytes below that are the stub's
+bool same_sna(const std::vector<uint8_t> &sna, const Machine &at)
+{
+    if (sna.size() != SnaSize)
+        return false;
+    const Snapshot &s = at.regs;
+    const uint8_t *h = sna.data();
+    const uint16_t sp = s.sp - 2;
+    if (h[0] != s.i || word(h + 1) != s.hl2 || word(h + 3) != s.de2 || word(h + 5) != s.bc2 || word(h + 7) != s.af2
+        || word(h + 9) != s.hl || word(h + 11) != s.de || word(h + 13) != s.bc || word(h + 15) != s.iy
+        || word(h + 17) != s.ix || h[19] != (s.iff2 ? 4 : 0) || h[20] != s.r || word(h + 21) != s.af
+        || word(h + 23) != sp || h[25] != s.im || h[26] != s.border) {
+        return false;
+    }
+    const uint8_t *ram = h + 27;
+    if (word(ram + sp - RamShadowBase) != s.pc)
+        return false;
+    for (uint32_t i = 0; i < RamShadowSize; ++i) {
+        const uint16_t addr = RamShadowBase + i;
+        if (addr >= uint16_t(sp - 6) && addr < sp + 2)
+            continue;
+        if (ram[i] != at.ram[i])
+            return false;
+    }
+    return true;
+}
+
+std::vector<uint8_t> read_file(const std::string &path)
+{
+    std::vector<uint8_t> data;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f)
+        return data;
+    int c;
+    while ((c = fgetc(f)) != EOF)
+        data.push_back(c);
+    fclose(f);
+    return data;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options] DIR\n"
+           "  --seed N          registers and save points (default 1)\n"
+           "  --saves N         snapshots to save (default 8)\n"
+           "  --task-us N       core0 runs snapshot_task() every N us (default 100)\n"
+           "  --sys-clock MHZ   Pico clock (default 150)\n"
+           "  --zx-clock MHZ    Z80 clock (default 3.5469)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--saves")
+            opts.saves = strtoul(value(), nullptr, 0);
+        else if (arg == "--task-us")
+            opts.taskUs = strtoul(value(), nullptr, 0);
+        else if (arg == "--sys-clock")
+            opts.sysMHz = atof(value());
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg[0] != '-' && !opts.dir)
+            opts.dir = argv[i];
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.dir && opts.saves;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    sim::pio_reset();
+    rombank_select(rombank_add(BuiltinRoms[0]));
+    zpi_init(nullptr);
+    zx_init();
+    PosixFileSystem fs(opts.dir);
+    std::vector<std::string> old;
+    uint32_t cursor = 0;
+    FsEntry entry;
+    while (fs.list(cursor, entry)) {
+        if (!strncmp(entry.name, "SNAP", 4))
+            old.push_back(entry.name);
+    }
+    for (const std::string &name : old)
+        fs.remove(name.c_str());
+
+    static ZxMachine m;
+    m.reset(false);
+    check("nothing seen at power on", !ramshadow_valid(RamShadowBase, RamShadowSize));
+    check("no save before the RAM is seen", !snapshot_save(fs) && !snapshot_busy());
+
+    // the clock follows the Z80
+    const double cyclesPerT = opts.sysMHz / opts.zxMHz;
+    auto step = [&]() {
+        if (!m.step()) {
+            printf("FAIL: unknown instruction at %04x\n", m.pc);
+            exit(1);
+        }
+        sim::Cycles = std::max(sim::Cycles, uint64_t(m.tstates * cyclesPerT));
+        MailMessage message;
+        while (mailbox_fetch(MailToCore0, message)) {
+        }
+    };
+
+    // the ROM's RAM test
+    while (!ramshadow_valid(RamShadowBase, RamShadowSize) && m.tstates < 20 * 3546900)
+        step();
+    const double testMs = m.tstates / opts.zxMHz / 1000;
+    check("the ROM wrote all of the RAM", ramshadow_valid(RamShadowBase, RamShadowSize));
+    bool same = true;
+    for (uint32_t i = 0; i < RamShadowSize; ++i)
+        same &= RamShadow[i] == *m.ram(RamShadowBase + i);
+    check("the shadow is the RAM", same);
+
+    for (uint32_t i = 0; i < sizeof(Program); ++i)
+        poke(m, ProgramAddr + i, Program[i]);
+    m.pc = ProgramAddr;
+
+    Rng rng{opts.seed};
+    const uint64_t taskCycles = uint64_t(opts.taskUs) * 150;
+    uint64_t worstStubT = 0;
+    uint32_t worstStoppedUs = 0;
+    uint32_t wrongFile = 0;
+    uint32_t wrongResume = 0;
+    Machine *at = new Machine;
+    std::string lastName;
+    for (uint32_t save = 0; save < opts.saves; ++save) {
+        for (uint32_t i = 1000 + rng.next() % 50000; i; --i)
+            step();
+
+        // what the program does not use is random, IM 2 with I in the RAM
+        m.bc = rng.next();
+        m.de = rng.next();
+        m.ix = rng.next();
+        m.iy = rng.next();
+        m.af2 = rng.next();
+        m.bc2 = rng.next();
+        m.de2 = rng.next();
+        m.hl2 = rng.next();
+        m.sp = 0xfe00 - rng.next() % 0x100 * 2;
+        m.r = rng.next();
+        m.iff1 = m.iff2 = rng.next() & 1;
+        m.im = rng.next() & 1 ? 2 : 1;
+        m.i = m.im == 2 ? 0x80 | (rng.next() & 0x7f) : 0x3f;
+        *at = state_of(m);
+
+        check("save accepted", snapshot_save(fs));
+        const uint64_t nmiT = m.tstates;
+        m.nmi();
+        uint64_t nextTask = sim::Cycles + taskCycles;
+        bool returned = false;
+        for (uint64_t steps = 0; snapshot_busy(); ++steps) {
+            if (steps > 1000000) {
+                printf("FAIL: the save stub is stuck at %04x\n", m.pc);
+                return 1;
+            }
+            step();
+            // the stub runs in the ROM range, the program in the RAM
+            if (!returned && m.pc >= RamShadowBase) {
+                returned = true;
+                worstStubT = std::max(worstStubT, m.tstates - nmiT);
+                wrongResume += !same_registers(m, at->regs);
+            }
+            if (sim::Cycles >= nextTask) {
+                snapshot_task();
+                nextTask = sim::Cycles + taskCycles;
+            }
+        }
+        worstStoppedUs = std::max(worstStoppedUs, snapshot_stats().lastUs);
+
+        char name[20];
+        snprintf(name, sizeof(name), "SNAP%04u.SNA", save);
+        lastName = name;
+        wrongFile += !same_sna(read_file(std::string(opts.dir) + "/" + name), *at);
+    }
+    check("every .SNA is the machine at the NMI", !wrongFile);
+    check("the program resumes unchanged", !wrongResume);
+    check("every save counted", snapshot_stats().saves == opts.saves && !snapshot_stats().failures);
+
+    // and back in, through the loader
+    const Snapshot saved = at->regs;
+    m.reset(false);
+    check("load", snapshot_load(fs, lastName.c_str()));
+    m.nmi();
+    for (uint64_t steps = 0; snapshot_busy(); ++steps) {
+        if (steps > 10000000) {
+            printf("FAIL: loader stuck at %04x\n", m.pc);
+            return 1;
+        }
+        step();
+        snapshot_task();
+    }
+    check("loaded back with the registers saved", same_registers(m, saved) && m.r == saved.r && m.im == saved.im);
+    same = true;
+    for (uint32_t i = 0; i < RamShadowSize; ++i) {
+        const uint16_t addr = RamShadowBase + i;
+        if (addr < uint16_t(saved.sp - 8) || addr >= saved.sp)
+            same &= *m.ram(addr) == at->ram[i];
+    }
+    check("loaded back with the RAM saved", same);
+    delete at;
+
+    const double transferMs = RamShadowSize * PageInT / opts.zxMHz / 1000;
+    printf("ROM RAM test fills the shadow in %.0f ms of Z80 time\n", testMs);
+    printf("%u saves, the Z80 stopped %" PRIu64 " T states (%u us) at worst\n", opts.saves, worstStubT,
+           worstStoppedUs);
+    if (Failures) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: every snapshot byte exact, the Z80 stopped %.2f ms instead of %.0f ms for the RAM over port 3\n",
+           worstStoppedUs / 1000.0, transferMs);
+    return 0;
+}
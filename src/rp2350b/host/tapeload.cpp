@@ -0,0 +1,468 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Flash loads synthetic .TAP files through the LD-BYTES trap of tape.cpp and
+// checks them against the real thing.
+//
+// Every LD-BYTES call runs twice. The flash run is a ZxMachine on the IFp
+// bus: the fetch of 0x0556 pages in the routine of tape.cpp, the tape is a
+// file in the given directory. The reference run is a plain Z80 executing the
+// 48K ROM against the EAR pulses of the same tape, standard ROM timings. Both
+// must leave the same A, F, BC, DE, H, L, IX and RAM.
+// The T states of both runs give the speedup, a 40K block is flash loaded on
+// its own for the sustained rate.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "posixfs.h"
+#include "rombank.h"
+#include "sim.h"
+#include "tape.h"
+#include "zpi.h"
+#include "zx.h"
+#include "zxmachine.h"
+
+extern const unsigned char __48_rom[];
+
+namespace {
+
+constexpr uint16_t LdBytes = 0x0556;
+constexpr uint16_t ReturnAddr = 0xfff0;
+constexpr uint16_t StackTop = 0xff00;
+
+// ROM saving timings, T states
+constexpr uint32_t PilotPulse = 2168;
+constexpr uint32_t HeaderPilots = 8063;
+constexpr uint32_t DataPilots = 3223;
+constexpr uint32_t Sync1 = 667;
+constexpr uint32_t Sync2 = 735;
+constexpr uint32_t ZeroPulse = 855;
+constexpr uint32_t OnePulse = 1710;
+constexpr uint32_t Pause = 3500000;
+
+struct Options
+{
+    const char *dir = nullptr;
+    uint32_t seed = 1;
+    double zxMHz = 3.5469;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+// --- the tape ---------------------------------------------------------------
+
+struct Block
+{
+    uint8_t flag;
+    std::vector<uint8_t> data;
+    bool badChecksum = false;
+};
+
+std::vector<uint8_t> make_tap(const std::vector<Block> &blocks)
+{
+    std::vector<uint8_t> tap;
+    for (const Block &block : blocks) {
+        const uint32_t length = block.data.size() + 2;
+        tap.push_back(length);
+        tap.push_back(length >> 8);
+        tap.push_back(block.flag);
+        uint8_t checksum = block.flag;
+        for (uint8_t value : block.data)
+            checksum ^= value;
+        tap.insert(tap.end(), block.data.begin(), block.data.end());
+        tap.push_back(block.badChecksum ? ~checksum : checksum);
+    }
+    return tap;
+}
+
+// the pulses the ROM SAVE routine would write, the EAR level flips at the end
+// of each one
+std::vector<uint32_t> make_pulses(const std::vector<uint8_t> &tap)
+{
+    std::vector<uint32_t> pulses;
+    for (uint32_t pos = 0; pos + 2 < tap.size();) {
+        const uint32_t length = tap[pos] | tap[pos + 1] << 8;
+        const uint8_t *block = &tap[pos + 2];
+        pos += 2 + length;
+        pulses.insert(pulses.end(), block[0] < 0x80 ? HeaderPilots : DataPilots, PilotPulse);
+        pulses.push_back(Sync1);
+        pulses.push_back(Sync2);
+        for (uint32_t i = 0; i < length; ++i) {
+            for (int bit = 7; bit >= 0; --bit) {
+                const uint32_t pulse = (block[i] >> bit) & 1 ? OnePulse : ZeroPulse;
+                pulses.push_back(pulse);
+                pulses.push_back(pulse);
+            }
+        }
+        pulses.push_back(Pause);
+    }
+    return pulses;
+}
+
+// --- the reference: the 48K ROM reading EAR ---------------------------------
+
+class Deck : public Z80
+{
+public:
+    void reset(const std::vector<uint8_t> &tap)
+    {
+        Z80::reset();
+        memcpy(memory, __48_rom, RomBankSize);
+        memset(memory + RomBankSize, 0x55, sizeof(memory) - RomBankSize);
+        m_pulses = make_pulses(tap);
+        m_next = 0;
+        m_edge = Pause;
+        m_ear = false;
+    }
+
+    // the tape played to its end more than t T states ago
+    bool silent(uint64_t t) const { return m_next == m_pulses.size() && tstates > m_edge + t; }
+
+    uint8_t read(uint16_t addr) override { return memory[addr]; }
+    void write(uint16_t addr, uint8_t data) override
+    {
+        if (addr >= RomBankSize)
+            memory[addr] = data;
+    }
+    uint8_t in(uint16_t port) override
+    {
+        if (port & 1)
+            return 0xff;
+        while (m_next < m_pulses.size() && tstates >= m_edge) {
+            m_ear = !m_ear;
+            m_edge += m_pulses[m_next++];
+        }
+        // no key pressed, EAR on bit 6
+        return m_ear ? 0xff : 0xbf;
+    }
+    void out(uint16_t, uint8_t) override {}
+
+    uint8_t memory[0x10000];
+
+private:
+    std::vector<uint32_t> m_pulses;
+    size_t m_next = 0;
+    uint64_t m_edge = 0;
+    bool m_ear = false;
+};
+
+// --- the test ---------------------------------------------------------------
+
+struct Call
+{
+    uint8_t flag;
+    bool load;
+    uint16_t length;
+    uint16_t dest;
+};
+
+struct Case
+{
+    const char *name;
+    std::vector<Block> blocks;
+    std::vector<Call> calls;
+    // RAM the VERIFY calls compare against, at each call's dest
+    std::vector<std::vector<uint8_t>> ram;
+};
+
+// a call of LD-BYTES returning to ReturnAddr
+template <typename Machine>
+void enter(Machine &z, const Call &call)
+{
+    z.af = call.flag << 8 | (call.load ? 0x01 : 0x00);
+    z.de = call.length;
+    z.ix = call.dest;
+    z.sp = StackTop - 2;
+    z.write(z.sp, ReturnAddr & 0xff);
+    z.write(z.sp + 1, ReturnAddr >> 8);
+    z.pc = LdBytes;
+}
+
+// runs the calls on both machines, compares after each one
+bool run(const Options &opts, const Case &c, PosixFileSystem &fs)
+{
+    static ZxMachine m;
+    static Deck d;
+    const std::vector<uint8_t> tap = make_tap(c.blocks);
+    const std::string path = std::string(opts.dir) + "/TEST.TAP";
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f || fwrite(tap.data(), 1, tap.size(), f) != tap.size()) {
+        perror(path.c_str());
+        exit(2);
+    }
+    fclose(f);
+    tape_mount(fs, "TEST.TAP");
+
+    m.reset(false);
+    d.reset(tap);
+    int bad = 0;
+    uint64_t flashT = 0;
+    uint64_t tapeT = 0;
+    for (size_t k = 0; k < c.calls.size(); ++k) {
+        const Call &call = c.calls[k];
+        if (k < c.ram.size()) {
+            for (size_t i = 0; i < c.ram[k].size(); ++i) {
+                *m.ram(call.dest + i) = c.ram[k][i];
+                d.memory[uint16_t(call.dest + i)] = c.ram[k][i];
+            }
+        }
+
+        // flash: the clock follows the Z80
+        enter(m, call);
+        const uint64_t startT = m.tstates;
+        const uint64_t startCycles = sim::Cycles;
+        const double cyclesPerT = 150 / opts.zxMHz;
+        tape_task();
+        while (m.pc != ReturnAddr) {
+            if (!m.step() || m.tstates - startT > 100000000) {
+                printf("%-14s FAIL: flash load stuck at %04x\n", c.name, m.pc);
+                return false;
+            }
+            sim::Cycles = std::max(sim::Cycles, startCycles + uint64_t((m.tstates - startT) * cyclesPerT));
+            zpi_task();
+            tape_task();
+        }
+        flashT += m.tstates - startT;
+        for (int i = 0; i < 4; ++i) {
+            zpi_task();
+            tape_task();
+        }
+
+        // reference
+        enter(d, call);
+        const uint64_t deckT = d.tstates;
+        while (d.pc != ReturnAddr) {
+            if (!d.step() || d.silent(Pause)) {
+                printf("%-14s FAIL: ROM load stuck at %04x\n", c.name, d.pc);
+                return false;
+            }
+        }
+        tapeT += d.tstates - deckT;
+
+        auto check = [&](const char *what, uint32_t got, uint32_t want) {
+            if (got == want)
+                return;
+            printf("  call %zu: %s is %04x, the ROM leaves %04x\n", k + 1, what, got, want);
+            ++bad;
+        };
+        check("A", m.a(), d.a());
+        check("F", m.f(), d.f());
+        check("BC", m.bc, d.bc);
+        check("DE", m.de, d.de);
+        check("HL", m.hl, d.hl);
+        check("IX", m.ix, d.ix);
+        check("SP", m.sp, d.sp);
+        check("IFF1", m.iff1, d.iff1);
+        for (uint32_t addr = RomBankSize; addr < StackTop - 0x100; ++addr) {
+            if (*m.ram(addr) != d.memory[addr]) {
+                printf("  call %zu: RAM differs from %04x\n", k + 1, addr);
+                ++bad;
+                break;
+            }
+        }
+    }
+    if (m.undriven) {
+        printf("  %u ROM reads were not driven\n", m.undriven);
+        ++bad;
+    }
+    printf("%-14s %s: %2zu calls, %8" PRIu64 " T states flash, %10" PRIu64 " T states tape, x%.0f\n", c.name,
+           bad ? "FAIL" : "OK  ", c.calls.size(), flashT, tapeT, flashT ? double(tapeT) / flashT : 0.0);
+    return !bad;
+}
+
+// a 40K block alone, for the sustained rate
+bool run_big(const Options &opts, Rng &rng, PosixFileSystem &fs)
+{
+    static ZxMachine m;
+    Block block{0xff, std::vector<uint8_t>(40000)};
+    for (uint8_t &value : block.data)
+        value = rng.next();
+    const std::vector<uint8_t> tap = make_tap({block});
+    const std::string path = std::string(opts.dir) + "/BIG.TAP";
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f || fwrite(tap.data(), 1, tap.size(), f) != tap.size()) {
+        perror(path.c_str());
+        exit(2);
+    }
+    fclose(f);
+    tape_mount(fs, "BIG.TAP");
+
+    m.reset(false);
+    const Call call{0xff, true, uint16_t(block.data.size()), 0x6000};
+    enter(m, call);
+    const uint64_t startCycles = sim::Cycles;
+    const double cyclesPerT = 150 / opts.zxMHz;
+    tape_task();
+    while (m.pc != ReturnAddr) {
+        if (!m.step() || m.tstates > 100000000) {
+            printf("%-14s FAIL: flash load stuck at %04x\n", "40K block", m.pc);
+            return false;
+        }
+        sim::Cycles = std::max(sim::Cycles, startCycles + uint64_t(m.tstates * cyclesPerT));
+        zpi_task();
+        tape_task();
+    }
+    for (int i = 0; i < 4; ++i) {
+        zpi_task();
+        tape_task();
+    }
+
+    bool ok = (m.f() & 0x01) && m.de == 0 && m.ix == call.dest + block.data.size();
+    for (uint32_t i = 0; i < block.data.size(); ++i)
+        ok &= *m.ram(call.dest + i) == block.data[i];
+    const TapeStats &stats = tape_stats();
+    printf("%-14s %s: %zu bytes, %8" PRIu64 " T states, %6.1f ms measured, %4.0f KB/s\n", "40K block",
+           ok ? "OK  " : "FAIL", block.data.size(), m.tstates, stats.lastZxUs / 1000.0,
+           stats.lastZxUs ? block.data.size() * 1000.0 / stats.lastZxUs : 0.0);
+    return ok;
+}
+
+std::vector<uint8_t> random_data(Rng &rng, uint32_t size)
+{
+    std::vector<uint8_t> data(size);
+    for (uint8_t &value : data)
+        value = rng.next();
+    return data;
+}
+
+// a 17 byte header of a CODE block
+std::vector<uint8_t> code_header(const char *name, uint16_t length, uint16_t start)
+{
+    std::vector<uint8_t> header(17, ' ');
+    header[0] = 3;
+    memcpy(&header[1], name, std::min<size_t>(strlen(name), 10));
+    header[11] = length;
+    header[12] = length >> 8;
+    header[13] = start;
+    header[14] = start >> 8;
+    header[15] = 0;
+    header[16] = 0x80;
+    return header;
+}
+
+std::vector<Case> make_cases(Rng &rng)
+{
+    std::vector<Case> cases;
+    const std::vector<uint8_t> screen = random_data(rng, 6912);
+    const std::vector<uint8_t> code = random_data(rng, 2000);
+    cases.push_back({"program",
+                     {{0x00, code_header("screen", 6912, 0x4000)},
+                      {0xff, screen},
+                      {0x00, code_header("code", 2000, 0x8000)},
+                      {0xff, code}},
+                     {{0x00, true, 17, 0xf000}, {0xff, true, 6912, 0x4000}, {0x00, true, 17, 0xf000},
+                      {0xff, true, 2000, 0x8000}},
+                     {}});
+
+    cases.push_back({"wrong flag", {{0x00, code_header("code", 300, 0x8000)}}, {{0xff, true, 300, 0x8000}}, {}});
+    cases.push_back({"verify flag", {{0x00, code_header("code", 300, 0x8000)}}, {{0xff, false, 300, 0x8000}}, {}});
+
+    const std::vector<uint8_t> block = random_data(rng, 500);
+    cases.push_back({"short block", {{0xff, block}}, {{0xff, true, 800, 0x8000}}, {}});
+    cases.push_back({"long block", {{0xff, block}}, {{0xff, true, 300, 0x8000}}, {}});
+    cases.push_back({"bad checksum", {{0xff, block, true}}, {{0xff, true, 500, 0x8000}}, {}});
+    cases.push_back({"verify", {{0xff, block}}, {{0xff, false, 500, 0x8000}}, {block}});
+
+    std::vector<uint8_t> changed = block;
+    changed[321] ^= 0x10;
+    cases.push_back({"verify fail", {{0xff, block}, {0xff, code}},
+                     {{0xff, false, 500, 0x8000}, {0xff, true, 2000, 0x9000}}, {changed}});
+    return cases;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options] dir\n"
+           "  --seed N         seed of the synthetic tapes (default 1)\n"
+           "  --zx-clock MHZ   Z80 clock (default 3.5469)\n"
+           "The synthetic tapes are written to dir as TEST.TAP and BIG.TAP.\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg[0] != '-' && !opts.dir)
+            opts.dir = argv[i];
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.dir;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    sim::pio_reset();
+    static const RomImage rom48{"48K", RomModel::Zx48, __48_rom, RomBankSize};
+    rombank_select(rombank_add(&rom48));
+    zpi_init(nullptr);
+    zx_init();
+    PosixFileSystem fs(opts.dir);
+
+    Rng rng{opts.seed};
+    bool ok = true;
+    for (const Case &c : make_cases(rng))
+        ok &= run(opts, c, fs);
+    ok &= run_big(opts, rng, fs);
+    tape_eject();
+    if (!ok) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK\n");
+    return 0;
+}
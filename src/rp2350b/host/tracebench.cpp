@@ -0,0 +1,343 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Streams a bus trace of the 48K ROM booting through a link of --link-kbs.
+//
+// A ZxMachine runs the ROM from reset with the trace on, core0 calls
+// trace_task() every --loop-us and the link takes --link-kbs worth of bytes
+// each time, about what a full speed USB CDC does. The stream is then decoded
+// and checked against the words the Z80 put on the bus: every decoded word in
+// order, the dropped counters accounting for the rest, frame numbers and cycle
+// stamps in sequence. Runs every filter, or the one given.
+//
+// The bus has every MREQ cycle on it, RAM reads, writes and the refresh of each
+// opcode fetch included, so every filter must pass words. The instructions the
+// Z80 ran are printed: zxtrace --instructions checks that a capture written
+// with --out decodes to as many, M1 found by the refresh cycles.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "rombank.h"
+#include "sim.h"
+#include "trace.h"
+#include "tracefile.h"
+#include "zpi.h"
+#include "zx.h"
+#include "zxmachine.h"
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr uint32_t CyclesPerUs = 150;
+constexpr uint32_t FrameT = 69888;
+
+struct Options
+{
+    int filter = 0;             // 0 for all of them
+    uint32_t frames = 25;       // Spectrum frames to run
+    uint32_t loopUs = 20;
+    uint32_t linkKBs = 1000;
+    double zxMHz = 3.5469;
+    const char *out = nullptr;  // keeps the stream of the last filter run
+};
+
+// the words the bus saw, as zxmachine.cpp builds them
+class Recorder : public ZxMachine
+{
+public:
+    uint8_t read(uint16_t addr) override
+    {
+        words.push_back(word(addr, (1u << I_MREQ_L) | (1u << I_RD_L), 0));
+        return ZxMachine::read(addr);
+    }
+
+    void write(uint16_t addr, uint8_t data) override
+    {
+        // sampled before /WR goes low
+        words.push_back(word(addr, 1u << I_MREQ_L, data) & ~(1u << I_ZXRDWR));
+        ++writes;
+        ZxMachine::write(addr, data);
+    }
+
+    void refresh(uint16_t addr) override
+    {
+        words.push_back(word(addr, 1u << I_MREQ_L, 0) & ~(1u << I_ZXRDWR));
+        ++refreshes;
+        ZxMachine::refresh(addr);
+    }
+
+    uint8_t in(uint16_t port) override
+    {
+        words.push_back(word(port, (1u << I_IORQ_L) | (1u << I_RD_L), 0));
+        return ZxMachine::in(port);
+    }
+
+    void out(uint16_t port, uint8_t data) override
+    {
+        words.push_back(word(port, (1u << I_IORQ_L) | (1u << I_WR_L), data));
+        ZxMachine::out(port, data);
+    }
+
+    std::vector<uint32_t> words;
+    uint64_t writes = 0;
+    uint64_t refreshes = 0;
+
+private:
+    static uint32_t word(uint16_t addr, uint32_t active, uint8_t data)
+    {
+        return ((ControlIdle | uint32_t(addr) << I_ADDR_BASE) & ~active) | (1u << I_ZXRDWR) | data;
+    }
+};
+
+// the link: what the loop budget lets through ends up in Stream
+std::vector<uint8_t> Stream;
+uint32_t Budget = 0;
+
+uint32_t link_space()
+{
+    return Budget;
+}
+
+void link_write(const uint8_t *data, uint32_t size)
+{
+    Stream.insert(Stream.end(), data, data + size);
+    Budget -= size;
+}
+
+const TraceSink Link{link_space, link_write};
+
+struct Decoded
+{
+    std::vector<uint32_t> words;
+    uint64_t frames = 0;
+    uint64_t bad = 0;       // failed the check or out of sequence
+    uint64_t dropped = 0;
+    bool ended = false;
+    bool stampsInOrder = true;
+};
+
+Decoded decode(const std::vector<uint8_t> &stream)
+{
+    Decoded d;
+    TraceReader reader(stream.data(), stream.size(), false);
+    TraceWord word;
+    uint32_t lastCycles = 0;
+    while (reader.next(word)) {
+        if (d.words.size() && int32_t(word.cycles - lastCycles) < 0)
+            d.stampsInOrder = false;
+        lastCycles = word.cycles;
+        d.words.push_back(word.bus);
+    }
+    d.frames = reader.frames();
+    d.bad = reader.badFrames() + (reader.traces() != 1);
+    d.dropped = reader.dropped();
+    d.ended = reader.ended();
+    return d;
+}
+
+struct Result
+{
+    uint64_t busWords = 0;  // passing the filter
+    Decoded decoded;
+    uint64_t bytes = 0;
+    uint64_t instructions = 0;
+    uint64_t writes = 0;
+    uint64_t refreshes = 0;
+    bool ok = false;
+};
+
+Result run(const Options &opts, int filter)
+{
+    Stream.clear();
+    static Recorder m;
+    m.reset(false);
+    m.words.clear();
+    m.writes = m.refreshes = 0;
+
+    const uint32_t loopBytes = uint64_t(opts.linkKBs) * 1000 * opts.loopUs / 1000000;
+    const double cyclesPerT = CyclesPerUs / opts.zxMHz;
+    const uint64_t end = uint64_t(opts.frames) * FrameT;
+    const uint64_t start = sim::Cycles;
+    uint64_t core0 = 0;
+    uint64_t instructions = 0;
+    trace_request(filter);
+    trace_task();
+    while (m.tstates < end) {
+        if (sim::Cycles >= core0) {
+            Budget = loopBytes;
+            trace_task();
+            core0 = sim::Cycles + opts.loopUs * CyclesPerUs;
+        }
+        if (!m.step()) {
+            fprintf(stderr, "unknown instruction at %04x\n", m.pc);
+            break;
+        }
+        ++instructions;
+        sim::Cycles = std::max(sim::Cycles, start + uint64_t(m.tstates * cyclesPerT));
+    }
+    trace_request(0);
+    for (int loop = 0; loop < 10000; ++loop) {
+        Budget = loopBytes;
+        trace_task();
+    }
+
+    Result r;
+    r.instructions = instructions;
+    r.writes = m.writes;
+    r.refreshes = m.refreshes;
+    const TraceFilter &f = TraceFilters[filter];
+    std::vector<uint32_t> expected;
+    for (const uint32_t word : m.words) {
+        if ((word & f.mask) == f.match)
+            expected.push_back(word);
+    }
+    r.busWords = expected.size();
+    r.decoded = decode(Stream);
+    r.bytes = Stream.size();
+
+    // the decoded words are the bus ones in order, with dropped ones missing
+    size_t at = 0;
+    bool subsequence = true;
+    for (const uint32_t word : r.decoded.words) {
+        while (at < expected.size() && expected[at] != word)
+            ++at;
+        if (at++ == expected.size()) {
+            subsequence = false;
+            break;
+        }
+    }
+    const Decoded &d = r.decoded;
+    // every filter has words to pass, the write one included
+    r.ok = subsequence && d.ended && !d.bad && d.stampsInOrder && d.words.size() + d.dropped == expected.size()
+           && !expected.empty();
+    if (!r.ok)
+        printf("%s: %s%s%s%" PRIu64 " bad frames, %zu + %" PRIu64 " dropped of %zu\n", f.name, subsequence ? "" : "out of order, ",
+               d.ended ? "" : "no last frame, ", d.stampsInOrder ? "" : "stamps out of order, ", d.bad,
+               d.words.size(), d.dropped, expected.size());
+    return r;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --filter N       trace filter, see trace.h (default: each of them)\n"
+           "  --frames N       Spectrum frames to run (default 25)\n"
+           "  --loop-us N      core0 main loop period (default 20)\n"
+           "  --link-kbs N     link throughput in KB/s (default 1000)\n"
+           "  --zx-clock MHZ   Z80 clock (default 3.5469)\n"
+           "  --out FILE       write the stream of the last filter to FILE, for zxtrace\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--filter")
+            opts.filter = strtol(value(), nullptr, 0);
+        else if (arg == "--frames")
+            opts.frames = strtoul(value(), nullptr, 0);
+        else if (arg == "--loop-us")
+            opts.loopUs = std::max(1ul, strtoul(value(), nullptr, 0));
+        else if (arg == "--link-kbs")
+            opts.linkKBs = strtoul(value(), nullptr, 0);
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--out")
+            opts.out = value();
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.filter >= 0 && opts.filter < TraceFilterCount;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    const double seconds = double(opts.frames) * FrameT / (opts.zxMHz * 1e6);
+    printf("48K ROM from reset for %.2f s, link %u KB/s, core0 loop %u us, ring %u words\n\n", seconds,
+           opts.linkKBs, opts.loopUs, TraceEntries);
+    printf("%-8s %10s %10s %8s %8s %10s %8s\n", "filter", "bus words", "sent", "dropped", "frames", "bytes",
+           "B/word");
+
+    sim::pio_reset();
+    rombank_select(rombank_add(BuiltinRoms[0]));
+    zpi_init(nullptr);
+    zx_init();
+    trace_init(&Link);
+
+    bool ok = true;
+    Result r;
+    for (int filter = 1; filter < TraceFilterCount; ++filter) {
+        if (opts.filter && filter != opts.filter)
+            continue;
+        r = run(opts, filter);
+        const Decoded &d = r.decoded;
+        printf("%-8s %10" PRIu64 " %10zu %7.1f%% %8" PRIu64 " %10" PRIu64 " %8.2f\n", TraceFilters[filter].name,
+               r.busWords, d.words.size(), r.busWords ? 100.0 * d.dropped / r.busWords : 0.0, d.frames, r.bytes,
+               d.words.size() ? double(r.bytes) / d.words.size() : 0.0);
+        ok &= r.ok;
+    }
+
+    // the RAM writes and the refresh cycle of every opcode fetch are on the
+    // bus too, zxtrace finds M1 by the latter
+    printf("\n%" PRIu64 " instructions, %" PRIu64 " MREQ writes, %" PRIu64 " refresh cycles\n", r.instructions,
+           r.writes, r.refreshes);
+    ok &= r.writes && r.refreshes >= r.instructions;
+
+    if (opts.out) {
+        FILE *f = fopen(opts.out, "wb");
+        if (!f || fwrite(Stream.data(), 1, Stream.size(), f) != Stream.size()) {
+            perror(opts.out);
+            ok = false;
+        }
+        if (f)
+            fclose(f);
+    }
+
+    if (!ok) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: every trace decodes to the bus words, drops accounted\n");
+    return 0;
+}
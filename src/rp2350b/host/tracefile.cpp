@@ -0,0 +1,168 @@
+#include "tracefile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+
+#include "trace.h"
+
+namespace {
+
+constexpr size_t ProbeSize = 64 * 1024;
+
+uint32_t get16(const uint8_t *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+uint32_t get32(const uint8_t *p)
+{
+    return get16(p) | get16(p + 2) << 16;
+}
+
+// the payload size of a frame header at p that checks out, -1 otherwise
+long frame_at(const uint8_t *p, const uint8_t *end)
+{
+    if (end - p < long(TraceHeaderSize) || get32(p) != TraceMagic)
+        return -1;
+    const uint32_t bytes = get16(p + 6);
+    if (end - p - TraceHeaderSize < bytes)
+        return -1;
+    if (trace_check(p + TraceHeaderSize, bytes) != get16(p + 18))
+        return -1;
+    // the smallest entry is a byte of delta and the word
+    const uint32_t entries = get16(p + 4);
+    if (entries > TraceFrameEntries || bytes < entries * 5 || bytes > entries * 9)
+        return -1;
+    return bytes;
+}
+
+} // namespace
+
+MappedFile::MappedFile(const char *path)
+{
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        perror(path);
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            madvise(data, st.st_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const uint8_t *>(data);
+            m_size = st.st_size;
+        } else {
+            perror(path);
+        }
+    }
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+        munmap(const_cast<uint8_t *>(m_data), m_size);
+}
+
+TraceReader::TraceReader(const uint8_t *data, size_t size, bool raw)
+    : m_pos(data)
+    , m_end(data + size)
+    , m_raw(raw)
+{}
+
+bool TraceReader::nextFrame()
+{
+    while (m_pos < m_end) {
+        const long bytes = frame_at(m_pos, m_end);
+        if (bytes < 0) {
+            if (get32(m_pos) == TraceMagic && m_end - m_pos >= long(TraceHeaderSize))
+                ++m_badFrames;
+            ++m_pos;
+            ++m_skipped;
+            continue;
+        }
+
+        const uint8_t *h = m_pos;
+        const uint32_t seq = get16(h + 16);
+        if (!seq) {
+            m_droppedTotal += m_dropped;
+            m_dropped = 0;
+            m_gap = m_frames != 0;
+            ++m_traces;
+        } else if (seq != (m_seq & 0xffff)) {
+            m_badFrames += (seq - m_seq) & 0xffff;
+            m_gap = true;
+        }
+        m_seq = seq + 1;
+
+        const uint32_t dropped = get32(h + 12);
+        if (dropped != m_dropped)
+            m_gap = true;
+        m_dropped = dropped;
+
+        m_entries = get16(h + 4);
+        m_cycles = get32(h + 8);
+        m_payload = h + TraceHeaderSize;
+        m_payloadEnd = m_payload + bytes;
+        m_pos = m_payloadEnd;
+        ++m_frames;
+        if (!m_entries)
+            ++m_ended;
+        return true;
+    }
+    return false;
+}
+
+bool TraceReader::next(TraceWord &word)
+{
+    if (m_raw) {
+        if (m_end - m_pos < 4)
+            return false;
+        word = {get32(m_pos), 0, false};
+        m_pos += 4;
+        return true;
+    }
+
+    while (!m_entries) {
+        if (!nextFrame())
+            return false;
+    }
+    uint32_t delta = 0;
+    for (int shift = 0; m_payload < m_payloadEnd && shift < 35; shift += 7) {
+        const uint8_t byte = *m_payload++;
+        delta |= uint32_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            break;
+    }
+    if (m_payloadEnd - m_payload < 4) {
+        // cannot be with the check passed, unless the sender is broken
+        ++m_badFrames;
+        m_entries = 0;
+        return next(word);
+    }
+    m_cycles += delta;
+    word.bus = get32(m_payload);
+    word.cycles = m_cycles;
+    word.gap = m_gap;
+    m_gap = false;
+    m_payload += 4;
+    --m_entries;
+    return true;
+}
+
+bool trace_looks_framed(const uint8_t *data, size_t size)
+{
+    const uint8_t *end = data + size;
+    const uint8_t *probeEnd = data + std::min(size, ProbeSize);
+    for (const uint8_t *p = data; p < probeEnd; ++p) {
+        if (frame_at(p, end) >= 0)
+            return true;
+    }
+    return false;
+}
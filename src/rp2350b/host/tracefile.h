@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Bus captures for the host tools: the frames trace.cpp streams over USB, or
+// raw little endian u32 bus words as zxsim reads them.
+
+// A capture mapped read only, for one pass front to back
+class MappedFile
+{
+public:
+    explicit MappedFile(const char *path);
+    ~MappedFile();
+
+    bool isOpen() const { return m_data; }
+    const uint8_t *data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    const uint8_t *m_data = nullptr;
+    size_t m_size = 0;
+};
+
+struct TraceWord
+{
+    uint32_t bus = 0;
+    uint32_t cycles = 0;    // core1 cycles, framed captures only
+    bool gap = false;       // words are missing right before this one
+};
+
+class TraceReader
+{
+public:
+    // framed unless raw, see trace_looks_framed()
+    TraceReader(const uint8_t *data, size_t size, bool raw);
+
+    bool next(TraceWord &word);
+
+    bool framed() const { return !m_raw; }
+    uint64_t frames() const { return m_frames; }
+    uint64_t badFrames() const { return m_badFrames; }     // failed the check, or lost
+    uint64_t traces() const { return m_traces; }           // frame 0 seen
+    uint64_t ended() const { return m_ended; }             // last frame seen
+    uint64_t dropped() const { return m_droppedTotal + m_dropped; }
+    uint64_t skipped() const { return m_skipped; }         // bytes between the frames
+
+private:
+    bool nextFrame();
+
+    const uint8_t *m_pos;
+    const uint8_t *m_end;
+    bool m_raw;
+
+    // the frame being read
+    const uint8_t *m_payload = nullptr;
+    const uint8_t *m_payloadEnd = nullptr;
+    uint32_t m_entries = 0;
+    uint32_t m_cycles = 0;
+    bool m_gap = false;
+
+    uint32_t m_seq = 0;
+    uint32_t m_dropped = 0;         // of the current trace
+    uint64_t m_droppedTotal = 0;    // of the traces before it
+    uint64_t m_frames = 0;
+    uint64_t m_badFrames = 0;
+    uint64_t m_traces = 0;
+    uint64_t m_ended = 0;
+    uint64_t m_skipped = 0;
+};
+
+// true when one of the first frames of data checks out
+bool trace_looks_framed(const uint8_t *data, size_t size);
@@ -0,0 +1,319 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Checks the ROM trap tables of rombank.cpp and what zx_mreq() does with them.
+//
+// The 48K ROM is selected with a DivMMC/esxDOS style set of traps: entry
+// points paging IFp in, the 0x1ff8..0x1fff range paging it out and LD-BYTES
+// only notifying core0. Every ROM address must read back its action, and a
+// random walk of fetches must page in and out where the traps say, posting a
+// MailTag::Trap for each change and each notify.
+//
+// Then the same fetches are timed against the 3 traps the 48K descriptor
+// has and a table with --traps random ones: the reply of a fetch must not
+// depend on how many traps the image has. The cycle model does not charge
+// the loads inside a call, so the fetches are also served from a table where
+// only the word of the fetched address holds its traps, every other word
+// notifies: a lookup reading anything else than that one word goes wrong.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "mailbox.h"
+#include "rombank.h"
+#include "sim.h"
+#include "zpi.h"
+#include "zx.h"
+
+extern const unsigned char __48_rom[];
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int MreqSm = 0;
+constexpr uint32_t RomcsPin = 25;   // O_ROMCS of zx.cpp
+
+struct Options
+{
+    uint32_t seed = 1;
+    uint32_t fetches = 200000;
+    uint32_t traps = 250;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+// esxDOS: RST 0/8/0x38, NMI, SAVE and LOAD entries and the 0x3dxx page in,
+// the 0x1ff8..0x1fff page out, and LD-BYTES for a tape loader
+constexpr RomTrapRange EsxTraps[] = {
+    {0x0000, 0x0000, RomTrap::PageIn}, {0x0008, 0x0008, RomTrap::PageIn},   {0x0038, 0x0038, RomTrap::PageIn},
+    {0x0066, 0x0066, RomTrap::PageIn}, {0x04c6, 0x04c6, RomTrap::PageIn},   {0x0562, 0x0562, RomTrap::PageIn},
+    {0x3d00, 0x3dff, RomTrap::PageIn}, {0x1ff8, 0x1fff, RomTrap::PageOut}, {0x0556, 0x0556, RomTrap::Notify},
+};
+
+struct Reply
+{
+    bool sent = false;
+    uint32_t data = 0;
+    uint64_t cycles = 0;    // from the word in the RX FIFO to the reply in the TX one
+};
+
+int Failures = 0;
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+bool romcs()
+{
+    return sim::GpioOut & (1ull << RomcsPin);
+}
+
+Reply fetch(uint16_t addr)
+{
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE);
+    bus &= ~((1u << I_MREQ_L) | (1u << I_RD_L));
+    bus |= 1u << I_ZXRDWR;
+    const uint64_t start = sim::Cycles;
+    sim::pio_rx_push(MreqSm, bus);
+    zx_poll();
+
+    Reply reply;
+    uint32_t word;
+    uint64_t cycle;
+    if (sim::pio_tx_pop(MreqSm, word, cycle)) {
+        reply.sent = true;
+        reply.data = word >> 1;
+        reply.cycles = cycle - start;
+    }
+    return reply;
+}
+
+RomTrap expected_trap(uint16_t addr)
+{
+    for (const RomTrapRange &trap : EsxTraps) {
+        if (addr >= trap.first && addr <= trap.last)
+            return trap.action;
+    }
+    return RomTrap::None;
+}
+
+// the worst reply of the fetches of a random walk, with every trap taken
+uint64_t walk(uint32_t fetches, uint32_t seed)
+{
+    Rng rng{seed};
+    uint64_t worst = 0;
+    for (uint32_t i = 0; i < fetches; ++i) {
+        const Reply reply = fetch(rng.next() & 0x3fff);
+        worst = std::max(worst, reply.cycles);
+        MailMessage message;
+        while (mailbox_fetch(MailToCore0, message)) {
+        }
+    }
+    return worst;
+}
+
+// the fetches whose trap did not come from the single table word of their
+// address, see the header
+uint32_t stray_probes(uint32_t fetches, uint32_t seed)
+{
+    static uint32_t probed[RomTrapWords];
+    std::fill_n(probed, RomTrapWords, ~0u);
+    const uint32_t *table = RomTrapPtr;
+    RomTrapPtr = probed;
+
+    Rng rng{seed};
+    uint32_t stray = 0;
+    for (uint32_t i = 0; i < fetches; ++i) {
+        const uint16_t addr = rng.next() & 0x3fff;
+        probed[addr / 16] = table[addr / 16];
+        const RomTrap trap = rombank_trap(addr);
+        fetch(addr);
+        MailMessage message;
+        const bool posted = mailbox_fetch(MailToCore0, message);
+        stray += (trap == RomTrap::Notify) != (posted && message.payload[0] == uint32_t(RomTrap::Notify));
+        while (mailbox_fetch(MailToCore0, message)) {
+        }
+        probed[addr / 16] = ~0u;
+    }
+    RomTrapPtr = table;
+    return stray;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --seed N       fetch pattern (default 1)\n"
+           "  --fetches N    fetches of the random walks (default 200000)\n"
+           "  --traps N      traps of the large table (default 250)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--fetches")
+            opts.fetches = strtoul(value(), nullptr, 0);
+        else if (arg == "--traps")
+            opts.traps = std::min(strtoul(value(), nullptr, 0), 255ul);
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    sim::pio_reset();
+    const RomImage esx{"48K esxDOS", RomModel::Zx48, __48_rom, RomBankSize, 0, 0, EsxTraps,
+                       uint8_t(std::size(EsxTraps))};
+    const RomTrapRange bad{0x3fff, 0x4000, RomTrap::PageIn};
+    const RomImage invalid{"bad traps", RomModel::Zx48, __48_rom, RomBankSize, 0, 0, &bad, 1};
+    check("traps past the ROM refused", rombank_add(&invalid) < 0);
+    const int esxBank = rombank_add(&esx);
+    const int rom48Bank = rombank_add(BuiltinRoms[0]);
+    check("select", rombank_select(esxBank));
+    zpi_init(nullptr);
+    zx_init();
+
+    uint32_t wrongTable = 0;
+    for (uint32_t addr = 0; addr < RomBankSize; ++addr)
+        wrongTable += rombank_trap(addr) != expected_trap(addr);
+    check("every ROM address reads back its trap", !wrongTable);
+    check("no traps above the ROM", rombank_trap(0x4000) == RomTrap::None && rombank_trap(0xffff) == RomTrap::None);
+
+    // a random walk of fetches, following the paging the traps leave
+    Rng rng{opts.seed};
+    bool pagedIn = romcs();
+    check("paged in at boot", pagedIn);
+    uint32_t wrongPaging = 0;
+    uint32_t wrongData = 0;
+    uint32_t wrongMail = 0;
+    uint32_t changes = 0;
+    uint32_t notifies = 0;
+    for (uint32_t i = 0; i < opts.fetches; ++i) {
+        // mostly the traps, the odd other address
+        uint16_t addr = rng.next() & 0x3fff;
+        if (rng.next() % 4) {
+            const RomTrapRange &trap = EsxTraps[rng.next() % std::size(EsxTraps)];
+            addr = trap.first + rng.next() % (trap.last - trap.first + 1);
+        }
+        const RomTrap trap = expected_trap(addr);
+        const Reply reply = fetch(addr);
+        // served by IFp when paged in, or paged in by this very fetch
+        const bool served = pagedIn || trap == RomTrap::PageIn;
+        wrongData += !reply.sent || reply.data != (served ? 0xff00u | __48_rom[addr] : 0);
+
+        bool mail = trap == RomTrap::Notify;
+        if (trap == RomTrap::PageIn && !pagedIn) {
+            pagedIn = true;
+            mail = true;
+            ++changes;
+        } else if (trap == RomTrap::PageOut && pagedIn) {
+            pagedIn = false;
+            mail = true;
+            ++changes;
+        }
+        notifies += trap == RomTrap::Notify;
+        wrongPaging += romcs() != pagedIn;
+
+        MailMessage message;
+        const bool posted = mailbox_fetch(MailToCore0, message);
+        if (posted != mail || (posted && (message.tag != MailTag::Trap || message.arg != addr || message.words != 1
+                                          || message.payload[0] != uint32_t(trap))))
+            ++wrongMail;
+    }
+    check("every fetch answered from the paged in ROM only", !wrongData);
+    check("paging follows the traps", !wrongPaging);
+    check("a Trap message for each change and notify", !wrongMail);
+    check("paged in and out", changes > 100);
+
+    // a trap set at runtime, gone with the next switch
+    check("runtime trap", rombank_set_trap(0x04c2, 0x04c2, RomTrap::Notify));
+    check("invalid runtime trap", !rombank_set_trap(0x3000, 0x4000, RomTrap::Notify));
+    fetch(0x04c2);
+    MailMessage message;
+    check("runtime trap taken", mailbox_fetch(MailToCore0, message) && message.arg == 0x04c2);
+    rombank_select(rom48Bank);
+    check("48K traps after the switch", rombank_trap(0x04c2) == RomTrap::None && rombank_trap(0x0066) == RomTrap::PageIn
+                                            && rombank_trap(0x1ff8) == RomTrap::None);
+
+    // the reply does not grow with the traps
+    const uint64_t few = walk(opts.fetches, opts.seed);
+    RomTrapRange *many = new RomTrapRange[opts.traps];
+    for (uint32_t i = 0; i < opts.traps; ++i) {
+        const uint16_t addr = rng.next() % (RomBankSize - 64);
+        many[i] = {addr, uint16_t(addr + rng.next() % 64), RomTrap::Notify};
+    }
+    const RomImage manyTraps{"48K many traps", RomModel::Zx48, __48_rom, RomBankSize, 0, 0, many, uint8_t(opts.traps)};
+    check("select many traps", rombank_select(rombank_add(&manyTraps)));
+    const uint64_t lots = walk(opts.fetches, opts.seed);
+    printf("%-16s %6s %14s\n", "image", "traps", "worst reply");
+    printf("%-16s %6u %14" PRIu64 "\n", BuiltinRoms[0]->name, unsigned(BuiltinRoms[0]->trapCount), few);
+    printf("%-16s %6u %14" PRIu64 "\n", manyTraps.name, unsigned(opts.traps), lots);
+    check("reply independent of the trap count", lots == few);
+    check("a fetch reads one word of the trap table", !stray_probes(opts.fetches, opts.seed));
+    const uint32_t dropped = MailToCore0.dropped.load();
+    delete[] many;
+
+    if (Failures) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: %u paging changes and %u notifies where the traps say, reply %" PRIu64
+           " cycles and one table word with 3 or %u traps (%u messages dropped)\n",
+           changes, notifies, few, unsigned(opts.traps), dropped);
+    return 0;
+}
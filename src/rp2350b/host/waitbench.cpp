@@ -0,0 +1,268 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Checks the on-demand wait states of a ROM switch, and that the Z80 is held
+// until the bus loop starts.
+//
+// rombank_begin() flips the Z80 to the new image at once and rombank_fill()
+// copies it in a line at a time. The Z80 keeps fetching meanwhile, ROM reads
+// of lines not copied yet must come with a hold word ahead of the data (see
+// zx_mreq in zx.pio), every other read with the data alone, and every byte
+// must be the new image's. The switch is run at several copy rates, reads
+// between two lines, to show how many reads get held. The hold words have to
+// reach the PIO before the Z80 samples /WAIT, their worst latency is checked
+// at the slowest clock profile, like zxsim checks the reads.
+//
+// Flash reads cost nothing on the host, the Z80 time they would take is
+// estimated from --xip-ns per held read. The switches go round three images
+// and rombank_task() never runs, so nothing is found in SRAM ahead of them.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "mailbox.h"
+#include "margin.h"
+#include "rombank.h"
+#include "sim.h"
+#include "zpi.h"
+#include "zx.h"
+
+extern const unsigned char __48_rom[];
+extern const unsigned char testrom_bin[];
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int MreqSm = 0;
+
+struct Options
+{
+    uint32_t seed = 1;
+    double xipNs = 400;     // a flash read missing the XIP cache
+    double zxMHz = 3.5469;
+};
+
+struct Rng
+{
+    uint32_t seed;
+    uint32_t next()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    }
+};
+
+struct Switch
+{
+    uint32_t reads = 0;
+    uint32_t held = 0;
+    uint32_t wrong = 0;     // bytes not from the new image, or words out of protocol
+    uint64_t worstHold = 0; // core1 cycles from a word to its hold word
+    ZxWaitStats stats;      // what the counters saw
+};
+
+int Failures = 0;
+
+void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++Failures;
+    }
+}
+
+// one ROM read, false when the answer is not the expected byte. holdCycles
+// is the time to the hold word, when there is one.
+bool fetch(uint16_t addr, uint8_t expected, bool &held, uint64_t &holdCycles)
+{
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE);
+    bus &= ~((1u << I_MREQ_L) | (1u << I_RD_L));
+    bus |= 1u << I_ZXRDWR;
+    sim::pio_rx_push(MreqSm, bus);
+    const uint64_t start = sim::Cycles;
+    zx_poll();
+
+    uint32_t word;
+    uint64_t cycle;
+    held = false;
+    if (!sim::pio_tx_pop(MreqSm, word, cycle))
+        return false;
+    if (word & 1) {
+        held = true;
+        holdCycles = cycle - start;
+        if (word != 1 || !sim::pio_tx_pop(MreqSm, word, cycle))
+            return false;
+    }
+    uint32_t extra;
+    if (sim::pio_tx_pop(MreqSm, extra, cycle) || (word & 1))
+        return false;
+    return (word >> 1) == (0xff00u | expected);
+}
+
+// switches to image, fetching readsPerLine code bytes between two lines copied
+Switch run_switch(int image, uint32_t readsPerLine, Rng &rng)
+{
+    const uint8_t *data = rombank_image(image)->data;
+    const ZxWaitStats before = zx_wait_stats(ZxWaitSource::Flash);
+    Switch result;
+    check("begin", rombank_begin(image));
+    uint16_t pc = 0;
+    bool done = false;
+    while (!done) {
+        for (uint32_t i = 0; i < readsPerLine; ++i) {
+            // mostly straight code with the odd jump, like the ROM at reset
+            pc = rng.next() % 8 ? (pc + 1) & 0x3fff : rng.next() & 0x3fff;
+            bool held;
+            uint64_t holdCycles = 0;
+            result.wrong += !fetch(pc, data[pc], held, holdCycles);
+            result.held += held;
+            result.worstHold = std::max(result.worstHold, holdCycles);
+            ++result.reads;
+        }
+        done = rombank_fill(1);
+    }
+    const ZxWaitStats after = zx_wait_stats(ZxWaitSource::Flash);
+    result.stats.waits = after.waits - before.waits;
+    result.stats.cycles = after.cycles - before.cycles;
+
+    // all in: never held again
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const uint16_t addr = rng.next() & 0x3fff;
+        bool held;
+        uint64_t holdCycles;
+        result.wrong += !fetch(addr, data[addr], held, holdCycles);
+        check("held after the fill", !held);
+    }
+    return result;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  --seed N         fetch pattern (default 1)\n"
+           "  --xip-ns NS      flash read missing the XIP cache (default 400)\n"
+           "  --zx-clock MHZ   Z80 clock (default 3.5469)\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--seed")
+            opts.seed = strtoul(value(), nullptr, 0);
+        else if (arg == "--xip-ns")
+            opts.xipNs = atof(value());
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    sim::pio_reset();
+    const RomImage rom48{"48K", RomModel::Zx48, __48_rom, RomBankSize};
+    const RomImage test{"test", RomModel::Diagnostic, testrom_bin, RomBankSize};
+    static uint8_t inverted[RomBankSize];
+    for (uint32_t i = 0; i < RomBankSize; ++i)
+        inverted[i] = ~__48_rom[i];
+    const RomImage rom48Inverted{"48K inverted", RomModel::Diagnostic, inverted, RomBankSize};
+    const int images[] = {rombank_add(&rom48), rombank_add(&test), rombank_add(&rom48Inverted)};
+    rombank_select(images[0]);
+    zpi_init(nullptr);
+    zx_init();
+
+    // nothing serves the bus before zx_start(), the Z80 must not run on
+    constexpr uint64_t WaitPin = 1ull << (PIO_BASE + O_WAIT_L);
+    check("held from zx_init()", sim::GpioForcedLow & WaitPin);
+    zx_start();
+    zx_boot();
+    check("released by zx_start()", !(sim::GpioForcedLow & WaitPin));
+
+    // a word that lands right after the look at FSTAT waits a whole trip
+    const uint64_t idleStart = sim::Cycles;
+    zx_poll();
+    const uint64_t idleCycles = sim::Cycles - idleStart;
+
+    const double tNs = 1000 / opts.zxMHz;
+    printf("%u lines of %u bytes per 16K bank, flash read %.0f ns\n\n", RomBankSize / RomFillLine, RomFillLine,
+           opts.xipNs);
+    printf("%10s %8s %8s %7s %12s\n", "reads/line", "reads", "held", "held%", "Z80 waits us");
+    Rng rng{opts.seed};
+    int next = 1;
+    uint64_t worstHold = 0;
+    for (const uint32_t readsPerLine : {0u, 1u, 4u, 16u, 64u, 256u}) {
+        const Switch s = run_switch(images[next], readsPerLine, rng);
+        worstHold = std::max(worstHold, s.worstHold);
+        next = (next + 1) % 3;
+        // a held read costs the Z80 whole T states
+        const double waitUs = s.held * (uint32_t(opts.xipNs / tNs) + 1) * tNs / 1000;
+        printf("%10u %8u %8u %6.1f%% %12.1f\n", readsPerLine, s.reads, s.held,
+               s.reads ? 100.0 * s.held / s.reads : 0.0, waitUs);
+        check("every byte from the new image, in protocol", !s.wrong);
+        check("counters match the hold words", s.stats.waits == s.held);
+    }
+
+    // a plain select copies it all before the next read on this one thread
+    const ZxWaitStats before = zx_wait_stats(ZxWaitSource::Flash);
+    rombank_select(images[next]);
+    check("select holds nothing", zx_wait_stats(ZxWaitSource::Flash).waits == before.waits);
+
+    // the hold word against the /WAIT sample, at the slowest clock profile
+    const BusBudget budget;
+    const ClockProfile &slowest = ClockProfiles[0];
+    const uint32_t holdCycles = uint32_t(worstHold + idleCycles);
+    const uint32_t holdNs = margin_latency_ns(slowest, holdCycles, budget);
+    const uint32_t holdBudgetNs = margin_hold_budget_ns(budget);
+    printf("\nhold word worst %u cycles + %u PIO, %u of %u ns at %s\n", holdCycles, budget.pioCycles, holdNs,
+           holdBudgetNs, slowest.name);
+    check("hold words before the /WAIT sample", holdNs <= holdBudgetNs);
+
+    if (Failures) {
+        printf("\nFAIL\n");
+        return 1;
+    }
+    printf("\nOK: held until zx_start(), reads of lines not copied in are held, every byte from the new image\n");
+    return 0;
+}
@@ -0,0 +1,696 @@
+#include "z80.h"
+
+#include <utility>
+
+namespace {
+
+constexpr uint8_t FlagC = 0x01;
+constexpr uint8_t FlagN = 0x02;
+constexpr uint8_t FlagPV = 0x04;
+constexpr uint8_t FlagX = 0x08;
+constexpr uint8_t FlagH = 0x10;
+constexpr uint8_t FlagY = 0x20;
+constexpr uint8_t FlagZ = 0x40;
+constexpr uint8_t FlagS = 0x80;
+
+// unprefixed T states, conditional jumps, calls and returns when not taken
+constexpr uint8_t Cycles[256] = {
+    4, 10, 7, 6, 4, 4, 7, 4, 4, 11, 7, 6, 4, 4, 7, 4,
+    8, 10, 7, 6, 4, 4, 7, 4, 12, 11, 7, 6, 4, 4, 7, 4,
+    7, 10, 16, 6, 4, 4, 7, 4, 7, 11, 16, 6, 4, 4, 7, 4,
+    7, 10, 13, 6, 11, 11, 10, 4, 7, 11, 13, 6, 4, 4, 7, 4,
+    4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+    4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+    4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+    7, 7, 7, 7, 7, 7, 4, 7, 4, 4, 4, 4, 4, 4, 7, 4,
+    4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+    4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+    4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+    4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+    5, 10, 10, 10, 10, 11, 7, 11, 5, 10, 10, 0, 10, 17, 7, 11,
+    5, 10, 10, 11, 10, 11, 7, 11, 5, 4, 10, 11, 10, 0, 7, 11,
+    5, 10, 10, 19, 10, 11, 7, 11, 5, 4, 10, 4, 10, 0, 7, 11,
+    5, 10, 10, 4, 10, 11, 7, 11, 5, 6, 10, 4, 10, 0, 7, 11,
+};
+
+bool parity(uint8_t value)
+{
+    value ^= value >> 4;
+    value ^= value >> 2;
+    value ^= value >> 1;
+    return !(value & 1);
+}
+
+uint8_t sz53(uint8_t value)
+{
+    return (value & (FlagS | FlagY | FlagX)) | (value ? 0 : FlagZ);
+}
+
+uint8_t sz53p(uint8_t value)
+{
+    return sz53(value) | (parity(value) ? FlagPV : 0);
+}
+
+} // namespace
+
+uint8_t Z80::fetch()
+{
+    const uint8_t op = read(pc++);
+    // T3 of M1 puts I:R on the bus, R counts the fetch after that
+    refresh(uint16_t(i << 8 | r));
+    r = (r & 0x80) | ((r + 1) & 0x7f);
+    return op;
+}
+
+uint16_t Z80::operand16()
+{
+    const uint8_t lo = operand();
+    return lo | operand() << 8;
+}
+
+uint16_t Z80::read16(uint16_t addr)
+{
+    const uint8_t lo = read(addr);
+    return lo | read(addr + 1) << 8;
+}
+
+void Z80::write16(uint16_t addr, uint16_t value)
+{
+    write(addr, value);
+    write(addr + 1, value >> 8);
+}
+
+void Z80::push(uint16_t value)
+{
+    write(--sp, value >> 8);
+    write(--sp, value);
+}
+
+uint16_t Z80::pop()
+{
+    const uint16_t value = read16(sp);
+    sp += 2;
+    return value;
+}
+
+// B, C, D, E, H, L, (addr), A; H and L are the ones of m_index
+uint8_t Z80::reg(int n, uint16_t addr)
+{
+    switch (n) {
+    case 0: return bc >> 8;
+    case 1: return bc;
+    case 2: return de >> 8;
+    case 3: return de;
+    case 4: return *m_index >> 8;
+    case 5: return *m_index;
+    case 6: return read(addr);
+    default: return af >> 8;
+    }
+}
+
+void Z80::setReg(int n, uint8_t value, uint16_t addr)
+{
+    switch (n) {
+    case 0: bc = (bc & 0xff) | value << 8; break;
+    case 1: bc = (bc & 0xff00) | value; break;
+    case 2: de = (de & 0xff) | value << 8; break;
+    case 3: de = (de & 0xff00) | value; break;
+    case 4: *m_index = (*m_index & 0xff) | value << 8; break;
+    case 5: *m_index = (*m_index & 0xff00) | value; break;
+    case 6: write(addr, value); break;
+    default: setA(value); break;
+    }
+}
+
+// BC, DE, HL, SP
+uint16_t &Z80::pair(int n)
+{
+    switch (n) {
+    case 0: return bc;
+    case 1: return de;
+    case 2: return *m_index;
+    default: return sp;
+    }
+}
+
+// NZ, Z, NC, C, PO, PE, P, M
+bool Z80::condition(int n) const
+{
+    static constexpr uint8_t Masks[4] = {FlagZ, FlagC, FlagPV, FlagS};
+    const bool set = f() & Masks[n >> 1];
+    return (n & 1) ? set : !set;
+}
+
+// ADD, ADC, SUB, SBC, AND, XOR, OR, CP
+void Z80::alu(int op, uint8_t value)
+{
+    const uint8_t a = this->a();
+    const uint8_t carry = (op == 1 || op == 3) ? (f() & FlagC) : 0;
+    switch (op) {
+    case 0:
+    case 1: {
+        const uint32_t result = a + value + carry;
+        const uint8_t res = result;
+        setA(res);
+        setF(sz53(res) | ((a ^ value ^ res) & FlagH) | (((a ^ ~value) & (a ^ res) & 0x80) ? FlagPV : 0)
+             | (result > 0xff ? FlagC : 0));
+        return;
+    }
+    case 2:
+    case 3:
+    case 7: {
+        const int32_t result = a - value - carry;
+        const uint8_t res = result;
+        uint8_t flags = (res & FlagS) | (res ? 0 : FlagZ) | ((a ^ value ^ res) & FlagH)
+                        | (((a ^ value) & (a ^ res) & 0x80) ? FlagPV : 0) | FlagN | (result < 0 ? FlagC : 0);
+        // CP takes the undocumented bits from the operand
+        flags |= (op == 7 ? value : res) & (FlagY | FlagX);
+        setF(flags);
+        if (op != 7)
+            setA(res);
+        return;
+    }
+    case 4:
+        setA(a & value);
+        setF(sz53p(a & value) | FlagH);
+        return;
+    case 5:
+        setA(a ^ value);
+        setF(sz53p(a ^ value));
+        return;
+    default:
+        setA(a | value);
+        setF(sz53p(a | value));
+        return;
+    }
+}
+
+uint8_t Z80::inc(uint8_t value)
+{
+    const uint8_t res = value + 1;
+    setF((f() & FlagC) | sz53(res) | ((res & 0x0f) ? 0 : FlagH) | (res == 0x80 ? FlagPV : 0));
+    return res;
+}
+
+uint8_t Z80::dec(uint8_t value)
+{
+    const uint8_t res = value - 1;
+    setF((f() & FlagC) | sz53(res) | FlagN | ((value & 0x0f) ? 0 : FlagH) | (res == 0x7f ? FlagPV : 0));
+    return res;
+}
+
+// RLC, RRC, RL, RR, SLA, SRA, SLL, SRL
+uint8_t Z80::rotate(int op, uint8_t value)
+{
+    uint8_t res = 0;
+    bool carry = false;
+    switch (op) {
+    case 0: carry = value & 0x80; res = value << 1 | carry; break;
+    case 1: carry = value & 1; res = value >> 1 | carry << 7; break;
+    case 2: carry = value & 0x80; res = value << 1 | (f() & FlagC); break;
+    case 3: carry = value & 1; res = value >> 1 | (f() & FlagC) << 7; break;
+    case 4: carry = value & 0x80; res = value << 1; break;
+    case 5: carry = value & 1; res = (value >> 1) | (value & 0x80); break;
+    case 6: carry = value & 0x80; res = value << 1 | 1; break;
+    default: carry = value & 1; res = value >> 1; break;
+    }
+    setF(sz53p(res) | (carry ? FlagC : 0));
+    return res;
+}
+
+uint16_t Z80::add16(uint16_t a, uint16_t b)
+{
+    const uint32_t result = a + b;
+    setF((f() & (FlagS | FlagZ | FlagPV)) | (((a ^ b ^ result) >> 8) & FlagH) | ((result >> 8) & (FlagY | FlagX))
+         | (result > 0xffff ? FlagC : 0));
+    return result;
+}
+
+void Z80::adc16(uint16_t value)
+{
+    const uint16_t a = *m_index;
+    const uint32_t result = a + value + (f() & FlagC);
+    const uint16_t res = result;
+    setF(((res >> 8) & (FlagS | FlagY | FlagX)) | (res ? 0 : FlagZ) | (((a ^ value ^ res) >> 8) & FlagH)
+         | (((a ^ ~value) & (a ^ res) & 0x8000) ? FlagPV : 0) | (result > 0xffff ? FlagC : 0));
+    *m_index = res;
+}
+
+void Z80::sbc16(uint16_t value)
+{
+    const uint16_t a = *m_index;
+    const int32_t result = a - value - (f() & FlagC);
+    const uint16_t res = result;
+    setF(((res >> 8) & (FlagS | FlagY | FlagX)) | (res ? 0 : FlagZ) | (((a ^ value ^ res) >> 8) & FlagH)
+         | (((a ^ value) & (a ^ res) & 0x8000) ? FlagPV : 0) | FlagN | (result < 0 ? FlagC : 0));
+    *m_index = res;
+}
+
+void Z80::daa()
+{
+    const uint8_t a = this->a();
+    uint8_t correction = 0;
+    bool carry = f() & FlagC;
+    if ((f() & FlagH) || (a & 0x0f) > 9)
+        correction |= 0x06;
+    if (carry || a > 0x99) {
+        correction |= 0x60;
+        carry = true;
+    }
+    const uint8_t res = (f() & FlagN) ? a - correction : a + correction;
+    setA(res);
+    setF(sz53p(res) | (f() & FlagN) | ((a ^ res) & FlagH) | (carry ? FlagC : 0));
+}
+
+void Z80::reset()
+{
+    af = 0xffff;
+    bc = de = hl = 0;
+    af2 = bc2 = de2 = hl2 = 0;
+    ix = iy = 0;
+    sp = 0xffff;
+    pc = 0;
+    i = r = im = 0;
+    iff1 = iff2 = false;
+    tstates = 0;
+}
+
+void Z80::nmi()
+{
+    iff1 = false;
+    push(pc);
+    pc = 0x0066;
+    r = (r & 0x80) | ((r + 1) & 0x7f);
+    tstates += 11;
+}
+
+bool Z80::step()
+{
+    uint8_t op = fetch();
+    m_index = &hl;
+    uint16_t *index = &hl;
+    if (op == 0xdd || op == 0xfd) {
+        index = op == 0xdd ? &ix : &iy;
+        m_index = index;
+        tstates += 4;
+        op = fetch();
+    }
+    if (op == 0xcb)
+        return prefixCb(index);
+    if (op == 0xed) {
+        m_index = &hl;
+        return prefixEd();
+    }
+
+    tstates += Cycles[op];
+    const int x = op >> 6;
+    const int y = (op >> 3) & 7;
+    const int z = op & 7;
+    const int p = y >> 1;
+    const bool q = y & 1;
+
+    // (hl) operand: (ix+d) when prefixed, and then H and L are the real ones
+    auto memory = [&]() -> uint16_t {
+        if (index == &hl)
+            return hl;
+        const uint16_t addr = *index + int8_t(operand());
+        m_index = &hl;
+        tstates += 8;
+        return addr;
+    };
+
+    switch (x) {
+    case 0:
+        switch (z) {
+        case 0:
+            switch (y) {
+            case 0: return true;                                        // nop
+            case 1: std::swap(af, af2); return true;                    // ex af, af'
+            case 2: {                                                   // djnz
+                const int8_t d = operand();
+                bc -= 0x100;
+                if (bc >> 8) {
+                    pc += d;
+                    tstates += 5;
+                }
+                return true;
+            }
+            default: {                                                  // jr [cc]
+                const int8_t d = operand();
+                if (y == 3 || condition(y - 4)) {
+                    pc += d;
+                    if (y != 3)
+                        tstates += 5;
+                }
+                return true;
+            }
+            }
+        case 1:
+            if (!q)
+                pair(p) = operand16();                                  // ld rr, nn
+            else
+                *m_index = add16(*m_index, pair(p));                    // add hl, rr
+            return true;
+        case 2:
+            switch (y) {
+            case 0: write(bc, a()); return true;                       // ld (bc), a
+            case 1: setA(read(bc)); return true;                       // ld a, (bc)
+            case 2: write(de, a()); return true;                       // ld (de), a
+            case 3: setA(read(de)); return true;                       // ld a, (de)
+            case 4: write16(operand16(), *m_index); return true;       // ld (nn), hl
+            case 5: *m_index = read16(operand16()); return true;       // ld hl, (nn)
+            case 6: write(operand16(), a()); return true;              // ld (nn), a
+            default: setA(read(operand16())); return true;             // ld a, (nn)
+            }
+        case 3:
+            pair(p) += q ? -1 : 1;                                      // inc/dec rr
+            return true;
+        case 4:
+        case 5: {                                                       // inc/dec r
+            const uint16_t addr = y == 6 ? memory() : 0;
+            const uint8_t value = reg(y, addr);
+            setReg(y, z == 4 ? inc(value) : dec(value), addr);
+            return true;
+        }
+        case 6: {                                                       // ld r, n
+            const uint16_t addr = y == 6 ? memory() : 0;
+            if (y == 6 && index != &hl)
+                tstates -= 3;
+            setReg(y, operand(), addr);
+            return true;
+        }
+        default:
+            switch (y) {
+            case 0:                                                     // rlca, rrca, rla, rra
+            case 1:
+            case 2:
+            case 3: {
+                const uint8_t flags = f() & (FlagS | FlagZ | FlagPV);
+                const uint8_t res = rotate(y, a());
+                setA(res);
+                setF(flags | (res & (FlagY | FlagX)) | (f() & FlagC));
+                return true;
+            }
+            case 4: daa(); return true;
+            case 5:                                                     // cpl
+                setA(~a());
+                setF((f() & (FlagS | FlagZ | FlagPV | FlagC)) | FlagH | FlagN | (a() & (FlagY | FlagX)));
+                return true;
+            case 6:                                                     // scf
+                setF((f() & (FlagS | FlagZ | FlagPV)) | (a() & (FlagY | FlagX)) | FlagC);
+                return true;
+            default:                                                    // ccf
+                setF(((f() & (FlagS | FlagZ | FlagPV | FlagC)) | ((f() & FlagC) << 4) | (a() & (FlagY | FlagX)))
+                     ^ FlagC);
+                return true;
+            }
+        }
+    case 1: {
+        if (op == 0x76) {                                               // halt
+            --pc;
+            return true;
+        }
+        const uint16_t addr = (y == 6 || z == 6) ? memory() : 0;       // ld r, r'
+        setReg(y, reg(z, addr), addr);
+        return true;
+    }
+    case 2: {
+        const uint16_t addr = z == 6 ? memory() : 0;                   // alu a, r
+        alu(y, reg(z, addr));
+        return true;
+    }
+    default:
+        break;
+    }
+
+    switch (z) {
+    case 0:                                                             // ret cc
+        if (condition(y)) {
+            pc = pop();
+            tstates += 6;
+        }
+        return true;
+    case 1:
+        if (!q) {
+            const uint16_t value = pop();                               // pop rr
+            if (p == 3)
+                af = value;
+            else
+                pair(p) = value;
+            return true;
+        }
+        switch (p) {
+        case 0: pc = pop(); return true;                                // ret
+        case 1:                                                         // exx
+            std::swap(bc, bc2);
+            std::swap(de, de2);
+            std::swap(hl, hl2);
+            return true;
+        case 2: pc = *m_index; return true;                             // jp (hl)
+        default: sp = *m_index; return true;                            // ld sp, hl
+        }
+    case 2: {                                                           // jp cc, nn
+        const uint16_t addr = operand16();
+        if (condition(y))
+            pc = addr;
+        return true;
+    }
+    case 3:
+        switch (y) {
+        case 0: pc = operand16(); return true;                          // jp nn
+        case 2: {                                                       // out (n), a
+            const uint8_t port = operand();
+            out(a() << 8 | port, a());
+            return true;
+        }
+        case 3: {                                                       // in a, (n)
+            const uint8_t port = operand();
+            setA(in(a() << 8 | port));
+            return true;
+        }
+        case 4: {                                                       // ex (sp), hl
+            const uint16_t value = read16(sp);
+            write16(sp, *m_index);
+            *m_index = value;
+            return true;
+        }
+        case 5: std::swap(de, hl); return true;                         // ex de, hl
+        case 6: iff1 = iff2 = false; return true;                       // di
+        case 7: iff1 = iff2 = true; return true;                        // ei
+        default: return false;
+        }
+    case 4: {                                                           // call cc, nn
+        const uint16_t addr = operand16();
+        if (condition(y)) {
+            push(pc);
+            pc = addr;
+            tstates += 7;
+        }
+        return true;
+    }
+    case 5:
+        if (!q) {                                                       // push rr
+            push(p == 3 ? af : pair(p));
+            return true;
+        }
+        if (p == 0) {                                                   // call nn
+            const uint16_t addr = operand16();
+            push(pc);
+            pc = addr;
+            return true;
+        }
+        return false;
+    case 6:
+        alu(y, operand());                                              // alu a, n
+        return true;
+    default:
+        push(pc);                                                       // rst
+        pc = y * 8;
+        return true;
+    }
+}
+
+bool Z80::prefixCb(uint16_t *index)
+{
+    uint16_t addr = hl;
+    if (index != &hl) {
+        // DDCB/FDCB: the displacement comes before the opcode
+        addr = *index + int8_t(operand());
+        m_index = &hl;
+    }
+    const uint8_t op = index == &hl ? fetch() : operand();
+    const int x = op >> 6;
+    const int y = (op >> 3) & 7;
+    int z = op & 7;
+    if (index != &hl) {
+        if (z != 6)
+            return false;
+        tstates += x == 1 ? 16 : 19;
+    } else {
+        tstates += z == 6 ? (x == 1 ? 12 : 15) : 8;
+    }
+
+    const uint8_t value = reg(z, addr);
+    switch (x) {
+    case 0:
+        setReg(z, rotate(y, value), addr);
+        return true;
+    case 1: {                                                           // bit
+        const uint8_t bit = value & (1 << y);
+        uint8_t flags = (f() & FlagC) | FlagH | (bit ? 0 : FlagZ | FlagPV) | (bit & FlagS);
+        flags |= (z == 6 ? addr >> 8 : value) & (FlagY | FlagX);
+        setF(flags);
+        return true;
+    }
+    case 2:
+        setReg(z, value & ~(1 << y), addr);                             // res
+        return true;
+    default:
+        setReg(z, value | 1 << y, addr);                                // set
+        return true;
+    }
+}
+
+bool Z80::prefixEd()
+{
+    const uint8_t op = fetch();
+    const int x = op >> 6;
+    const int y = (op >> 3) & 7;
+    const int z = op & 7;
+    const int p = y >> 1;
+    const bool q = y & 1;
+
+    if (x == 1) {
+        switch (z) {
+        case 0: {                                                       // in r, (c)
+            const uint8_t value = in(bc);
+            if (y != 6)
+                setReg(y, value, 0);
+            setF((f() & FlagC) | sz53p(value));
+            tstates += 12;
+            return true;
+        }
+        case 1:                                                         // out (c), r
+            out(bc, y == 6 ? 0 : reg(y, 0));
+            tstates += 12;
+            return true;
+        case 2:                                                         // sbc/adc hl, rr
+            if (q)
+                adc16(pair(p));
+            else
+                sbc16(pair(p));
+            tstates += 15;
+            return true;
+        case 3:                                                         // ld (nn), rr / ld rr, (nn)
+            if (q)
+                pair(p) = read16(operand16());
+            else
+                write16(operand16(), pair(p));
+            tstates += 20;
+            return true;
+        case 4: {                                                       // neg
+            const uint8_t value = a();
+            setA(0);
+            alu(2, value);
+            tstates += 8;
+            return true;
+        }
+        case 5:                                                         // retn, reti
+            iff1 = iff2;
+            pc = pop();
+            tstates += 14;
+            return true;
+        case 6: {                                                       // im
+            static constexpr uint8_t Modes[4] = {0, 0, 1, 2};
+            im = Modes[y & 3];
+            tstates += 8;
+            return true;
+        }
+        default:
+            tstates += 9;
+            switch (y) {
+            case 0: i = a(); return true;                               // ld i, a
+            case 1: r = a(); return true;                               // ld r, a
+            case 2:                                                     // ld a, i
+            case 3:                                                     // ld a, r
+                setA(y == 2 ? i : r);
+                setF((f() & FlagC) | sz53(a()) | (iff2 ? FlagPV : 0));
+                return true;
+            case 4:                                                     // rrd
+            case 5: {                                                   // rld
+                const uint8_t value = read(hl);
+                const uint8_t acc = a();
+                if (y == 4) {
+                    write(hl, (acc << 4) | (value >> 4));
+                    setA((acc & 0xf0) | (value & 0x0f));
+                } else {
+                    write(hl, (value << 4) | (acc & 0x0f));
+                    setA((acc & 0xf0) | (value >> 4));
+                }
+                setF((f() & FlagC) | sz53p(a()));
+                tstates += 9;
+                return true;
+            }
+            default:
+                return true;                                            // nop
+            }
+        }
+    }
+
+    if (x != 2 || y < 4 || z > 3)
+        return false;
+
+    // block instructions: y = 4 increment, 5 decrement, 6 and 7 repeat
+    const int step = (y & 1) ? -1 : 1;
+    const bool repeat = y >= 6;
+    tstates += 16;
+    switch (z) {
+    case 0: {                                                           // ldi, ldd, ldir, lddr
+        const uint8_t value = read(hl);
+        write(de, value);
+        hl += step;
+        de += step;
+        --bc;
+        const uint8_t n = value + a();
+        setF((f() & (FlagS | FlagZ | FlagC)) | (bc ? FlagPV : 0) | (n & FlagX) | ((n << 4) & FlagY));
+        break;
+    }
+    case 1: {                                                           // cpi, cpd, cpir, cpdr
+        const uint8_t value = read(hl);
+        const uint8_t res = a() - value;
+        hl += step;
+        --bc;
+        const uint8_t half = (a() ^ value ^ res) & FlagH;
+        const uint8_t n = res - (half ? 1 : 0);
+        setF((f() & FlagC) | (res & FlagS) | (res ? 0 : FlagZ) | half | (bc ? FlagPV : 0) | FlagN | (n & FlagX)
+             | ((n << 4) & FlagY));
+        if (repeat && bc && res) {
+            pc -= 2;
+            tstates += 5;
+        }
+        return true;
+    }
+    case 2: {                                                           // ini, ind, inir, indr
+        const uint8_t value = in(bc);
+        write(hl, value);
+        hl += step;
+        bc -= 0x100;
+        setF(sz53(bc >> 8) | FlagN);
+        break;
+    }
+    default: {                                                          // outi, outd, otir, otdr
+        const uint8_t value = read(hl);
+        bc -= 0x100;
+        out(bc, value);
+        hl += step;
+        setF(sz53(bc >> 8) | FlagN);
+        break;
+    }
+    }
+    const bool again = z == 0 ? bc != 0 : (bc >> 8) != 0;
+    if (repeat && again) {
+        pc -= 2;
+        tstates += 5;
+    }
+    return true;
+}
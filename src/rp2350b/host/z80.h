@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+
+// A Z80 for the host benches, enough to run the Pico generated shadow ROM
+// routines and the Spectrum ROM code around them.
+//
+// All the documented instructions are there, of the undocumented ones only
+// IXH/IXL/IYH/IYL and SLL. T states are uncontended, interrupts other than
+// NMI are not modelled. The Spectrum side (memory, ports) is the subclass,
+// see zxmachine.h.
+class Z80
+{
+public:
+    virtual ~Z80() = default;
+
+    // the registers as after power on, tstates back to 0
+    void reset();
+    // executes one instruction, false on one this core does not know
+    bool step();
+    void nmi();
+
+    uint8_t a() const { return af >> 8; }
+    uint8_t f() const { return af; }
+
+    uint16_t af = 0xffff, bc = 0, de = 0, hl = 0;
+    uint16_t af2 = 0, bc2 = 0, de2 = 0, hl2 = 0;
+    uint16_t ix = 0, iy = 0, sp = 0xffff, pc = 0;
+    uint8_t i = 0, r = 0, im = 0;
+    bool iff1 = false, iff2 = false;
+    uint64_t tstates = 0;
+
+protected:
+    virtual uint8_t read(uint16_t addr) = 0;
+    virtual void write(uint16_t addr, uint8_t data) = 0;
+    virtual uint8_t in(uint16_t port) = 0;
+    virtual void out(uint16_t port, uint8_t data) = 0;
+    // the refresh cycle of an opcode fetch, addr is I:R
+    virtual void refresh(uint16_t) {}
+
+private:
+    uint8_t fetch();
+    uint8_t operand() { return read(pc++); }
+    uint16_t operand16();
+    uint16_t read16(uint16_t addr);
+    void write16(uint16_t addr, uint16_t value);
+    void push(uint16_t value);
+    uint16_t pop();
+
+    uint8_t reg(int n, uint16_t addr);
+    void setReg(int n, uint8_t value, uint16_t addr);
+    uint16_t &pair(int n);
+    bool condition(int n) const;
+    void setA(uint8_t value) { af = (af & 0xff) | value << 8; }
+    void setF(uint8_t value) { af = (af & 0xff00) | value; }
+
+    void alu(int op, uint8_t value);
+    uint8_t inc(uint8_t value);
+    uint8_t dec(uint8_t value);
+    uint8_t rotate(int op, uint8_t value);
+    uint16_t add16(uint16_t a, uint16_t b);
+    void adc16(uint16_t value);
+    void sbc16(uint16_t value);
+    void daa();
+
+    bool prefixCb(uint16_t *index);
+    bool prefixEd();
+
+    uint16_t *m_index = &hl;    // hl, ix or iy for the current instruction
+};
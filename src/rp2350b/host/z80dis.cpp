@@ -0,0 +1,295 @@
+#include "z80dis.h"
+
+#include <cstdio>
+#include <string>
+
+namespace {
+
+const char *const R[] = {"B", "C", "D", "E", "H", "L", "(HL)", "A"};
+const char *const RP[] = {"BC", "DE", "HL", "SP"};
+const char *const RP2[] = {"BC", "DE", "HL", "AF"};
+const char *const CC[] = {"NZ", "Z", "NC", "C", "PO", "PE", "P", "M"};
+const char *const ALU[] = {"ADD A,", "ADC A,", "SUB ", "SBC A,", "AND ", "XOR ", "OR ", "CP "};
+const char *const ROT[] = {"RLC", "RRC", "RL", "RR", "SLA", "SRA", "SLL", "SRL"};
+const char *const IM[] = {"0", "0/1", "1", "2", "0", "0/1", "1", "2"};
+const char *const BLI[4][4] = {{"LDI", "CPI", "INI", "OUTI"},
+                               {"LDD", "CPD", "IND", "OUTD"},
+                               {"LDIR", "CPIR", "INIR", "OTIR"},
+                               {"LDDR", "CPDR", "INDR", "OTDR"}};
+
+std::string hex8(uint8_t value)
+{
+    char s[8];
+    snprintf(s, sizeof(s), "0x%02x", value);
+    return s;
+}
+
+std::string hex16(uint16_t value)
+{
+    char s[8];
+    snprintf(s, sizeof(s), "0x%04x", value);
+    return s;
+}
+
+class Decoder
+{
+public:
+    Decoder(const uint8_t *bytes, uint16_t pc)
+        : m_bytes(bytes)
+        , m_pc(pc)
+    {}
+
+    Z80Insn decode()
+    {
+        std::string text;
+        const uint8_t op = next();
+        if (op == 0xdd || op == 0xfd) {
+            const uint8_t after = m_bytes[1];
+            if (after == 0xdd || after == 0xfd || after == 0xed) {
+                // a prefix on its own, the next one wins
+                text = "NOP*";
+            } else {
+                m_index = op == 0xdd ? "IX" : "IY";
+                text = after == 0xcb ? indexed_cb() : main(next());
+            }
+        } else if (op == 0xcb) {
+            text = cb(next());
+        } else if (op == 0xed) {
+            text = ed(next());
+        } else {
+            text = main(op);
+        }
+        m_insn.length = m_pos;
+        snprintf(m_insn.text, sizeof(m_insn.text), "%s", text.c_str());
+        return m_insn;
+    }
+
+private:
+    uint8_t next() { return m_bytes[m_pos++]; }
+
+    uint16_t word()
+    {
+        const uint8_t lo = next();
+        return lo | next() << 8;
+    }
+
+    std::string hl() const { return m_index ? m_index : "HL"; }
+
+    // r[i], with an index prefix (HL) becomes (IX+d) and H/L its halves
+    // unless the instruction also has an (IX+d)
+    std::string reg(int i, bool halves = true)
+    {
+        if (!m_index)
+            return R[i];
+        if (i == 6) {
+            const int8_t d = next();
+            char s[16];
+            snprintf(s, sizeof(s), "(%s%c0x%02x)", m_index, d < 0 ? '-' : '+', d < 0 ? -d : d);
+            return s;
+        }
+        if (halves && (i == 4 || i == 5))
+            return std::string(m_index) + (i == 4 ? "H" : "L");
+        return R[i];
+    }
+
+    std::string rp(int p) const { return p == 2 ? hl() : RP[p]; }
+    std::string rp2(int p) const { return p == 2 ? hl() : RP2[p]; }
+
+    void jump(Z80Flow flow, uint16_t target, bool conditional)
+    {
+        m_insn.flow = flow;
+        m_insn.target = target;
+        m_insn.conditional = conditional;
+    }
+
+    std::string relative(Z80Flow flow, bool conditional)
+    {
+        const int8_t d = next();
+        const uint16_t target = m_pc + 2 + d;
+        jump(flow, target, conditional);
+        return hex16(target);
+    }
+
+    std::string main(uint8_t op)
+    {
+        const int x = op >> 6, y = (op >> 3) & 7, z = op & 7, p = y >> 1, q = y & 1;
+        switch (x) {
+        case 0:
+            switch (z) {
+            case 0:
+                switch (y) {
+                case 0: return "NOP";
+                case 1: return "EX AF,AF'";
+                case 2: return "DJNZ " + relative(Z80Flow::Jump, true);
+                case 3: return "JR " + relative(Z80Flow::Jump, false);
+                default: {
+                    const std::string cc = CC[y - 4];
+                    return "JR " + cc + "," + relative(Z80Flow::Jump, true);
+                }
+                }
+            case 1:
+                if (!q)
+                    return "LD " + rp(p) + "," + hex16(word());
+                return "ADD " + hl() + "," + rp(p);
+            case 2: {
+                static const char *const Ind[] = {"(BC)", "(DE)"};
+                if (p < 2)
+                    return q ? "LD A," + std::string(Ind[p]) : "LD " + std::string(Ind[p]) + ",A";
+                const std::string nn = std::string("(") + hex16(word()) + ")";
+                if (p == 2)
+                    return q ? "LD " + hl() + "," + nn : "LD " + nn + "," + hl();
+                return q ? "LD A," + nn : "LD " + nn + ",A";
+            }
+            case 3: return (q ? "DEC " : "INC ") + rp(p);
+            case 4: return "INC " + reg(y);
+            case 5: return "DEC " + reg(y);
+            case 6: {
+                const std::string r = reg(y);
+                return "LD " + r + "," + hex8(next());
+            }
+            default: {
+                static const char *const Acc[] = {"RLCA", "RRCA", "RLA", "RRA", "DAA", "CPL", "SCF", "CCF"};
+                return Acc[y];
+            }
+            }
+        case 1:
+            if (op == 0x76) {
+                m_insn.flow = Z80Flow::Halt;
+                return "HALT";
+            } else {
+                // with an (IX+d) the other register is the plain H/L
+                const bool halves = y != 6 && z != 6;
+                const std::string dst = reg(y, halves);
+                return "LD " + dst + "," + reg(z, halves);
+            }
+        case 2:
+            return ALU[y] + reg(z);
+        default:
+            switch (z) {
+            case 0:
+                m_insn.flow = Z80Flow::Return;
+                m_insn.conditional = true;
+                return "RET " + std::string(CC[y]);
+            case 1:
+                if (!q)
+                    return "POP " + rp2(p);
+                switch (p) {
+                case 0:
+                    m_insn.flow = Z80Flow::Return;
+                    return "RET";
+                case 1: return "EXX";
+                case 2:
+                    m_insn.flow = Z80Flow::Indirect;
+                    return "JP (" + hl() + ")";
+                default: return "LD SP," + hl();
+                }
+            case 2: {
+                const uint16_t nn = word();
+                jump(Z80Flow::Jump, nn, true);
+                return "JP " + std::string(CC[y]) + "," + hex16(nn);
+            }
+            case 3:
+                switch (y) {
+                case 0: {
+                    const uint16_t nn = word();
+                    jump(Z80Flow::Jump, nn, false);
+                    return "JP " + hex16(nn);
+                }
+                case 2: return "OUT (" + hex8(next()) + "),A";
+                case 3: return "IN A,(" + hex8(next()) + ")";
+                case 4: return "EX (SP)," + hl();
+                case 5: return "EX DE,HL";
+                case 6: return "DI";
+                case 7: return "EI";
+                default: return "NOP*"; // CB is handled by the caller
+                }
+            case 4: {
+                const uint16_t nn = word();
+                jump(Z80Flow::Call, nn, true);
+                return "CALL " + std::string(CC[y]) + "," + hex16(nn);
+            }
+            case 5:
+                if (!q)
+                    return "PUSH " + rp2(p);
+                if (p == 0) {
+                    const uint16_t nn = word();
+                    jump(Z80Flow::Call, nn, false);
+                    return "CALL " + hex16(nn);
+                }
+                return "NOP*";
+            case 6:
+                return ALU[y] + hex8(next());
+            default:
+                jump(Z80Flow::Call, y * 8, false);
+                return "RST " + hex8(y * 8);
+            }
+        }
+    }
+
+    std::string cb(uint8_t op)
+    {
+        const int x = op >> 6, y = (op >> 3) & 7, z = op & 7;
+        if (!x)
+            return std::string(ROT[y]) + " " + R[z];
+        static const char *const Bit[] = {"", "BIT ", "RES ", "SET "};
+        return Bit[x] + std::to_string(y) + "," + R[z];
+    }
+
+    // DD CB d op: the displacement comes before the opcode
+    std::string indexed_cb()
+    {
+        ++m_pos;
+        const std::string mem = reg(6);
+        const uint8_t op = next();
+        const int x = op >> 6, y = (op >> 3) & 7, z = op & 7;
+        // all but BIT also copy the result to r[z]
+        const std::string copy = (x != 1 && z != 6) ? std::string(",") + R[z] : "";
+        if (!x)
+            return std::string(ROT[y]) + " " + mem + copy;
+        static const char *const Bit[] = {"", "BIT ", "RES ", "SET "};
+        return Bit[x] + std::to_string(y) + "," + mem + copy;
+    }
+
+    std::string ed(uint8_t op)
+    {
+        const int x = op >> 6, y = (op >> 3) & 7, z = op & 7, p = y >> 1, q = y & 1;
+        if (x == 2 && z <= 3 && y >= 4) {
+            if (y >= 6)
+                m_insn.flow = Z80Flow::Repeat;
+            return BLI[y - 4][z];
+        }
+        if (x != 1)
+            return "NOP*";
+        switch (z) {
+        case 0: return y == 6 ? "IN (C)" : "IN " + std::string(R[y]) + ",(C)";
+        case 1: return y == 6 ? "OUT (C),0" : "OUT (C)," + std::string(R[y]);
+        case 2: return (q ? "ADC HL," : "SBC HL,") + std::string(RP[p]);
+        case 3: {
+            const std::string nn = std::string("(") + hex16(word()) + ")";
+            return q ? "LD " + std::string(RP[p]) + "," + nn : "LD " + nn + "," + RP[p];
+        }
+        case 4: return "NEG";
+        case 5:
+            m_insn.flow = Z80Flow::Return;
+            return y == 1 ? "RETI" : "RETN";
+        case 6: return "IM " + std::string(IM[y]);
+        default: {
+            static const char *const Misc[] = {"LD I,A", "LD R,A", "LD A,I", "LD A,R", "RRD", "RLD", "NOP*", "NOP*"};
+            return Misc[y];
+        }
+        }
+    }
+
+    const uint8_t *m_bytes;
+    uint16_t m_pc;
+    int m_pos = 0;
+    const char *m_index = nullptr;
+    Z80Insn m_insn;
+};
+
+} // namespace
+
+Z80Insn z80_disassemble(const uint8_t *bytes, uint16_t pc)
+{
+    return Decoder(bytes, pc).decode();
+}
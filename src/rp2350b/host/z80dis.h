@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+// Z80 disassembler for the trace tools.
+//
+// All the documented instructions plus the IXH/IXL/IYH/IYL forms, SLL and the
+// DDCB/FDCB ones copying their result to a register. Besides the text it
+// tells where the next fetch can be: zxtrace follows the instruction stream
+// of a bus trace with it.
+
+enum class Z80Flow : uint8_t {
+    Next,       // falls through
+    Jump,       // JP/JR/DJNZ nn, conditional ones fall through too
+    Call,       // CALL/RST nn
+    Return,     // RET/RETI/RETN, the next fetch is not known
+    Indirect,   // JP (HL)/(IX)/(IY), nor is it here
+    Repeat,     // LDIR and friends: the same instruction again, or the next
+    Halt,
+};
+
+struct Z80Insn
+{
+    uint8_t length = 1;
+    Z80Flow flow = Z80Flow::Next;
+    bool conditional = false;
+    uint16_t target = 0;        // Jump and Call
+    char text[24] = {};
+};
+
+// Disassembles the instruction of bytes, read from pc; bytes holds 4 of them.
+Z80Insn z80_disassemble(const uint8_t *bytes, uint16_t pc);
@@ -0,0 +1,196 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Decodes the live screen stream of screencast.cpp and shows what it cost.
+//
+// The capture is what came over USB while the stream ran, the frames found
+// by their magic, console output and bus trace frames in between skipped.
+// Every frame is applied to the screen the way a viewer would, a frame lost
+// or failing its check makes it wait for the next key frame.
+//
+// Prints the bytes a frame took, the lines in it and how often the link fell
+// behind the 50 Hz ticks. --scr saves the last screen, --ppm every frame as
+// a 256x192 picture, --frames lists them.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "castfile.h"
+#include "tracefile.h"
+
+namespace {
+
+constexpr uint32_t Width = 256;
+constexpr uint32_t Height = 192;
+
+struct Options
+{
+    const char *capture = nullptr;
+    const char *scr = nullptr;
+    const char *ppm = nullptr;
+    bool frames = false;
+};
+
+// the ULA colours, normal then bright
+constexpr uint8_t Palette[16][3] = {
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0xd7}, {0xd7, 0x00, 0x00}, {0xd7, 0x00, 0xd7},
+    {0x00, 0xd7, 0x00}, {0x00, 0xd7, 0xd7}, {0xd7, 0xd7, 0x00}, {0xd7, 0xd7, 0xd7},
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0xff}, {0xff, 0x00, 0x00}, {0xff, 0x00, 0xff},
+    {0x00, 0xff, 0x00}, {0x00, 0xff, 0xff}, {0xff, 0xff, 0x00}, {0xff, 0xff, 0xff},
+};
+
+bool write_file(const std::string &path, const void *data, size_t size, const char *header = "")
+{
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) {
+        perror(path.c_str());
+        return false;
+    }
+    const bool ok = fputs(header, f) >= 0 && fwrite(data, 1, size, f) == size;
+    if (fclose(f) != 0 || !ok) {
+        perror(path.c_str());
+        return false;
+    }
+    return true;
+}
+
+// flash shown as its first phase
+bool write_ppm(const std::string &path, const uint8_t *screen)
+{
+    static uint8_t image[Height][Width][3];
+    for (uint32_t y = 0; y < Height; ++y) {
+        const uint32_t row = (y & 0xc0) << 5 | (y & 0x07) << 8 | (y & 0x38) << 2;
+        for (uint32_t x = 0; x < 32; ++x) {
+            const uint8_t pixels = screen[row | x];
+            const uint8_t attr = screen[6144 + y / 8 * 32 + x];
+            const uint32_t bright = attr & 0x40 ? 8 : 0;
+            for (uint32_t bit = 0; bit < 8; ++bit) {
+                const uint32_t colour = pixels & 0x80 >> bit ? attr & 7 : attr >> 3 & 7;
+                memcpy(image[y][x * 8 + bit], Palette[colour | bright], 3);
+            }
+        }
+    }
+    char header[32];
+    snprintf(header, sizeof(header), "P6\n%u %u\n255\n", Width, Height);
+    return write_file(path, image, sizeof(image), header);
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options] capture\n"
+           "  --scr FILE       save the last screen as a .SCR\n"
+           "  --ppm DIR        save every frame as DIR/frameNNNNNN.ppm\n"
+           "  --frames         list the frames\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--scr")
+            opts.scr = value();
+        else if (arg == "--ppm")
+            opts.ppm = value();
+        else if (arg == "--frames")
+            opts.frames = true;
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg[0] != '-' && !opts.capture)
+            opts.capture = argv[i];
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.capture;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    const MappedFile file(opts.capture);
+    if (!file.isOpen())
+        return 2;
+    CastReader reader(file.data(), file.size());
+
+    CastFrame frame;
+    uint64_t bytes = 0;
+    uint64_t lines = 0;
+    uint64_t ticks = 0;
+    uint64_t late = 0;
+    uint32_t maxFrame = 0;
+    uint32_t firstStamp = 0;
+    uint32_t lastStamp = 0;
+    while (reader.next(frame)) {
+        if (reader.frames() == 1)
+            firstStamp = frame.stamp;
+        else
+            ticks += frame.ticks;
+        late += frame.ticks > 1 ? frame.ticks - 1 : 0;
+        lastStamp = frame.stamp;
+        bytes += frame.size;
+        lines += frame.lines;
+        maxFrame = std::max(maxFrame, frame.size);
+        if (opts.frames)
+            printf("%6u %s %3u lines %5u bytes at %10uus, %u ticks\n", frame.seq, frame.key ? "key" : "   ",
+                   frame.lines, frame.size, frame.stamp, frame.ticks);
+        if (opts.ppm) {
+            char name[32];
+            snprintf(name, sizeof(name), "/frame%06" PRIu64 ".ppm", reader.frames() - 1);
+            if (!write_ppm(opts.ppm + std::string(name), reader.screen()))
+                return 1;
+        }
+    }
+    if (opts.scr && reader.frames() && !write_file(opts.scr, reader.screen(), ScreenBytes))
+        return 1;
+
+    printf("%s: %zu bytes, %" PRIu64 " frames, %" PRIu64 " key, %" PRIu64 " bad or lost, %" PRIu64
+           " waiting for a key frame, %" PRIu64 " bytes between them\n",
+           opts.capture, file.size(), reader.frames(), reader.keyFrames(), reader.badFrames(), reader.waited(),
+           reader.skipped());
+    if (!reader.frames())
+        return 1;
+    const double seconds = (lastStamp - firstStamp) / 1e6;
+    printf("%.0f bytes a frame, %u at most, %.1f lines a frame, %" PRIu64 " of %" PRIu64
+           " ticks without a frame of their own\n",
+           double(bytes) / reader.frames(), maxFrame, double(lines) / reader.frames(), late, ticks);
+    if (seconds > 0)
+        printf("%.2f s, %.1f frames/s, %.1f KB/s\n", seconds, (reader.frames() - 1) / seconds,
+               bytes / seconds / 1024);
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "zxmachine.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "sim.h"
+#include "zx.h"
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+constexpr int MreqSm = 0;
+constexpr int IorqSm = 1;
+constexpr int SnoopSm = 2;
+
+uint32_t bus_transaction(int sm, uint32_t bus)
+{
+    sim::pio_rx_push(sm, bus);
+    uint32_t out = 0;
+    uint64_t cycle;
+    for (int poll = 0; poll < 4; ++poll) {
+        zx_poll();
+        while (sim::pio_tx_pop(sm, out, cycle)) {
+            // mreq words are a hold flag and the data, see zx.pio
+            if (sm != MreqSm)
+                return out;
+            if (!(out & 1))
+                return out >> 1;
+        }
+    }
+    fprintf(stderr, "bus word %08x was never answered\n", bus);
+    exit(1);
+}
+
+} // namespace
+
+void ZxMachine::reset(bool zx128)
+{
+    Z80::reset();
+    this->zx128 = zx128;
+    memset(banks, 0x55, sizeof(banks));
+    port7ffd = 0;
+    border = 0;
+    undriven = 0;
+}
+
+uint8_t *ZxMachine::ram(uint16_t addr)
+{
+    static const uint8_t map48[4] = {0, 5, 2, 0};
+    const int slot = addr >> 14;
+    const int n = slot == 3 && zx128 ? port7ffd & 7 : map48[slot];
+    return &banks[n][addr & 0x3fff];
+}
+
+uint8_t ZxMachine::read(uint16_t addr)
+{
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE);
+    bus &= ~((1u << I_MREQ_L) | (1u << I_RD_L));
+    bus |= 1u << I_ZXRDWR;
+    const uint32_t out = bus_transaction(MreqSm, bus);
+    if (addr >= 0x4000)
+        return *ram(addr);
+    if ((out & 0xff00) != 0xff00)
+        ++undriven;
+    return out;
+}
+
+void ZxMachine::write(uint16_t addr, uint8_t data)
+{
+    if (addr >= 0x4000)
+        *ram(addr) = data;
+    // mreq samples the bus on /MREQ, /WR is still high, the data already out
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE) | data;
+    bus &= ~(1u << I_MREQ_L);
+    bus_transaction(MreqSm, bus);
+    if (!(sim::PioEnabled & 1u << SnoopSm))
+        return;
+    bus &= ~(1u << I_WR_L);
+    bus |= 1u << I_ZXRDWR;
+    sim::pio_rx_push(SnoopSm, bus);
+    zx_poll();
+}
+
+uint8_t ZxMachine::in(uint16_t port)
+{
+    uint32_t bus = ControlIdle | (uint32_t(port) << I_ADDR_BASE);
+    bus &= ~((1u << I_IORQ_L) | (1u << I_RD_L));
+    bus |= 1u << I_ZXRDWR;
+    const uint32_t out = bus_transaction(IorqSm, bus);
+    // nobody drives the bus: the ULA with no key pressed and EAR high
+    return (out & 0xff00) ? out : 0xff;
+}
+
+void ZxMachine::out(uint16_t port, uint8_t data)
+{
+    uint32_t bus = ControlIdle | (uint32_t(port) << I_ADDR_BASE);
+    bus &= ~((1u << I_IORQ_L) | (1u << I_WR_L));
+    bus |= (1u << I_ZXRDWR) | data;
+    bus_transaction(IorqSm, bus);
+    if (zx128 && !(port & 0x8002) && !(port7ffd & 0x20))
+        port7ffd = data;
+    if (!(port & 1))
+        border = data & 7;
+}
+
+void ZxMachine::refresh(uint16_t addr)
+{
+    // /MREQ without /RD or /WR
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE);
+    bus &= ~(1u << I_MREQ_L);
+    bus_transaction(MreqSm, bus);
+}
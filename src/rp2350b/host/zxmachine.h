@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+#include "z80.h"
+
+// The Spectrum around the host Z80: every MREQ cycle, reads, writes and the
+// refresh of each opcode fetch, and every port access goes through zx_poll()
+// as a bus word, like the PIO programs push them. The RAM itself is local.
+// Every memory write also goes to the zx_snoop state machine while it runs,
+// like on the bus. 48K, or 128K with the 0x7ffd paging when zx128 is set.
+class ZxMachine : public Z80
+{
+public:
+    static constexpr int Banks = 8;
+    static constexpr uint32_t BankSize = 0x4000;
+
+    void reset(bool zx128);
+    uint8_t *ram(uint16_t addr);
+
+    uint8_t read(uint16_t addr) override;
+    void write(uint16_t addr, uint8_t data) override;
+    uint8_t in(uint16_t port) override;
+    void out(uint16_t port, uint8_t data) override;
+    void refresh(uint16_t addr) override;
+
+    bool zx128 = false;
+    uint8_t banks[Banks][BankSize];
+    uint8_t port7ffd = 0;
+    uint8_t border = 0;
+    uint32_t undriven = 0; // ROM reads IFp did not drive
+};
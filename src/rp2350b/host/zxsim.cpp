@@ -0,0 +1,334 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Replays Z80 bus words through zx_poll() and checks the modelled service
+// time of every transaction against the T-state budget of a MREQ read.
+//
+// A trace is a sequence of 32 bit words exactly as the PIO programs push
+// them (see zx.pio): raw little endian words, or with --text one hex word per
+// line ('#' starts a comment). Words with /MREQ low go to the mreq state
+// machine, words with /IORQ low to the iorq one.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "rombank.h"
+#include "sim.h"
+#include "zpi.h"
+#include "zx.h"
+
+namespace {
+
+constexpr uint32_t ControlIdle = (1u << I_MREQ_L) | (1u << I_IORQ_L) | (1u << I_RD_L) | (1u << I_WR_L);
+
+enum Kind : uint8_t {
+    MreqRead,
+    MreqWrite,
+    IorqRead,
+    IorqWrite,
+    KindCount
+};
+
+const char *const KindNames[KindCount] = {"mreq rd", "mreq wr", "iorq rd", "iorq wr"};
+
+struct Options
+{
+    const char *trace = nullptr;
+    bool text = false;
+    bool verbose = false;
+    bool testRom = false;
+    uint32_t synth = 0;
+    double sysMHz = 150;
+    double zxMHz = 3.5469;
+    double budgetT = 1.5;  // /MREQ falling edge in T1 to the data sample on the rising edge of T3
+    uint32_t pioCycles = 6; // input synchronizers, in + push, pull + out
+};
+
+struct Stats
+{
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+
+    void add(uint64_t cycles)
+    {
+        ++count;
+        total += cycles;
+        min = std::min(min, cycles);
+        max = std::max(max, cycles);
+    }
+};
+
+uint32_t bus_word(Kind kind, uint16_t addr, uint8_t data)
+{
+    uint32_t bus = ControlIdle | (uint32_t(addr) << I_ADDR_BASE);
+    switch (kind) {
+    case MreqRead:
+        // M1 and memory reads: /MREQ and /RD fall together
+        bus &= ~((1u << I_MREQ_L) | (1u << I_RD_L));
+        bus |= 1u << I_ZXRDWR;
+        break;
+    case MreqWrite:
+        // the mreq program samples on /MREQ, /WR is still high at that point
+        bus &= ~(1u << I_MREQ_L);
+        bus |= data;
+        break;
+    case IorqRead:
+        bus &= ~((1u << I_IORQ_L) | (1u << I_RD_L));
+        bus |= 1u << I_ZXRDWR;
+        break;
+    case IorqWrite:
+        bus &= ~((1u << I_IORQ_L) | (1u << I_WR_L));
+        bus |= (1u << I_ZXRDWR) | data;
+        break;
+    default:
+        break;
+    }
+    return bus;
+}
+
+Kind bus_kind(uint32_t bus)
+{
+    if (!(bus & (1u << I_MREQ_L)))
+        return (bus & (1u << I_RD_L)) ? MreqWrite : MreqRead;
+    return (bus & (1u << I_RD_L)) ? IorqWrite : IorqRead;
+}
+
+// A crude Z80 workload: mostly ROM fetches with some RAM traffic, port 0xfe
+// and joystick reads, and the occasional trap address.
+std::vector<uint32_t> synth_trace(uint32_t count)
+{
+    std::vector<uint32_t> trace;
+    trace.reserve(count);
+    uint32_t seed = 0x1f0e5eedu;
+    auto rnd = [&seed] {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    };
+    const uint8_t ports[] = {0xfe, 0x1f, 0x7f, 0x03};
+    uint16_t pc = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t r = rnd() % 100;
+        if (r < 55) {
+            trace.push_back(bus_word(MreqRead, pc, 0));
+            pc = (pc + 1) & 0x3fff;
+        } else if (r < 57) {
+            static const uint16_t traps[] = {0x0066, 0x0008, 0x1708};
+            trace.push_back(bus_word(MreqRead, traps[rnd() % 3], 0));
+        } else if (r < 75) {
+            trace.push_back(bus_word(MreqRead, 0x4000 + rnd() % 0xc000, 0));
+        } else if (r < 90) {
+            trace.push_back(bus_word(MreqWrite, 0x4000 + rnd() % 0xc000, rnd()));
+        } else if (r < 96) {
+            trace.push_back(bus_word(IorqRead, (rnd() & 0xff00) | ports[rnd() % 4], 0));
+        } else {
+            trace.push_back(bus_word(IorqWrite, (rnd() & 0xff00) | ports[rnd() % 4], rnd()));
+        }
+    }
+    return trace;
+}
+
+bool load_trace(const Options &opts, std::vector<uint32_t> &trace)
+{
+    FILE *f = fopen(opts.trace, opts.text ? "r" : "rb");
+    if (!f) {
+        perror(opts.trace);
+        return false;
+    }
+    if (opts.text) {
+        char line[256];
+        while (fgets(line, sizeof(line), f)) {
+            char *end = strchr(line, '#');
+            if (end)
+                *end = 0;
+            char *p = line;
+            while (*p == ' ' || *p == '\t')
+                ++p;
+            if (*p == '\n' || !*p)
+                continue;
+            trace.push_back(uint32_t(strtoul(p, nullptr, 16)));
+        }
+    } else {
+        uint8_t word[4];
+        while (fread(word, 1, 4, f) == 4)
+            trace.push_back(word[0] | word[1] << 8 | word[2] << 16 | uint32_t(word[3]) << 24);
+    }
+    fclose(f);
+    return true;
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options] [trace]\n"
+           "  --text           trace is text, one hex bus word per line\n"
+           "  --synth N        replay N synthetic transactions instead of a trace\n"
+           "  --test-rom       serve testrom.bin instead of the 48K ROM\n"
+           "  --clock MHZ      RP2350 system clock (default 150)\n"
+           "  --zx-clock MHZ   Z80 clock (default 3.5469)\n"
+           "  --budget T       T-states from /MREQ to data sampled (default 1.5)\n"
+           "  --pio CYCLES     fixed PIO overhead per transaction (default 6)\n"
+           "  --verbose        print every transaction\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--text")
+            opts.text = true;
+        else if (arg == "--synth")
+            opts.synth = strtoul(value(), nullptr, 0);
+        else if (arg == "--test-rom")
+            opts.testRom = true;
+        else if (arg == "--clock")
+            opts.sysMHz = atof(value());
+        else if (arg == "--zx-clock")
+            opts.zxMHz = atof(value());
+        else if (arg == "--budget")
+            opts.budgetT = atof(value());
+        else if (arg == "--pio")
+            opts.pioCycles = strtoul(value(), nullptr, 0);
+        else if (arg == "--verbose")
+            opts.verbose = true;
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg[0] != '-' && !opts.trace)
+            opts.trace = argv[i];
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.trace || opts.synth;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::vector<uint32_t> trace;
+    if (opts.synth)
+        trace = synth_trace(opts.synth);
+    else if (!load_trace(opts, trace))
+        return 2;
+
+    sim::pio_reset();
+    // the images the firmware has built in, traps included
+    rombank_select(rombank_add(BuiltinRoms[opts.testRom ? 1 : 0]));
+    zpi_init(nullptr);
+    zx_init();
+
+    // what one trip around the loop costs when nothing is pending; a word that
+    // lands right after its state machine was checked waits for that long
+    const uint64_t idleStart = sim::Cycles;
+    zx_poll();
+    const uint64_t idleCycles = sim::Cycles - idleStart;
+
+    const uint64_t budget = uint64_t(opts.budgetT / opts.zxMHz * opts.sysMHz);
+    constexpr int MreqSm = 0;
+    constexpr int IorqSm = 1;
+
+    Stats service[KindCount];
+    Stats worst[KindCount];
+    uint64_t overBudget = 0;
+    uint64_t lost = 0;
+
+    for (size_t i = 0; i < trace.size(); ++i) {
+        const uint32_t bus = trace[i];
+        const Kind kind = bus_kind(bus);
+        const int sm = (kind == MreqRead || kind == MreqWrite) ? MreqSm : IorqSm;
+
+        sim::pio_rx_push(sm, bus);
+        const uint64_t start = sim::Cycles;
+        uint32_t outData = 0;
+        uint64_t pushed = 0;
+        bool served = false;
+        for (int poll = 0; poll < 4 && !served; ++poll) {
+            zx_poll();
+            served = sim::pio_tx_pop(sm, outData, pushed);
+        }
+        // mreq words are a hold flag and the data, see zx.pio
+        if (sm == MreqSm)
+            outData >>= 1;
+        if (!served) {
+            ++lost;
+            continue;
+        }
+
+        const uint64_t cycles = pushed - start;
+        const uint64_t latency = cycles + idleCycles + opts.pioCycles;
+        service[kind].add(cycles);
+        worst[kind].add(latency);
+        const bool late = kind == MreqRead && latency > budget;
+        overBudget += late;
+
+        if (opts.verbose || late)
+            printf("%8zu %s %04x  bus %08x  out %06x  service %3" PRIu64 "  worst %3" PRIu64 "%s\n",
+                   i, KindNames[kind], bus >> I_ADDR_BASE, bus, outData, cycles, latency,
+                   late ? "  OVER BUDGET" : "");
+    }
+
+    printf("%zu transactions, %.1f MHz system clock, %.4f MHz Z80\n", trace.size(), opts.sysMHz, opts.zxMHz);
+    printf("idle loop %" PRIu64 " cycles, PIO overhead %u cycles\n", idleCycles, opts.pioCycles);
+    printf("cost model: FSTAT %u, FIFO %u/%u, SIO %u, hot call %u cycles, the code inside a call is free\n",
+           unsigned(sim::Costs.fstat), unsigned(sim::Costs.rxf), unsigned(sim::Costs.txf), unsigned(sim::Costs.sio),
+           unsigned(sim::Costs.call));
+    printf("MREQ read budget %.2f T = %.0f ns = %" PRIu64 " cycles\n\n", opts.budgetT,
+           opts.budgetT / opts.zxMHz * 1000, budget);
+    printf("%-8s %10s %8s %8s %8s %8s\n", "kind", "count", "min", "avg", "max", "worst");
+    for (int k = 0; k < KindCount; ++k) {
+        const Stats &s = service[k];
+        if (!s.count)
+            continue;
+        printf("%-8s %10" PRIu64 " %8" PRIu64 " %8.1f %8" PRIu64 " %8" PRIu64 "\n", KindNames[k], s.count, s.min,
+               double(s.total) / s.count, s.max, worst[k].max);
+    }
+
+    if (lost)
+        printf("\n%" PRIu64 " transactions were never answered\n", lost);
+
+    const uint64_t margin = worst[MreqRead].max <= budget ? budget - worst[MreqRead].max : 0;
+    if (overBudget) {
+        printf("\nFAIL: %" PRIu64 " MREQ reads over budget\n", overBudget);
+        return 1;
+    }
+    printf("\nOK: worst MREQ read %" PRIu64 " of %" PRIu64 " cycles (%" PRIu64 " cycles margin)\n",
+           worst[MreqRead].max, budget, margin);
+    return lost ? 1 : 0;
+}
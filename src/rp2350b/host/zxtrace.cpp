@@ -0,0 +1,623 @@
+// -----------------------------------------------------------------------------
+// This file is part of IfP "Interface Pico"
+// Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+// -----------------------------------------------------------------------------
+
+// Decodes a bus trace and tells where the Z80 spent its time.
+//
+// The capture is what trace.cpp streams over USB (found by its magic, console
+// output in between is skipped) or, with --raw or when no frame checks out,
+// raw little endian u32 bus words as zxsim reads them. It is mapped and read
+// once front to back with a fixed amount of state, so a capture of a few GB
+// costs the time to read it and no more memory than a small one.
+//
+// The mreq program samples the bus when /MREQ falls, before the data of a
+// read is there: the instructions are disassembled from a memory image
+// instead, the ROM (--rom, the 48K one by default) plus every MREQ write seen
+// so far. A read is an opcode fetch (M1) when the next word is its refresh
+// cycle: an MREQ word without /RD at I:R, R going up by one on each of them.
+// Captures without refresh words (zxsim, the "rom rd" filter) fall back to
+// following the instruction stream: a read is a fetch when the instruction
+// before it can continue there. --instructions checks the count against what
+// the capture is known to hold, tracebench prints it.
+//
+// Prints the instructions fetched most often, the cycles spent on them when
+// the capture has stamps, the same by ROM routine (--labels, the 48K ROM ones
+// by default) and the I/O ports in use. --events lists the decoded words.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tracefile.h"
+#include "z80dis.h"
+#include "zx.pio.h"
+
+extern const unsigned char __48_rom[];
+
+namespace {
+
+constexpr uint32_t RomSize = 0x4000;
+constexpr int RefreshLock = 4;          // refresh words in a row with R in sequence
+constexpr int RefreshLost = 64;         // reads in a row without one
+constexpr int ResyncReads = 16;         // reads in a row not following the stream
+
+struct Options
+{
+    const char *trace = nullptr;
+    const char *rom = nullptr;
+    const char *labels = nullptr;
+    bool raw = false;
+    uint32_t top = 20;
+    bool events = false;
+    uint64_t from = 0;
+    uint64_t count = 100;
+    uint64_t instructions = 0;  // expected, 0 for any
+};
+
+struct Label
+{
+    uint16_t addr;
+    std::string name;
+};
+
+// The 48K ROM entry points, from "The Complete Spectrum ROM Disassembly"
+const Label Rom48Labels[] = {
+    {0x0000, "START"},     {0x0008, "ERROR_1"},   {0x0010, "PRINT_A_1"}, {0x0018, "GET_CHAR"},
+    {0x0020, "NEXT_CHAR"}, {0x0028, "FP_CALC"},   {0x0030, "BC_SPACES"}, {0x0038, "MASK_INT"},
+    {0x0066, "RESET"},     {0x028e, "KEY_SCAN"},  {0x02bf, "KEYBOARD"},  {0x03b5, "BEEPER"},
+    {0x03f8, "BEEP"},      {0x04c2, "SA_BYTES"},  {0x0556, "LD_BYTES"},  {0x05e3, "LD_EDGE_2"},
+    {0x05e7, "LD_EDGE_1"}, {0x0605, "SAVE_ETC"},  {0x0802, "LD_BLOCK"},  {0x09f4, "PRINT_OUT"},
+    {0x0d6b, "CLS"},       {0x0daf, "CL_ALL"},    {0x0e44, "CL_LINE"},   {0x0eac, "COPY"},
+    {0x0f2c, "EDITOR"},    {0x10a8, "KEY_INPUT"}, {0x11b7, "NEW"},       {0x11cb, "START_NEW"},
+    {0x11da, "RAM_CHECK"}, {0x12a2, "MAIN_EXEC"}, {0x15d4, "WAIT_KEY"},  {0x1601, "CHAN_OPEN"},
+    {0x1655, "MAKE_ROOM"}, {0x16b0, "SET_MIN"},   {0x1795, "AUTO_LIST"}, {0x1b17, "LINE_SCAN"},
+    {0x1b8a, "LINE_RUN"},  {0x1e80, "POKE"},      {0x1e94, "FIND_INT1"}, {0x1e99, "FIND_INT2"},
+    {0x1f3a, "PAUSE"},     {0x1f54, "BREAK_KEY"}, {0x1fcd, "PRINT"},     {0x2089, "INPUT"},
+    {0x2294, "BORDER"},    {0x22aa, "PIXEL_ADD"}, {0x22dc, "PLOT"},      {0x24fb, "SCANNING"},
+    {0x2aff, "LET"},       {0x2bf1, "STK_FETCH"}, {0x2d28, "STACK_A"},   {0x2d2b, "STACK_BC"},
+    {0x2da2, "FP_TO_BC"},  {0x2dd5, "FP_TO_A"},   {0x2de3, "PRINT_FP"},  {0x3014, "ADDITION"},
+    {0x30ca, "MULTIPLY"},  {0x31af, "DIVISION"},  {0x335b, "CALCULATE"}, {0x3d00, "CHAR_SET"},
+};
+
+enum Kind : uint8_t {
+    MreqRead,
+    MreqWrite,
+    Refresh,
+    IorqRead,
+    IorqWrite,
+    KindCount
+};
+
+const char *const KindNames[KindCount] = {"mreq rd", "mreq wr", "refresh", "iorq rd", "iorq wr"};
+
+// The instruction stream of a capture, fed one word at a time
+class Decoder
+{
+public:
+    Decoder(const Options &opts, const uint8_t *rom)
+        : m_opts(opts)
+    {
+        memcpy(m_memory, rom, RomSize);
+    }
+
+    void add(const TraceWord &word);
+    void finish() { flush(false); }
+
+    uint64_t kinds[KindCount] = {};
+    uint64_t words = 0;
+    uint64_t instructions = 0;
+    uint64_t resyncs = 0;
+    uint64_t refreshLocks = 0;
+    uint64_t cycles = 0;        // attributed to the instructions
+
+    // by address
+    uint64_t fetches[0x10000] = {};
+    uint64_t fetchCycles[0x10000] = {};
+    uint64_t portReads[0x100] = {};
+    uint64_t portWrites[0x100] = {};
+
+    const Z80Insn &insn(uint16_t addr);
+
+private:
+    void read(uint16_t addr);
+    void write(uint16_t addr, uint8_t data);
+    void flush(bool m1);
+    void fetch(uint16_t addr);
+    bool follows(uint16_t addr) const;
+    bool refresh(uint16_t addr, bool afterRead);
+    void lose();
+    void event(Kind kind, uint16_t addr, uint8_t data, const char *text = "");
+
+    const Options &m_opts;
+    uint8_t m_memory[0x10000] = {};
+    Z80Insn m_insns[0x10000];
+    bool m_decoded[0x10000] = {};
+
+    TraceWord m_word;
+    bool m_pending = false;     // a read waiting for the word after it
+    TraceWord m_pendingWord;
+    uint64_t m_pendingIndex = 0;
+
+    // where the instruction stream is
+    bool m_any = true;          // next fetch can be anywhere
+    uint16_t m_pc = 0;          // of the last instruction
+    uint16_t m_operand = 0;     // next byte of it
+    int m_operands = 0;         // bytes of it left to read
+    int m_strays = 0;           // reads in a row not following it
+    bool m_ramSeen = false;     // the capture has RAM reads
+
+    // refresh cycles
+    bool m_locked = false;
+    int m_streak = 0;
+    uint16_t m_lastRefresh = 0;
+    int m_sinceRefresh = 0;
+    bool m_newI = false;        // LD I,A fetched, a refresh after it has the new I
+
+    // cycle attribution
+    bool m_stamped = false;
+    uint16_t m_lastFetch = 0;
+    uint32_t m_lastFetchCycles = 0;
+};
+
+const Z80Insn &Decoder::insn(uint16_t addr)
+{
+    if (!m_decoded[addr]) {
+        uint8_t bytes[4];
+        for (int i = 0; i < 4; ++i)
+            bytes[i] = m_memory[uint16_t(addr + i)];
+        m_insns[addr] = z80_disassemble(bytes, addr);
+        m_decoded[addr] = true;
+    }
+    return m_insns[addr];
+}
+
+void Decoder::event(Kind kind, uint16_t addr, uint8_t data, const char *text)
+{
+    const uint64_t index = kind == MreqRead ? m_pendingIndex : words - 1;
+    if (!m_opts.events || index < m_opts.from || index - m_opts.from >= m_opts.count)
+        return;
+    const uint32_t stamp = kind == MreqRead ? m_pendingWord.cycles : m_word.cycles;
+    printf("%10" PRIu64 " %10u  %-7s %04x", index, stamp, KindNames[kind], addr);
+    if (kind == MreqWrite || kind == IorqWrite)
+        printf(" %02x", data);
+    else
+        printf("   ");
+    if (*text)
+        printf("  %s", text);
+    printf("\n");
+}
+
+// the stream went somewhere the capture cannot follow
+void Decoder::lose()
+{
+    m_any = true;
+    m_operands = 0;
+    m_strays = 0;
+    m_stamped = false;
+}
+
+bool Decoder::follows(uint16_t addr) const
+{
+    // the interrupt and NMI can come after any instruction
+    if (m_any || addr == 0x0038 || addr == 0x0066)
+        return true;
+    const Z80Insn &last = m_insns[m_pc];
+    const uint16_t next = m_pc + last.length;
+    switch (last.flow) {
+    case Z80Flow::Next:
+        return addr == next;
+    case Z80Flow::Jump:
+    case Z80Flow::Call:
+        // a call can go where the capture does not see, and come back
+        if (addr == last.target || ((last.conditional || last.flow == Z80Flow::Call) && addr == next))
+            return true;
+        return last.target >= RomSize && !m_ramSeen;
+    case Z80Flow::Repeat:
+        return addr == m_pc || addr == next;
+    case Z80Flow::Halt:
+        return addr == m_pc || addr == uint16_t(m_pc + 1);
+    default:
+        return true;
+    }
+}
+
+void Decoder::fetch(uint16_t addr)
+{
+    const Z80Insn &i = insn(addr);
+    ++instructions;
+    ++fetches[addr];
+    if (m_stamped && !m_pendingWord.gap) {
+        const uint32_t spent = m_pendingWord.cycles - m_lastFetchCycles;
+        fetchCycles[m_lastFetch] += spent;
+        cycles += spent;
+    }
+    m_stamped = !m_opts.raw && m_pendingWord.cycles;
+    m_lastFetch = addr;
+    m_lastFetchCycles = m_pendingWord.cycles;
+
+    m_pc = addr;
+    m_any = i.flow == Z80Flow::Return || i.flow == Z80Flow::Indirect;
+    m_operand = addr + 1;
+    m_operands = i.length - 1;
+    m_strays = 0;
+    m_newI = m_memory[addr] == 0xed && m_memory[uint16_t(addr + 1)] == 0x47;
+    event(MreqRead, addr, 0, i.text);
+}
+
+// decides what the pending read was, m1 when a refresh word followed it
+void Decoder::flush(bool m1)
+{
+    if (!m_pending)
+        return;
+    m_pending = false;
+    const uint16_t addr = m_pendingWord.bus >> I_ADDR_BASE;
+    ++kinds[MreqRead];
+    if (addr >= RomSize)
+        m_ramSeen = true;
+
+    if (m_operands && addr == m_operand) {
+        // the bytes after the opcode, DD CB d op reads two of them with M1
+        ++m_operand;
+        --m_operands;
+        event(MreqRead, addr, 0, "");
+        return;
+    }
+    if (m_locked ? m1 : follows(addr)) {
+        fetch(addr);
+        return;
+    }
+
+    m_operands = 0;
+    event(MreqRead, addr, 0, "");
+    if (!m_locked && ++m_strays >= ResyncReads) {
+        // data reads only for a while: the stream is lost
+        ++resyncs;
+        lose();
+    }
+}
+
+// true when a word without /RD is a refresh cycle; the one of the read before
+// it, or once locked the one of an interrupt acknowledge, which the PIO does
+// not see and which takes an R step of its own
+bool Decoder::refresh(uint16_t addr, bool afterRead)
+{
+    const uint8_t step = (addr - m_lastRefresh) & 0x7f;
+    const uint16_t same = m_locked && m_newI ? 0x0080 : 0xff80;
+    const bool inSequence = (addr & same) == (m_lastRefresh & same) && (step == 1 || (m_locked && step == 2));
+    if (m_locked) {
+        if (!inSequence)
+            return false;
+        if ((addr ^ m_lastRefresh) & 0xff00)
+            m_newI = false;
+    } else if (!afterRead) {
+        return false;
+    } else if (inSequence) {
+        if (++m_streak >= RefreshLock) {
+            m_locked = true;
+            ++refreshLocks;
+        }
+    } else {
+        m_streak = 1;
+    }
+    m_lastRefresh = addr;
+    m_sinceRefresh = 0;
+    return m_locked || m_streak > 1;
+}
+
+void Decoder::read(uint16_t)
+{
+    flush(false);
+    if (m_locked && ++m_sinceRefresh > RefreshLost) {
+        // LD R,A or a capture without them from here on
+        m_locked = false;
+        m_streak = 0;
+    }
+    m_pending = true;
+    m_pendingWord = m_word;
+    m_pendingIndex = words - 1;
+}
+
+void Decoder::write(uint16_t addr, uint8_t data)
+{
+    m_memory[addr] = data;
+    for (int i = 0; i < 4; ++i)
+        m_decoded[uint16_t(addr - i)] = false;
+}
+
+void Decoder::add(const TraceWord &word)
+{
+    ++words;
+    m_word = word;
+    if (word.gap) {
+        flush(false);
+        lose();
+        m_locked = false;
+        m_streak = 0;
+    }
+
+    const uint32_t bus = word.bus;
+    const uint16_t addr = bus >> I_ADDR_BASE;
+    const uint8_t data = bus;
+    if (!(bus & (1u << I_MREQ_L))) {
+        if (!(bus & (1u << I_RD_L))) {
+            read(addr);
+            return;
+        }
+        // /RD is high: a write, or the refresh cycle of the read before it
+        const bool afterRead = m_pending;
+        if (refresh(addr, afterRead)) {
+            flush(afterRead);
+            ++kinds[Refresh];
+            event(Refresh, addr, 0);
+            return;
+        }
+        flush(false);
+        ++kinds[MreqWrite];
+        event(MreqWrite, addr, data);
+        // ROM writes go nowhere
+        if (addr >= RomSize)
+            write(addr, data);
+        return;
+    }
+
+    flush(false);
+    if (!(bus & (1u << I_IORQ_L))) {
+        const bool rd = !(bus & (1u << I_RD_L));
+        ++kinds[rd ? IorqRead : IorqWrite];
+        ++(rd ? portReads : portWrites)[addr & 0xff];
+        event(rd ? IorqRead : IorqWrite, addr, data);
+    }
+}
+
+bool load_rom(const char *path, uint8_t *rom)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    const size_t size = fread(rom, 1, RomSize, f);
+    fclose(f);
+    if (size != RomSize) {
+        fprintf(stderr, "%s: not a 16K ROM\n", path);
+        return false;
+    }
+    return true;
+}
+
+// one "hex-address name" per line, '#' starts a comment
+bool load_labels(const char *path, std::vector<Label> &labels)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        char *end = strchr(line, '#');
+        if (end)
+            *end = 0;
+        char name[128];
+        unsigned addr;
+        if (sscanf(line, "%x %127s", &addr, name) == 2 && addr <= 0xffff)
+            labels.push_back({uint16_t(addr), name});
+    }
+    fclose(f);
+    return true;
+}
+
+struct Hot
+{
+    uint32_t index;
+    uint64_t fetches;
+    uint64_t cycles;
+};
+
+// the top n by cycles when the capture has them, by fetches otherwise
+std::vector<Hot> top(std::vector<Hot> hot, uint32_t n, bool byCycles)
+{
+    auto hotter = [byCycles](const Hot &a, const Hot &b) {
+        return byCycles ? a.cycles > b.cycles : a.fetches > b.fetches;
+    };
+    n = std::min<size_t>(n, hot.size());
+    std::partial_sort(hot.begin(), hot.begin() + n, hot.end(), hotter);
+    hot.resize(n);
+    return hot;
+}
+
+void print_hot(const std::vector<Hot> &hot, const Decoder &d, auto name)
+{
+    const bool stamped = d.cycles;
+    printf("%10s %7s", "fetches", "%");
+    if (stamped)
+        printf(" %12s %7s", "cycles", "%");
+    printf("\n");
+    for (const Hot &h : hot) {
+        printf("%10" PRIu64 " %6.2f%%", h.fetches, 100.0 * h.fetches / d.instructions);
+        if (stamped)
+            printf(" %12" PRIu64 " %6.2f%%", h.cycles, 100.0 * h.cycles / d.cycles);
+        printf("  %s\n", name(h).c_str());
+    }
+}
+
+void usage(const char *name)
+{
+    printf("Usage: %s [options] trace\n"
+           "  --raw            trace is raw u32 bus words (default: framed when it checks out)\n"
+           "  --rom FILE       16K ROM to disassemble (default: the 48K one)\n"
+           "  --labels FILE    ROM routines, \"hex-address name\" per line (default: the 48K ones)\n"
+           "  --top N          hottest addresses and routines to list (default 20)\n"
+           "  --events         list the decoded words\n"
+           "  --from N         first word to list (default 0)\n"
+           "  --count N        words to list (default 100)\n"
+           "  --instructions N fail unless the capture decodes to N instructions\n",
+           name);
+}
+
+bool parse_options(int argc, char **argv, Options &opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--raw")
+            opts.raw = true;
+        else if (arg == "--rom")
+            opts.rom = value();
+        else if (arg == "--labels")
+            opts.labels = value();
+        else if (arg == "--top")
+            opts.top = strtoul(value(), nullptr, 0);
+        else if (arg == "--events")
+            opts.events = true;
+        else if (arg == "--from")
+            opts.from = strtoull(value(), nullptr, 0);
+        else if (arg == "--count")
+            opts.count = strtoull(value(), nullptr, 0);
+        else if (arg == "--instructions")
+            opts.instructions = strtoull(value(), nullptr, 0);
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg[0] != '-' && !opts.trace)
+            opts.trace = argv[i];
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opts.trace;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_options(argc, argv, opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    uint8_t rom[RomSize];
+    if (opts.rom) {
+        if (!load_rom(opts.rom, rom))
+            return 2;
+    } else {
+        memcpy(rom, __48_rom, RomSize);
+    }
+    std::vector<Label> labels;
+    if (opts.labels) {
+        if (!load_labels(opts.labels, labels))
+            return 2;
+    } else {
+        labels.assign(std::begin(Rom48Labels), std::end(Rom48Labels));
+    }
+    std::sort(labels.begin(), labels.end(), [](const Label &a, const Label &b) { return a.addr < b.addr; });
+
+    const MappedFile file(opts.trace);
+    if (!file.isOpen())
+        return 2;
+    opts.raw = opts.raw || !trace_looks_framed(file.data(), file.size());
+    TraceReader reader(file.data(), file.size(), opts.raw);
+
+    // 64K entries each, too much for the stack
+    auto decoder = std::make_unique<Decoder>(opts, rom);
+    Decoder &d = *decoder;
+    TraceWord word;
+    while (reader.next(word))
+        d.add(word);
+    d.finish();
+    if (opts.events)
+        printf("\n");
+
+    printf("%s: %zu bytes, %s\n", opts.trace, file.size(), opts.raw ? "raw bus words" : "framed");
+    if (reader.framed())
+        printf("%" PRIu64 " frames, %" PRIu64 " bad, %" PRIu64 " traces (%" PRIu64 " ended), %" PRIu64
+               " words dropped, %" PRIu64 " bytes between frames\n",
+               reader.frames(), reader.badFrames(), reader.traces(), reader.ended(), reader.dropped(),
+               reader.skipped());
+    printf("%" PRIu64 " words:", d.words);
+    for (int k = 0; k < KindCount; ++k)
+        printf(" %" PRIu64 " %s%s", d.kinds[k], KindNames[k], k + 1 < KindCount ? "," : "\n");
+    printf("%" PRIu64 " instructions, M1 from %s, %" PRIu64 " resyncs\n\n", d.instructions,
+           d.refreshLocks ? "refresh cycles" : "the instruction stream", d.resyncs);
+
+    if (!d.instructions) {
+        printf("FAIL: no instructions in %s\n", opts.trace);
+        return 1;
+    }
+    if (opts.instructions && d.instructions != opts.instructions) {
+        printf("FAIL: %" PRIu64 " instructions, the capture holds %" PRIu64 "\n", d.instructions, opts.instructions);
+        return 1;
+    }
+    const bool byCycles = d.cycles;
+
+    std::vector<Hot> hot;
+    for (uint32_t addr = 0; addr < 0x10000; ++addr) {
+        if (d.fetches[addr])
+            hot.push_back({addr, d.fetches[addr], d.fetchCycles[addr]});
+    }
+    printf("Hottest instructions\n");
+    print_hot(top(hot, opts.top, byCycles), d, [&d](const Hot &h) {
+        char s[64];
+        snprintf(s, sizeof(s), "%04x  %s", h.index, d.insn(h.index).text);
+        return std::string(s);
+    });
+
+    // routine i runs from labels[i] up to the next label, the rest is "RAM"
+    std::vector<Hot> routines(labels.size() + 1);
+    for (uint32_t i = 0; i < routines.size(); ++i)
+        routines[i].index = i;
+    for (const Hot &h : hot) {
+        auto after = std::upper_bound(labels.begin(), labels.end(), h.index,
+                                      [](uint32_t addr, const Label &l) { return addr < l.addr; });
+        const bool ram = h.index >= RomSize || after == labels.begin();
+        Hot &r = routines[ram ? labels.size() : after - labels.begin() - 1];
+        r.fetches += h.fetches;
+        r.cycles += h.cycles;
+    }
+    std::erase_if(routines, [](const Hot &r) { return !r.fetches; });
+    printf("\nHottest routines\n");
+    print_hot(top(routines, opts.top, byCycles), d, [&labels](const Hot &r) {
+        if (r.index == labels.size())
+            return std::string("RAM or unlabelled");
+        char s[64];
+        snprintf(s, sizeof(s), "%04x  %s", labels[r.index].addr, labels[r.index].name.c_str());
+        return std::string(s);
+    });
+
+    printf("\n%-6s %12s %12s\n", "port", "in", "out");
+    for (int port = 0; port < 0x100; ++port) {
+        if (d.portReads[port] || d.portWrites[port])
+            printf("xx%02x   %12" PRIu64 " %12" PRIu64 "\n", port, d.portReads[port], d.portWrites[port]);
+    }
+
+    printf("\nOK: %" PRIu64 " instructions at %zu addresses\n", d.instructions, hot.size());
+    return 0;
+}
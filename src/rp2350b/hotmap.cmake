@@ -0,0 +1,234 @@
+# Latency audit of the bus engine, run after linking the firmware:
+#
+#   cmake -DELF=IFp.elf -DNM=nm -DOBJDUMP=objdump -DREPORT=IFp.hotmap.txt
+#         "-DHOT_CODE=zx_main;zpi_read" "-DHOT_DATA=RomPtr" "-DSHARED_DATA=RamShadow"
+#         -DCOLD=zx_init -P hotmap.cmake
+#
+# HOT_CODE are the entry points core1 runs on the bus path: the loop itself
+# and every IO handler, since those are only reached through IoReadTable and
+# IoWriteTable. Starting from them, everything their code references is
+# followed through the disassembly: the <sym> annotations objdump gives calls,
+# branches and pc relative loads, and the .word values of the literal pools,
+# resolved to the symbol they point into. A table reached through a pointer
+# loaded at run time is not seen, nor is one addressed through a section
+# anchor at an offset from another symbol: list those in HOT_DATA, the
+# variables and tables the loop reads. Names are plain C++
+# identifiers, they match free functions and variables either global or in
+# an anonymous namespace; a name that does not resolve was inlined or is not
+# built in this configuration and is only reported. COLD names the one-off
+# setup the entry points call before looping (zx_init, zx_boot), it is not
+# followed.
+#
+# HOT_DATA has to be in the banks core1 has to itself, SCRATCH_X/Y or SRAM4-7;
+# SHARED_DATA are the buffers too big for those, allowed in SRAM0-3.
+#
+# The build fails when any of it resolves to flash/XIP, or HOT_DATA to
+# SRAM0-3. The report lists
+# where every symbol lives and how full the scratch banks and SRAM4-7 are.
+
+cmake_minimum_required(VERSION 3.13)
+
+foreach(var ELF NM OBJDUMP REPORT)
+    if (NOT ${var})
+        message(FATAL_ERROR "hotmap.cmake: ${var} is not set")
+    endif()
+endforeach()
+
+function(region_of addr out)
+    math(EXPR a "0x${addr}" OUTPUT_FORMAT DECIMAL)
+    if (a LESS 0x10000000)
+        set(r "bootrom")
+    elseif (a LESS 0x20000000)
+        set(r "FLASH/XIP")
+    elseif (a LESS 0x20040000)
+        set(r "SRAM0-3")
+    elseif (a LESS 0x20080000)
+        set(r "SRAM4-7")
+    elseif (a LESS 0x20081000)
+        set(r "SCRATCH_X")
+    elseif (a LESS 0x20082000)
+        set(r "SCRATCH_Y")
+    else()
+        set(r "io")
+    endif()
+    set(${out} ${r} PARENT_SCOPE)
+endfunction()
+
+# symbol table: address and size of every defined symbol
+execute_process(COMMAND ${NM} --defined-only --print-size ${ELF}
+    OUTPUT_VARIABLE nm_out RESULT_VARIABLE nm_result)
+if (NOT nm_result EQUAL 0)
+    message(FATAL_ERROR "hotmap.cmake: ${NM} failed on ${ELF}")
+endif()
+string(REPLACE "\n" ";" nm_lines "${nm_out}")
+set(all_symbols "")
+set(flash_data "")
+foreach(line IN LISTS nm_lines)
+    if (line MATCHES "^([0-9a-fA-F]+) ([0-9a-fA-F]+ )?([A-Za-z]) (.+)$")
+        set(sym "${CMAKE_MATCH_4}")
+        set("ADDR_${sym}" ${CMAKE_MATCH_1})
+        string(STRIP "${CMAKE_MATCH_2}" size)
+        if (size STREQUAL "")
+            set(size 0)
+        endif()
+        set("SIZE_${sym}" ${size})
+        set("TYPE_${sym}" ${CMAKE_MATCH_3})
+        list(APPEND all_symbols "${sym}")
+        math(EXPR at "0x${CMAKE_MATCH_1}" OUTPUT_FORMAT DECIMAL)
+        if (NOT DEFINED "SYM_AT_${at}")
+            set("SYM_AT_${at}" "${sym}")
+        endif()
+        if (CMAKE_MATCH_3 MATCHES "^[rR]$" AND at GREATER_EQUAL 0x10000000 AND at LESS 0x20000000)
+            list(APPEND flash_data "${sym}")
+        endif()
+    endif()
+endforeach()
+
+# the mangled symbols an identifier stands for, .isra/.part clones included
+function(resolve name out)
+    string(LENGTH "${name}" len)
+    set(found ${all_symbols})
+    list(FILTER found INCLUDE REGEX "^(${name}|_Z[NL]?(12_GLOBAL__N_1)?${len}${name}[^0-9].*)$")
+    set(${out} "${found}" PARENT_SCOPE)
+endfunction()
+
+# the symbol a literal pool word points into, empty when none
+function(pool_symbol value out)
+    math(EXPR at "0x${value}" OUTPUT_FORMAT DECIMAL)
+    # Thumb code addresses have bit 0 set
+    math(EXPR code "${at} & ~1" OUTPUT_FORMAT DECIMAL)
+    if (DEFINED "SYM_AT_${at}")
+        set(${out} "${SYM_AT_${at}}" PARENT_SCOPE)
+        return()
+    elseif (DEFINED "SYM_AT_${code}")
+        set(${out} "${SYM_AT_${code}}" PARENT_SCOPE)
+        return()
+    endif()
+    # inside a flash table, an element or a field of it
+    foreach(sym IN LISTS flash_data)
+        math(EXPR start "0x${ADDR_${sym}}" OUTPUT_FORMAT DECIMAL)
+        math(EXPR end "${start} + 0x${SIZE_${sym}}" OUTPUT_FORMAT DECIMAL)
+        if (at GREATER_EQUAL start AND at LESS end)
+            set(${out} "${sym}" PARENT_SCOPE)
+            return()
+        endif()
+    endforeach()
+    set(${out} "" PARENT_SCOPE)
+endfunction()
+
+set(report "")
+set(failures 0)
+
+macro(check sym)
+    region_of(${ADDR_${sym}} region)
+    math(EXPR size "0x${SIZE_${sym}}" OUTPUT_FORMAT DECIMAL)
+    string(APPEND report "  ${ADDR_${sym}}  ${region}\t${size}\t${sym}\n")
+    if (region STREQUAL "FLASH/XIP")
+        math(EXPR failures "${failures} + 1")
+        message(SEND_ERROR "hot path symbol ${sym} resolves to flash/XIP at 0x${ADDR_${sym}}")
+    endif()
+endmacro()
+
+# code: the entry points and everything reachable from them
+string(APPEND report "Hot code\n")
+set(queue "")
+set(seen "")
+foreach(name IN LISTS COLD)
+    resolve(${name} syms)
+    foreach(sym IN LISTS syms)
+        string(APPEND report "  ${ADDR_${sym}}  cold\t\t${sym}\n")
+    endforeach()
+    list(APPEND seen ${syms})
+endforeach()
+foreach(name IN LISTS HOT_CODE)
+    resolve(${name} syms)
+    if (NOT syms)
+        string(APPEND report "  --------  inlined\t\t${name}\n")
+    endif()
+    list(APPEND queue ${syms})
+endforeach()
+while (queue)
+    list(POP_FRONT queue sym)
+    if (sym IN_LIST seen)
+        continue()
+    endif()
+    list(APPEND seen "${sym}")
+    if (NOT DEFINED "ADDR_${sym}")
+        continue()
+    endif()
+    check("${sym}")
+    if (NOT TYPE_${sym} MATCHES "^[TtWw]$")
+        continue()
+    endif()
+    execute_process(COMMAND ${OBJDUMP} -d --no-show-raw-insn "--disassemble=${sym}" ${ELF}
+        OUTPUT_VARIABLE dis)
+    string(REGEX MATCHALL "<[^>\n]+>" refs "${dis}")
+    foreach(ref IN LISTS refs)
+        string(REGEX REPLACE "^<([^>+]+)(\\+0x[0-9a-fA-F]+)?>$" "\\1" ref "${ref}")
+        if (NOT ref STREQUAL sym AND NOT ref IN_LIST seen)
+            list(APPEND queue "${ref}")
+        endif()
+    endforeach()
+    string(REGEX MATCHALL "\\.word[ \t]+0x[0-9a-fA-F]+" words "${dis}")
+    foreach(word IN LISTS words)
+        string(REGEX REPLACE "^.*0x" "" value "${word}")
+        pool_symbol(${value} ref)
+        if (ref AND NOT ref STREQUAL sym AND NOT ref IN_LIST seen)
+            list(APPEND queue "${ref}")
+        endif()
+    endforeach()
+endwhile()
+
+string(APPEND report "\nHot data\n")
+foreach(name IN LISTS HOT_DATA)
+    resolve(${name} syms)
+    if (NOT syms)
+        string(APPEND report "  --------  absent\t\t${name}\n")
+    endif()
+    foreach(sym IN LISTS syms)
+        check("${sym}")
+        if (region STREQUAL "SRAM0-3")
+            math(EXPR failures "${failures} + 1")
+            message(SEND_ERROR "hot data ${sym} is in SRAM0-3 at 0x${ADDR_${sym}}, shared with core0 and the DMA")
+        endif()
+    endforeach()
+endforeach()
+
+string(APPEND report "\nShared data\n")
+foreach(name IN LISTS SHARED_DATA)
+    resolve(${name} syms)
+    if (NOT syms)
+        string(APPEND report "  --------  absent\t\t${name}\n")
+    endif()
+    foreach(sym IN LISTS syms)
+        check("${sym}")
+    endforeach()
+endforeach()
+
+# how much of the scratch banks is left to the stacks, and of SRAM4-7
+string(APPEND report "\nBanks\n")
+foreach(bank x y)
+    set(start "__scratch_${bank}_start__")
+    set(end "__scratch_${bank}_end__")
+    if (DEFINED "ADDR_${start}" AND DEFINED "ADDR_${end}")
+        math(EXPR used "0x${ADDR_${end}} - 0x${ADDR_${start}}" OUTPUT_FORMAT DECIMAL)
+        string(TOUPPER ${bank} b)
+        string(APPEND report "  SCRATCH_${b}: ${used} of 4096 bytes\n")
+    endif()
+endforeach()
+if (DEFINED ADDR___zx_bank_start__ AND DEFINED ADDR___zx_bank_end__)
+    math(EXPR used "0x${ADDR___zx_bank_end__} - 0x${ADDR___zx_bank_start__}" OUTPUT_FORMAT DECIMAL)
+    string(APPEND report "  SRAM4-7 (__zx_bank): ${used} of 262144 bytes\n")
+endif()
+foreach(stack __StackOneBottom __StackBottom)
+    if (DEFINED "ADDR_${stack}")
+        region_of(${ADDR_${stack}} region)
+        string(APPEND report "  ${stack} 0x${ADDR_${stack}} (${region})\n")
+    endif()
+endforeach()
+
+file(WRITE ${REPORT} "${report}")
+if (failures GREATER 0)
+    message(FATAL_ERROR "${failures} hot path symbols misplaced, see ${REPORT}")
+endif()
+message(STATUS "Hot path placement written to ${REPORT}")
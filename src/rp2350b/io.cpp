@@ -0,0 +1,118 @@
+#include "io.h"
+
+#include <pico.h>
+
+#include <array>
+#include <bit>
+
+#include "sram.h"
+#include "utils.h"
+
+__zx_bank IoReadHandler IoReadTable[256];
+__zx_bank IoWriteHandler IoWriteTable[256];
+__zx_bank uint16_t IoReadDrive[256];
+
+namespace {
+
+constexpr int MaxIoDevices = 16;
+std::array<const IoDevice *, MaxIoDevices> Devices;
+int DevicesCount = 0;
+
+// Ports more than one device decodes, a bit for each device in Devices
+// order: shared_read() and shared_write() call them all
+__zx_bank IoReadHandler SharedReaders[MaxIoDevices];
+__zx_bank IoWriteHandler SharedWriters[MaxIoDevices];
+__zx_bank uint16_t SharedReadObservers[256];
+__zx_bank int8_t SharedReadAnswer[256];  // -1 when only observed
+__zx_bank uint16_t SharedWriteDevices[256];
+
+uint8_t __zx_code(unclaimed_read)(uint16_t)
+{
+    return 0;
+}
+
+void __zx_code(unclaimed_write)(uint16_t, uint8_t)
+{
+}
+
+uint8_t __zx_code(shared_read)(uint16_t addr)
+{
+    const uint8_t port = addr;
+    for (uint32_t devices = SharedReadObservers[port]; devices; devices &= devices - 1)
+        SharedReaders[std::countr_zero(devices)](addr);
+    const int answer = SharedReadAnswer[port];
+    return answer < 0 ? 0 : SharedReaders[answer](addr);
+}
+
+void __zx_code(shared_write)(uint16_t addr, uint8_t data)
+{
+    for (uint32_t devices = SharedWriteDevices[addr & 0xff]; devices; devices &= devices - 1)
+        SharedWriters[std::countr_zero(devices)](addr, data);
+}
+
+// a device that decodes more address bits, or as many and drives the bus
+bool answers_before(const IoDevice *dev, const IoDevice *other)
+{
+    const int bits = std::popcount(dev->mask);
+    const int otherBits = std::popcount(other->mask);
+    return bits > otherBits || (bits == otherBits && !dev->passive && other->passive);
+}
+
+} // namespace {
+
+bool io_register(const IoDevice *device)
+{
+    if (DevicesCount == MaxIoDevices) {
+        error("Too many IO devices");
+        return false;
+    }
+    Devices[DevicesCount++] = device;
+    return true;
+}
+
+void io_build()
+{
+    for (int i = 0; i < DevicesCount; ++i) {
+        SharedReaders[i] = Devices[i]->read;
+        SharedWriters[i] = Devices[i]->write;
+    }
+    for (int port = 0; port < 256; ++port) {
+        int answer = -1;
+        uint16_t readers = 0;
+        uint16_t writers = 0;
+        for (int i = 0; i < DevicesCount; ++i) {
+            const IoDevice *dev = Devices[i];
+            if ((port & dev->mask) != dev->match)
+                continue;
+            if (dev->read) {
+                readers |= 1u << i;
+                if (answer < 0 || answers_before(dev, Devices[answer]))
+                    answer = i;
+            }
+            if (dev->write)
+                writers |= 1u << i;
+        }
+
+        // the devices that do not answer a read only see it when passive, an
+        // active one would answer it too on the real bus
+        uint16_t observers = 0;
+        for (uint32_t devices = readers; devices; devices &= devices - 1) {
+            const int i = std::countr_zero(devices);
+            if (i != answer && Devices[i]->passive)
+                observers |= 1u << i;
+        }
+        SharedReadObservers[port] = observers;
+        SharedReadAnswer[port] = answer;
+        if (observers)
+            IoReadTable[port] = shared_read;
+        else
+            IoReadTable[port] = answer < 0 ? unclaimed_read : Devices[answer]->read;
+        IoReadDrive[port] = answer >= 0 && !Devices[answer]->passive ? 0xff00 : 0;
+
+        SharedWriteDevices[port] = writers;
+        if (std::popcount(writers) > 1)
+            IoWriteTable[port] = shared_write;
+        else
+            IoWriteTable[port] = writers ? Devices[std::countr_zero(writers)]->write : unclaimed_write;
+    }
+}
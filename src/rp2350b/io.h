@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+using IoReadHandler = uint8_t (*)(uint16_t addr);
+using IoWriteHandler = void (*)(uint16_t addr, uint8_t data);
+
+// An emulated peripheral. Like the real hardware, devices only decode the low
+// address byte and most of them only look at a few bits of it: the device owns
+// every port for which (port & mask) == match.
+struct IoDevice
+{
+    const char *name;
+    uint8_t mask;
+    uint8_t match;
+    IoReadHandler read;   // nullptr for write only devices
+    IoWriteHandler write; // nullptr for read only devices
+    bool passive = false; // reads are only observed, the machine answers them (ULA)
+};
+
+// Adds a device to the registry. Must be called before io_build(), the device
+// must outlive the registry.
+bool io_register(const IoDevice *device);
+
+// Compiles the registered devices into IoReadTable/IoWriteTable. The result
+// does not depend on the registration order, as on the real bus:
+// - a write goes to every device decoding the port (the ULA and the 0x7ffd
+//   latch both take a write to 0xfc)
+// - a read is answered by the device decoding the most address bits, on a tie
+//   one that drives the bus beats a passive one (Kempston answers 0x1e, not
+//   the ULA); two active devices that tie both drive the real bus, the first
+//   registered answers here
+// - the passive devices that do not answer a read still see it
+// A port with a single device calls it directly, a shared one goes through a
+// handler calling them all.
+void io_build();
+
+// Flat decode tables indexed by the low address byte, every entry is valid
+// (unclaimed ports get a handler that reads 0 and ignores writes) so the bus
+// loop does one indexed load and one indirect call, no matter how many
+// devices are registered.
+extern IoReadHandler IoReadTable[256];
+extern IoWriteHandler IoWriteTable[256];
+
+// pindirs half of the word pushed to the iorq program for a read: 0xff00
+// when a device answers the port, 0 when the bus is left alone
+extern uint16_t IoReadDrive[256];
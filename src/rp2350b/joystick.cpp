@@ -0,0 +1,111 @@
+#include "joystick.h"
+
+#include <hardware/gpio.h>
+#include <hardware/timer.h>
+
+#include <array>
+
+#include "sram.h"
+
+// idle: nothing pressed on either interface
+__zx_data volatile uint32_t JoystickPorts = 0xff00;
+
+namespace {
+
+constexpr uint32_t JoyLines = 5;
+constexpr uint32_t JoyMask = ((1u << JoyLines) - 1) << JoyFire;
+
+// Both port bytes for every combination of the pressed lines, indexed by the
+// lines shifted down to bit 0: fire, right, left, down, up.
+constexpr std::array<uint32_t, 1u << JoyLines> make_port_words()
+{
+    std::array<uint32_t, 1u << JoyLines> words{};
+    for (uint32_t pressed = 0; pressed < words.size(); ++pressed) {
+        const bool fire = pressed & (1u << (JoyFire - JoyFire));
+        const bool right = pressed & (1u << (JoyRight - JoyFire));
+        const bool left = pressed & (1u << (JoyLeft - JoyFire));
+        const bool down = pressed & (1u << (JoyDown - JoyFire));
+        const bool up = pressed & (1u << (JoyUp - JoyFire));
+        const uint8_t kempston = right | left << 1 | down << 2 | up << 3 | fire << 4;
+        const uint8_t fuller = ~(up | down << 1 | left << 2 | right << 3 | fire << 7);
+        words[pressed] = kempston | uint32_t(fuller) << 8;
+    }
+    return words;
+}
+
+constexpr auto PortWords = make_port_words();
+
+uint32_t Stable = 0;    // debounced pressed lines, GPIO positions
+uint32_t LastRaw = 0;
+uint32_t ChangedUs[JoyLines] = {};
+uint32_t LastSampleUs = 0;
+JoystickStats Stats;
+
+} // namespace {
+
+void joystick_init()
+{
+    for (uint32_t gpio = JoyFire; gpio < JoyFire + JoyLines; ++gpio) {
+        gpio_init(gpio);
+        gpio_set_dir(gpio, GPIO_IN);
+        gpio_pull_up(gpio);
+    }
+    Stable = 0;
+    LastRaw = 0;
+    JoystickPorts = PortWords[0];
+    LastSampleUs = time_us_32();
+    for (auto &us : ChangedUs)
+        us = LastSampleUs - JoystickLockoutUs;
+}
+
+void joystick_task()
+{
+    const uint32_t now = time_us_32();
+    const uint32_t raw = ~gpio_get_all() & JoyMask;
+    const uint32_t edges = raw ^ LastRaw;
+    const uint32_t differ = raw ^ Stable;
+    LastRaw = raw;
+
+    uint32_t stable = Stable;
+    for (uint32_t line = 0; line < JoyLines; ++line) {
+        const uint32_t bit = 1u << (JoyFire + line);
+        if (!((edges | differ) & bit))
+            continue;
+        if (now - ChangedUs[line] < JoystickLockoutUs) {
+            if (edges & bit)
+                ++Stats.bounces;
+            continue;
+        }
+        if (differ & bit) {
+            stable ^= bit;
+            ChangedUs[line] = now;
+        }
+    }
+
+    if (stable != Stable) {
+        Stable = stable;
+        JoystickPorts = PortWords[stable >> JoyFire];
+        // the change happened at some point after the previous sample
+        const uint32_t us = time_us_32() - LastSampleUs;
+        ++Stats.changes;
+        Stats.lastUs = us;
+        if (us > Stats.worstUs)
+            Stats.worstUs = us;
+    }
+    LastSampleUs = now;
+}
+
+const JoystickStats &joystick_stats()
+{
+    return Stats;
+}
+
+uint8_t __zx_code(joystick_kempston_read)(uint16_t)
+{
+    return reinterpret_cast<const volatile uint8_t *>(&JoystickPorts)[0];
+}
+
+uint8_t __zx_code(joystick_fuller_read)(uint16_t)
+{
+    return reinterpret_cast<const volatile uint8_t *>(&JoystickPorts)[1];
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+// Kempston and Fuller joysticks on the DE9 connector.
+//
+// core0 samples the five switch lines, debounces them and publishes both port
+// bytes, already in the format the interfaces return, into JoystickPorts with
+// a single store. The core1 handlers only load their byte of it: no GPIO
+// access and no bit fiddling on the bus path.
+//
+// Debouncing is eager: a line that changes is published at once, then it is
+// locked for JoystickLockoutUs so its contact bounce does not reach the Z80.
+// The latency from a switch to the bus is thus one core0 loop, the worst seen
+// is in JoystickStats.
+
+constexpr uint32_t JoyFire = 3;     // GPIO, the lines switch to ground
+constexpr uint32_t JoyRight = 4;
+constexpr uint32_t JoyLeft = 5;
+constexpr uint32_t JoyDown = 6;
+constexpr uint32_t JoyUp = 7;
+
+constexpr uint32_t JoystickLockoutUs = 4000;
+
+// byte 0: Kempston (000FUDLR, active high), byte 1: Fuller (F000RLDU, active low)
+extern volatile uint32_t JoystickPorts;
+
+struct JoystickStats
+{
+    uint32_t changes = 0;   // published port values
+    uint32_t bounces = 0;   // line changes swallowed by the lockout
+    uint32_t lastUs = 0;    // a change seen to published, bounded by the sample before it
+    uint32_t worstUs = 0;
+};
+
+// core0
+void joystick_init();
+void joystick_task();
+const JoystickStats &joystick_stats();
+
+// core1, IoDevice read handlers
+uint8_t joystick_kempston_read(uint16_t addr);
+uint8_t joystick_fuller_read(uint16_t addr);
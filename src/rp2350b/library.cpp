@@ -0,0 +1,165 @@
+#include "library.h"
+
+#include <cstdio>
+#include <cstring>
+#include <strings.h>
+
+#include "psram.h"
+#include "snapshot.h"
+#include "utils.h"
+
+namespace {
+
+constexpr uint32_t MaxSnapshotSize = 160 * 1024;   // a 128K .Z80 stored raw
+
+LibraryEntry Entries[MaxLibraryEntries];
+int EntryCount = 0;
+uint32_t Used = 0;
+
+bool has_extension(const char *name, const char *ext)
+{
+    const char *dot = strrchr(name, '.');
+    return dot && !strcasecmp(dot + 1, ext);
+}
+
+bool rom_model(uint32_t size, RomModel &model)
+{
+    switch (size) {
+    case RomBankSize:
+        model = RomModel::Zx48;
+        return true;
+    case 2 * RomBankSize:
+        model = RomModel::Zx128;
+        return true;
+    case 4 * RomBankSize:
+        model = RomModel::Plus3;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// the next entry and the PSRAM it gets, nullptr when either is used up;
+// commit() keeps it
+LibraryEntry *reserve(const char *name, uint32_t size)
+{
+    LibraryEntry &entry = Entries[EntryCount];
+    entry = LibraryEntry{};
+    snprintf(entry.name, sizeof(entry.name), "%s", name);
+    RomModel model;
+    if (has_extension(name, "ROM") && rom_model(size, model)) {
+        entry.kind = LibraryKind::Rom;
+        entry.image = RomImage{entry.name, model, nullptr, size};
+    } else if ((has_extension(name, "SNA") || has_extension(name, "Z80")) && size <= MaxSnapshotSize) {
+        entry.kind = LibraryKind::Snapshot;
+    } else {
+        return nullptr;
+    }
+    if (EntryCount == MaxLibraryEntries || psram_size() - Used < size) {
+        error("PSRAM library is full");
+        return nullptr;
+    }
+    entry.data = psram_base() + Used;
+    entry.size = size;
+    return &entry;
+}
+
+const LibraryEntry *snapshot_entry(int index)
+{
+    for (int i = 0; i < EntryCount; ++i) {
+        if (Entries[i].kind == LibraryKind::Snapshot && !index--)
+            return &Entries[i];
+    }
+    return nullptr;
+}
+
+int commit(LibraryEntry &entry)
+{
+    if (entry.kind == LibraryKind::Rom) {
+        entry.image.data = entry.data;
+        entry.image.crc = crc32(entry.data, entry.size);
+        // a copy of a built in image works like it
+        for (int i = 0; i < BuiltinRomCount; ++i) {
+            const RomImage &builtin = *BuiltinRoms[i];
+            if (builtin.crc == entry.image.crc && builtin.size == entry.size) {
+                entry.image.model = builtin.model;
+                entry.image.traps = builtin.traps;
+                entry.image.trapCount = builtin.trapCount;
+                break;
+            }
+        }
+        entry.rom = rombank_add(&entry.image);
+        if (entry.rom < 0)
+            return -1;
+    }
+    Used += (entry.size + 3) & ~3u;
+    return EntryCount++;
+}
+
+} // namespace {
+
+int library_add(const char *name, const uint8_t *data, uint32_t size)
+{
+    LibraryEntry *entry = reserve(name, size);
+    if (!entry)
+        return -1;
+    memcpy(const_cast<uint8_t *>(entry->data), data, size);
+    return commit(*entry);
+}
+
+int library_scan(FileSystem &fs)
+{
+    if (!psram_size())
+        return 0;
+    int added = 0;
+    uint32_t cursor = 0;
+    FsEntry file;
+    while (fs.list(cursor, file)) {
+        LibraryEntry *entry = reserve(file.name, file.size);
+        if (!entry)
+            continue;
+        const int handle = fs.open(file.name, false);
+        if (handle < 0)
+            continue;
+        const int32_t read = fs.read(handle, 0, const_cast<uint8_t *>(entry->data), file.size);
+        fs.close(handle);
+        if (read == int32_t(file.size) && commit(*entry) >= 0)
+            ++added;
+    }
+
+    char message[64];
+    snprintf(message, sizeof(message), "PSRAM library: %d files, %luK of %luK", added,
+             (unsigned long)(Used / 1024), (unsigned long)(psram_size() / 1024));
+    notice(message);
+    return added;
+}
+
+int library_count()
+{
+    return EntryCount;
+}
+
+const LibraryEntry *library_entry(int index)
+{
+    return index >= 0 && index < EntryCount ? &Entries[index] : nullptr;
+}
+
+uint32_t library_used()
+{
+    return Used;
+}
+
+bool library_snapshot(int index)
+{
+    const LibraryEntry *entry = snapshot_entry(index);
+    return entry && snapshot_load(entry->name, entry->data, entry->size);
+}
+
+void library_request(uint8_t index)
+{
+    if (!snapshot_entry(index)) {
+        error("No such snapshot");
+        return;
+    }
+    library_snapshot(index);
+}
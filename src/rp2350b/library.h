@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+#include "fs.h"
+#include "rombank.h"
+
+// ROM images and snapshots kept in PSRAM, see psram.h.
+//
+// library_scan() copies the *.ROM, *.SNA and *.Z80 files of the SD card into
+// PSRAM once, at boot. ROM files become images of the ROM bank library, the
+// model taken from their size: 16K 48K, 32K 128K, 64K +2A/+3, or from the
+// built in image with the same CRC-32, along with its traps. Switching to
+// one reads it from PSRAM instead of flash, rombank_task() prefetches the
+// one expected next into SRAM meanwhile. Snapshots are loaded straight from
+// PSRAM by library_snapshot(), port 3 command 0b0100xxxx.
+//
+// Without PSRAM the library stays empty.
+
+constexpr int MaxLibraryEntries = 64;
+
+enum class LibraryKind : uint8_t {
+    Rom,
+    Snapshot,
+};
+
+struct LibraryEntry
+{
+    char name[13];
+    LibraryKind kind;
+    const uint8_t *data = nullptr;  // in PSRAM
+    uint32_t size = 0;
+    int rom = -1;                   // the rombank index of a ROM
+    RomImage image{};               // what rombank_add() was given
+};
+
+// core0: copies a file into PSRAM, the kind from the name extension; returns
+// its index or -1
+int library_add(const char *name, const uint8_t *data, uint32_t size);
+// core0: adds the files of the root directory, returns how many
+int library_scan(FileSystem &fs);
+
+int library_count();
+const LibraryEntry *library_entry(int index);
+// PSRAM bytes used
+uint32_t library_used();
+
+// core0: loads the index-th snapshot of the library
+bool library_snapshot(int index);
+// core0: loads a snapshot port 3 asked for
+void library_request(uint8_t index);
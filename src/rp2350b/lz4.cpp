@@ -0,0 +1,164 @@
+#include "lz4.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t MinMatch = 4;
+constexpr uint32_t LastLiterals = 5;    // the block ends with literals
+constexpr uint32_t MatchLimit = 12;     // no match starts in the last 12 bytes
+constexpr uint32_t MaxOffset = 65535;
+constexpr uint32_t HashBits = 14;
+
+// a length nibble of 15 goes on in bytes, each one 255 adds another
+bool read_length(const uint8_t *&ip, const uint8_t *end, uint32_t &length)
+{
+    if (length != 15)
+        return true;
+    uint8_t byte;
+    do {
+        if (ip == end)
+            return false;
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+uint8_t *write_length(uint8_t *op, uint32_t length)
+{
+    for (; length >= 255; length -= 255)
+        *op++ = 255;
+    *op++ = length;
+    return op;
+}
+
+uint8_t *write_sequence(uint8_t *op, const uint8_t *literals, uint32_t count, uint32_t offset, uint32_t match)
+{
+    uint8_t *token = op++;
+    *token = std::min<uint32_t>(count, 15) << 4;
+    if (count >= 15)
+        op = write_length(op, count - 15);
+    memcpy(op, literals, count);
+    op += count;
+    if (!match)
+        return op;
+    *op++ = offset;
+    *op++ = offset >> 8;
+    match -= MinMatch;
+    *token |= std::min<uint32_t>(match, 15);
+    if (match >= 15)
+        op = write_length(op, match - 15);
+    return op;
+}
+
+uint32_t hash(const uint8_t *p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return (value * 2654435761u) >> (32 - HashBits);
+}
+
+} // namespace {
+
+int32_t lz4_unpack(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize)
+{
+    const uint8_t *ip = src;
+    const uint8_t *const ipEnd = src + srcSize;
+    uint8_t *op = dst;
+    uint8_t *const opEnd = dst + dstSize;
+    while (ip < ipEnd) {
+        const uint8_t token = *ip++;
+        uint32_t length = token >> 4;
+        if (!read_length(ip, ipEnd, length) || uint32_t(ipEnd - ip) < length || uint32_t(opEnd - op) < length)
+            return -1;
+        memcpy(op, ip, length);
+        ip += length;
+        op += length;
+        // the last sequence has no match
+        if (ip == ipEnd)
+            break;
+
+        if (ipEnd - ip < 2)
+            return -1;
+        const uint32_t offset = ip[0] | ip[1] << 8;
+        ip += 2;
+        length = token & 15;
+        if (!offset || offset > uint32_t(op - dst) || !read_length(ip, ipEnd, length))
+            return -1;
+        length += MinMatch;
+        if (uint32_t(opEnd - op) < length)
+            return -1;
+        const uint8_t *match = op - offset;
+        if (offset >= length) {
+            memcpy(op, match, length);
+            op += length;
+        } else {
+            // overlapping: repeats the last offset bytes
+            while (length--)
+                *op++ = *match++;
+        }
+    }
+    return op - dst;
+}
+
+uint32_t lz4_pack(const uint8_t *src, uint32_t size, uint8_t *dst)
+{
+    // the longest match at each position, through hash chains of every
+    // earlier position with the same 4 bytes
+    std::vector<uint32_t> matchLength(size + 1, 0);
+    std::vector<uint32_t> matchOffset(size + 1, 0);
+    if (size > MatchLimit) {
+        std::vector<int32_t> head(1u << HashBits, -1);
+        std::vector<int32_t> chain(size, -1);
+        const uint32_t matchEnd = size - LastLiterals;
+        for (uint32_t pos = 0; pos + MatchLimit < size; ++pos) {
+            const uint32_t h = hash(src + pos);
+            for (int32_t candidate = head[h]; candidate >= 0 && pos - candidate <= MaxOffset;
+                 candidate = chain[candidate]) {
+                uint32_t length = 0;
+                while (pos + length < matchEnd && src[candidate + length] == src[pos + length])
+                    ++length;
+                if (length >= MinMatch && length > matchLength[pos]) {
+                    matchLength[pos] = length;
+                    matchOffset[pos] = pos - candidate;
+                }
+            }
+            chain[pos] = head[h];
+            head[h] = pos;
+        }
+    }
+
+    // cheapest parse from the end: a literal costs its byte, a match its
+    // token and offset, any of its lengths may be taken
+    std::vector<uint32_t> cost(size + 1, 0);
+    std::vector<uint32_t> take(size + 1, 0);
+    for (uint32_t pos = size; pos-- > 0;) {
+        cost[pos] = cost[pos + 1] + 1;
+        take[pos] = 0;
+        for (uint32_t length = MinMatch; length <= matchLength[pos]; ++length) {
+            const uint32_t extra = length - MinMatch >= 15 ? (length - MinMatch - 15) / 255 + 1 : 0;
+            const uint32_t c = 3 + extra + cost[pos + length];
+            if (c < cost[pos]) {
+                cost[pos] = c;
+                take[pos] = length;
+            }
+        }
+    }
+
+    uint8_t *op = dst;
+    uint32_t anchor = 0;
+    for (uint32_t pos = 0; pos < size;) {
+        if (!take[pos]) {
+            ++pos;
+            continue;
+        }
+        op = write_sequence(op, src + anchor, pos - anchor, matchOffset[pos], take[pos]);
+        pos += take[pos];
+        anchor = pos;
+    }
+    op = write_sequence(op, src + anchor, size - anchor, 0, 0);
+    return op - dst;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+// LZ4 blocks, the raw block format without the frame around it.
+//
+// The built in ROM images are stored packed, see rompack in host/. A 16K ROM
+// unpacks in well under a millisecond, from flash, at boot or when it is
+// selected.
+
+// worst case size of a packed block
+constexpr uint32_t lz4_bound(uint32_t size)
+{
+    return size + size / 255 + 16;
+}
+
+// bytes unpacked into dst, -1 for a block that is corrupt or does not fit
+int32_t lz4_unpack(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize);
+
+// host tools: packs size bytes of src into dst, at least lz4_bound(size)
+// bytes, returns the block size. The parse picks the cheapest sequences, it
+// is slow but ROMs are small.
+uint32_t lz4_pack(const uint8_t *src, uint32_t size, uint8_t *dst);
@@ -0,0 +1,112 @@
+#include "mailbox.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "cycles.h"
+#include "library.h"
+#include "profile.h"
+#include "rombank.h"
+#include "screen.h"
+#include "trace.h"
+#include "utils.h"
+#include "zx.h"
+
+Mailbox MailToCore0;
+Mailbox MailToCore1;
+
+namespace {
+
+constexpr int BenchPosts = 64;
+
+Mailbox BenchBox;
+uint32_t ReportedDrops = 0;
+
+} // namespace {
+
+bool mailbox_fetch(Mailbox &box, MailMessage &message)
+{
+    const uint32_t tail = box.tail.load(std::memory_order_relaxed);
+    if (tail == box.head.load(std::memory_order_acquire))
+        return false;
+    const uint32_t header = box.ring[tail % MailboxWords];
+    message.tag = MailTag(header >> 24);
+    message.words = std::min<uint32_t>((header >> 16) & 0xff, MailMaxPayload);
+    message.arg = header;
+    for (uint8_t i = 0; i < message.words; ++i)
+        message.payload[i] = box.ring[(tail + 1 + i) % MailboxWords];
+    box.tail.store(tail + 1 + ((header >> 16) & 0xff), std::memory_order_release);
+    return true;
+}
+
+MailboxBench __not_in_flash_func(mailbox_bench)()
+{
+    // what reading the counter twice costs comes off every sample
+    uint32_t overhead = UINT32_MAX;
+    for (int i = 0; i < BenchPosts; ++i) {
+        const uint32_t start = cycles_now();
+        overhead = std::min(overhead, cycles_now() - start);
+    }
+
+    MailboxBench bench;
+    const uint32_t payload[MailMaxPayload] = {};
+    MailMessage message;
+    for (int size = 0; size < MailboxBench::Sizes; ++size) {
+        bench.minCycles[size] = UINT32_MAX;
+        for (int i = 0; i < BenchPosts; ++i) {
+            const uint32_t start = cycles_now();
+            mailbox_post(BenchBox, MailTag::Trap, i, payload, MailboxBench::Words[size]);
+            const uint32_t cycles = cycles_now() - start - overhead;
+            bench.minCycles[size] = std::min(bench.minCycles[size], cycles);
+            bench.maxCycles[size] = std::max(bench.maxCycles[size], cycles);
+            mailbox_fetch(BenchBox, message);
+        }
+    }
+    return bench;
+}
+
+void mailbox_task()
+{
+    MailMessage message;
+    while (mailbox_fetch(MailToCore0, message)) {
+        switch (message.tag) {
+        case MailTag::Trace:
+            trace_request(message.arg);
+            break;
+        case MailTag::Profile:
+            profile_request(message.arg);
+            break;
+        case MailTag::RomImage:
+            rombank_request(message.arg);
+            break;
+        case MailTag::Snapshot:
+            library_request(message.arg);
+            break;
+        case MailTag::Screen:
+            screen_request(message.arg);
+            break;
+        case MailTag::Nmi:
+            zx_nmi();
+            break;
+        case MailTag::Trap: {
+            static const char *const Actions[] = {"", "ROM paged in by", "ROM paged out by", "Trap at"};
+            const uint32_t action = message.words ? message.payload[0] : uint32_t(RomTrap::PageIn);
+            char text[48];
+            snprintf(text, sizeof(text), "%s the fetch of 0x%04x", Actions[action & 3], unsigned(message.arg));
+            notice(text);
+            break;
+        }
+        default:
+            // a boot reply that came too late
+            break;
+        }
+    }
+
+    const uint32_t dropped = MailToCore0.dropped.load(std::memory_order_relaxed);
+    if (dropped != ReportedDrops) {
+        char text[48];
+        snprintf(text, sizeof(text), "%lu messages from core1 dropped", (unsigned long)(dropped - ReportedDrops));
+        error(text);
+        ReportedDrops = dropped;
+    }
+}
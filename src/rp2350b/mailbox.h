@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+
+#include <atomic>
+
+#include <pico.h>
+
+// Mailboxes between the two cores: single producer, single consumer rings of
+// 32 bit words carrying tagged messages.
+//
+// A message is a header word, tag << 24 | payload words << 16 | arg, followed
+// by its payload. The producer never waits: a message that does not fit is
+// counted in dropped and the post fails, so core1 can post from the bus loop.
+// A post is two loads, the stores of the message and the head store.
+//
+// MailToCore0 carries what core1 hands over to core0: the port 3 commands
+// served by core0, trap events and the replies of the boot handshake, all
+// dispatched by mailbox_task(). MailToCore1 carries the boot handshake, see
+// zx_main(): core1 only reads it before the bus loop starts.
+//
+// The RP2350 has no data cache, the indices each core writes just sit in
+// words of their own. The rings are a power of two so the indices run free
+// and wrap with a mask.
+
+constexpr uint32_t MailboxWords = 256;
+constexpr uint32_t MailMaxPayload = 16;    // words
+
+enum class MailTag : uint8_t {
+    // core0 -> core1, before the bus loop
+    Measure,    // payload cycles, see zx_measure_request()
+    Bench,      // time mailbox_post(), see mailbox_bench()
+    Start,      // serve the bus
+    // core1 -> core0
+    Measured,   // payload ZxMargin
+    Benched,    // payload MailboxBench
+    Trace,      // arg filter, port 3 command 0b0001xxxx
+    Profile,    // arg profile, port 3 command 0b0010xxxx
+    RomImage,   // arg image, port 3 command 0b0011xxxx
+    Trap,       // arg address of a trapped fetch, payload its RomTrap
+    Snapshot,   // arg snapshot, port 3 command 0b0100xxxx
+    Screen,     // arg command, port 3 command 0b0101xxxx
+    Nmi,        // port 3 command 0b00001110
+};
+
+struct Mailbox
+{
+    uint32_t ring[MailboxWords];
+    std::atomic<uint32_t> head{0};      // written by the producer
+    std::atomic<uint32_t> tail{0};      // written by the consumer
+    std::atomic<uint32_t> dropped{0};   // messages that did not fit
+};
+
+struct MailMessage
+{
+    MailTag tag;
+    uint8_t words = 0;
+    uint16_t arg = 0;
+    uint32_t payload[MailMaxPayload];
+};
+
+// cycles a post costs on the calling core, for the payload sizes in words
+struct MailboxBench
+{
+    static constexpr uint8_t Words[] = {0, 2, 8};
+    static constexpr int Sizes = sizeof(Words);
+    uint32_t minCycles[Sizes] = {};
+    uint32_t maxCycles[Sizes] = {};
+};
+
+extern Mailbox MailToCore0;
+extern Mailbox MailToCore1;
+
+// producer side, never waits; words is at most MailMaxPayload
+__force_inline bool mailbox_post(Mailbox &box, MailTag tag, uint16_t arg = 0, const uint32_t *payload = nullptr,
+                                 uint8_t words = 0)
+{
+    const uint32_t head = box.head.load(std::memory_order_relaxed);
+    if (MailboxWords - (head - box.tail.load(std::memory_order_acquire)) <= words) {
+        box.dropped.store(box.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+    box.ring[head % MailboxWords] = uint32_t(tag) << 24 | uint32_t(words) << 16 | arg;
+    for (uint8_t i = 0; i < words; ++i)
+        box.ring[(head + 1 + i) % MailboxWords] = payload[i];
+    box.head.store(head + 1 + words, std::memory_order_release);
+    return true;
+}
+
+// consumer side: the next message, false when there is none
+bool mailbox_fetch(Mailbox &box, MailMessage &message);
+
+// times mailbox_post() on the calling core, into a mailbox of its own
+MailboxBench mailbox_bench();
+
+// core0: dispatches what core1 posted to MailToCore0
+void mailbox_task();
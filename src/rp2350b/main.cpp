@@ -1,4 +1,3 @@
-
 // -----------------------------------------------------------------------------
 // This file is part of IfP "Interface Pico"
 // Copyright (C) 2025 BogDan Vatra <bogdan@kde.org>
@@ -21,15 +20,170 @@
 #include <hardware/gpio.h>
 #include <hardware/irq.h>
 #include <pico/multicore.h>
+#include <pico/rand.h>
+#ifdef ENABLE_USB_STDIO
+#include <pico/stdio_usb.h>
+#endif
 
 #include <tusb.h>
 
+#include <cstdio>
+
+#include "bdos.h"
+#include "blockcache.h"
+#include "fat.h"
+#include "framelink.h"
+#include "joystick.h"
+#include "library.h"
+#include "mailbox.h"
+#include "profile.h"
+#include "psram.h"
+#include "ramshadow.h"
+#include "rombank.h"
+#include "screen.h"
+#include "screencast.h"
+#include "sd.h"
+#include "snapshot.h"
+#include "tape.h"
+#include "trace.h"
+#include "uartport.h"
+#include "utils.h"
+#include "zpi.h"
 #include "zx.h"
 
-extern unsigned char __48_rom[];
-extern unsigned char testrom_bin[];
 using namespace std;
 
+namespace {
+SdCard Sd;
+BlockCache SdCache(Sd);
+FatFileSystem Fat(SdCache);
+
+int console_read()
+{
+    const int c = getchar_timeout_us(0);
+    return c < 0 ? -1 : c;
+}
+
+void console_write(uint8_t c)
+{
+    putchar_raw(c);
+}
+
+const BdosConsole UsbConsole{console_read, console_write};
+
+void report_mail_bench()
+{
+    MailboxBench bench;
+    if (!zx_mail_bench(bench)) {
+        error("core1 does not answer");
+        return;
+    }
+    char message[112];
+    int size = snprintf(message, sizeof(message), "core1 mailbox post:");
+    for (int i = 0; i < MailboxBench::Sizes; ++i)
+        size += snprintf(message + size, sizeof(message) - size, " %u words %lu-%lu cycles%s",
+                         unsigned(MailboxBench::Words[i]), (unsigned long)bench.minCycles[i],
+                         (unsigned long)bench.maxCycles[i], i + 1 < MailboxBench::Sizes ? "," : "");
+    notice(message);
+}
+
+// the image is unpacked before core1 starts, so before the first fetch it
+// serves
+void report_boot_rom()
+{
+    char message[64];
+    snprintf(message, sizeof(message), "%s unpacked in %luus at boot", rombank_active()->name,
+             (unsigned long)rombank_last_switch_us());
+    notice(message);
+}
+
+void report_psram()
+{
+    if (!psram_init()) {
+        notice("No PSRAM");
+        return;
+    }
+    const PsramBench bench = psram_bench();
+    char message[80];
+    snprintf(message, sizeof(message), "PSRAM: %lu MB on CS1, read %lu KB/s, %lu ns a random byte",
+             (unsigned long)(psram_size() >> 20), (unsigned long)bench.readKBs, (unsigned long)bench.randomNs);
+    notice(message);
+}
+
+#ifdef ENABLE_USB_STDIO
+// the bus trace frames go out with the console, see trace.h
+uint32_t usb_trace_space()
+{
+    return tud_cdc_connected() ? tud_cdc_write_available() : 0;
+}
+
+void usb_trace_write(const uint8_t *data, uint32_t size)
+{
+    stdio_usb.out_chars(reinterpret_cast<const char *>(data), size);
+}
+
+const TraceSink UsbTrace{usb_trace_space, usb_trace_write};
+#endif
+
+// The link to the ESP32-C3, see framelink.h. The channels are numbered the
+// same on its side.
+enum EspChannel : uint8_t {
+    EspControl = 0,     // short messages, echoed back for now: a ping
+    EspScreen = 2,      // the screen stream when there is no USB link
+};
+constexpr uint32_t EspBaudrate = 3000000;   // clk_peri / 16, clk_peri runs at 48 MHz
+UartPort EspUart;
+FrameLink Esp(EspUart);
+bool EspReady = false;
+
+void esp_message(void *, uint8_t channel, const uint8_t *data, uint32_t size)
+{
+    if (channel == EspControl)
+        Esp.send(EspControl, data, size);
+}
+
+void esp_init()
+{
+    const uint32_t baudrate = EspUart.init(EspBaudrate);
+    if (!baudrate) {
+        error("No DMA channels for the ESP32-C3 link");
+        return;
+    }
+    Esp.setHandler(esp_message, nullptr);
+    Esp.start(get_rand_32());
+    EspReady = true;
+    char message[48];
+    snprintf(message, sizeof(message), "ESP32-C3 link at %lu baud", (unsigned long)baudrate);
+    notice(message);
+}
+
+void esp_task()
+{
+    static bool synced = false;
+    if (!EspReady)
+        return;
+    Esp.task();
+    if (Esp.synced() != synced) {
+        synced = Esp.synced();
+        notice("ESP32-C3 link up");
+    }
+}
+
+#ifndef ENABLE_USB_STDIO
+uint32_t esp_screen_space()
+{
+    return Esp.space(EspScreen);
+}
+
+void esp_screen_write(const uint8_t *data, uint32_t size)
+{
+    Esp.send(EspScreen, data, size);
+}
+
+const TraceSink EspScreenSink{esp_screen_space, esp_screen_write};
+#endif
+} // namespace {
+
 //#define NO_PIO
 // #define PIO_DEBUG
 #ifdef PIO_DEBUG
@@ -41,6 +195,13 @@ void wait_callback(uint gpio, uint32_t events)
 
 int main()
 {
+    for (int i = 0; i < BuiltinRomCount; ++i)
+        rombank_add(BuiltinRoms[i]);
+    zpi_init(nullptr);
+#ifndef PIO_DEBUG
+    joystick_init();
+#endif
+
 #ifdef PIO_DEBUG
     stdio_init_all();
     while (!tud_cdc_connected())
@@ -48,7 +209,8 @@ int main()
 
     puts("\033[2J\033[HHello there !\n");
 
-    RomPtr = testrom_bin;
+    // the test ROM, second in CMakeLists.txt
+    rombank_select(1);
 #ifndef NO_PIO
     auto setInGpio = [](int pos) {
         gpio_init(pos);
@@ -89,6 +251,8 @@ int main()
     gpio_put(26, true);
 #endif
 
+#else
+    rombank_select(0);
 #endif
 #ifndef NO_PIO
     multicore_reset_core1();
@@ -97,8 +261,42 @@ int main()
     stdio_init_all();
 #endif
 
-    // tell core1 that stdio is initialized
-    multicore_fifo_push_blocking(0);
+#ifndef PIO_DEBUG
+    profile_boot();
+    report_boot_rom();
+    report_mail_bench();
+    report_psram();
+#endif
+
+    // stdio is initialized, core1 starts serving the bus
+    zx_start();
+
+#ifndef PIO_DEBUG
+    if (Sd.init()) {
+        char message[48];
+        snprintf(message, sizeof(message), "SD card: %lu MB%s", (unsigned long)(Sd.sectorCount() / 2048),
+                 Fat.mount() ? "" : ", no FAT16/32 volume");
+        notice(message);
+    } else {
+        error("No SD card");
+    }
+    bdos_init(Fat.mounted() ? &Fat : nullptr, &UsbConsole);
+    screen_init(Fat.mounted() ? &Fat : nullptr);
+#ifdef ENABLE_USB_STDIO
+    trace_init(&UsbTrace);
+    screencast_init(&UsbTrace);
+#endif
+    esp_init();
+#ifndef ENABLE_USB_STDIO
+    if (EspReady)
+        screencast_init(&EspScreenSink);
+#endif
+    if (Fat.mounted()) {
+        library_scan(Fat);
+        tape_automount(Fat);
+        snapshot_autoload(Fat);
+    }
+#endif
 
 #ifdef PIO_DEBUG
     gpio_set_irq_enabled_with_callback(O_WAIT_L, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true, &wait_callback);
@@ -173,7 +371,18 @@ int main()
         // gpio_put(PIO_BASE + O_WAIT_L, gpio_get(PIO_BASE + I_RD_L));
 #endif
 #else
-        sleep_ms(1000);
+        mailbox_task();
+        zpi_task();
+        SdCache.task();
+        rombank_task();
+        ramshadow_task();
+        snapshot_task();
+        tape_task();
+        joystick_task();
+        profile_task();
+        trace_task();
+        screencast_task();
+        esp_task();
         // putchar('.');
         // if (!--maxLine) {
         //     maxLine = 160;
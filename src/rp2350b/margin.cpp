@@ -0,0 +1,50 @@
+#include "margin.h"
+
+uint32_t margin_budget_ns(const BusBudget &budget)
+{
+    if (!budget.zxHz)
+        return 0;
+    // rounded down, centiT * 10^9 / 100 / zxHz
+    return uint32_t(uint64_t(budget.centiT) * 10000000 / budget.zxHz);
+}
+
+uint32_t margin_hold_budget_ns(const BusBudget &budget)
+{
+    if (!budget.zxHz)
+        return 0;
+    return uint32_t(uint64_t(budget.holdCentiT) * 10000000 / budget.zxHz);
+}
+
+uint32_t margin_latency_ns(const ClockProfile &profile, uint32_t worstCycles, const BusBudget &budget)
+{
+    if (!profile.sysKhz)
+        return UINT32_MAX;
+    // in 1/256 system clocks, the PIO runs at sysKhz / divider
+    const uint64_t div = uint64_t(profile.pioDivInt) * 256 + profile.pioDivFrac;
+    const uint64_t cycles256 = uint64_t(worstCycles) * 256 + budget.pioCycles * div;
+    const uint64_t den = uint64_t(profile.sysKhz) * 256;
+    return uint32_t((cycles256 * 1000000 + den - 1) / den);
+}
+
+int32_t margin_ns(const ClockProfile &profile, uint32_t worstCycles, const BusBudget &budget)
+{
+    return int32_t(int64_t(margin_budget_ns(budget)) - margin_latency_ns(profile, worstCycles, budget));
+}
+
+bool margin_fits(const ClockProfile &profile, uint32_t worstCycles, const BusBudget &budget)
+{
+    const int64_t headroom = uint64_t(margin_budget_ns(budget)) * budget.headroomPct / 100;
+    return margin_ns(profile, worstCycles, budget) >= headroom;
+}
+
+int margin_pick(const ClockProfile *profiles, const uint32_t *worstCycles, int count, const BusBudget &budget)
+{
+    int best = -1;
+    for (int i = 0; i < count; ++i) {
+        if (!worstCycles[i] || !margin_fits(profiles[i], worstCycles[i], budget))
+            continue;
+        if (best < 0 || profiles[i].sysKhz < profiles[best].sysKhz)
+            best = i;
+    }
+    return best;
+}
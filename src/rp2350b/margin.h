@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+
+// Clock profiles and the bus margin maths used to calibrate them. No SDK
+// calls in here, the host tools check it as is; profile.cpp applies them.
+
+struct ClockProfile
+{
+    const char *name;
+    uint32_t sysKhz;
+    uint16_t millivolts;    // core voltage, set before the clock goes up
+    uint16_t pioDivInt;     // divider of the bus state machines
+    uint8_t pioDivFrac;     // in 1/256ths
+};
+
+// by clock, the calibration picks the lowest one that fits
+constexpr ClockProfile ClockProfiles[] = {
+    {"150 MHz", 150000, 1100, 1, 0},
+    {"200 MHz", 200000, 1150, 1, 0},
+    {"250 MHz", 250000, 1250, 1, 0},
+    {"300 MHz", 300000, 1350, 1, 0},
+};
+constexpr int ClockProfileCount = sizeof(ClockProfiles) / sizeof(ClockProfiles[0]);
+
+// What a MREQ read has to fit in: /MREQ falls in T1, the Z80 samples /WAIT
+// on the falling edge of T2 and the data on the rising edge of T3, so the data
+// has to be out 1.5 T states later or the Z80 reads an undriven bus. It is not
+// held for a late answer, only for a hold word, see margin_hold_budget_ns().
+struct BusBudget
+{
+    uint32_t zxHz = 3546900;
+    uint16_t centiT = 150;      // budget in 1/100 T states
+    uint16_t holdCentiT = 100;  // the same for a hold word, see margin_hold_budget_ns()
+    uint16_t pioCycles = 6;     // PIO clocks: input synchronizers, in + push, pull + out
+    uint8_t headroomPct = 25;   // margin to keep, in percent of the budget
+};
+
+uint32_t margin_budget_ns(const BusBudget &budget);
+
+// What a hold word has to fit in: the Z80 samples /WAIT on the falling edge
+// of T2, 1 T state after /MREQ fell. A read core1 cannot answer in time gets
+// its hold word out by then, see zx_wait_read(); the latency is counted like
+// a read's, with margin_latency_ns().
+uint32_t margin_hold_budget_ns(const BusBudget &budget);
+
+// worst MREQ read latency of a profile, from the core1 cycles zx_measure()
+// reported plus the PIO part, rounded up
+uint32_t margin_latency_ns(const ClockProfile &profile, uint32_t worstCycles, const BusBudget &budget);
+
+// budget minus latency, negative when the data comes late
+int32_t margin_ns(const ClockProfile &profile, uint32_t worstCycles, const BusBudget &budget);
+
+// true when the margin keeps the headroom
+bool margin_fits(const ClockProfile &profile, uint32_t worstCycles, const BusBudget &budget);
+
+// The lowest clock profile that fits, -1 when none does. A profile with
+// worstCycles 0 was not measured and is skipped.
+int margin_pick(const ClockProfile *profiles, const uint32_t *worstCycles, int count, const BusBudget &budget);
@@ -0,0 +1,213 @@
+#include "profile.h"
+
+#include <hardware/clocks.h>
+#include <hardware/flash.h>
+#include <hardware/timer.h>
+#include <hardware/vreg.h>
+#include <pico/flash.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#include "psram.h"
+#include "utils.h"
+#include "zx.h"
+
+namespace {
+
+constexpr uint32_t SettingsMagic = 0x31504649; // "IFP1"
+constexpr uint32_t SettingsVersion = 1;
+constexpr uint32_t SettingsOffset = PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE;
+
+constexpr uint32_t VregSettleUs = 1000;
+constexpr uint32_t LockoutTimeoutMs = 100;  // core1 parks within a bus cycle
+constexpr uint32_t CalibrateUs = 50000;     // bus time per profile
+constexpr uint32_t MinReads = 1000;         // fewer: no Spectrum on the bus
+
+struct StoredSettings
+{
+    uint32_t magic;
+    uint32_t version;
+    ProfileSettings settings;
+    uint32_t check;
+};
+static_assert(sizeof(StoredSettings) <= FLASH_PAGE_SIZE);
+
+ProfileSettings Settings;
+int Active = -1;
+bool Dirty = false;     // Settings differ from the flash copy
+
+uint32_t checksum(const StoredSettings &stored)
+{
+    const auto *bytes = reinterpret_cast<const uint8_t *>(&stored);
+    uint32_t sum = 0x811c9dc5;
+    for (size_t i = 0; i < offsetof(StoredSettings, check); ++i)
+        sum = (sum ^ bytes[i]) * 0x01000193;
+    return sum;
+}
+
+bool load()
+{
+    StoredSettings stored;
+    memcpy(&stored, reinterpret_cast<const void *>(XIP_BASE + SettingsOffset), sizeof(stored));
+    if (stored.magic != SettingsMagic || stored.version != SettingsVersion || stored.check != checksum(stored))
+        return false;
+    if (stored.settings.profile >= ClockProfileCount)
+        return false;
+    Settings = stored.settings;
+    return true;
+}
+
+// flash_safe_execute() callback, page is FLASH_PAGE_SIZE bytes
+void write_settings(void *page)
+{
+    flash_range_erase(SettingsOffset, FLASH_SECTOR_SIZE);
+    flash_range_program(SettingsOffset, static_cast<const uint8_t *>(page), FLASH_PAGE_SIZE);
+}
+
+void store()
+{
+    alignas(4) uint8_t page[FLASH_PAGE_SIZE];
+    memset(page, 0xff, sizeof(page));
+    StoredSettings stored{SettingsMagic, SettingsVersion, Settings, 0};
+    stored.check = checksum(stored);
+    memcpy(page, &stored, sizeof(stored));
+
+    // the Z80 stays on /WAIT for the erase, core1 has nothing to serve
+    zx_hold(true);
+    const int result = flash_safe_execute(write_settings, page, LockoutTimeoutMs);
+    zx_hold(false);
+    if (result != PICO_OK)
+        error("Clock profile not stored");
+    Dirty = false;
+}
+
+void set_voltage(uint16_t millivolts)
+{
+    if (millivolts > 1300)
+        vreg_disable_voltage_limit();
+    // 0.55 V and up in 50 mV steps
+    vreg_set_voltage(static_cast<vreg_voltage>((millivolts - 550) / 50));
+    busy_wait_us(VregSettleUs);
+}
+
+void report(int index, const ZxMargin &margin, const BusBudget &budget)
+{
+    const ClockProfile &p = ClockProfiles[index];
+    char message[160];
+    snprintf(message, sizeof(message), "%s: worst MREQ read %lu cycles, %lu of %lu ns (%ld ns margin), %lu reads",
+             p.name, (unsigned long)margin.worstCycles,
+             (unsigned long)margin_latency_ns(p, margin.worstCycles, budget),
+             (unsigned long)margin_budget_ns(budget), (long)margin_ns(p, margin.worstCycles, budget),
+             (unsigned long)margin.reads);
+    notice(message);
+}
+
+// times the bus at every profile and keeps the lowest one that fits
+bool calibrate()
+{
+    BusBudget budget;
+    budget.headroomPct = Settings.headroomPct;
+    uint32_t worst[ClockProfileCount] = {};
+    for (int i = 0; i < ClockProfileCount; ++i) {
+        profile_apply(i);
+        const ZxMargin margin = zx_measure_request(CalibrateUs * (ClockProfiles[i].sysKhz / 1000));
+        report(i, margin, budget);
+        if (margin.reads < MinReads) {
+            error("No bus activity, clock profiles not calibrated");
+            return false;
+        }
+        worst[i] = margin.worstCycles;
+    }
+
+    int pick = margin_pick(ClockProfiles, worst, ClockProfileCount, budget);
+    if (pick < 0) {
+        // the fastest one comes closest
+        error("No clock profile keeps the bus headroom");
+        pick = ClockProfileCount - 1;
+    }
+    Settings.profile = pick;
+    Settings.calibrated = true;
+    memcpy(Settings.worstCycles, worst, sizeof(worst));
+    Dirty = true;
+    return true;
+}
+
+} // namespace {
+
+void profile_boot()
+{
+    if (!load())
+        Settings = ProfileSettings{};
+    if (Settings.mode == ProfileMode::Auto && !Settings.calibrated && !calibrate())
+        Settings.profile = 0;
+    profile_apply(Settings.profile);
+
+    char message[48];
+    snprintf(message, sizeof(message), "Clock profile %s%s", ClockProfiles[Active].name,
+             Settings.mode == ProfileMode::Auto ? " (auto)" : "");
+    notice(message);
+}
+
+bool profile_apply(int index)
+{
+    if (index < 0 || index >= ClockProfileCount)
+        return false;
+    const ClockProfile &p = ClockProfiles[index];
+    const uint32_t currentKhz = clock_get_hz(clk_sys) / 1000;
+
+    // more voltage before a faster clock, less after a slower one
+    if (p.sysKhz > currentKhz) {
+        set_voltage(p.millivolts);
+        psram_set_timing(p.sysKhz * 1000);
+    }
+    if (!set_sys_clock_khz(p.sysKhz, false)) {
+        error("Clock profile not reachable by the PLL");
+        return false;
+    }
+    if (p.sysKhz <= currentKhz)
+        set_voltage(p.millivolts);
+    psram_set_timing(clock_get_hz(clk_sys));
+
+    // set_sys_clock_khz() puts clk_peri back on clk_sys
+    clock_configure_undivided(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB, USB_CLK_HZ);
+    zx_set_pio_clkdiv(p.pioDivInt, p.pioDivFrac);
+    Active = index;
+    return true;
+}
+
+int profile_active()
+{
+    return Active;
+}
+
+const ProfileSettings &profile_settings()
+{
+    return Settings;
+}
+
+void profile_request(uint8_t index)
+{
+    if (index == ProfileAuto) {
+        Settings.mode = ProfileMode::Auto;
+        Settings.calibrated = false;
+        Dirty = true;
+        notice("Clock profiles calibrate at the next boot");
+    } else if (index >= ClockProfileCount) {
+        error("No such clock profile");
+    } else {
+        Settings.mode = ProfileMode::Fixed;
+        Settings.profile = index;
+        Dirty = true;
+        char message[48];
+        snprintf(message, sizeof(message), "Clock profile %s at the next boot", ClockProfiles[index].name);
+        notice(message);
+    }
+}
+
+void profile_task()
+{
+    if (Dirty)
+        store();
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+#include "margin.h"
+
+// Clock profiles: the system clock, the core voltage and the divider of the
+// bus state machines, always changed together. The choice lives in the last
+// flash sector.
+//
+// Auto times the bus at every profile on the first boot, or the next one after
+// a request, and keeps the lowest clock whose worst MREQ read still leaves
+// the headroom; later boots just apply the stored result. Fixed applies one
+// profile as it is.
+//
+// clk_peri is moved to the USB PLL so the SD card and UART clocks do not
+// follow the system clock around.
+
+enum class ProfileMode : uint8_t {
+    Auto,
+    Fixed,
+};
+
+constexpr uint8_t ProfileAuto = 0x0f; // profile_request() value for Auto
+
+struct ProfileSettings
+{
+    ProfileMode mode = ProfileMode::Auto;
+    uint8_t profile = 0;            // the one in use
+    uint8_t headroomPct = BusBudget{}.headroomPct;
+    bool calibrated = false;        // Auto: worstCycles hold a calibration
+    uint32_t worstCycles[ClockProfileCount] = {};
+};
+
+// core0, once stdio is up and before the bus loop starts (before
+// zx_start()): loads the settings, calibrates when due and applies the profile.
+// The SD card has to be initialised after it.
+void profile_boot();
+
+// core0, before zx_start(): switches to a profile now, the choice is not
+// stored. The clock goes through clk_ref meanwhile, too slow for the bus.
+bool profile_apply(int index);
+int profile_active();
+const ProfileSettings &profile_settings();
+
+// core0, with the bus loop running: stores a profile port 3 asked for, or
+// ProfileAuto, which calibrates; either takes effect at the next boot
+void profile_request(uint8_t index);
+
+// core0, with the bus loop running: stores the choice of profile_request()
+// or of a boot calibration. Flash is only written from here, with the Z80
+// held (zx_hold()) and core1 parked in SRAM by flash_safe_execute(): it reads
+// ROM images from flash while they are copied in, see rombank_begin().
+void profile_task();
@@ -0,0 +1,212 @@
+#include "psram.h"
+
+#include <hardware/clocks.h>
+#include <hardware/timer.h>
+
+#include <cstring>
+
+#if PICO_ON_DEVICE
+#include <hardware/gpio.h>
+#include <hardware/structs/qmi.h>
+#include <hardware/structs/xip_ctrl.h>
+#include <hardware/sync.h>
+#else
+#include "sim.h"
+#endif
+
+namespace {
+
+constexpr uint32_t BenchBytes = 64 * 1024;
+constexpr uint32_t BenchReads = 256;
+
+uint32_t Size = 0;
+
+#if PICO_ON_DEVICE
+constexpr uint PsramCsPin = 8;
+constexpr uint32_t PsramMaxHz = 133000000;
+constexpr uint32_t RxDelayHz = 100000000;   // above it the data is sampled a cycle later
+uint8_t *const Base = reinterpret_cast<uint8_t *>(0x11000000);
+uint8_t *const Uncached = reinterpret_cast<uint8_t *>(0x15000000);
+
+constexpr uint8_t CmdReadId = 0x9f;
+constexpr uint8_t CmdResetEnable = 0x66;
+constexpr uint8_t CmdReset = 0x99;
+constexpr uint8_t CmdQpiEnable = 0x35;
+constexpr uint8_t CmdQpiExit = 0xf5;
+constexpr uint8_t CmdQuadRead = 0xeb;
+constexpr uint8_t CmdQuadWrite = 0x38;
+constexpr uint8_t KnownGoodDie = 0x5d;
+
+// Everything between entering and leaving direct mode runs from SRAM: flash
+// is not readable meanwhile.
+uint8_t __no_inline_not_in_flash_func(direct_transfer)(uint32_t tx)
+{
+    qmi_hw->direct_tx = tx;
+    while (!(qmi_hw->direct_csr & QMI_DIRECT_CSR_TXEMPTY_BITS)) {
+    }
+    while (qmi_hw->direct_csr & QMI_DIRECT_CSR_BUSY_BITS) {
+    }
+    return qmi_hw->direct_rx;
+}
+
+void __no_inline_not_in_flash_func(direct_command)(uint32_t tx)
+{
+    hw_set_bits(&qmi_hw->direct_csr, QMI_DIRECT_CSR_ASSERT_CS1N_BITS);
+    direct_transfer(tx);
+    hw_clear_bits(&qmi_hw->direct_csr, QMI_DIRECT_CSR_ASSERT_CS1N_BITS);
+}
+
+uint32_t __no_inline_not_in_flash_func(probe)()
+{
+    qmi_hw->direct_csr = 30 << QMI_DIRECT_CSR_CLKDIV_LSB | QMI_DIRECT_CSR_EN_BITS;
+    while (qmi_hw->direct_csr & QMI_DIRECT_CSR_BUSY_BITS) {
+    }
+
+    // a warm reboot leaves the part in QPI mode, where it ignores SPI commands
+    direct_command(QMI_DIRECT_TX_OE_BITS | QMI_DIRECT_TX_IWIDTH_VALUE_Q << QMI_DIRECT_TX_IWIDTH_LSB | CmdQpiExit);
+
+    // read ID: the command, 3 address bytes, the known good die and EID bytes
+    hw_set_bits(&qmi_hw->direct_csr, QMI_DIRECT_CSR_ASSERT_CS1N_BITS);
+    uint8_t kgd = 0;
+    uint8_t eid = 0;
+    for (int i = 0; i < 7; ++i) {
+        const uint8_t in = direct_transfer(i ? 0xff : CmdReadId);
+        if (i == 5)
+            kgd = in;
+        else if (i == 6)
+            eid = in;
+    }
+    hw_clear_bits(&qmi_hw->direct_csr, QMI_DIRECT_CSR_ASSERT_CS1N_BITS);
+
+    uint32_t size = 0;
+    if (kgd == KnownGoodDie) {
+        // density in EID[7:5], 0x26 is an 8MB part with an older ID
+        const uint8_t density = eid >> 5;
+        size = 1024 * 1024;
+        if (eid == 0x26 || density == 2)
+            size *= 8;
+        else if (density == 1)
+            size *= 4;
+        else if (density == 0)
+            size *= 2;
+        direct_command(CmdResetEnable);
+        direct_command(CmdReset);
+        direct_command(CmdQpiEnable);
+    }
+    qmi_hw->direct_csr = 0;
+    return size;
+}
+
+void __no_inline_not_in_flash_func(set_timing)(uint32_t hz)
+{
+    uint32_t divisor = (hz + PsramMaxHz - 1) / PsramMaxHz;
+    if (divisor == 1 && hz > RxDelayHz)
+        divisor = 2;
+    uint32_t rxDelay = divisor;
+    if (hz / divisor > RxDelayHz)
+        ++rxDelay;
+
+    // /CE low for at most 8 us, in units of 64 clocks, high for at least 18 ns
+    const uint64_t periodFs = 1000000000000000ull / hz;
+    const uint32_t maxSelect = 125 * 1000000 / periodFs;
+    const uint32_t minDeselect = (18 * 1000000 + periodFs - 1) / periodFs - (divisor + 1) / 2;
+
+    qmi_hw->m[1].timing = 1 << QMI_M1_TIMING_COOLDOWN_LSB
+        | QMI_M1_TIMING_PAGEBREAK_VALUE_1024 << QMI_M1_TIMING_PAGEBREAK_LSB
+        | maxSelect << QMI_M1_TIMING_MAX_SELECT_LSB | minDeselect << QMI_M1_TIMING_MIN_DESELECT_LSB
+        | rxDelay << QMI_M1_TIMING_RXDELAY_LSB | divisor << QMI_M1_TIMING_CLKDIV_LSB;
+}
+
+void setup_quad()
+{
+    constexpr uint32_t quad = QMI_M1_RFMT_PREFIX_WIDTH_VALUE_Q << QMI_M1_RFMT_PREFIX_WIDTH_LSB
+        | QMI_M1_RFMT_ADDR_WIDTH_VALUE_Q << QMI_M1_RFMT_ADDR_WIDTH_LSB
+        | QMI_M1_RFMT_SUFFIX_WIDTH_VALUE_Q << QMI_M1_RFMT_SUFFIX_WIDTH_LSB
+        | QMI_M1_RFMT_DUMMY_WIDTH_VALUE_Q << QMI_M1_RFMT_DUMMY_WIDTH_LSB
+        | QMI_M1_RFMT_DATA_WIDTH_VALUE_Q << QMI_M1_RFMT_DATA_WIDTH_LSB
+        | QMI_M1_RFMT_PREFIX_LEN_VALUE_8 << QMI_M1_RFMT_PREFIX_LEN_LSB;
+    // 0xeb takes 6 wait cycles, 24 bits of dummy at quad width
+    qmi_hw->m[1].rfmt = quad | 6 << QMI_M1_RFMT_DUMMY_LEN_LSB;
+    qmi_hw->m[1].rcmd = CmdQuadRead << QMI_M1_RCMD_PREFIX_LSB;
+    qmi_hw->m[1].wfmt = quad;
+    qmi_hw->m[1].wcmd = CmdQuadWrite << QMI_M1_WCMD_PREFIX_LSB;
+}
+#else
+uint8_t *const Base = sim::Psram;
+uint8_t *const Uncached = sim::Psram;
+#endif
+
+} // namespace {
+
+uint32_t psram_init()
+{
+#if PICO_ON_DEVICE
+    gpio_set_function(PsramCsPin, GPIO_FUNC_XIP_CS1);
+    const uint32_t interrupts = save_and_disable_interrupts();
+    Size = probe();
+    if (Size) {
+        set_timing(clock_get_hz(clk_sys));
+        setup_quad();
+    }
+    restore_interrupts(interrupts);
+    if (Size)
+        hw_set_bits(&xip_ctrl_hw->ctrl, XIP_CTRL_WRITABLE_M1_BITS);
+#else
+    Size = sim::PsramBytes;
+#endif
+    return Size;
+}
+
+uint32_t psram_size()
+{
+    return Size;
+}
+
+uint8_t *psram_base()
+{
+    return Size ? Base : nullptr;
+}
+
+bool psram_contains(const void *p)
+{
+    return Size && uintptr_t(p) - uintptr_t(Base) < Size;
+}
+
+void psram_set_timing([[maybe_unused]] uint32_t sysHz)
+{
+#if PICO_ON_DEVICE
+    if (!Size)
+        return;
+    const uint32_t interrupts = save_and_disable_interrupts();
+    set_timing(sysHz);
+    restore_interrupts(interrupts);
+#endif
+}
+
+PsramBench psram_bench()
+{
+    PsramBench bench;
+    if (Size < 2 * BenchBytes)
+        return bench;
+
+    // the second 64K, the XIP cache is 16K and was last filled from flash
+    static uint8_t buffer[4096];
+    uint32_t start = time_us_32();
+    for (uint32_t offset = 0; offset < BenchBytes; offset += sizeof(buffer))
+        memcpy(buffer, Base + BenchBytes + offset, sizeof(buffer));
+    uint32_t us = time_us_32() - start;
+    if (us)
+        bench.readKBs = uint64_t(BenchBytes) * 1000000 / 1024 / us;
+
+    // scattered single bytes through the uncached alias
+    volatile uint8_t sink = 0;
+    uint32_t offset = 0;
+    start = time_us_32();
+    for (uint32_t i = 0; i < BenchReads; ++i) {
+        offset = (offset + 0x9e3779b1u) % Size;
+        sink = sink + Uncached[offset];
+    }
+    us = time_us_32() - start;
+    bench.randomNs = us * 1000 / BenchReads;
+    return bench;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+// Optional QSPI PSRAM on QMI chip select 1 (GPIO8).
+//
+// psram_init() probes for an APS6404 style part by its read ID answer, puts
+// it in QPI mode and maps it behind the XIP cache at 0x11000000, writable.
+// Without one everything here is a no-op and psram_size() is 0.
+//
+// The QMI divider of the PSRAM follows clk_sys: profile_apply() sets the
+// timing of the faster of the two clocks before a change and the one of the
+// new clock after it. Flash programming keeps the chip select 1 setup, but
+// the PSRAM is not readable while it runs, like flash itself.
+
+// core0, before zx_start(): bytes found
+uint32_t psram_init();
+uint32_t psram_size();
+uint8_t *psram_base();
+bool psram_contains(const void *p);
+
+// core0: the QMI timing for a clk_sys of sysHz
+void psram_set_timing(uint32_t sysHz);
+
+struct PsramBench
+{
+    uint32_t readKBs = 0;       // copying 64K out of it, 0 when not timed
+    uint32_t randomNs = 0;      // a single byte read missing the XIP cache
+};
+
+// core0: times reads of the first 64K+ of the PSRAM, nothing else may use it
+// meanwhile
+PsramBench psram_bench();
@@ -0,0 +1,82 @@
+#include "ramshadow.h"
+
+#include "sram.h"
+#include "zx.h"
+
+// too big for SRAM4-7, core1 only writes them for snooped writes, which the
+// Z80 does not wait for
+uint8_t RamShadow[RamShadowSize];
+std::atomic<uint32_t> RamValid[RamValidWords];
+__zx_data uint8_t RamDump[RamDumpSize];
+__zx_data std::atomic<uint32_t> RamDumpWritten{0};
+
+namespace {
+
+bool Capturing = true;      // zx_init() starts the snoop state machine
+uint32_t Restarts = 0;
+
+void invalidate()
+{
+    for (std::atomic<uint32_t> &valid : RamValid)
+        valid.store(0, std::memory_order_relaxed);
+}
+
+} // namespace {
+
+void ramshadow_capture(bool on)
+{
+    if (on == Capturing)
+        return;
+    Capturing = on;
+    // what the Z80 wrote while the state machine was off is missing
+    if (on)
+        invalidate();
+    zx_snoop(on);
+}
+
+bool ramshadow_capturing()
+{
+    return Capturing;
+}
+
+bool ramshadow_valid(uint16_t addr, uint32_t size)
+{
+    uint32_t offset = uint32_t(addr) - RamShadowBase;
+    if (offset >= RamShadowSize || size > RamShadowSize - offset)
+        return false;
+    // whole words at a time where they are all in the range
+    for (const uint32_t end = offset + size; offset < end;) {
+        const uint32_t bits = RamValid[offset / 32].load(std::memory_order_relaxed);
+        if (offset % 32 == 0 && end - offset >= 32) {
+            if (bits != ~0u)
+                return false;
+            offset += 32;
+            continue;
+        }
+        if (!(bits & 1u << (offset % 32)))
+            return false;
+        ++offset;
+    }
+    return true;
+}
+
+void ramshadow_task()
+{
+    if (!Capturing || !zx_snoop_lost())
+        return;
+    // stopped first, so core1 sets no bit while they are cleared
+    zx_snoop(false);
+    invalidate();
+    zx_snoop(true);
+    ++Restarts;
+}
+
+uint32_t ramshadow_restarts()
+{
+    return Restarts;
+}
+
+void ramshadow_dump_clear()
+{
+    RamDumpWritten.store(0, std::memory_order_relaxed);
+}
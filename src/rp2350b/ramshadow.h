@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+
+#include <atomic>
+
+#include <pico.h>
+
+#include "screen.h"
+#include "zx.pio.h"
+
+// A byte exact copy of the 48K RAM, kept from the memory writes the Z80 does.
+//
+// The zx_snoop state machine samples every memory write with /WR low, when
+// the data is on the bus, and core1 copies the ones to 0x4000..0xffff into
+// RamShadow, marking the byte valid and, for the display file, its screen
+// line dirty. zx_poll() serves it after the MREQ and IORQ words, from the
+// same FSTAT read: a write is over before the next MREQ starts, so the ROM
+// reads never wait for it.
+//
+// A byte is valid once the Z80 wrote it while the capture ran. The 48K ROM
+// writes all of the RAM while it tests it after a reset, so from then on the
+// shadow is the RAM and saving it is a memcpy on the Pico. Capture runs from
+// boot, stopped and started again every byte is invalid until written again.
+//
+// Writes to the ROM range are dropped, but for the RamDumpSize bytes at
+// RamDumpBase: the register dump of the snapshot save stub, see snapshot.h.
+//
+// 48K only: the 128K banks paged at 0xc000 all land on the same 16K.
+
+constexpr uint16_t RamShadowBase = 0x4000;
+constexpr uint32_t RamShadowSize = 0xc000;
+constexpr uint32_t RamValidWords = RamShadowSize / 32;
+constexpr uint16_t RamDumpBase = 0x3fe0;
+constexpr uint32_t RamDumpSize = 32;
+
+extern uint8_t RamShadow[RamShadowSize];
+// a bit for each byte of RamShadow written since the capture started
+extern std::atomic<uint32_t> RamValid[RamValidWords];
+extern uint8_t RamDump[RamDumpSize];
+// a bit for each byte of RamDump written since ramshadow_dump_clear()
+extern std::atomic<uint32_t> RamDumpWritten;
+
+// core0: starts or stops the zx_snoop state machine, starting it again
+// invalidates the whole shadow
+void ramshadow_capture(bool on);
+bool ramshadow_capturing();
+// core0: true when every byte of addr..addr + size - 1 is valid
+bool ramshadow_valid(uint16_t addr, uint32_t size);
+// core0 main loop: starts the capture again, the whole shadow invalid, when
+// the zx_snoop RX FIFO ran full. The write that found it full is lost and
+// its byte would stay stale but valid, the screen of screen.h included.
+void ramshadow_task();
+// how often ramshadow_task() started over
+uint32_t ramshadow_restarts();
+
+// core0: forgets the register dump before the stub writes it again
+void ramshadow_dump_clear();
+
+// core1: called with every word popped from the zx_snoop state machine
+__force_inline void ramshadow_record(uint32_t bus)
+{
+    const uint16_t addr = bus >> I_ADDR_BASE;
+    const uint8_t data = bus >> B_DATA_BASE;
+    const uint32_t offset = uint32_t(addr) - RamShadowBase;
+    if (offset >= RamShadowSize) [[unlikely]] {
+        const uint32_t dump = uint32_t(addr) - RamDumpBase;
+        if (dump < RamDumpSize) {
+            RamDump[dump] = data;
+            RamDumpWritten.store(RamDumpWritten.load(std::memory_order_relaxed) | 1u << dump,
+                                 std::memory_order_release);
+        }
+        return;
+    }
+    RamShadow[offset] = data;
+    std::atomic<uint32_t> &valid = RamValid[offset / 32];
+    valid.store(valid.load(std::memory_order_relaxed) | 1u << (offset % 32), std::memory_order_relaxed);
+    if (offset < ScreenBytes) {
+        const uint32_t line = offset / ScreenLineBytes;
+        std::atomic<uint32_t> &dirty = ScreenDirty[line / 32];
+        dirty.store(dirty.load(std::memory_order_relaxed) | 1u << (line % 32), std::memory_order_release);
+    }
+}
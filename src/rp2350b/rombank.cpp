@@ -0,0 +1,325 @@
+#include "rombank.h"
+
+#include <hardware/clocks.h>
+#include <hardware/timer.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "io.h"
+#include "lz4.h"
+#include "psram.h"
+#include "sram.h"
+#include "utils.h"
+#include "zx.h"
+
+namespace {
+
+const RomImage *Library[MaxRomImages];
+int LibraryCount = 0;
+
+// Two sets of banks: the bus engine serves one, the next image is copied into
+// the other one. Each set holds all the banks of an image so 0x7ffd/0x1ffd
+// paging is just a pointer change.
+alignas(4) __zx_bank uint8_t RomSets[2][MaxRomBanks * RomBankSize];
+__zx_data uint8_t *volatile ActiveBase = RomSets[0];
+const RomImage *Active = nullptr;
+int ActiveIndex = -1;
+int ActiveSet = 0;
+
+// the image each set holds, -1 for none, and how many of its lines from the
+// start; the inactive one is what rombank_task() prefetches into
+int SetImage[2] = {-1, -1};
+uint32_t SetLines[2] = {};
+// the image selected after each one the last time it was left, -1 if none
+int8_t Successor[MaxRomImages];
+// the trap table of each set, see RomTrapPtr
+__zx_bank uint32_t TrapTables[2][RomTrapWords];
+uint32_t LastPrefetched = 0;
+__zx_data uint8_t ActiveBankMask = 0;
+__zx_data bool PlusThree = false;
+
+__zx_data uint8_t Port7ffd = 0;
+__zx_data uint8_t Port1ffd = 0;
+
+uint32_t LastSwitchUs = 0;
+
+// the next line of the set being filled in, see rombank_begin()
+uint32_t FillNext = 0;
+uint32_t FillStartUs = 0;
+
+// 128K: A15 and A1 low; +2A/+3: 0x7ffd needs A14 high, 0x1ffd is A15..A12 = 0001
+void __zx_code(paging_write)(uint16_t addr, uint8_t data)
+{
+    if (addr & 0x8000)
+        return;
+    // bit 5 locks the paging until the next reset
+    if (Port7ffd & 0x20)
+        return;
+    if (!PlusThree || (addr & 0x4000))
+        Port7ffd = data;
+    else if ((addr & 0xf000) == 0x1000)
+        Port1ffd = data;
+    else
+        return;
+#ifndef ZX_ROM_DMA
+    // the zx_rom table holds a single bank, see rombank_select()
+    if (!zx_shadow_active())
+        rombank_page();
+#endif
+}
+
+const IoDevice RomPaging{"rom paging", 0x02, 0x00, nullptr, paging_write};
+
+// a packed image, all of it
+bool unpack(int set, int index)
+{
+    const RomImage *image = Library[index];
+    if (lz4_unpack(image->data, image->packed, RomSets[set], image->size) == int32_t(image->size)) {
+        SetImage[set] = index;
+        SetLines[set] = image->size / RomFillLine;
+        return true;
+    }
+    SetImage[set] = -1;
+    SetLines[set] = 0;
+    error("Corrupt packed ROM image");
+    return false;
+}
+
+void set_traps(uint32_t *table, uint16_t first, uint16_t last, RomTrap action)
+{
+    for (uint32_t addr = first; addr <= last; ++addr) {
+        const uint32_t shift = addr % 16 * 2;
+        table[addr / 16] = (table[addr / 16] & ~(3u << shift)) | uint32_t(action) << shift;
+    }
+}
+
+} // namespace {
+
+__zx_data std::atomic<uint32_t> RomFillBytes{0};
+__zx_data uint8_t *RomFillBase = nullptr;
+__zx_data const uint8_t *RomFillSource = nullptr;
+__zx_data ZxWaitSource RomFillWait = ZxWaitSource::Flash;
+__zx_data std::atomic<uint32_t> RomFillValid[RomFillLines / 32];
+__zx_data const uint32_t *volatile RomTrapPtr = TrapTables[0];
+
+int rombank_add(const RomImage *image)
+{
+    if (LibraryCount == MaxRomImages) {
+        error("ROM library is full");
+        return -1;
+    }
+    if (!image->size || image->size % RomBankSize || image->size > MaxRomBanks * RomBankSize) {
+        error("Invalid ROM image size");
+        return -1;
+    }
+    for (uint8_t i = 0; i < image->trapCount; ++i) {
+        const RomTrapRange &trap = image->traps[i];
+        if (trap.first > trap.last || trap.last >= RomBankSize || trap.action > RomTrap::Notify) {
+            error("Invalid ROM trap");
+            return -1;
+        }
+    }
+    if (!LibraryCount)
+        io_register(&RomPaging);
+    Library[LibraryCount] = image;
+    Successor[LibraryCount] = -1;
+    return LibraryCount++;
+}
+
+int rombank_count()
+{
+    return LibraryCount;
+}
+
+const RomImage *rombank_image(int index)
+{
+    return index >= 0 && index < LibraryCount ? Library[index] : nullptr;
+}
+
+const RomImage *rombank_active()
+{
+    return Active;
+}
+
+void __zx_code(rombank_page)()
+{
+    const uint32_t bank = (((Port1ffd >> 1) & 2) | ((Port7ffd >> 4) & 1)) & ActiveBankMask;
+    RomPtr = ActiveBase + bank * RomBankSize;
+}
+
+bool rombank_select(int index)
+{
+    if (!rombank_begin(index))
+        return false;
+    while (!rombank_fill(RomFillLines)) {
+    }
+    return true;
+}
+
+bool rombank_begin(int index)
+{
+    const RomImage *image = rombank_image(index);
+    if (!image)
+        return false;
+    while (!rombank_fill(RomFillLines)) {
+    }
+
+    FillStartUs = time_us_32();
+    const int set = Active ? ActiveSet ^ 1 : ActiveSet;
+    // what a prefetch or an earlier switch left there
+    const uint32_t imageLines = image->size / RomFillLine;
+    uint32_t lines = SetImage[set] == index ? SetLines[set] : 0;
+    LastPrefetched = lines;
+    if (image->packed && lines < imageLines) {
+        if (!unpack(set, index))
+            return false;
+        lines = imageLines;
+    }
+    SetImage[set] = index;
+#ifdef ZX_ROM_DMA
+    memcpy(RomSets[set] + lines * RomFillLine, image->data + lines * RomFillLine,
+           image->size - lines * RomFillLine);
+    SetLines[set] = imageLines;
+    // zx_rom reads the other table until zx_rom_dma_select() below
+    zx_rom_dma_load(set, RomSets[set]);
+#else
+    // core1 does not read this set before RomPtr points to it
+    RomFillBase = RomSets[set];
+    RomFillSource = image->data;
+    RomFillWait = psram_contains(image->data) ? ZxWaitSource::Psram : ZxWaitSource::Flash;
+    for (uint32_t word = 0; word < RomFillLines / 32; ++word) {
+        const uint32_t first = word * 32;
+        const uint32_t valid = lines <= first ? 0 : lines >= first + 32 ? ~0u : (1u << (lines - first)) - 1;
+        RomFillValid[word].store(valid, std::memory_order_relaxed);
+    }
+    SetLines[set] = lines;
+    FillNext = lines;
+    RomFillBytes.store(lines < imageLines ? image->size : 0, std::memory_order_release);
+#endif
+
+    if (ActiveIndex >= 0 && ActiveIndex != index)
+        Successor[ActiveIndex] = index;
+    Active = image;
+    ActiveIndex = index;
+    ActiveSet = set;
+    ActiveBankMask = image->size / RomBankSize - 1;
+    PlusThree = image->model == RomModel::Plus3;
+    Port7ffd = 0;
+    Port1ffd = 0;
+    // core1 does not read this table before RomTrapPtr points to it
+    std::fill_n(TrapTables[set], RomTrapWords, 0);
+    for (uint8_t i = 0; i < image->trapCount; ++i)
+        set_traps(TrapTables[set], image->traps[i].first, image->traps[i].last, image->traps[i].action);
+    ActiveBase = RomSets[set];
+    // single aligned stores: the bus engine sees either the old or the new
+    // image, and a fetch in between the traps of the old one
+    RomPtr = RomSets[set];
+    RomTrapPtr = TrapTables[set];
+#ifdef ZX_ROM_DMA
+    zx_rom_dma_select(set);
+#endif
+
+    // the inactive set keeps the image left unless another one is expected
+    const int next = Successor[index];
+    if (next >= 0 && SetImage[set ^ 1] != next) {
+        SetImage[set ^ 1] = next;
+        SetLines[set ^ 1] = 0;
+    }
+    return true;
+}
+
+bool rombank_fill(uint32_t lines)
+{
+    const uint32_t bytes = RomFillBytes.load(std::memory_order_relaxed);
+    if (!bytes && !FillNext) {
+        if (FillStartUs) {
+            LastSwitchUs = time_us_32() - FillStartUs;
+            FillStartUs = 0;
+        }
+        return true;
+    }
+    const uint32_t end = std::min(bytes / RomFillLine, FillNext + lines);
+    for (; FillNext < end; ++FillNext) {
+        memcpy(RomFillBase + FillNext * RomFillLine, RomFillSource + FillNext * RomFillLine,
+               RomFillLine);
+        RomFillValid[FillNext / 32].fetch_or(1u << (FillNext % 32), std::memory_order_release);
+    }
+    SetLines[ActiveSet] = FillNext;
+    if (FillNext * RomFillLine < bytes)
+        return false;
+    RomFillBytes.store(0, std::memory_order_release);
+    FillNext = 0;
+    LastSwitchUs = time_us_32() - FillStartUs;
+    FillStartUs = 0;
+    return true;
+}
+
+RomTrap rombank_trap(uint16_t addr)
+{
+    if (addr >= RomBankSize)
+        return RomTrap::None;
+    return RomTrap(RomTrapPtr[addr / 16] >> (addr % 16 * 2) & 3);
+}
+
+bool rombank_set_trap(uint16_t first, uint16_t last, RomTrap action)
+{
+    if (first > last || last >= RomBankSize || action > RomTrap::Notify)
+        return false;
+    set_traps(TrapTables[ActiveSet], first, last, action);
+    return true;
+}
+
+void rombank_request(uint8_t index)
+{
+    const RomImage *image = rombank_image(index);
+    if (!image) {
+        error("No such ROM image");
+        return;
+    }
+    const ZxWaitSource source = psram_contains(image->data) ? ZxWaitSource::Psram : ZxWaitSource::Flash;
+    const ZxWaitStats before = zx_wait_stats(source);
+    rombank_select(index);
+
+    // the Z80 runs the new image from the begin, reads of lines not copied in
+    // yet were held
+    const ZxWaitStats after = zx_wait_stats(source);
+    const uint32_t heldUs = uint64_t(after.cycles - before.cycles) * 1000000 / clock_get_hz(clk_sys);
+    char message[128];
+    snprintf(message, sizeof(message), "ROM %s ready in %luus, %lu/%lu lines prefetched, %lu reads held for %luus",
+             image->name, (unsigned long)LastSwitchUs, (unsigned long)LastPrefetched,
+             (unsigned long)(image->size / RomFillLine), (unsigned long)(after.waits - before.waits),
+             (unsigned long)heldUs);
+    notice(message);
+}
+
+void rombank_task()
+{
+    // a switch in progress comes first
+    if (!rombank_fill(RomPrefetchLines))
+        return;
+    const int set = ActiveSet ^ 1;
+    const RomImage *image = rombank_image(SetImage[set]);
+    if (!Active || !image)
+        return;
+    if (image->packed) {
+        if (!SetLines[set])
+            unpack(set, SetImage[set]);
+        return;
+    }
+    const uint32_t end = std::min(image->size / RomFillLine, SetLines[set] + RomPrefetchLines);
+    for (uint32_t line = SetLines[set]; line < end; ++line)
+        memcpy(RomSets[set] + line * RomFillLine, image->data + line * RomFillLine, RomFillLine);
+    SetLines[set] = end;
+}
+
+uint32_t rombank_last_switch_us()
+{
+    return LastSwitchUs;
+}
+
+uint32_t rombank_last_prefetched()
+{
+    return LastPrefetched;
+}
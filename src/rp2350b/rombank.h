@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+
+#include <atomic>
+
+constexpr uint32_t RomBankSize = 0x4000;
+constexpr uint32_t MaxRomBanks = 4;   // +2A/+3: four 16K ROMs
+constexpr int MaxRomImages = 64;      // port 3 can select the first 16
+constexpr uint32_t RomFillLine = 256; // bytes copied in at a time, see rombank_fill()
+constexpr uint32_t RomFillLines = MaxRomBanks * RomBankSize / RomFillLine;
+constexpr uint32_t RomPrefetchLines = 4; // copied by each rombank_task()
+constexpr uint32_t RomTrapWords = RomBankSize / 16; // 2 bits per ROM address, see RomTrapPtr
+
+enum class RomModel : uint8_t {
+    Zx48,       // one bank
+    Zx128,      // ROM0/ROM1 paged by bit 4 of 0x7ffd
+    Plus3,      // ROM0..ROM3 paged by 0x7ffd bit 4 and 0x1ffd bit 2
+    Diagnostic,
+    Shadow,     // paged in by its traps
+};
+
+// What a fetch of a ROM address does besides being served, see zx_mreq().
+// Traps which change nothing, paging in while paged in already, are ignored.
+enum class RomTrap : uint8_t {
+    None,
+    PageIn,     // IFp serves the ROM from this fetch on
+    PageOut,    // the machine's own ROM serves the fetches after this one
+    Notify,     // posts MailTag::Trap to core0, the paging stays
+};
+
+struct RomTrapRange
+{
+    uint16_t first;
+    uint16_t last;      // first included, below RomBankSize
+    RomTrap action;
+};
+
+// The built in images are constexpr descriptors generated from roms/ by
+// ifp_rom(), see CMakeLists.txt.
+struct RomImage
+{
+    const char *name;
+    RomModel model;
+    const uint8_t *data;
+    uint32_t size;  // a multiple of RomBankSize, at most MaxRomBanks banks
+    uint32_t packed = 0;    // bytes of the LZ4 block at data, 0 when raw, see lz4.h
+    uint32_t crc = 0;       // CRC-32 of the image, 0 when not known
+    // the trap table of the image, see RomTrapPtr
+    const RomTrapRange *traps = nullptr;
+    uint8_t trapCount = 0;
+};
+
+// the images given to ifp_rom(), in that order: the first one is selected at
+// boot
+extern const RomImage *const BuiltinRoms[];
+extern const int BuiltinRomCount;
+
+// Adds an image to the library, returns its index or -1.
+int rombank_add(const RomImage *image);
+int rombank_count();
+const RomImage *rombank_image(int index);
+const RomImage *rombank_active();
+
+// Copies an image into the inactive SRAM bank set and flips RomPtr to it.
+// Called on core0, the switch is atomic for the bus engine.
+//
+// The inactive set keeps the image switched away from, so switching back is
+// only the pointer flip. Each switch also notes which image followed the one
+// left: when the new one was followed by another one last time, rombank_task()
+// copies that one into the inactive set instead, ahead of the next switch.
+// Lines found there are not copied again.
+//
+// A packed image is unpacked into the set whole before RomPtr flips, there
+// is nothing to read a missing byte from.
+bool rombank_select(int index);
+
+// rombank_select() in steps. rombank_begin() flips RomPtr to the inactive
+// set right away, rombank_fill() then copies the image in, lines at a time,
+// and returns true once it is all there. Meanwhile the bus engine reads the
+// lines not copied yet from the image itself, holding the Z80 on /WAIT, see
+// zx_wait_read(). A begin finishes the fill before it. With ZX_ROM_DMA begin
+// copies the image all and builds the zx_rom table of the inactive set from
+// it, then switches zx_rom to that table in the same step as RomPtr.
+bool rombank_begin(int index);
+bool rombank_fill(uint32_t lines);
+
+// The traps of the active image, one RomTrap in 2 bits for each ROM
+// address: the bus engine finds the one of a fetch with a single load. Each
+// SRAM set has a table of its own, rombank_begin() builds it from the image
+// and flips the pointer with RomPtr.
+extern const uint32_t *volatile RomTrapPtr;
+
+// the trap of addr in the active table
+RomTrap rombank_trap(uint16_t addr);
+// core0: sets the traps of first..last in the active table, until the next
+// switch. Each word is a single store, the bus engine sees a trap either
+// before or after it changes.
+bool rombank_set_trap(uint16_t first, uint16_t last, RomTrap action);
+
+// bytes of the image being filled in, 0 once it is all there
+extern std::atomic<uint32_t> RomFillBytes;
+// the set being filled in, where from, and a bit for each line copied in;
+// zx_mreq() checks them inline so a line not copied in yet is held for on
+// /WAIT right away, see zx.h
+enum class ZxWaitSource : uint8_t;
+extern uint8_t *RomFillBase;
+extern const uint8_t *RomFillSource;
+extern ZxWaitSource RomFillWait;
+extern std::atomic<uint32_t> RomFillValid[RomFillLines / 32];
+
+// core0: selects an image port 3 asked for and reports it.
+void rombank_request(uint8_t index);
+
+// core0 main loop: copies RomPrefetchLines lines of the image expected next
+// into the inactive set, see rombank_select()
+void rombank_task();
+
+// core1: points RomPtr to the bank selected by 0x7ffd/0x1ffd, used when a
+// shadow ROM session ends. The paging ports only latch their value while a
+// session is active.
+void rombank_page();
+
+// duration of the last rombank_select() in microseconds, from the begin to
+// the end of the fill
+uint32_t rombank_last_switch_us();
+// lines of the last image selected which were in SRAM already
+uint32_t rombank_last_prefetched();
@@ -0,0 +1,63 @@
+# The ROM image build step, shared by the firmware and the host builds. The
+# includer sets IFP_ROMPACK to the rompack command and IFP_ROMPACK_DEPENDS to
+# what builds it, see host/rompack.cpp.
+
+set(IFP_ROMS_DIR ${CMAKE_CURRENT_LIST_DIR}/roms)
+
+# Builds roms/<IMAGE> into TARGET as the constexpr RomImage SYMBOL (see
+# rombank.h): the image packed as an LZ4 block, aligned, with its size and
+# CRC-32, the RomModel and its traps, ADDR[-LAST][:in|out|notify] each. A ROM
+# is one line:
+#
+#   ifp_rom(IFp 48.rom rom48 NAME "48K BASIC" MODEL Zx48 TRAPS 0x0066 0x0008)
+#
+# It goes into BuiltinRoms[] in the order of the calls, see ifp_rom_table().
+# RAW defines an unsigned char SYMBOL[] array of the image as it is instead,
+# for the host benches.
+function(ifp_rom TARGET IMAGE SYMBOL)
+    cmake_parse_arguments(ROM "RAW" "NAME;MODEL" "TRAPS" ${ARGN})
+    set(dir ${CMAKE_CURRENT_BINARY_DIR}/roms)
+    set(out ${dir}/${SYMBOL}.cpp)
+    file(MAKE_DIRECTORY ${dir})
+    if (ROM_RAW)
+        set(args --raw)
+    else()
+        if (NOT ROM_NAME)
+            set(ROM_NAME ${SYMBOL})
+        endif()
+        if (NOT ROM_MODEL)
+            set(ROM_MODEL Zx48)
+        endif()
+        set(args --name ${ROM_NAME} --model ${ROM_MODEL})
+        if (ROM_TRAPS)
+            string(REPLACE ";" "," traps "${ROM_TRAPS}")
+            list(APPEND args --traps ${traps})
+        endif()
+        set_property(TARGET ${TARGET} APPEND PROPERTY IFP_ROMS ${SYMBOL})
+    endif()
+    add_custom_command(OUTPUT ${out}
+        COMMAND ${IFP_ROMPACK} ${args} ${IFP_ROMS_DIR}/${IMAGE} ${SYMBOL} ${out}
+        DEPENDS ${IFP_ROMPACK_DEPENDS} ${IFP_ROMS_DIR}/${IMAGE}
+        VERBATIM)
+    target_sources(${TARGET} PRIVATE ${out})
+endfunction()
+
+# BuiltinRoms[] of the ifp_rom() images of TARGET, called after all of them
+function(ifp_rom_table TARGET)
+    get_property(roms TARGET ${TARGET} PROPERTY IFP_ROMS)
+    list(LENGTH roms count)
+    set(source "// Generated by ifp_rom_table(), the images of the ifp_rom() calls\n\n#include \"rombank.h\"\n\n")
+    set(table "")
+    foreach(rom IN LISTS roms)
+        string(APPEND source "extern const RomImage ${rom};\n")
+        list(APPEND table "&${rom}")
+    endforeach()
+    string(REPLACE ";" ", " table "${table}")
+    string(APPEND source "\nextern constexpr const RomImage *BuiltinRoms[] = {${table}};\n")
+    string(APPEND source "extern constexpr int BuiltinRomCount = ${count};\n")
+    # rewritten only when it changes, so it does not rebuild every time
+    set(out ${CMAKE_CURRENT_BINARY_DIR}/roms/builtin_roms.cpp)
+    file(WRITE ${out}.new "${source}")
+    configure_file(${out}.new ${out} COPYONLY)
+    target_sources(${TARGET} PRIVATE ${out})
+endfunction()
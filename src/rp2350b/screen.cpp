@@ -0,0 +1,107 @@
+#include "screen.h"
+
+#include <hardware/timer.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "ramshadow.h"
+#include "screencast.h"
+#include "snapshot.h"
+#include "sram.h"
+#include "utils.h"
+
+__zx_data std::atomic<uint32_t> ScreenDirty[ScreenDirtyWords];
+
+namespace {
+
+FileSystem *Fs = nullptr;
+int NextShot = -1;          // SHOTnnnn.SCR number, -1 before the directory is read
+
+} // namespace {
+
+void screen_init(FileSystem *fs)
+{
+    Fs = fs;
+    NextShot = -1;
+}
+
+bool screen_complete()
+{
+    return ramshadow_valid(ScreenBase, ScreenBytes);
+}
+
+uint32_t screen_take(uint8_t *out, uint32_t *dirty)
+{
+    uint32_t lines = 0;
+    for (uint32_t i = 0; i < ScreenDirtyWords; ++i) {
+        dirty[i] = ScreenDirty[i].exchange(0, std::memory_order_acquire);
+        lines += __builtin_popcount(dirty[i]);
+    }
+    memcpy(out, RamShadow, ScreenBytes);
+    return lines;
+}
+
+bool screen_save()
+{
+    if (!Fs) {
+        error("Screenshots need an SD card");
+        return false;
+    }
+    if (NextShot < 0)
+        NextShot = next_file_number(*Fs, "SHOT", "SCR");
+    if (NextShot > 9999) {
+        error("No screenshot names left");
+        return false;
+    }
+    char name[20];
+    snprintf(name, sizeof(name), "SHOT%04d.SCR", NextShot);
+
+    // a copy, the Z80 keeps drawing meanwhile. The dirty lines are left to
+    // whoever takes them.
+    static uint8_t shot[ScreenBytes];
+    const uint32_t start = time_us_32();
+    memcpy(shot, RamShadow, ScreenBytes);
+    const uint32_t copyUs = time_us_32() - start;
+    const int file = Fs->open(name, true);
+    const bool ok = file >= 0 && Fs->write(file, 0, shot, ScreenBytes) == int32_t(ScreenBytes);
+    if (file >= 0)
+        Fs->close(file);
+    if (!ok) {
+        error("Screenshot not saved");
+        return false;
+    }
+    ++NextShot;
+    char message[128];
+    snprintf(message, sizeof(message), "Screenshot %s, copied in %luus%s", name, (unsigned long)copyUs,
+             screen_complete() ? "" : ", bytes not written since the capture started are stale");
+    notice(message);
+    return true;
+}
+
+void screen_request(uint8_t arg)
+{
+    switch (arg) {
+    case 0:
+    case 1:
+        ramshadow_capture(arg);
+        notice(arg ? "Capture on" : "Capture off");
+        break;
+    case 2:
+        screen_save();
+        break;
+    case 3:
+        if (Fs)
+            snapshot_save(*Fs);
+        else
+            error("Snapshots need an SD card");
+        break;
+    case 4:
+    case 5:
+        screencast_request(arg & 1);
+        break;
+    default:
+        error("No such screen command");
+        break;
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+#include <atomic>
+
+#include "fs.h"
+
+// The display file out of the RAM shadow of ramshadow.h.
+//
+// Every write to 0x4000..0x5aff the RAM shadow records marks its 32 byte line
+// dirty, core0 takes the screen and the lines changed since the last take,
+// or a screenshot, without the Z80 running the ZPI screen transfer.
+//
+// ZPI command 0b0101000x stops or starts the capture, 0b01010010 saves a
+// screenshot to the SD card as SHOTnnnn.SCR, 0b01010011 a snapshot, see
+// snapshot_save(), 0b0101010x stops or starts the live stream of screencast.h.
+
+constexpr uint16_t ScreenBase = 0x4000;
+constexpr uint32_t ScreenBytes = 6144 + 768;
+constexpr uint32_t ScreenLineBytes = 32;
+// 192 pixel lines in display file order, then 24 attribute lines
+constexpr uint32_t ScreenLines = ScreenBytes / ScreenLineBytes;
+constexpr uint32_t ScreenDirtyWords = (ScreenLines + 31) / 32;
+
+// Written by core1 with a plain load and store, core0 takes it with an
+// exchange: a line core0 takes may come back dirty once more, one written
+// after it is never lost.
+extern std::atomic<uint32_t> ScreenDirty[ScreenDirtyWords];
+
+// core0: the file system screenshots go to, nullptr for none
+void screen_init(FileSystem *fs);
+// core0: true when the capture saw every byte of the screen, see
+// ramshadow_valid()
+bool screen_complete();
+
+// core0: copies the screen into out, ScreenBytes, and the lines written since
+// the last take into dirty, ScreenDirtyWords. Returns how many there are.
+uint32_t screen_take(uint8_t *out, uint32_t *dirty);
+
+// core0: saves the screen as the next SHOTnnnn.SCR, false without a file
+// system or when the write fails
+bool screen_save();
+
+// core0: serves ZPI command 0b0101xxxx
+void screen_request(uint8_t arg);
+
@@ -0,0 +1,261 @@
+#include "screencast.h"
+
+#include <hardware/timer.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "utils.h"
+
+namespace {
+
+constexpr uint32_t MaxLiteral = 128;
+constexpr uint32_t MinRun = 3;
+constexpr uint32_t MaxRun = 0x7f + MinRun;
+
+const TraceSink *Sink = nullptr;
+bool Running = false;
+bool Stopping = false;      // stops once the last frame is sent
+bool Last = false;          // the frame going out is the last one
+uint16_t Seq = 0;
+uint32_t TickUs = 0;        // start of the current tick
+uint32_t Ticks = 0;         // since the frame before
+uint32_t KeyTicks = 0;      // since the last key frame
+ScreencastStats Stats;
+
+// taken, then the XOR of the lines to send, packed to the front
+uint8_t Screen[ScreenBytes];
+// the screen the decoder has
+uint8_t Sent[ScreenBytes];
+
+// the frame on its way out
+uint8_t Frame[ScreencastMaxFrame];
+uint32_t FrameSize = 0;
+uint32_t FrameSent = 0;
+uint32_t FrameStamp = 0;
+
+uint8_t *put16(uint8_t *out, uint16_t value)
+{
+    out[0] = value;
+    out[1] = value >> 8;
+    return out + 2;
+}
+
+uint8_t *put32(uint8_t *out, uint32_t value)
+{
+    out = put16(out, value);
+    return put16(out, value >> 16);
+}
+
+uint8_t *put_literals(uint8_t *out, const uint8_t *src, uint32_t size)
+{
+    while (size) {
+        const uint32_t chunk = std::min(size, MaxLiteral);
+        *out++ = chunk - 1;
+        memcpy(out, src, chunk);
+        out += chunk;
+        src += chunk;
+        size -= chunk;
+    }
+    return out;
+}
+
+// encodes the lines changed since the last frame into Frame, 0 when there
+// are none
+uint32_t encode(uint32_t now)
+{
+    uint32_t dirty[ScreenDirtyWords];
+    screen_take(Screen, dirty);
+    const bool key = KeyTicks >= ScreencastKeyTicks || !Stats.frames;
+    if (key) {
+        // against a black screen, whatever the decoder has
+        for (uint32_t i = 0; i < ScreenDirtyWords; ++i)
+            dirty[i] = i + 1 < ScreenDirtyWords ? ~0u : (1u << (ScreenLines % 32)) - 1;
+        memset(Sent, 0, sizeof(Sent));
+        KeyTicks = 0;
+    }
+
+    uint32_t lines = 0;
+    for (uint32_t line = 0; line < ScreenLines; ++line) {
+        if (!(dirty[line / 32] & 1u << (line % 32)))
+            continue;
+        const uint32_t at = line * ScreenLineBytes;
+        uint8_t *delta = Screen + lines * ScreenLineBytes;
+        for (uint32_t i = 0; i < ScreenLineBytes; ++i) {
+            const uint8_t value = Screen[at + i];
+            delta[i] = value ^ Sent[at + i];
+            Sent[at + i] = value;
+        }
+        ++lines;
+    }
+    if (!lines)
+        return 0;
+
+    uint8_t *p = Frame + ScreencastHeaderSize;
+    for (uint32_t word : dirty)
+        p = put32(p, word);
+    p += screencast_pack(Screen, lines * ScreenLineBytes, p);
+    const uint32_t bytes = p - Frame - ScreencastHeaderSize;
+
+    uint8_t *h = put32(Frame, ScreencastMagic);
+    h = put16(h, Seq++);
+    *h++ = key ? ScreencastKey : 0;
+    *h++ = lines;
+    h = put32(h, now);
+    h = put16(h, Ticks);
+    h = put16(h, bytes);
+    put16(h, trace_check(Frame + ScreencastHeaderSize, bytes));
+
+    ++Stats.frames;
+    Stats.keyFrames += key;
+    Stats.bytes += ScreencastHeaderSize + bytes;
+    Stats.maxFrame = std::max(Stats.maxFrame, ScreencastHeaderSize + bytes);
+    Ticks = 0;
+    return ScreencastHeaderSize + bytes;
+}
+
+void report()
+{
+    char message[192];
+    snprintf(message, sizeof(message),
+             "Screen stream: %lu frames, %lu key, %lu bytes a frame, %lu at most, %lu of %lu ticks late, "
+             "%luus from the take to the link at worst",
+             (unsigned long)Stats.frames, (unsigned long)Stats.keyFrames,
+             (unsigned long)(Stats.frames ? Stats.bytes / Stats.frames : 0), (unsigned long)Stats.maxFrame,
+             (unsigned long)Stats.lateTicks, (unsigned long)Stats.ticks, (unsigned long)Stats.worstUs);
+    notice(message);
+}
+
+} // namespace {
+
+uint32_t screencast_pack(const uint8_t *src, uint32_t size, uint8_t *dst)
+{
+    uint8_t *out = dst;
+    uint32_t literal = 0;   // start of the literals not written yet
+    for (uint32_t pos = 0; pos < size;) {
+        uint32_t run = 1;
+        while (pos + run < size && run < MaxRun && src[pos + run] == src[pos])
+            ++run;
+        if (run < MinRun) {
+            pos += run;
+            continue;
+        }
+        out = put_literals(out, src + literal, pos - literal);
+        *out++ = 0x80 + run - MinRun;
+        *out++ = src[pos];
+        pos += run;
+        literal = pos;
+    }
+    out = put_literals(out, src + literal, size - literal);
+    return out - dst;
+}
+
+int32_t screencast_unpack(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize)
+{
+    uint32_t out = 0;
+    for (uint32_t pos = 0; pos < srcSize;) {
+        const uint8_t token = src[pos++];
+        if (token < 0x80) {
+            const uint32_t count = token + 1;
+            if (count > srcSize - pos || count > dstSize - out)
+                return -1;
+            memcpy(dst + out, src + pos, count);
+            pos += count;
+            out += count;
+        } else {
+            const uint32_t count = token - 0x80 + MinRun;
+            if (pos == srcSize || count > dstSize - out)
+                return -1;
+            memset(dst + out, src[pos++], count);
+            out += count;
+        }
+    }
+    return out;
+}
+
+void screencast_init(const TraceSink *sink)
+{
+    Sink = sink;
+}
+
+void screencast_request(bool on)
+{
+    if (!on) {
+        Stopping = Running;
+        return;
+    }
+    if (!Sink) {
+        error("Screen stream needs a USB link");
+        return;
+    }
+    // still stopping, it just goes on
+    Stopping = Last = false;
+    if (Running)
+        return;
+    Running = true;
+    Stats = ScreencastStats{};
+    Seq = 0;
+    Ticks = 0;
+    KeyTicks = 0;
+    FrameSize = FrameSent = 0;
+    // the first tick right away, with a key frame
+    TickUs = time_us_32() - ScreencastTickUs;
+    notice("Screen stream started");
+}
+
+bool screencast_running()
+{
+    return Running;
+}
+
+bool screencast_sending()
+{
+    return FrameSent != FrameSize;
+}
+
+const ScreencastStats &screencast_stats()
+{
+    return Stats;
+}
+
+void screencast_task()
+{
+    if (!Running)
+        return;
+    const uint32_t now = time_us_32();
+    const uint32_t ticks = (now - TickUs) / ScreencastTickUs;
+    TickUs += ticks * ScreencastTickUs;
+    Stats.ticks += ticks;
+    Ticks += ticks;
+    KeyTicks += ticks;
+    // a frame started goes out whole, a trace starts after it
+    if (FrameSent == FrameSize && trace_link_busy())
+        return;
+
+    uint32_t space = Sink->space();
+    while (space && FrameSent < FrameSize) {
+        const uint32_t size = std::min(space, FrameSize - FrameSent);
+        Sink->write(Frame + FrameSent, size);
+        FrameSent += size;
+        space -= size;
+        if (FrameSent == FrameSize)
+            Stats.worstUs = std::max(Stats.worstUs, time_us_32() - FrameStamp);
+    }
+    if (FrameSent < FrameSize) {
+        Stats.lateTicks += ticks;
+        return;
+    }
+    if (Last) {
+        Running = Stopping = Last = false;
+        report();
+        return;
+    }
+    // stopping, what changed since the last tick goes out right away
+    if (!ticks && !Stopping)
+        return;
+    FrameSize = encode(now);
+    FrameSent = 0;
+    FrameStamp = now;
+    Last = Stopping;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+
+#include "screen.h"
+#include "trace.h"
+
+// Live screen stream: the display file lines the Z80 changed, each 50 Hz
+// frame, out of screen_take().
+//
+// Every ScreencastTickUs core0 takes the dirty lines and sends them XORed
+// with what it sent of them before, so the bytes the Z80 did not change are
+// zero, packed with PackBits. A key frame every ScreencastKeyTicks sends all
+// lines against a black screen, a decoder that lost a frame starts again from
+// there. While a frame is still going out the lines pile up in ScreenDirty
+// and go with the next tick: a slow link gets fewer frames, never stale
+// lines. All little endian:
+//
+//   u32 ScreencastMagic
+//   u16 seq         frame number, from 0
+//   u8  flags       ScreencastKey
+//   u8  lines       lines in the frame
+//   u32 stamp       time_us_32() the lines were taken at
+//   u16 ticks       frame periods since the frame before, more than 1 when
+//                   the link fell behind
+//   u16 bytes       of the payload
+//   u16 check       trace_check() of the payload
+//   payload         ScreenDirtyWords * 4 bytes line bitmap, then the PackBits
+//                   of the XOR of those lines, 32 bytes each, in line order
+//
+// The frames go out on the link of the bus trace, never while a trace runs
+// or one of its frames is going out, see trace_link_busy(). The decoder finds
+// them by the magic.
+
+constexpr uint32_t ScreencastMagic = 0x63734649;  // "IFsc"
+constexpr uint32_t ScreencastHeaderSize = 18;
+constexpr uint32_t ScreencastTickUs = 19968;      // 69888 T states at 3.5 MHz
+constexpr uint32_t ScreencastKeyTicks = 50;
+constexpr uint8_t ScreencastKey = 0x01;
+constexpr uint32_t ScreencastBitmapSize = ScreenDirtyWords * 4;
+
+// worst case size of size bytes packed with screencast_pack()
+constexpr uint32_t screencast_bound(uint32_t size)
+{
+    return size + size / 128 + 2;
+}
+
+constexpr uint32_t ScreencastMaxFrame = ScreencastHeaderSize + ScreencastBitmapSize + screencast_bound(ScreenBytes);
+
+struct ScreencastStats
+{
+    uint32_t frames = 0;
+    uint32_t keyFrames = 0;
+    uint32_t ticks = 0;         // frame periods since the start
+    uint32_t lateTicks = 0;     // periods without a frame of their own, the link was busy
+    uint32_t bytes = 0;
+    uint32_t maxFrame = 0;
+    uint32_t worstUs = 0;       // from the take to the last byte handed to the link
+};
+
+// PackBits: a byte n below 0x80 is followed by n + 1 literal bytes, one from
+// 0x80 on by a byte repeated n - 0x80 + 3 times. Returns the size written to
+// dst, screencast_bound(size) at most.
+uint32_t screencast_pack(const uint8_t *src, uint32_t size, uint8_t *dst);
+// bytes unpacked into dst, -1 for a block that is corrupt or does not fit
+int32_t screencast_unpack(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize);
+
+// core0, without a sink every start is refused
+void screencast_init(const TraceSink *sink);
+// core0: starts or stops the stream, ZPI command 0b0101010x
+void screencast_request(bool on);
+bool screencast_running();
+// true while a frame is partly handed to the link
+bool screencast_sending();
+const ScreencastStats &screencast_stats();
+
+// core0: takes and sends a frame each tick, as much of it as the link takes
+void screencast_task();
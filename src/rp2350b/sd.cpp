@@ -0,0 +1,332 @@
+#include "sd.h"
+
+#include <hardware/dma.h>
+#include <hardware/gpio.h>
+#include <hardware/spi.h>
+#include <hardware/timer.h>
+
+namespace {
+spi_inst_t *const SdSpi = spi1;
+constexpr uint SdCs = 9;
+constexpr uint SdSck = 10;
+constexpr uint SdMosi = 11;
+constexpr uint SdMiso = 12;
+
+constexpr uint InitBaudrate = 400 * 1000;
+constexpr uint Baudrate = 25 * 1000 * 1000;
+
+constexpr uint32_t InitTimeoutUs = 1000 * 1000;
+constexpr uint32_t ReadTimeoutUs = 100 * 1000;
+constexpr uint32_t WriteTimeoutUs = 500 * 1000;
+
+enum Cmd : uint8_t {
+    GoIdleState = 0,
+    SendIfCond = 8,
+    SendCsd = 9,
+    StopTransmission = 12,
+    ReadSingleBlock = 17,
+    ReadMultipleBlock = 18,
+    WriteBlock = 24,
+    WriteMultipleBlock = 25,
+    AppSendOpCond = 41,
+    AppCmd = 55,
+    ReadOcr = 58,
+};
+
+constexpr uint8_t R1Idle = 0x01;
+constexpr uint8_t StartBlock = 0xfe;
+constexpr uint8_t StartMultiWrite = 0xfc;
+constexpr uint8_t StopMultiWrite = 0xfd;
+constexpr uint8_t DataAccepted = 0x05;
+
+// the TX channel sends this byte over and over while a sector is read, and
+// the RX channel dumps the received bytes here while a sector is written
+uint8_t FillByte = 0xff;
+uint8_t DrainByte;
+
+uint8_t xfer(uint8_t out = 0xff)
+{
+    uint8_t in;
+    spi_write_read_blocking(SdSpi, &out, &in, 1);
+    return in;
+}
+
+bool wait_ready(uint32_t timeoutUs)
+{
+    const uint32_t start = time_us_32();
+    while (xfer() != 0xff) {
+        if (time_us_32() - start > timeoutUs)
+            return false;
+    }
+    return true;
+}
+} // namespace {
+
+void SdCard::select()
+{
+    gpio_put(SdCs, false);
+    xfer();
+}
+
+void SdCard::deselect()
+{
+    gpio_put(SdCs, true);
+    // the card releases MISO on the next clock
+    xfer();
+}
+
+uint8_t SdCard::command(uint8_t cmd, uint32_t arg)
+{
+    // only CMD0 and CMD8 are checked in SPI mode, the other CRCs are dummies
+    const uint8_t crc = cmd == GoIdleState ? 0x95 : cmd == SendIfCond ? 0x87 : 0x01;
+    const uint8_t frame[6] = {uint8_t(0x40 | cmd), uint8_t(arg >> 24), uint8_t(arg >> 16),
+                              uint8_t(arg >> 8), uint8_t(arg), crc};
+    if (cmd != StopTransmission && !wait_ready(WriteTimeoutUs))
+        return 0xff;
+    spi_write_blocking(SdSpi, frame, sizeof(frame));
+    if (cmd == StopTransmission)
+        xfer(); // stuff byte
+
+    uint8_t r1;
+    for (int i = 0; i < 10; ++i) {
+        r1 = xfer();
+        if (!(r1 & 0x80))
+            break;
+    }
+    return r1;
+}
+
+uint8_t SdCard::appCommand(uint8_t cmd, uint32_t arg)
+{
+    command(AppCmd, 0);
+    return command(cmd, arg);
+}
+
+bool SdCard::init()
+{
+    spi_init(SdSpi, InitBaudrate);
+    spi_set_format(SdSpi, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    gpio_set_function(SdSck, GPIO_FUNC_SPI);
+    gpio_set_function(SdMosi, GPIO_FUNC_SPI);
+    gpio_set_function(SdMiso, GPIO_FUNC_SPI);
+    gpio_pull_up(SdMiso);
+    gpio_init(SdCs);
+    gpio_set_dir(SdCs, GPIO_OUT);
+    gpio_put(SdCs, true);
+
+    // at least 74 clocks with CS high to enter the native mode
+    for (int i = 0; i < 10; ++i)
+        xfer();
+
+    select();
+    bool ok = command(GoIdleState, 0) == R1Idle;
+
+    // v2 cards echo the check pattern, v1 cards answer illegal command
+    bool v2 = false;
+    if (ok && command(SendIfCond, 0x1aa) == R1Idle) {
+        uint8_t r7[4];
+        for (uint8_t &b : r7)
+            b = xfer();
+        v2 = true;
+        ok = (r7[2] & 0x0f) == 0x01 && r7[3] == 0xaa;
+    }
+
+    const uint32_t start = time_us_32();
+    while (ok && appCommand(AppSendOpCond, v2 ? 0x40000000 : 0)) {
+        if (time_us_32() - start > InitTimeoutUs)
+            ok = false;
+    }
+
+    if (ok && v2 && command(ReadOcr, 0) == 0) {
+        uint8_t ocr[4];
+        for (uint8_t &b : ocr)
+            b = xfer();
+        m_blockAddressing = ocr[0] & 0x40;
+    }
+
+    uint8_t csd[16];
+    if (ok && command(SendCsd, 0) == 0) {
+        const uint32_t tokenStart = time_us_32();
+        uint8_t token;
+        while ((token = xfer()) == 0xff && time_us_32() - tokenStart < ReadTimeoutUs)
+            ;
+        ok = token == StartBlock;
+        for (uint8_t &b : csd)
+            b = xfer();
+        xfer();
+        xfer();
+    } else {
+        ok = false;
+    }
+    deselect();
+    if (!ok)
+        return false;
+
+    if ((csd[0] >> 6) == 1) {
+        // CSD v2: (C_SIZE + 1) * 512K
+        const uint32_t cSize = (uint32_t(csd[7] & 0x3f) << 16) | (uint32_t(csd[8]) << 8) | csd[9];
+        m_sectors = (cSize + 1) * 1024;
+    } else {
+        // CSD v1: (C_SIZE + 1) * 2^(C_SIZE_MULT + 2) * 2^READ_BL_LEN
+        const uint32_t cSize = (uint32_t(csd[6] & 0x03) << 10) | (uint32_t(csd[7]) << 2) | (csd[8] >> 6);
+        const uint32_t mult = ((csd[9] & 0x03) << 1) | (csd[10] >> 7);
+        const uint32_t blockLen = csd[5] & 0x0f;
+        m_sectors = ((cSize + 1) << (mult + 2 + blockLen)) / SectorSize;
+    }
+
+    spi_set_baudrate(SdSpi, Baudrate);
+
+    if (m_txChan < 0) {
+        m_txChan = dma_claim_unused_channel(true);
+        m_rxChan = dma_claim_unused_channel(true);
+    }
+    return true;
+}
+
+void SdCard::startDma(uint8_t *rx, const uint8_t *tx)
+{
+    dma_channel_config cfg = dma_channel_get_default_config(m_rxChan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, rx != &DrainByte);
+    channel_config_set_dreq(&cfg, spi_get_dreq(SdSpi, false));
+    dma_channel_configure(m_rxChan, &cfg, rx, &spi_get_hw(SdSpi)->dr, SectorSize, false);
+
+    cfg = dma_channel_get_default_config(m_txChan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, tx != &FillByte);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, spi_get_dreq(SdSpi, true));
+    dma_channel_configure(m_txChan, &cfg, &spi_get_hw(SdSpi)->dr, tx, SectorSize, false);
+
+    // start both at once, so RX is armed before the first byte comes back
+    dma_start_channel_mask((1u << m_rxChan) | (1u << m_txChan));
+}
+
+bool SdCard::startRead(uint32_t lba, uint8_t *data, uint32_t count)
+{
+    if (m_state != State::Idle || !count || lba + count > m_sectors)
+        return false;
+    m_data = data;
+    m_left = count - 1;
+    m_multi = count > 1;
+    select();
+    if (command(m_multi ? ReadMultipleBlock : ReadSingleBlock, m_blockAddressing ? lba : lba * SectorSize)) {
+        deselect();
+        return false;
+    }
+    m_state = State::ReadToken;
+    m_startUs = time_us_32();
+    return true;
+}
+
+bool SdCard::startWrite(uint32_t lba, const uint8_t *data, uint32_t count)
+{
+    if (m_state != State::Idle || !count || lba + count > m_sectors)
+        return false;
+    m_data = const_cast<uint8_t *>(data);
+    m_left = count - 1;
+    m_multi = count > 1;
+    select();
+    if (command(m_multi ? WriteMultipleBlock : WriteBlock, m_blockAddressing ? lba : lba * SectorSize)) {
+        deselect();
+        return false;
+    }
+    xfer(m_multi ? StartMultiWrite : StartBlock);
+    startDma(&DrainByte, m_data);
+    m_state = State::WriteData;
+    return true;
+}
+
+BlockStatus SdCard::fail()
+{
+    if (m_state == State::ReadData || m_state == State::WriteData) {
+        dma_channel_abort(m_txChan);
+        dma_channel_abort(m_rxChan);
+    }
+    if (m_multi && m_state <= State::ReadData)
+        command(StopTransmission, 0);
+    deselect();
+    m_state = State::Idle;
+    return BlockStatus::Error;
+}
+
+BlockStatus SdCard::finish()
+{
+    deselect();
+    m_state = State::Idle;
+    return BlockStatus::Done;
+}
+
+BlockStatus SdCard::poll()
+{
+    switch (m_state) {
+    case State::Idle:
+        return BlockStatus::Idle;
+
+    case State::ReadToken: {
+        const uint8_t token = xfer();
+        if (token == StartBlock) {
+            startDma(m_data, &FillByte);
+            m_state = State::ReadData;
+        } else if (token != 0xff || time_us_32() - m_startUs > ReadTimeoutUs) {
+            return fail();
+        }
+        return BlockStatus::Busy;
+    }
+
+    case State::ReadData:
+        if (dma_channel_is_busy(m_rxChan))
+            return BlockStatus::Busy;
+        // CRC
+        xfer();
+        xfer();
+        if (m_left) {
+            --m_left;
+            m_data += SectorSize;
+            m_state = State::ReadToken;
+            m_startUs = time_us_32();
+            return BlockStatus::Busy;
+        }
+        if (m_multi && command(StopTransmission, 0))
+            return fail();
+        return finish();
+
+    case State::WriteData:
+        if (dma_channel_is_busy(m_rxChan))
+            return BlockStatus::Busy;
+        xfer();
+        xfer();
+        if ((xfer() & 0x1f) != DataAccepted)
+            return fail();
+        m_state = State::WriteBusy;
+        m_startUs = time_us_32();
+        return BlockStatus::Busy;
+
+    case State::WriteBusy:
+    case State::StopBusy:
+        if (xfer() != 0xff) {
+            if (time_us_32() - m_startUs > WriteTimeoutUs)
+                return fail();
+            return BlockStatus::Busy;
+        }
+        if (m_state == State::StopBusy)
+            return finish();
+        if (m_left) {
+            --m_left;
+            m_data += SectorSize;
+            xfer(StartMultiWrite);
+            startDma(&DrainByte, m_data);
+            m_state = State::WriteData;
+            return BlockStatus::Busy;
+        }
+        if (!m_multi)
+            return finish();
+        xfer(StopMultiWrite);
+        xfer();
+        m_state = State::StopBusy;
+        m_startUs = time_us_32();
+        return BlockStatus::Busy;
+    }
+    return BlockStatus::Error;
+}
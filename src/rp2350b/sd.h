@@ -0,0 +1,51 @@
+#pragma once
+
+#include "blockdev.h"
+
+// SD card in SPI mode on SPI1: GPIO9 CS, GPIO10 SCK, GPIO11 MOSI, GPIO12 MISO.
+// GPIO24 is wired to DAT0 as well (DONT_USE in zx.pio), it is left as an
+// input so it never fights the card.
+//
+// Commands and the short response polls are done with plain SPI transfers,
+// the 512 byte data phases are moved by two DMA channels. poll() never waits
+// for the card: each call looks at one byte or at the DMA channels and
+// returns, so core0 can keep servicing the ZPI buffers in between.
+class SdCard : public BlockDevice
+{
+public:
+    bool init() override;
+    uint32_t sectorCount() const override { return m_sectors; }
+
+    bool startRead(uint32_t lba, uint8_t *data, uint32_t count) override;
+    bool startWrite(uint32_t lba, const uint8_t *data, uint32_t count) override;
+    BlockStatus poll() override;
+
+private:
+    enum class State : uint8_t {
+        Idle,
+        ReadToken,   // waiting for the data start token
+        ReadData,    // DMA is filling a sector
+        WriteData,   // DMA is sending a sector
+        WriteBusy,   // the card is programming a sector
+        StopBusy,    // the card is finishing a multi-block write
+    };
+
+    uint8_t command(uint8_t cmd, uint32_t arg);
+    uint8_t appCommand(uint8_t cmd, uint32_t arg);
+    void select();
+    void deselect();
+    void startDma(uint8_t *rx, const uint8_t *tx);
+    BlockStatus fail();
+    BlockStatus finish();
+
+    uint32_t m_sectors = 0;
+    bool m_blockAddressing = false;
+    int m_txChan = -1;
+    int m_rxChan = -1;
+
+    State m_state = State::Idle;
+    uint8_t *m_data = nullptr;
+    uint32_t m_left = 0;       // sectors left after the current one
+    bool m_multi = false;
+    uint32_t m_startUs = 0;    // start of the current wait, for timeouts
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+// A byte stream to another chip. Every call returns at once: read() takes
+// what arrived so far, write() only ever gets the space() reported just
+// before, the way TraceSink works for the USB link.
+class SerialPort
+{
+public:
+    virtual ~SerialPort() = default;
+
+    // bytes copied into data, size at most
+    virtual uint32_t read(uint8_t *data, uint32_t size) = 0;
+    virtual uint32_t space() = 0;
+    virtual void write(const uint8_t *data, uint32_t size) = 0;
+};
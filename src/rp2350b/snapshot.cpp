@@ -0,0 +1,840 @@
+#include "snapshot.h"
+
+#include <hardware/timer.h>
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+#include "ramshadow.h"
+#include "rombank.h"
+#include "sram.h"
+#include "utils.h"
+#include "z80code.h"
+#include "zpi.h"
+#include "zx.h"
+
+namespace {
+
+constexpr uint32_t SnaHeaderSize = 27;
+constexpr uint32_t Sna48Size = SnaHeaderSize + 3 * SnapshotBankSize;
+constexpr uint32_t Sna128Size = Sna48Size + 4 + 5 * SnapshotBankSize;
+constexpr uint32_t Sna128FullSize = Sna128Size + SnapshotBankSize; // paged bank is 2 or 5
+constexpr uint32_t Z80HeaderSize = 30;
+
+constexpr uint16_t LoaderAddr = 0x0066;   // the NMI fetch enters the loader
+constexpr uint8_t LoaderPort = 0x03;      // ZPI, see zpi_stream()
+constexpr uint32_t NmiTimeoutUs = 1000000;
+
+// where the save stub leaves each register, from RamDumpBase, see
+// build_save_stub()
+constexpr uint16_t DumpSp = 0;
+constexpr uint16_t DumpR = 2;
+constexpr uint16_t DumpBc = 3;
+constexpr uint16_t DumpDe = 5;
+constexpr uint16_t DumpHl = 7;
+constexpr uint16_t DumpIx = 9;
+constexpr uint16_t DumpIy = 11;
+constexpr uint16_t DumpBc2 = 13;
+constexpr uint16_t DumpDe2 = 15;
+constexpr uint16_t DumpHl2 = 17;
+constexpr uint16_t DumpAf = 19;
+constexpr uint16_t DumpAf2 = 21;
+constexpr uint16_t DumpFlagsI = 23;   // F after ld a, i (P/V is IFF2), then I
+constexpr uint32_t DumpBytes = 25;
+static_assert(DumpBytes <= RamDumpSize);
+constexpr uint32_t DumpComplete = (1u << DumpBytes) - 1;
+// M1 cycles from the NMI to the ld a, r of the stub, itself included
+constexpr uint8_t DumpRFetches = 7;
+
+enum class SaveState : uint8_t {
+    Idle,
+    Dumping,    // the NMI is sent, the stub writes the registers
+    Released,   // the RAM is copied, the stub returns
+};
+
+// slot of each 128K bank in Ram, the banks mapped at 0x4000 and 0x8000 first
+constexpr uint8_t BankSlot[SnapshotMaxBanks] = {2, 3, 1, 4, 5, 0, 6, 7};
+constexpr uint8_t SlotBank[SnapshotMaxBanks] = {5, 2, 0, 1, 3, 4, 6, 7};
+
+Snapshot Last;
+uint8_t Ram[SnapshotMaxBanks * SnapshotBankSize];
+__zx_bank uint8_t Loader[RomBankSize];
+ZxShadowSession Session{Loader, LoaderAddr, 0};
+SnapshotStats Stats;
+
+bool Loading = false;
+SaveState Save = SaveState::Idle;
+FileSystem *SaveFs = nullptr;
+uint16_t SpinOffset = 0;    // the offset of the jr $ the save stub waits on
+uint32_t StartUs = 0;
+uint32_t StreamBytes = 0;
+char Name[16];
+
+// Sequential reader over a file of the FileSystem or a memory buffer
+class Input
+{
+public:
+    Input(const uint8_t *data, uint32_t size)
+        : m_data(data)
+        , m_size(size)
+    {}
+    Input(FileSystem &fs, int file)
+        : m_fs(&fs)
+        , m_file(file)
+        , m_size(fs.size(file))
+    {}
+
+    uint32_t size() const { return m_size; }
+    uint32_t pos() const { return m_pos; }
+    void seek(uint32_t pos) { m_pos = pos; }
+
+    // next byte or -1 at the end of the file
+    int get()
+    {
+        if (m_pos >= m_size)
+            return -1;
+        if (m_data)
+            return m_data[m_pos++];
+        if (m_pos - m_bufferPos >= m_bufferSize) {
+            const int32_t size = m_fs->read(m_file, m_pos, m_buffer, sizeof(m_buffer));
+            if (size <= 0)
+                return -1;
+            m_bufferPos = m_pos;
+            m_bufferSize = size;
+        }
+        return m_buffer[m_pos++ - m_bufferPos];
+    }
+
+    bool read(uint8_t *data, uint32_t size)
+    {
+        while (size--) {
+            const int c = get();
+            if (c < 0)
+                return false;
+            *data++ = c;
+        }
+        return true;
+    }
+
+private:
+    FileSystem *m_fs = nullptr;
+    int m_file = -1;
+    const uint8_t *m_data = nullptr;
+    uint32_t m_size = 0;
+    uint32_t m_pos = 0;
+    uint8_t m_buffer[512];
+    uint32_t m_bufferPos = 0;
+    uint32_t m_bufferSize = 0;
+};
+
+uint16_t word(const uint8_t *data)
+{
+    return data[0] | data[1] << 8;
+}
+
+uint8_t *bank(int n)
+{
+    return Ram + BankSlot[n] * SnapshotBankSize;
+}
+
+bool parse_sna(Input &in, Snapshot &s)
+{
+    const uint32_t size = in.size();
+    if (size != Sna48Size && size != Sna128Size && size != Sna128FullSize) {
+        error("Not a .SNA snapshot");
+        return false;
+    }
+
+    uint8_t h[SnaHeaderSize];
+    if (!in.read(h, sizeof(h)))
+        return false;
+    s = {};
+    s.i = h[0];
+    s.hl2 = word(h + 1);
+    s.de2 = word(h + 3);
+    s.bc2 = word(h + 5);
+    s.af2 = word(h + 7);
+    s.hl = word(h + 9);
+    s.de = word(h + 11);
+    s.bc = word(h + 13);
+    s.iy = word(h + 15);
+    s.ix = word(h + 17);
+    s.iff2 = h[19] & 0x04;
+    s.iff1 = s.iff2; // saved from an NMI handler, RETN copies IFF2 back
+    s.r = h[20];
+    s.af = word(h + 21);
+    s.sp = word(h + 23);
+    s.im = h[25] & 3;
+    s.border = h[26] & 7;
+
+    if (size == Sna48Size) {
+        if (!in.read(Ram, 3 * SnapshotBankSize))
+            return false;
+        // the PC is on the stack, like after the NMI that took the snapshot
+        if (s.sp >= 0x4000 && s.sp < 0xffff) {
+            s.pc = word(Ram + s.sp - 0x4000);
+            s.sp += 2;
+        }
+        return true;
+    }
+
+    // 128K: banks 5, 2 and the paged one, PC, 0x7ffd, TR-DOS, then the other
+    // banks in ascending order
+    uint8_t ext[4];
+    in.seek(Sna48Size);
+    if (!in.read(ext, sizeof(ext)))
+        return false;
+    s.zx128 = true;
+    s.pc = word(ext);
+    s.port7ffd = ext[2];
+    const int paged = s.port7ffd & 7;
+
+    in.seek(SnaHeaderSize);
+    if (!in.read(bank(5), SnapshotBankSize) || !in.read(bank(2), SnapshotBankSize)
+        || !in.read(bank(paged), SnapshotBankSize)) {
+        return false;
+    }
+    in.seek(Sna48Size + sizeof(ext));
+    for (int n = 0; n < int(SnapshotMaxBanks); ++n) {
+        if (n == 2 || n == 5 || n == paged)
+            continue;
+        if (!in.read(bank(n), SnapshotBankSize))
+            return false;
+    }
+    return true;
+}
+
+// .Z80 compression: ED ED count value, the byte after a single ED is literal
+bool unpack(Input &in, uint8_t *out, uint32_t size)
+{
+    uint32_t pos = 0;
+    while (pos < size) {
+        int c = in.get();
+        if (c < 0)
+            return false;
+        if (c != 0xed) {
+            out[pos++] = c;
+            continue;
+        }
+        const int next = in.get();
+        if (next < 0)
+            return false;
+        if (next != 0xed) {
+            out[pos++] = 0xed;
+            if (pos < size)
+                out[pos++] = next;
+            continue;
+        }
+        const int count = in.get();
+        const int value = in.get();
+        if (value < 0)
+            return false;
+        for (int i = 0; i < count && pos < size; ++i)
+            out[pos++] = value;
+    }
+    return true;
+}
+
+uint8_t *z80_page(const Snapshot &s, int page)
+{
+    if (s.zx128)
+        return page >= 3 && page < 3 + int(SnapshotMaxBanks) ? bank(page - 3) : nullptr;
+    switch (page) {
+    case 8:
+        return Ram;
+    case 4:
+        return Ram + SnapshotBankSize;
+    case 5:
+        return Ram + 2 * SnapshotBankSize;
+    default:
+        return nullptr; // ROM pages
+    }
+}
+
+bool parse_z80(Input &in, Snapshot &s)
+{
+    uint8_t h[Z80HeaderSize];
+    if (!in.read(h, sizeof(h))) {
+        error("Not a .Z80 snapshot");
+        return false;
+    }
+    s = {};
+    const uint8_t flags = h[12] == 0xff ? 1 : h[12];
+    s.af = h[0] << 8 | h[1];
+    s.bc = word(h + 2);
+    s.hl = word(h + 4);
+    s.pc = word(h + 6);
+    s.sp = word(h + 8);
+    s.i = h[10];
+    s.r = (h[11] & 0x7f) | (flags & 1) << 7;
+    s.border = (flags >> 1) & 7;
+    s.de = word(h + 13);
+    s.bc2 = word(h + 15);
+    s.de2 = word(h + 17);
+    s.hl2 = word(h + 19);
+    s.af2 = h[21] << 8 | h[22];
+    s.iy = word(h + 23);
+    s.ix = word(h + 25);
+    s.iff1 = h[27];
+    s.iff2 = h[28];
+    s.im = h[29] & 3;
+
+    if (s.pc) {
+        // version 1, 48K only
+        if (flags & 0x20)
+            return unpack(in, Ram, 3 * SnapshotBankSize);
+        return in.read(Ram, 3 * SnapshotBankSize);
+    }
+
+    uint8_t ext[2 + 55];
+    if (!in.read(ext, 2))
+        return false;
+    const uint16_t extSize = word(ext);
+    if ((extSize != 23 && extSize != 54 && extSize != 55) || !in.read(ext + 2, extSize)) {
+        error("Unknown .Z80 version");
+        return false;
+    }
+    s.pc = word(ext + 2);
+    const uint8_t mode = ext[4];
+    s.port7ffd = ext[5];
+    const bool v2 = extSize == 23;
+    const bool zx48 = mode <= 1 || (!v2 && mode == 3);
+    s.zx128 = v2 ? mode == 3 || mode == 4 : (mode >= 4 && mode <= 7) || mode == 12 || mode == 13;
+    if (!zx48 && !s.zx128) {
+        error("Unsupported .Z80 hardware");
+        return false;
+    }
+
+    while (in.pos() < in.size()) {
+        uint8_t block[3];
+        if (!in.read(block, sizeof(block)))
+            return false;
+        const uint16_t size = word(block);
+        const uint32_t start = in.pos();
+        uint8_t *dest = z80_page(s, block[2]);
+        if (dest) {
+            const bool ok = size == 0xffff ? in.read(dest, SnapshotBankSize) : unpack(in, dest, SnapshotBankSize);
+            if (!ok)
+                return false;
+        }
+        in.seek(start + (size == 0xffff ? SnapshotBankSize : size));
+    }
+    return true;
+}
+
+bool has_extension(const char *name, const char *ext)
+{
+    const char *dot = strrchr(name, '.');
+    if (!dot)
+        return false;
+    while (*++dot && *ext) {
+        if (toupper(*dot) != *ext++)
+            return false;
+    }
+    return !*dot && !*ext;
+}
+
+bool decode(const char *name, Input &in)
+{
+    // an armed tape trap steps aside, it is armed again once the snapshot runs
+    if (zx_shadow_state() == ZxShadow::Armed && !Loading)
+        zx_shadow_cancel();
+    if (Loading || Save != SaveState::Idle || zx_shadow_state() != ZxShadow::Idle) {
+        error("A snapshot is already loading");
+        return false;
+    }
+    bool ok = false;
+    if (has_extension(name, "SNA")) {
+        ok = parse_sna(in, Last);
+    } else if (has_extension(name, "Z80")) {
+        ok = parse_z80(in, Last);
+    } else {
+        error("Not a .SNA or .Z80 file");
+        return false;
+    }
+    if (!ok)
+        error("Truncated snapshot");
+    return ok;
+}
+
+// The loader, entered on the NMI fetch of 0x0066:
+//
+//          di
+//          ld sp, table        ; (destination, 0x7ffd, blocks of 256 bytes)
+//   next:  pop hl
+//          pop de
+//          ld a, d
+//          or a
+//          jp z, done
+//          ld a, e             ; 128K only
+//          ld bc, 0x7ffd
+//          out (c), a
+//          ld c, 3
+//   block: ini                 ; x256
+//          dec d
+//          jp nz, block
+//          jp next
+//   done:  registers, then jp pc
+uint16_t build_loader(const Snapshot &s, bool paging)
+{
+    Z80Code c(Loader, LoaderAddr);
+    c.b(0xf3);                    // di
+    c.b(0x31);                    // ld sp, table
+    const uint16_t table = c.later();
+    const uint16_t next = c.pc();
+    c.b(0xe1);                    // pop hl
+    c.b(0xd1);                    // pop de
+    c.b(0x7a);                    // ld a, d
+    c.b(0xb7);                    // or a
+    c.b(0xca);                    // jp z, done
+    const uint16_t done = c.later();
+    if (paging) {
+        c.b(0x7b);                // ld a, e
+        c.b(0x01);                // ld bc, 0x7ffd
+        c.w(0x7ffd);
+        c.b(0xed);                // out (c), a
+        c.b(0x79);
+    }
+    c.b(0x0e);                    // ld c, 3
+    c.b(LoaderPort);
+    const uint16_t block = c.pc();
+    for (int i = 0; i < 256; ++i) {
+        c.b(0xed);                // ini
+        c.b(0xa2);
+    }
+    c.b(0x15);                    // dec d
+    c.b(0xc2);                    // jp nz, block
+    c.w(block);
+    c.b(0xc3);                    // jp next
+    c.w(next);
+
+    c.patch(done, c.pc());
+    if (paging) {
+        c.b(0x01);                // ld bc, 0x7ffd
+        c.w(0x7ffd);
+        c.b(0x3e);                // ld a, n: a 48K snapshot gets ROM1, locked
+        c.b(s.zx128 ? s.port7ffd : 0x30);
+        c.b(0xed);                // out (c), a
+        c.b(0x79);
+    }
+    c.b(0x3e);                    // ld a, border
+    c.b(s.border);
+    c.b(0xd3);                    // out (0xfe), a
+    c.b(0xfe);
+    c.b(0x3e);                    // ld a, i
+    c.b(s.i);
+    c.b(0xed);                    // ld i, a
+    c.b(0x47);
+    c.b(0x31);                    // ld sp, af2; pop af; ex af, af'
+    const uint16_t af2 = c.later();
+    c.b(0xf1);
+    c.b(0x08);
+    c.b(0x01);                    // ld bc', de', hl'; exx
+    c.w(s.bc2);
+    c.b(0x11);
+    c.w(s.de2);
+    c.b(0x21);
+    c.w(s.hl2);
+    c.b(0xd9);
+    c.b(0xdd);                    // ld ix, iy
+    c.b(0x21);
+    c.w(s.ix);
+    c.b(0xfd);
+    c.b(0x21);
+    c.w(s.iy);
+    c.b(0x01);                    // ld bc, de, hl
+    c.w(s.bc);
+    c.b(0x11);
+    c.w(s.de);
+    c.b(0x21);
+    c.w(s.hl);
+    c.b(0xed);                    // im n
+    c.b(s.im == 0 ? 0x46 : s.im == 1 ? 0x56 : 0x5e);
+    // R counts the fetches left until the snapshot PC, bit 7 is never touched
+    const uint8_t fetches = 4 + s.iff1;
+    c.b(0x3e);                    // ld a, r
+    c.b((s.r & 0x80) | ((s.r - fetches) & 0x7f));
+    c.b(0xed);                    // ld r, a
+    c.b(0x4f);
+    c.b(0x31);                    // ld sp, af; pop af
+    const uint16_t af = c.later();
+    c.b(0xf1);
+    c.b(0x31);                    // ld sp, sp
+    c.w(s.sp);
+    if (s.iff1)
+        c.b(0xfb);                // ei
+    c.b(0xc3);                    // jp pc
+    c.w(s.pc);
+    const uint16_t exitAddr = c.pc() - 1;
+
+    c.patch(af2, c.pc());
+    c.w(s.af2);
+    c.patch(af, c.pc());
+    c.w(s.af);
+
+    c.patch(table, c.pc());
+    if (s.zx128) {
+        for (uint32_t slot = 0; slot < SnapshotMaxBanks; ++slot) {
+            const uint8_t n = SlotBank[slot];
+            c.w(n == 5 ? 0x4000 : n == 2 ? 0x8000 : 0xc000);
+            c.b(0x10 | n);
+            c.b(SnapshotBankSize / 256);
+        }
+    } else {
+        c.w(0x4000);
+        c.b(0x10);
+        c.b(3 * SnapshotBankSize / 256);
+    }
+    c.w(0);
+    c.w(0);
+    return exitAddr;
+}
+
+bool start(const char *name)
+{
+    const RomImage *rom = rombank_active();
+    const bool paging = rom && (rom->model == RomModel::Zx128 || rom->model == RomModel::Plus3);
+    if (Last.zx128 && !paging) {
+        error("A 128K snapshot needs a 128K ROM image");
+        return false;
+    }
+
+    Session.exit = build_loader(Last, paging);
+    StreamBytes = (Last.zx128 ? SnapshotMaxBanks : 3) * SnapshotBankSize;
+    if (!zpi_stream(Ram, StreamBytes)) {
+        error("Port 3 is busy");
+        return false;
+    }
+    if (!zx_shadow_arm(&Session)) {
+        zpi_stream_cancel();
+        error("The shadow ROM is not available");
+        return false;
+    }
+    snprintf(Name, sizeof(Name), "%s", name);
+    Loading = true;
+    StartUs = time_us_32();
+    zx_nmi();
+    return true;
+}
+
+// The save stub, entered on the NMI fetch of 0x0066. The registers are
+// written to the ROM range, where the RAM shadow picks them up from the bus
+// without a byte of the program's RAM changing, only the stack below SP:
+//
+//          ld (dump), sp       ; SP with the PC the NMI pushed on top
+//          push af
+//          push af
+//          ld a, r
+//          ld (dump), a
+//          ld (dump), bc       ; and DE, HL, IX, IY, BC', DE', HL'
+//          ex (sp), hl         ; AF
+//          ld (dump), hl
+//          ex af, af'          ; AF'
+//          push af
+//          pop hl
+//          ld (dump), hl
+//          ex af, af'
+//          ld a, i             ; P/V = IFF2
+//          push af
+//          pop hl
+//          ld (dump), hl
+//          pop hl
+//          pop af
+//   spin:  jr spin             ; until core0 copied the RAM, see save_task()
+//          retn
+//
+// Returns the address of the last byte of the retn, the exit of the session.
+uint16_t build_save_stub()
+{
+    Z80Code c(Loader, LoaderAddr);
+    auto dump = [&](uint8_t prefix, uint8_t op, uint16_t offset) {
+        if (prefix)
+            c.b(prefix);
+        c.b(op);
+        c.w(RamDumpBase + offset);
+    };
+    dump(0xed, 0x73, DumpSp);     // ld (dump), sp
+    c.b(0xf5);                    // push af
+    c.b(0xf5);                    // push af
+    c.b(0xed);                    // ld a, r
+    c.b(0x5f);
+    dump(0, 0x32, DumpR);         // ld (dump), a
+    dump(0xed, 0x43, DumpBc);     // ld (dump), bc
+    dump(0xed, 0x53, DumpDe);     // ld (dump), de
+    dump(0, 0x22, DumpHl);        // ld (dump), hl
+    dump(0xdd, 0x22, DumpIx);     // ld (dump), ix
+    dump(0xfd, 0x22, DumpIy);     // ld (dump), iy
+    c.b(0xd9);                    // exx
+    dump(0xed, 0x43, DumpBc2);
+    dump(0xed, 0x53, DumpDe2);
+    dump(0, 0x22, DumpHl2);
+    c.b(0xd9);                    // exx
+    c.b(0xe3);                    // ex (sp), hl
+    dump(0, 0x22, DumpAf);
+    c.b(0x08);                    // ex af, af'
+    c.b(0xf5);                    // push af
+    c.b(0xe1);                    // pop hl
+    dump(0, 0x22, DumpAf2);
+    c.b(0x08);                    // ex af, af'
+    c.b(0xed);                    // ld a, i
+    c.b(0x57);
+    c.b(0xf5);                    // push af
+    c.b(0xe1);                    // pop hl
+    dump(0, 0x22, DumpFlagsI);
+    c.b(0xe1);                    // pop hl
+    c.b(0xf1);                    // pop af
+    const uint16_t spin = c.pc();
+    c.jr(0x18, spin);             // jr spin
+    SpinOffset = spin + 1;
+    c.b(0xed);                    // retn
+    c.b(0x45);
+    return c.pc() - 1;
+}
+
+// the registers the stub left in RamDump, the PC from the stack in the RAM copy
+Snapshot dumped_state()
+{
+    Snapshot s;
+    s.sp = word(RamDump + DumpSp);
+    const uint8_t r = RamDump[DumpR];
+    s.r = (r & 0x80) | ((r - DumpRFetches) & 0x7f);
+    s.bc = word(RamDump + DumpBc);
+    s.de = word(RamDump + DumpDe);
+    s.hl = word(RamDump + DumpHl);
+    s.ix = word(RamDump + DumpIx);
+    s.iy = word(RamDump + DumpIy);
+    s.bc2 = word(RamDump + DumpBc2);
+    s.de2 = word(RamDump + DumpDe2);
+    s.hl2 = word(RamDump + DumpHl2);
+    s.af = word(RamDump + DumpAf);
+    s.af2 = word(RamDump + DumpAf2);
+    s.i = RamDump[DumpFlagsI + 1];
+    s.iff2 = RamDump[DumpFlagsI] & 0x04;
+    s.iff1 = s.iff2;
+    // the IM can not be read back: IM 2 programs point I at their vector
+    // table in RAM, the ROM leaves 0x3f
+    s.im = s.i >= 0x40 ? 2 : 1;
+    s.border = zx_border();
+    if (s.sp >= 0x4000 && s.sp < 0xffff) {
+        s.pc = word(Ram + s.sp - 0x4000);
+        s.sp += 2;
+    }
+    return s;
+}
+
+bool write_sna(FileSystem &fs, const char *name, const Snapshot &s)
+{
+    uint8_t h[SnaHeaderSize];
+    auto put = [&](int at, uint16_t value) {
+        h[at] = value;
+        h[at + 1] = value >> 8;
+    };
+    h[0] = s.i;
+    put(1, s.hl2);
+    put(3, s.de2);
+    put(5, s.bc2);
+    put(7, s.af2);
+    put(9, s.hl);
+    put(11, s.de);
+    put(13, s.bc);
+    put(15, s.iy);
+    put(17, s.ix);
+    h[19] = s.iff2 ? 0x04 : 0;
+    h[20] = s.r;
+    put(21, s.af);
+    // the PC back on the stack, where it is in the RAM copy already
+    put(23, s.sp - 2);
+    h[25] = s.im;
+    h[26] = s.border;
+
+    const int file = fs.open(name, true);
+    if (file < 0)
+        return false;
+    const uint32_t ramSize = 3 * SnapshotBankSize;
+    const bool ok = fs.write(file, 0, h, sizeof(h)) == int32_t(sizeof(h))
+                    && fs.write(file, sizeof(h), Ram, ramSize) == int32_t(ramSize);
+    fs.close(file);
+    return ok;
+}
+
+void save_failed(const char *message)
+{
+    Save = SaveState::Idle;
+    ++Stats.failures;
+    error(message);
+}
+
+void save_task()
+{
+    const ZxShadow state = zx_shadow_state();
+    if (Save == SaveState::Dumping) {
+        if (RamDumpWritten.load(std::memory_order_acquire) == DumpComplete) {
+            // the Z80 spins in the stub, the RAM stays as it was at the NMI
+            memcpy(Ram, RamShadow, RamShadowSize);
+            reinterpret_cast<volatile uint8_t *>(Loader)[SpinOffset] = 0;
+            Save = SaveState::Released;
+        } else if (time_us_32() - StartUs > NmiTimeoutUs) {
+            if (state == ZxShadow::Armed && zx_shadow_cancel()) {
+                save_failed("The Z80 did not take the NMI");
+            } else if (state == ZxShadow::Active) {
+                // registers missed, let the program go on anyway
+                reinterpret_cast<volatile uint8_t *>(Loader)[SpinOffset] = 0;
+                Save = SaveState::Released;
+                ramshadow_dump_clear();
+            }
+        }
+        return;
+    }
+
+    if (state != ZxShadow::Done)
+        return;
+    Stats.lastUs = zx_shadow_us();
+    zx_shadow_release();
+    if (RamDumpWritten.load(std::memory_order_relaxed) != DumpComplete) {
+        save_failed("The registers of the snapshot were not seen on the bus");
+        return;
+    }
+    Last = dumped_state();
+
+    char name[13];
+    snprintf(name, sizeof(name), "SNAP%04d.SNA", next_file_number(*SaveFs, "SNAP", "SNA"));
+    const uint32_t writeStart = time_us_32();
+    if (!write_sna(*SaveFs, name, Last)) {
+        save_failed("Snapshot not saved");
+        return;
+    }
+    Save = SaveState::Idle;
+    ++Stats.saves;
+    Stats.lastBytes = Sna48Size;
+    char message[80];
+    snprintf(message, sizeof(message), "%s: 48K saved, the Z80 stopped for %.1f ms, written in %.1f ms", name,
+             Stats.lastUs / 1000.0, (time_us_32() - writeStart) / 1000.0);
+    notice(message);
+}
+
+} // namespace {
+
+bool snapshot_load(const char *name, const uint8_t *file, uint32_t size)
+{
+    Input in(file, size);
+    return decode(name, in) && start(name);
+}
+
+bool snapshot_load(FileSystem &fs, const char *name)
+{
+    const int file = fs.open(name, false);
+    if (file < 0) {
+        error("No such snapshot");
+        return false;
+    }
+    Input in(fs, file);
+    const bool ok = decode(name, in);
+    fs.close(file);
+    return ok && start(name);
+}
+
+bool snapshot_autoload(FileSystem &fs)
+{
+    for (const char *name : {"AUTOLOAD.Z80", "AUTOLOAD.SNA"}) {
+        const int file = fs.open(name, false);
+        if (file < 0)
+            continue;
+        fs.close(file);
+        return snapshot_load(fs, name);
+    }
+    return false;
+}
+
+bool snapshot_save(FileSystem &fs)
+{
+    if (Loading || Save != SaveState::Idle) {
+        error("A snapshot is already loading or saving");
+        return false;
+    }
+    const RomImage *rom = rombank_active();
+    if (rom && (rom->model == RomModel::Zx128 || rom->model == RomModel::Plus3)) {
+        error("Snapshots are saved on 48K ROM images only");
+        return false;
+    }
+    if (!ramshadow_capturing() || !ramshadow_valid(RamShadowBase, RamShadowSize)) {
+        error("The capture did not see all of the RAM yet");
+        return false;
+    }
+    // an armed tape trap steps aside, like for a load
+    if (zx_shadow_state() == ZxShadow::Armed)
+        zx_shadow_cancel();
+    Session.exit = build_save_stub();
+    ramshadow_dump_clear();
+    if (!zx_shadow_arm(&Session)) {
+        error("The shadow ROM is not available");
+        return false;
+    }
+    SaveFs = &fs;
+    Save = SaveState::Dumping;
+    StartUs = time_us_32();
+    zx_nmi();
+    return true;
+}
+
+void snapshot_task()
+{
+    if (Save != SaveState::Idle) {
+        save_task();
+        return;
+    }
+    if (!Loading)
+        return;
+
+    switch (zx_shadow_state()) {
+    case ZxShadow::Done: {
+        Loading = false;
+        Stats.lastUs = zx_shadow_us();
+        Stats.lastBytes = StreamBytes - zpi_stream_left();
+        zx_shadow_release();
+        if (zpi_stream_left()) {
+            zpi_stream_cancel();
+            ++Stats.failures;
+            error("The snapshot loader stopped early");
+            return;
+        }
+        ++Stats.loads;
+        char message[80];
+        snprintf(message, sizeof(message), "%s: %luK loaded in %.1f ms, %.0f KB/s", Name,
+                 (unsigned long)(Stats.lastBytes / 1024), Stats.lastUs / 1000.0,
+                 Stats.lastUs ? Stats.lastBytes * 1000.0 / Stats.lastUs : 0.0);
+        notice(message);
+        break;
+    }
+    case ZxShadow::Armed:
+        if (time_us_32() - StartUs > NmiTimeoutUs && zx_shadow_cancel()) {
+            Loading = false;
+            zpi_stream_cancel();
+            ++Stats.failures;
+            error("The Z80 did not take the NMI");
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+bool snapshot_busy()
+{
+    return Loading || Save != SaveState::Idle;
+}
+
+const Snapshot &snapshot_last()
+{
+    return Last;
+}
+
+const uint8_t *snapshot_ram()
+{
+    return Ram;
+}
+
+const SnapshotStats &snapshot_stats()
+{
+    return Stats;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+#include "fs.h"
+
+// .SNA and .Z80 snapshots loaded through the shadow ROM.
+//
+// The snapshot is decoded into SRAM, then IFp pulls /NMI: the NMI fetch of
+// 0x0066 pages in a generated loader which streams the RAM over port 3 with
+// unrolled INI (16 T states a byte), restores the registers and jumps to the
+// snapshot PC. The fetch of the last byte of that jump pages the shadow ROM
+// out again, so the program resumes on the machine ROM. A 48K snapshot takes
+// about 0.23s, a 128K one 0.6s.
+//
+// A 48K snapshot is saved from the RAM shadow of ramshadow.h: IFp pulls /NMI
+// and a stub in the shadow ROM writes the registers to the ROM range, where
+// the shadow picks them up, then spins until core0 copied the RAM and returns
+// with RETN. The Z80 stops for well under a millisecond, the .SNA is written
+// to the SD card after it runs again.
+
+constexpr uint32_t SnapshotBankSize = 0x4000;
+constexpr uint32_t SnapshotMaxBanks = 8;
+
+struct Snapshot
+{
+    uint16_t af = 0, bc = 0, de = 0, hl = 0;
+    uint16_t af2 = 0, bc2 = 0, de2 = 0, hl2 = 0;
+    uint16_t ix = 0, iy = 0, sp = 0, pc = 0;
+    uint8_t i = 0, r = 0, im = 1, border = 7;
+    bool iff1 = false, iff2 = false;
+    bool zx128 = false;
+    uint8_t port7ffd = 0;
+};
+
+struct SnapshotStats
+{
+    uint32_t loads = 0;
+    uint32_t saves = 0;
+    uint32_t failures = 0;
+    uint32_t lastBytes = 0;
+    uint32_t lastUs = 0;    // NMI fetch to the jump into the snapshot, or to the RETN of a save
+};
+
+// core0: decodes a .SNA or a .Z80 (by the name extension) and starts loading
+// it, snapshot_task() reports when it is done
+bool snapshot_load(const char *name, const uint8_t *file, uint32_t size);
+bool snapshot_load(FileSystem &fs, const char *name);
+
+// core0: loads AUTOLOAD.Z80 or AUTOLOAD.SNA when there is one
+bool snapshot_autoload(FileSystem &fs);
+
+// core0: saves the 48K RAM and the registers as the next SNAPnnnn.SNA of fs,
+// once the RAM shadow saw all of the RAM. snapshot_task() writes the file.
+bool snapshot_save(FileSystem &fs);
+
+// core0: waits for the loader or the save stub to finish, gives up when the
+// NMI is not taken
+void snapshot_task();
+bool snapshot_busy();
+
+// the registers and the RAM of the last decoded or saved snapshot, the RAM is
+// in stream order: 0x4000..0xffff for 48K, banks 5, 2, 0, 1, 3, 4, 6, 7 for
+// 128K
+const Snapshot &snapshot_last();
+const uint8_t *snapshot_ram();
+
+const SnapshotStats &snapshot_stats();
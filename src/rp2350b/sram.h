@@ -0,0 +1,40 @@
+#pragma once
+
+#include <pico.h>
+
+// Where the bus engine lives.
+//
+// core1 serves the Z80 out of memories nothing else uses, so its fetches and
+// loads never wait behind core0 or the DMA channels feeding the SD card, USB
+// and the PIO FIFOs:
+//
+//   SCRATCH_X   __zx_code   the bus loop and the IO handlers it calls, next
+//                           to core1's own stack
+//   SCRATCH_Y   __zx_data   the scalars it reads on every cycle, next to
+//                           core0's stack
+//   SRAM4-7     __zx_bank   ROM images, the IO decode tables and the trace
+//                           ring, the upper striped half of the main SRAM
+//   SRAM0-3                 everything else, DMA buffers included
+//
+// A few buffers core1 writes are too big for SRAM4-7 and stay in SRAM0-3,
+// shared with core0: the RAM shadow, the ZPI pages and the mailbox to core0.
+// core1 only touches them off the MREQ read path, on snooped writes, on IORQ
+// cycles the Z80 is held on /WAIT for, or after the answer.
+//
+// The firmware links with a copy of the SDK linker script that gives SRAM4-7
+// a region of its own, see ifp_sram_linker_script() in CMakeLists.txt. The
+// build then fails when anything the bus loop reaches resolves to flash/XIP,
+// or any of its state to SRAM0-3 but for the buffers above, and writes the
+// placement of every hot symbol to IFp.hotmap.txt.
+//
+// __zx_bank is NOLOAD: it is neither zeroed nor initialised at boot, whatever
+// goes there is written before core1 reads it.
+
+#define __zx_code(func_name) __scratch_x(__STRING(func_name)) func_name
+#define __zx_data __scratch_y("zx_data")
+
+#if PICO_ON_DEVICE
+#define __zx_bank __attribute__((section(".zx_bank")))
+#else
+#define __zx_bank
+#endif
@@ -0,0 +1,424 @@
+#include "tape.h"
+
+#include <hardware/timer.h>
+
+#include <algorithm>
+#include <cstdio>
+
+#include "rombank.h"
+#include "snapshot.h"
+#include "sram.h"
+#include "utils.h"
+#include "z80code.h"
+#include "zpi.h"
+#include "zx.h"
+
+namespace {
+
+constexpr uint16_t LdBytes = 0x0556;
+constexpr uint16_t SaLdRet = 0x053f;
+constexpr uint8_t LoaderPort = 0x03;    // ZPI
+
+// inc d; ex af, af'; dec d; di; ld a, 0x0f; out (0xfe), a
+constexpr uint8_t LdBytesSignature[] = {0x14, 0x08, 0x15, 0xf3, 0x3e, 0x0f, 0xd3, 0xfe};
+
+// The answer streamed to the routine: the INIR passes (the first one's length,
+// 0 is 256, and their count), the parity of the flag for VERIFY, the data
+// and the registers LD-BYTES leaves: A, F, H, L, E, D, B, C.
+constexpr uint32_t AnswerHeader = 3;
+constexpr uint32_t AnswerResults = 8;
+
+// B and C as LD-BYTES leaves them with the EAR line idling low
+constexpr uint8_t ByteTiming = 0xb0;
+constexpr uint8_t BorderState = 0x01;
+
+__zx_bank uint8_t TapeRom[RomBankSize];
+ZxShadowSession Session{TapeRom, LdBytes, 0, true, LdBytesSignature, sizeof(LdBytesSignature)};
+uint8_t Answer[AnswerHeader + TapeMaxBlock + AnswerResults];
+TapeStats Stats;
+
+// the mounted tape, core0 only
+FileSystem *Fs = nullptr;
+int File = -1;
+uint32_t Size = 0;
+uint32_t Offset = 0;        // of the next block
+int Block = 0;
+int Blocks = 0;
+char Name[16];
+bool Trapped = false;       // our session is armed or active
+bool EndReported = false;
+
+// the block the Z80 is taking, reported once its session is over
+struct Pending
+{
+    bool valid = false;
+    uint32_t session = 0;
+    int block = 0;
+    uint8_t flag = 0;
+    uint32_t bytes = 0;
+    bool load = true;
+    const char *problem = "";
+};
+Pending Taken;
+
+uint8_t sz53p(uint8_t value)
+{
+    uint8_t parity = value ^ (value >> 4);
+    parity ^= parity >> 2;
+    parity ^= parity >> 1;
+    return (value & 0xa8) | (value ? 0 : 0x40) | ((parity & 1) ? 0 : 0x04);
+}
+
+// the flags of cp 1, LD-BYTES ends with ld a, h; cp 1
+uint8_t cp1(uint8_t value)
+{
+    const uint8_t res = value - 1;
+    return (res & 0x80) | (res ? 0 : 0x40) | ((value ^ 1 ^ res) & 0x10)
+           | (((value ^ 1) & (value ^ res) & 0x80) ? 0x04 : 0) | 0x02 | (value < 1 ? 0x01 : 0);
+}
+
+// The routine, entered on the fetch of LD-BYTES with A the flag, carry set to
+// LOAD, DE the length and IX the destination:
+//
+//          di
+//          ld c, 3
+//          push af
+//          pop hl              ; h = flag, l = flags
+//          ld a, TapeCommand
+//          out (c), a          ; the request: flag, flags, e, d
+//          ...
+// wait:    in a, (c)           ; same handshake as a page transfer
+//          cp TapeCommand
+//          jr z, wait
+//          cp ~TapeCommand
+//          jr z, answer
+//          xor a               ; not served, NC as on a tape error
+//          jr failed
+// answer:  in b, (c)           ; first INIR pass
+//          in h, (c)           ; parity of the flag
+//          in a, (c)           ; passes
+//          or a
+//          jr z, results
+//          bit 0, l
+//          jr z, verify
+//          push ix
+//          pop hl
+// load:    inir                ; 21 T states a byte
+//          dec a
+//          jr nz, load
+//          push hl
+//          pop ix
+//          jr results
+// verify:  ex af, af'          ; the compare loop of LD-BYTES
+// compare: ...
+//          jr nz, failed       ; the other registers are the ones LD-BYTES leaves
+//          ...
+// results: ...                 ; A, F, H, L, DE, B, C
+//          jr exit
+// failed:  ld bc, 0xb001       ; B and C as LD-BYTES leaves them
+// exit:    jp SA/LD-RET
+//
+// Returns the address of the last byte of the final jump.
+uint16_t build_routine()
+{
+    Z80Code c(TapeRom, LdBytes);
+    c.b(0xf3);                    // di
+    c.b(0x0e);                    // ld c, 3
+    c.b(LoaderPort);
+    c.b(0xf5);                    // push af
+    c.b(0xe1);                    // pop hl
+    c.b(0x3e);                    // ld a, TapeCommand
+    c.b(TapeCommand);
+    for (uint8_t out : {0x79, 0x61, 0x69, 0x59, 0x51}) {
+        c.b(0xed);                // out (c), a/h/l/e/d
+        c.b(out);
+    }
+
+    const uint16_t wait = c.pc();
+    c.b(0xed);                    // in a, (c)
+    c.b(0x78);
+    c.b(0xfe);                    // cp TapeCommand
+    c.b(TapeCommand);
+    c.jr(0x28, wait);             // jr z, wait
+    c.b(0xfe);                    // cp ~TapeCommand
+    c.b(uint8_t(~TapeCommand));
+    const uint16_t answer = c.jrLater(0x28);
+    c.b(0xaf);                    // xor a
+    const uint16_t failed = c.jrLater(0x18);
+
+    c.patchJr(answer);
+    for (uint8_t in : {0x40, 0x60, 0x78}) {
+        c.b(0xed);                // in b/h/a, (c)
+        c.b(in);
+    }
+    c.b(0xb7);                    // or a
+    const uint16_t empty = c.jrLater(0x28);
+    c.b(0xcb);                    // bit 0, l
+    c.b(0x45);
+    const uint16_t verify = c.jrLater(0x28);
+    c.b(0xdd);                    // push ix
+    c.b(0xe5);
+    c.b(0xe1);                    // pop hl
+    const uint16_t load = c.pc();
+    c.b(0xed);                    // inir
+    c.b(0xb2);
+    c.b(0x3d);                    // dec a
+    c.jr(0x20, load);             // jr nz, load
+    c.b(0xe5);                    // push hl
+    c.b(0xdd);                    // pop ix
+    c.b(0xe1);
+    const uint16_t loaded = c.jrLater(0x18);
+
+    c.patchJr(verify);
+    c.b(0x08);                    // ex af, af'
+    const uint16_t compare = c.pc();
+    c.b(0xed);                    // in l, (c)
+    c.b(0x68);
+    c.b(0x7c);                    // ld a, h
+    c.b(0xad);                    // xor l
+    c.b(0x67);                    // ld h, a
+    c.b(0xdd);                    // ld a, (ix + 0)
+    c.b(0x7e);
+    c.b(0x00);
+    c.b(0xad);                    // xor l
+    const uint16_t differs = c.jrLater(0x20);
+    c.b(0xdd);                    // inc ix
+    c.b(0x23);
+    c.b(0x1b);                    // dec de
+    c.jr(0x10, compare);          // djnz compare
+    c.b(0x08);                    // ex af, af'
+    c.b(0x3d);                    // dec a
+    const uint16_t verified = c.jrLater(0x28);
+    c.b(0x08);                    // ex af, af'
+    c.jr(0x18, compare);          // jr compare
+
+    c.patchJr(empty);
+    c.patchJr(loaded);
+    c.patchJr(verified);
+    c.b(0xed);                    // in h, (c)
+    c.b(0x60);
+    c.b(0xed);                    // in l, (c)
+    c.b(0x68);
+    c.b(0xe5);                    // push hl
+    for (uint8_t in : {0x60, 0x68, 0x58, 0x50, 0x40, 0x48}) {
+        c.b(0xed);                // in h/l/e/d/b/c, (c)
+        c.b(in);
+    }
+    c.b(0xf1);                    // pop af
+    const uint16_t done = c.jrLater(0x18);
+
+    c.patchJr(failed);
+    c.patchJr(differs);
+    c.b(0x01);                    // ld bc, ByteTiming/BorderState
+    c.b(BorderState);
+    c.b(ByteTiming);
+
+    c.patchJr(done);
+    c.b(0xc3);                    // jp SA/LD-RET
+    c.w(SaLdRet);
+    return c.pc() - 1;
+}
+
+// Plays the next block against the request like LD-BYTES would and fills
+// Answer, returns its size
+uint32_t play(uint8_t flag, bool load, uint16_t de)
+{
+    const uint32_t start = time_us_32();
+    uint8_t *data = Answer + AnswerHeader;
+    uint8_t header[3];
+    uint32_t length = 0;
+    while (File >= 0 && Offset + 2 < Size) {
+        Fs->read(File, Offset, header, sizeof(header));
+        length = header[0] | header[1] << 8;
+        Offset += 2 + length;
+        if (length)
+            break;
+    }
+
+    uint32_t count = 0;
+    uint8_t a = 0;
+    uint8_t f = 0x50;           // no signal: the edge timeout, NC
+    uint8_t h = 0;
+    uint8_t l = 1;
+    uint8_t b = 0;
+    uint8_t c = BorderState;
+    Taken = {};
+    if (!length) {
+        // the ROM would wait for a leader until BREAK, SA/LD-RET checks it
+        if (!EndReported)
+            notice("End of tape");
+        EndReported = true;
+        Taken.problem = ", end of tape";
+    } else {
+        const uint8_t tapeFlag = header[2];
+        Taken.block = ++Block;
+        Taken.flag = tapeFlag;
+        h = l = tapeFlag;
+        b = ByteTiming;
+        if (!de) {
+            // nothing but the flag, taken as the checksum
+            a = h;
+            f = cp1(h);
+        } else if (tapeFlag != flag) {
+            a = flag ^ tapeFlag;
+            f = sz53p(a);
+            // LD-FLAG rotates the LOAD carry into C before it compares
+            c = BorderState << 1 | (load ? 1 : 0);
+            Taken.problem = ", wrong flag";
+        } else {
+            // the data, then the checksum which LD-BYTES leaves in L
+            const uint32_t wanted = std::min({uint32_t(de) + 1, length - 1, TapeMaxBlock + 1});
+            const int32_t got = std::max<int32_t>(Fs->read(File, Offset - length + 1, data, wanted), 0);
+            count = std::min({uint32_t(de), uint32_t(got), TapeMaxBlock});
+            for (uint32_t i = 0; i < count; ++i)
+                h ^= data[i];
+            de -= count;
+            if (uint32_t(got) > count && !de) {
+                l = data[count];
+                h ^= l;
+                a = h;
+                f = cp1(h);
+            } else {
+                l = 1;
+                b = 0;
+                Taken.problem = ", short block";
+            }
+        }
+    }
+
+    Stats.lastSdUs = time_us_32() - start;
+
+    Answer[0] = count;
+    Answer[1] = Taken.flag;
+    Answer[2] = (count + 255) / 256;
+    uint8_t *results = data + count;
+    for (uint8_t value : {a, f, h, l, uint8_t(de), uint8_t(de >> 8), b, c})
+        *results++ = value;
+    Taken.bytes = count;
+    Taken.load = load;
+    return results - Answer;
+}
+
+void report()
+{
+    const bool verify = !Taken.load && Taken.bytes;
+    if (zpi_stream_left()) {
+        // the VERIFY compare loop stopped on a difference
+        zpi_stream_cancel();
+        Taken.problem = ", verify failed";
+    }
+    if (!Taken.block)
+        return;
+    Stats.blocks++;
+    Stats.bytes += Taken.bytes;
+    Stats.lastZxUs = zx_shadow_us();
+
+    char message[112];
+    snprintf(message, sizeof(message), "%s block %d/%d: flag %02x, %lu bytes %s, SD %.1f ms, Z80 %.1f ms%s", Name,
+             Taken.block, Blocks, Taken.flag, (unsigned long)Taken.bytes, verify ? "verified" : "loaded",
+             Stats.lastSdUs / 1000.0, Stats.lastZxUs / 1000.0, Taken.problem);
+    notice(message);
+}
+
+} // namespace {
+
+bool tape_mount(FileSystem &fs, const char *name)
+{
+    tape_eject();
+    const int file = fs.open(name, false);
+    if (file < 0) {
+        error("No such tape");
+        return false;
+    }
+
+    Fs = &fs;
+    File = file;
+    Size = fs.size(file);
+    Blocks = 0;
+    for (uint32_t offset = 0; offset + 2 <= Size; ++Blocks) {
+        uint8_t length[2];
+        fs.read(file, offset, length, sizeof(length));
+        offset += 2 + (length[0] | length[1] << 8);
+        if (offset > Size)
+            error("Truncated tape");
+    }
+    snprintf(Name, sizeof(Name), "%s", name);
+    if (!Session.exit)
+        Session.exit = build_routine();
+    tape_rewind();
+
+    char message[48];
+    snprintf(message, sizeof(message), "%s: %d blocks", Name, Blocks);
+    notice(message);
+    return true;
+}
+
+void tape_eject()
+{
+    if (File < 0)
+        return;
+    Fs->close(File);
+    File = -1;
+    if (Trapped && !snapshot_busy() && zx_shadow_cancel())
+        Trapped = false;
+}
+
+void tape_rewind()
+{
+    Offset = 0;
+    Block = 0;
+    EndReported = false;
+}
+
+bool tape_mounted()
+{
+    return File >= 0;
+}
+
+bool tape_automount(FileSystem &fs)
+{
+    const int file = fs.open("AUTOLOAD.TAP", false);
+    if (file < 0)
+        return false;
+    fs.close(file);
+    return tape_mount(fs, "AUTOLOAD.TAP");
+}
+
+void tape_task()
+{
+    if (Taken.valid && zx_shadow_sessions() != Taken.session) {
+        Taken.valid = false;
+        report();
+    }
+
+    // a snapshot cancels the trap to use the shadow ROM, it is armed again
+    // once the snapshot runs
+    if (snapshot_busy()) {
+        Trapped = false;
+        return;
+    }
+    const ZxShadow state = zx_shadow_state();
+    if (File < 0) {
+        if (Trapped && (state == ZxShadow::Idle || zx_shadow_cancel()))
+            Trapped = false;
+        return;
+    }
+    if (state == ZxShadow::Idle)
+        Trapped = zx_shadow_arm(&Session);
+}
+
+void tape_request(const uint8_t *request, uint16_t size)
+{
+    // zpi.cpp frames exactly TapeRequestSize bytes
+    (void)size;
+    const uint32_t answer = play(request[0], request[1] & 1, request[2] | request[3] << 8);
+    Taken.valid = true;
+    Taken.session = zx_shadow_sessions();
+    zpi_stream_cancel();
+    zpi_stream(Answer, answer);
+}
+
+const TapeStats &tape_stats()
+{
+    return Stats;
+}
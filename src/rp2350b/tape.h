@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+#include "fs.h"
+
+// .TAP flash loading through the shadow ROM.
+//
+// While a tape is mounted, the fetch of LD-BYTES (0x0556) pages in a
+// replacement routine, as long as IFp serves a ROM holding the 48K one there.
+// The routine sends the request (flag, LOAD/VERIFY, length) with the tape
+// command on port 3, IFp answers with the next block of the tape: INIR moves
+// it into place at 21 T states a byte, then the routine returns through the
+// ROM's SA/LD-RET with the registers and flags LD-BYTES would leave. Every
+// call takes the next block, like a tape that plays on.
+
+constexpr uint8_t TapeCommand = 0x04;
+constexpr uint16_t TapeRequestSize = 4;     // flag, F, E, D
+constexpr uint32_t TapeMaxBlock = 0xc000;   // bytes after the flag, 48K RAM
+
+struct TapeStats
+{
+    uint32_t blocks = 0;    // blocks served
+    uint32_t bytes = 0;
+    uint32_t lastSdUs = 0;  // reading the last block from the file
+    uint32_t lastZxUs = 0;  // LD-BYTES fetch to the return into SA/LD-RET
+};
+
+// core0: mounts a .TAP file, the file stays open until tape_eject()
+bool tape_mount(FileSystem &fs, const char *name);
+void tape_eject();
+void tape_rewind();
+bool tape_mounted();
+
+// core0: mounts AUTOLOAD.TAP when there is one
+bool tape_automount(FileSystem &fs);
+
+// core0: keeps LD-BYTES trapped while a tape is mounted and no snapshot is
+// loading, reports every block the Z80 took
+void tape_task();
+
+// core0: a request of the tape command framed by zpi.cpp, streams the answer
+void tape_request(const uint8_t *request, uint16_t size);
+
+const TapeStats &tape_stats();
@@ -1,1369 +0,0 @@
-unsigned char testrom_bin[] = {
-  0xf3, 0xdd, 0x21, 0x38, 0x00, 0x21, 0x00, 0x00, 0x16, 0x00, 0xdd, 0x7e,
-  0x00, 0x5f, 0x19, 0xdd, 0x23, 0xdd, 0x7c, 0xfe, 0x3f, 0x20, 0xf3, 0xdd,
-  0x7d, 0xfe, 0xbf, 0x20, 0xed, 0x11, 0x20, 0x78, 0x7a, 0xbc, 0x20, 0x07,
-  0x7b, 0xbd, 0x20, 0x03, 0xc3, 0x00, 0x01, 0x3c, 0xd3, 0xfe, 0x18, 0xfb,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x68, 0x35, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x52, 0x4f, 0x4d,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfd, 0xed, 0x78, 0xcb,
-  0x57, 0xca, 0x90, 0x25, 0x21, 0xee, 0xbe, 0xc3, 0xa8, 0x22, 0x5a, 0x58,
-  0x20, 0x44, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x74, 0x69, 0x63, 0x73,
-  0x20, 0x76, 0x30, 0x2e, 0x33, 0x37, 0x0a, 0x42, 0x75, 0x69, 0x6c, 0x74,
-  0x3a, 0x20, 0x20, 0x32, 0x32, 0x2f, 0x31, 0x30, 0x2f, 0x32, 0x30, 0x31,
-  0x38, 0x20, 0x32, 0x31, 0x3a, 0x32, 0x38, 0x3a, 0x31, 0x39, 0x00, 0x42,
-  0x72, 0x61, 0x6e, 0x63, 0x68, 0x3a, 0x20, 0x76, 0x30, 0x2e, 0x33, 0x37,
-  0x2d, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x00, 0x43, 0x6f, 0x6d,
-  0x6d, 0x69, 0x74, 0x3a, 0x20, 0x65, 0x62, 0x38, 0x35, 0x39, 0x65, 0x30,
-  0x00, 0x48, 0x6f, 0x73, 0x74, 0x3a, 0x20, 0x20, 0x20, 0x61, 0x6c, 0x66,
-  0x6f, 0x72, 0x64, 0x73, 0x2d, 0x70, 0x63, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0xed, 0x47, 0xed, 0x56, 0x21, 0x00,
-  0x40, 0x11, 0x01, 0x40, 0x01, 0x00, 0x40, 0x3e, 0x00, 0x77, 0xed, 0xb0,
-  0x3e, 0xff, 0xd3, 0x3f, 0x3e, 0x01, 0xd3, 0xfe, 0x21, 0xde, 0x35, 0xfd,
-  0x21, 0x40, 0x48, 0xfd, 0x54, 0xfd, 0x5d, 0x01, 0x20, 0x00, 0xed, 0xb0,
-  0xfd, 0x24, 0x11, 0x20, 0x00, 0xb7, 0xed, 0x52, 0xfd, 0x54, 0xfd, 0x5d,
-  0x01, 0x20, 0x00, 0xed, 0xb0, 0xfd, 0x24, 0xfd, 0x7d, 0xfe, 0x40, 0x20,
-  0x0c, 0xfd, 0x7c, 0xfe, 0x50, 0x20, 0xd8, 0xfd, 0x21, 0x60, 0x48, 0x18,
-  0xd2, 0xfd, 0x7c, 0xfe, 0x4a, 0x20, 0xcc, 0x21, 0x40, 0x59, 0x11, 0x41,
-  0x59, 0x01, 0x3f, 0x00, 0x3e, 0x07, 0x77, 0xed, 0xb0, 0x16, 0x7f, 0x06,
-  0x08, 0x21, 0x00, 0x80, 0xd9, 0x2e, 0x01, 0x11, 0x50, 0x01, 0x01, 0x10,
-  0x00, 0x0b, 0x78, 0xb1, 0x20, 0xfb, 0x7d, 0xee, 0x10, 0x6f, 0xd3, 0xfe,
-  0x1b, 0x7a, 0xb3, 0x20, 0xed, 0xd9, 0xdb, 0xfe, 0xe6, 0x1f, 0xfe, 0x1f,
-  0x20, 0x0d, 0x2b, 0x7c, 0xb5, 0x20, 0xf3, 0x7a, 0xd3, 0x3f, 0xa7, 0xcb,
-  0x1a, 0x10, 0xce, 0xaf, 0xd3, 0x3f, 0x2e, 0x01, 0x11, 0x50, 0x04, 0x01,
-  0x48, 0x00, 0x0b, 0x78, 0xb1, 0x20, 0xfb, 0x7d, 0x3c, 0xe6, 0x17, 0xee,
-  0x10, 0x6f, 0xd3, 0xfe, 0x1b, 0x7a, 0xb3, 0x20, 0xea, 0x11, 0x50, 0x01,
-  0x01, 0x23, 0x00, 0x0b, 0x78, 0xb1, 0x20, 0xfb, 0x7d, 0x3c, 0xe6, 0x17,
-  0xee, 0x10, 0x6f, 0xd3, 0xfe, 0x1b, 0x7a, 0xb3, 0x20, 0xea, 0xaf, 0xd3,
-  0x3f, 0x01, 0xfe, 0x7f, 0xed, 0x78, 0xcb, 0x47, 0xca, 0x03, 0x19, 0xcb,
-  0x4f, 0xca, 0xcc, 0x2e, 0xcb, 0x57, 0xca, 0x90, 0x25, 0x01, 0xfe, 0xdf,
-  0xed, 0x78, 0xcb, 0x5f, 0xca, 0x72, 0x1c, 0x01, 0xfe, 0xbf, 0xed, 0x78,
-  0xcb, 0x57, 0xca, 0xa8, 0x22, 0xaf, 0x47, 0x4f, 0xdd, 0x69, 0xdd, 0x60,
-  0xfd, 0x69, 0xfd, 0x60, 0x01, 0xfe, 0xfd, 0xed, 0x78, 0xcb, 0x4f, 0x28,
-  0x31, 0x01, 0xfe, 0xef, 0xed, 0x78, 0xcb, 0x47, 0x28, 0x28, 0xcb, 0x5f,
-  0xca, 0x72, 0x1c, 0xcb, 0x67, 0xca, 0x03, 0x19, 0x01, 0x00, 0xff, 0xdb,
-  0x1f, 0x4f, 0xe6, 0xe0, 0xfe, 0x00, 0x20, 0x2c, 0x10, 0xf5, 0xcb, 0x41,
-  0xc2, 0x72, 0x1c, 0xcb, 0x49, 0xc2, 0x03, 0x19, 0xcb, 0x61, 0x20, 0x02,
-  0x18, 0x1a, 0xfd, 0x21, 0x01, 0x00, 0x11, 0x00, 0x03, 0x01, 0x10, 0x00,
-  0x0b, 0x78, 0xb1, 0x20, 0xfb, 0x7d, 0xee, 0x10, 0x6f, 0xd3, 0xfe, 0x1b,
-  0x7a, 0xb3, 0x20, 0xed, 0x3e, 0x04, 0xd3, 0xfe, 0xaf, 0xd3, 0x3f, 0x21,
-  0x00, 0x40, 0x11, 0x01, 0x40, 0x01, 0x00, 0xc0, 0x3e, 0x00, 0x77, 0xed,
-  0xb0, 0x21, 0x00, 0x40, 0x11, 0x00, 0x40, 0x3e, 0x01, 0x06, 0x08, 0xb7,
-  0x77, 0x4f, 0x7e, 0xb9, 0x20, 0x0c, 0x17, 0x10, 0xf7, 0x23, 0x1b, 0x7a,
-  0xb3, 0xca, 0xa6, 0x02, 0x18, 0xe9, 0xa9, 0x57, 0xdd, 0x44, 0xdd, 0x4d,
-  0xb0, 0xd3, 0x3f, 0x47, 0x3e, 0x01, 0xb1, 0x4f, 0xdd, 0x69, 0xdd, 0x60,
-  0x3e, 0x02, 0xd3, 0xfe, 0x18, 0x00, 0x21, 0x00, 0x40, 0x11, 0x01, 0x40,
-  0x01, 0x00, 0x40, 0x3e, 0x00, 0x77, 0xed, 0xb0, 0x21, 0x00, 0x40, 0x01,
-  0x00, 0x40, 0x3e, 0x00, 0x2f, 0x77, 0x23, 0x23, 0x0b, 0x0b, 0x78, 0xb1,
-  0x20, 0xf4, 0x21, 0x00, 0x40, 0x01, 0x00, 0x40, 0x3e, 0x00, 0x2f, 0xbe,
-  0x20, 0x0e, 0x23, 0x0b, 0x2f, 0xbe, 0x20, 0x08, 0x23, 0x0b, 0x78, 0xb1,
-  0x20, 0xee, 0x18, 0x18, 0xae, 0xdd, 0x44, 0xdd, 0x4d, 0x57, 0xb0, 0xd3,
-  0x3f, 0x47, 0x3e, 0x02, 0xb1, 0x4f, 0xdd, 0x69, 0xdd, 0x60, 0x3e, 0x02,
-  0xd3, 0xfe, 0x18, 0x00, 0x21, 0x00, 0x40, 0x11, 0x01, 0x40, 0x01, 0x00,
-  0x40, 0x3e, 0xff, 0x77, 0xed, 0xb0, 0x21, 0x00, 0x40, 0x01, 0x00, 0x40,
-  0x3e, 0xff, 0x2f, 0x77, 0x23, 0x23, 0x0b, 0x0b, 0x78, 0xb1, 0x20, 0xf4,
-  0x21, 0x00, 0x40, 0x01, 0x00, 0x40, 0x3e, 0xff, 0x2f, 0xbe, 0x20, 0x0e,
-  0x23, 0x0b, 0x2f, 0xbe, 0x20, 0x08, 0x23, 0x0b, 0x78, 0xb1, 0x20, 0xee,
-  0x18, 0x18, 0xae, 0xdd, 0x44, 0xdd, 0x4d, 0x57, 0xb0, 0xd3, 0x3f, 0x47,
-  0x3e, 0x02, 0xb1, 0x4f, 0xdd, 0x69, 0xdd, 0x60, 0x3e, 0x02, 0xd3, 0xfe,
-  0x18, 0x00, 0x21, 0x00, 0x40, 0x11, 0x01, 0x40, 0x01, 0x00, 0x40, 0x3e,
-  0x00, 0x77, 0xed, 0xb0, 0x21, 0x00, 0x40, 0x01, 0x00, 0x40, 0x3e, 0x00,
-  0x2f, 0x23, 0x77, 0x23, 0x0b, 0x0b, 0x78, 0xb1, 0x20, 0xf4, 0x21, 0x00,
-  0x40, 0x01, 0x00, 0x40, 0x3e, 0x00, 0xbe, 0x20, 0x0e, 0x23, 0x0b, 0x2f,
-  0xbe, 0x20, 0x08, 0x23, 0x0b, 0x78, 0xb1, 0x20, 0xef, 0x18, 0x18, 0xae,
-  0xdd, 0x44, 0xdd, 0x4d, 0x57, 0xb0, 0xd3, 0x3f, 0x47, 0x3e, 0x02, 0xb1,
-  0x4f, 0xdd, 0x69, 0xdd, 0x60, 0x3e, 0x02, 0xd3, 0xfe, 0x18, 0x00, 0x21,
-  0x00, 0x40, 0x11, 0x01, 0x40, 0x01, 0x00, 0x40, 0x3e, 0xff, 0x77, 0xed,
-  0xb0, 0x21, 0x00, 0x40, 0x01, 0x00, 0x40, 0x3e, 0xff, 0x2f, 0x23, 0x77,
-  0x23, 0x0b, 0x0b, 0x78, 0xb1, 0x20, 0xf4, 0x21, 0x00, 0x40, 0x01, 0x00,
-  0x40, 0x3e, 0xff, 0xbe, 0x20, 0x0e, 0x23, 0x0b, 0x2f, 0xbe, 0x20, 0x08,
-  0x23, 0x0b, 0x78, 0xb1, 0x20, 0xef, 0x18, 0x18, 0xae, 0xdd, 0x44, 0xdd,
-  0x4d, 0x57, 0xb0, 0xd3, 0x3f, 0x47, 0x3e, 0x02, 0xb1, 0x4f, 0xdd, 0x69,
-  0xdd, 0x60, 0x3e, 0x02, 0xd3, 0xfe, 0x18, 0x00, 0x21, 0x00, 0x40, 0x01,
-  0x00, 0x40, 0x36, 0x00, 0x23, 0x0b, 0x78, 0xb1, 0x20, 0xf8, 0x21, 0x00,
-  0x40, 0x01, 0x00, 0x40, 0x7e, 0xfe, 0x00, 0x28, 0x0c, 0xd9, 0x47, 0xdd,
-  0x7c, 0xb0, 0xdd, 0x67, 0x3e, 0x02, 0xd3, 0xfe, 0xd9, 0x3e, 0xff, 0x77,
-  0x23, 0x0b, 0x78, 0xb1, 0x20, 0xe6, 0x21, 0x00, 0x40, 0x01, 0xff, 0x3f,
-  0x09, 0x7e, 0xfe, 0xff, 0x28, 0x0d, 0xaf, 0xd9, 0x47, 0xdd, 0x7c, 0xb0,
-  0xdd, 0x67, 0x3e, 0x02, 0xd3, 0xfe, 0xd9, 0xaf, 0x77, 0x2b, 0x0b, 0x78,
-  0xb1, 0x20, 0xe6, 0x21, 0x00, 0x40, 0x01, 0xff, 0x3f, 0x09, 0x7e, 0xfe,
-  0x00, 0x28, 0x0c, 0xd9, 0x47, 0xdd, 0x7c, 0xb0, 0xdd, 0x67, 0x3e, 0x02,
-  0xd3, 0xfe, 0xd9, 0x2b, 0x0b, 0x78, 0xb1, 0x20, 0xe9, 0x31, 0x00, 0x40,
-  0xd9, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x20, 0xd9,
-  0x50, 0x59, 0x7a, 0x63, 0x2e, 0xfd, 0xb7, 0xed, 0x52, 0xde, 0x00, 0xed,
-  0x52, 0x16, 0x00, 0x9a, 0x5f, 0xed, 0x52, 0x30, 0x01, 0x23, 0x44, 0x4d,
-  0x54, 0x5d, 0x21, 0x00, 0x00, 0x39, 0x73, 0x23, 0x72, 0x2b, 0x33, 0x33,
-  0xd9, 0x0b, 0x78, 0xb1, 0xc2, 0x67, 0x04, 0x31, 0x00, 0x40, 0xd9, 0x01,
-  0x00, 0x00, 0xd9, 0x01, 0x00, 0x20, 0x2e, 0x00, 0xd9, 0x50, 0x59, 0x7a,
-  0x63, 0x2e, 0xfd, 0xb7, 0xed, 0x52, 0xde, 0x00, 0xed, 0x52, 0x16, 0x00,
-  0x9a, 0x5f, 0xed, 0x52, 0x30, 0x01, 0x23, 0x44, 0x4d, 0xd1, 0x7c, 0xaa,
-  0xc2, 0xc6, 0x04, 0x7d, 0xab, 0xc2, 0xc6, 0x04, 0x18, 0x04, 0xd9, 0xb5,
-  0x6f, 0xd9, 0xd9, 0x0b, 0x78, 0xb1, 0xc2, 0xa0, 0x04, 0x7d, 0xfe, 0x00,
-  0xca, 0xf0, 0x04, 0xdd, 0x44, 0xdd, 0x4d, 0x57, 0xb0, 0xd3, 0x3f, 0x47,
-  0x3e, 0x04, 0xb1, 0x4f, 0xdd, 0x69, 0xdd, 0x60, 0x4f, 0x3e, 0x02, 0xd3,
-  0xfe, 0xc3, 0xf0, 0x04, 0x31, 0xfe, 0x7f, 0xd9, 0x01, 0xff, 0x00, 0xd9,
-  0x01, 0xff, 0x1f, 0x33, 0x33, 0xd9, 0x50, 0x59, 0x7a, 0x63, 0x2e, 0xfd,
-  0xb7, 0xed, 0x52, 0xde, 0x00, 0xed, 0x52, 0x16, 0x00, 0x9a, 0x5f, 0xed,
-  0x52, 0x30, 0x01, 0x23, 0x44, 0x4d, 0xe5, 0xd9, 0x0b, 0x78, 0xb1, 0xc2,
-  0xfd, 0x04, 0x31, 0xfe, 0x7f, 0xd9, 0x01, 0xff, 0x00, 0xd9, 0x01, 0xff,
-  0x1f, 0x2e, 0x00, 0xd9, 0x50, 0x59, 0x7a, 0x63, 0x2e, 0xfd, 0xb7, 0xed,
-  0x52, 0xde, 0x00, 0xed, 0x52, 0x16, 0x00, 0x9a, 0x5f, 0xed, 0x52, 0x30,
-  0x01, 0x23, 0x44, 0x4d, 0xd1, 0x3b, 0x3b, 0x3b, 0x3b, 0x7c, 0xba, 0xc2,
-  0x55, 0x05, 0x7d, 0xbb, 0xc2, 0x55, 0x05, 0x18, 0x04, 0xd9, 0xb5, 0x6f,
-  0xd9, 0xd9, 0x0b, 0x78, 0xb1, 0xc2, 0x2b, 0x05, 0x7d, 0xfe, 0x00, 0xc3,
-  0x7f, 0x05, 0xdd, 0x44, 0xdd, 0x4d, 0x57, 0xb0, 0xd3, 0x3f, 0x47, 0x3e,
-  0x04, 0xb1, 0x4f, 0xdd, 0x69, 0xdd, 0x60, 0x4f, 0x3e, 0x02, 0xd3, 0xfe,
-  0xc3, 0x7f, 0x05, 0x21, 0x00, 0x40, 0x11, 0x01, 0x40, 0x01, 0x00, 0x18,
-  0x3e, 0x00, 0x77, 0xed, 0xb0, 0x21, 0x00, 0x58, 0x11, 0x01, 0x58, 0x01,
-  0x00, 0x03, 0x3e, 0x38, 0x77, 0xed, 0xb0, 0xdd, 0x7c, 0xfe, 0x00, 0xca,
-  0x5d, 0x06, 0xdd, 0x54, 0xdd, 0x5d, 0x7a, 0xd3, 0x3f, 0x21, 0x80, 0x58,
-  0x11, 0x81, 0x58, 0x01, 0xff, 0x01, 0x36, 0x00, 0xed, 0xb0, 0x21, 0x9e,
-  0x35, 0x11, 0x80, 0x58, 0x06, 0x40, 0x0e, 0x08, 0x7e, 0xcb, 0x7f, 0x28,
-  0x04, 0xeb, 0x36, 0x7f, 0xeb, 0x13, 0x17, 0x0d, 0x20, 0xf3, 0x23, 0x05,
-  0x20, 0xec, 0x21, 0x80, 0x59, 0xdd, 0x4c, 0x16, 0x08, 0x06, 0x08, 0xcb,
-  0x41, 0x20, 0x0c, 0x3e, 0x00, 0x77, 0x23, 0x77, 0x23, 0x77, 0x23, 0x77,
-  0x23, 0x18, 0x04, 0x23, 0x23, 0x23, 0x23, 0xcb, 0x09, 0x10, 0xe8, 0x15,
-  0x7a, 0xfe, 0x00, 0x20, 0xe0, 0x2e, 0x00, 0xfb, 0x76, 0xc1, 0xdd, 0x54,
-  0xdd, 0x5d, 0x7a, 0xfe, 0x00, 0x20, 0x02, 0xfb, 0x76, 0x3e, 0x00, 0xd3,
-  0xfe, 0x3e, 0x24, 0x4f, 0x3e, 0x02, 0x47, 0x0b, 0x78, 0xb1, 0x20, 0xfb,
-  0xaf, 0x4f, 0x3e, 0x04, 0xcb, 0x42, 0x28, 0x02, 0x3e, 0x02, 0xd3, 0xfe,
-  0x3e, 0xff, 0x47, 0x10, 0xfe, 0x7d, 0xe6, 0xf8, 0xd3, 0xfe, 0x3e, 0xa8,
-  0x47, 0x10, 0xfe, 0xcb, 0x1a, 0x0c, 0x79, 0xfe, 0x08, 0x20, 0xdf, 0x01,
-  0x40, 0x00, 0x0b, 0x79, 0xb0, 0x20, 0xfb, 0xfd, 0x7c, 0xfd, 0xb5, 0x28,
-  0x0e, 0x3e, 0x06, 0xd3, 0xfe, 0x3e, 0x8a, 0x47, 0x10, 0xfe, 0x3e, 0x00,
-  0xd3, 0xfe, 0x2c, 0xdd, 0x54, 0xdd, 0x5d, 0xfb, 0x76, 0x21, 0x00, 0x5b,
-  0x11, 0x01, 0x5b, 0x01, 0x00, 0x25, 0x3e, 0x00, 0x77, 0xed, 0xb0, 0x31,
-  0xff, 0x7b, 0xcd, 0x37, 0x11, 0x3e, 0x07, 0xd3, 0xfe, 0xcd, 0x94, 0x16,
-  0x21, 0xae, 0x30, 0xcd, 0xea, 0x16, 0x21, 0xc1, 0x30, 0xcd, 0x8c, 0x13,
-  0xfd, 0x7c, 0xfd, 0xb5, 0x28, 0x17, 0x21, 0xe7, 0x30, 0xcd, 0x8c, 0x13,
-  0xfd, 0xe5, 0xe1, 0x11, 0x28, 0x7c, 0xcd, 0x56, 0x16, 0x21, 0x28, 0x7c,
-  0xcd, 0x8c, 0x13, 0x18, 0x03, 0xcd, 0x3b, 0x17, 0xaf, 0x32, 0x3a, 0x7c,
-  0x3a, 0x41, 0x7c, 0xfe, 0x00, 0x20, 0x0c, 0x32, 0x00, 0x7c, 0x21, 0x6d,
-  0x30, 0xcd, 0x8c, 0x13, 0xc3, 0xa0, 0x07, 0x21, 0x54, 0x32, 0xcd, 0x8c,
-  0x13, 0xcd, 0x00, 0x7d, 0x54, 0x5d, 0x21, 0x54, 0x2b, 0x4e, 0x23, 0x46,
-  0x2b, 0x78, 0xb1, 0xca, 0x84, 0x07, 0x7a, 0xa8, 0x20, 0x04, 0x7b, 0xa9,
-  0x28, 0x06, 0x01, 0x08, 0x00, 0x09, 0x18, 0xe9, 0xe5, 0x23, 0x23, 0x5e,
-  0x23, 0x56, 0x2b, 0x62, 0x6b, 0xaf, 0x32, 0x00, 0x7c, 0xcd, 0x8c, 0x13,
-  0xe1, 0x11, 0x04, 0x00, 0x19, 0x4e, 0x23, 0x46, 0x2b, 0xed, 0x43, 0x43,
-  0x7c, 0x23, 0x23, 0x5e, 0x23, 0x56, 0x2b, 0x7a, 0xb3, 0x28, 0x63, 0xe5,
-  0x21, 0x54, 0x33, 0xcd, 0x8c, 0x13, 0xe1, 0x5e, 0x23, 0x56, 0x2b, 0xdd,
-  0x6b, 0xdd, 0x62, 0x16, 0x01, 0x7a, 0xcd, 0xed, 0x18, 0xd5, 0xcd, 0x00,
-  0x7d, 0xd1, 0xdd, 0x7e, 0x00, 0xbd, 0x20, 0x1a, 0xdd, 0x7e, 0x01, 0xbc,
-  0x20, 0x14, 0x14, 0xdd, 0x23, 0xdd, 0x23, 0xdd, 0x23, 0xdd, 0x23, 0xdd,
-  0x46, 0x00, 0xdd, 0x7e, 0x01, 0xb0, 0x20, 0xd9, 0x18, 0x28, 0x21, 0x6b,
-  0x33, 0xcd, 0x8c, 0x13, 0xcd, 0xb3, 0x16, 0x21, 0x59, 0x35, 0xcd, 0x8c,
-  0x13, 0xdd, 0x5e, 0x02, 0xdd, 0x56, 0x03, 0x62, 0x6b, 0xcd, 0x8c, 0x13,
-  0x21, 0x65, 0x35, 0xcd, 0x8c, 0x13, 0x3e, 0xff, 0x32, 0x39, 0x7c, 0xc3,
-  0x79, 0x07, 0xaf, 0xcd, 0xed, 0x18, 0xe5, 0x21, 0x5e, 0x33, 0xcd, 0x8c,
-  0x13, 0xcd, 0xb3, 0x16, 0xe1, 0x11, 0x2e, 0x08, 0xd5, 0xed, 0x5b, 0x43,
-  0x7c, 0x62, 0x6b, 0xe9, 0xd5, 0x21, 0x67, 0x32, 0xaf, 0x32, 0x00, 0x7c,
-  0xcd, 0x8c, 0x13, 0xe1, 0x11, 0x20, 0x7c, 0xcd, 0x39, 0x16, 0xaf, 0x32,
-  0x24, 0x7c, 0x21, 0x20, 0x7c, 0xcd, 0x8c, 0x13, 0xfd, 0x7c, 0xfd, 0xb5,
-  0x28, 0x0e, 0x21, 0xf2, 0x32, 0xcd, 0x8c, 0x13, 0xcd, 0xb3, 0x16, 0xcd,
-  0xef, 0x0c, 0x18, 0x7a, 0x21, 0x99, 0x32, 0xcd, 0x8c, 0x13, 0x21, 0x01,
-  0x04, 0xfb, 0x76, 0x7d, 0xfe, 0x01, 0x20, 0x1b, 0xe5, 0x7c, 0x6f, 0x3e,
-  0x96, 0x95, 0xf5, 0x3e, 0xf8, 0x32, 0x00, 0x7c, 0x3e, 0x08, 0x32, 0x04,
-  0x7c, 0xf1, 0xcd, 0x4a, 0x15, 0x3e, 0x06, 0x32, 0x04, 0x7c, 0xe1, 0x2b,
-  0x7c, 0xb5, 0xc2, 0xf1, 0x07, 0x21, 0xc5, 0x32, 0xcd, 0x8c, 0x13, 0x11,
-  0xef, 0x0c, 0xc3, 0x1e, 0x08, 0x01, 0xfe, 0xf7, 0xed, 0x78, 0xe6, 0x0f,
-  0xfe, 0x0f, 0xca, 0xbe, 0x07, 0x21, 0x9c, 0x30, 0x47, 0x5e, 0x23, 0x56,
-  0x2b, 0x7a, 0xb3, 0x28, 0xb5, 0xcb, 0x40, 0x20, 0x19, 0xe5, 0x5e, 0x23,
-  0x56, 0x2b, 0x62, 0x6b, 0xcd, 0x8c, 0x13, 0xe1, 0x23, 0x23, 0x5e, 0x23,
-  0x56, 0x2b, 0xf3, 0x62, 0x6b, 0x11, 0x2e, 0x08, 0xd5, 0xe9, 0x11, 0x04,
-  0x00, 0x19, 0xcb, 0x18, 0x18, 0xd3, 0xfd, 0x7c, 0xfd, 0xb5, 0x20, 0x51,
-  0x21, 0x15, 0x34, 0xcd, 0x8c, 0x13, 0x3a, 0x01, 0x7c, 0x47, 0x21, 0x00,
-  0x00, 0x22, 0x10, 0x7c, 0x22, 0x12, 0x7c, 0xfb, 0x76, 0xe5, 0xc5, 0x2a,
-  0x10, 0x7c, 0x11, 0x20, 0x7c, 0xcd, 0x39, 0x16, 0xc1, 0x78, 0x32, 0x01,
-  0x7c, 0x3e, 0xe4, 0x32, 0x00, 0x7c, 0x21, 0x20, 0x7c, 0xcd, 0x8c, 0x13,
-  0xe1, 0x3a, 0x10, 0x7c, 0xd3, 0x3f, 0xfe, 0x00, 0x20, 0xda, 0x2a, 0x10,
-  0x7c, 0x7c, 0xfe, 0x03, 0x20, 0xd2, 0x78, 0x32, 0x01, 0x7c, 0x3e, 0xe4,
-  0x32, 0x00, 0x7c, 0x21, 0x5e, 0x33, 0xcd, 0x8c, 0x13, 0xf3, 0x21, 0x00,
-  0x00, 0x22, 0x10, 0x7c, 0xaf, 0x47, 0x3a, 0x36, 0x7c, 0xb0, 0x47, 0x3a,
-  0x38, 0x7c, 0xb0, 0x47, 0x3a, 0x37, 0x7c, 0xb0, 0x20, 0x07, 0x3a, 0x39,
-  0x7c, 0xfe, 0x00, 0x28, 0x40, 0xcd, 0xb3, 0x16, 0x21, 0x93, 0x34, 0xcd,
-  0x8c, 0x13, 0xf3, 0xfd, 0x7d, 0xfd, 0xb4, 0x20, 0x10, 0xcd, 0xb3, 0x12,
-  0xfe, 0x48, 0x20, 0xf9, 0xcd, 0x66, 0x2e, 0x3e, 0x02, 0xd3, 0xfe, 0x18,
-  0xf0, 0xf3, 0x2e, 0x02, 0x01, 0xa8, 0x00, 0x11, 0x80, 0x00, 0xcd, 0x66,
-  0x0c, 0x01, 0x00, 0x40, 0x0b, 0x78, 0xb1, 0x20, 0xfb, 0xcd, 0xb3, 0x12,
-  0xfe, 0x48, 0x20, 0xe5, 0xcd, 0x66, 0x2e, 0x18, 0xe0, 0xfd, 0x7c, 0xfd,
-  0xb5, 0x28, 0x49, 0xfd, 0x23, 0xfd, 0x7c, 0xfd, 0xb5, 0x28, 0x22, 0xcd,
-  0xb3, 0x16, 0x21, 0x30, 0x34, 0xcd, 0x8c, 0x13, 0x21, 0x08, 0x00, 0x01,
-  0xff, 0xff, 0x0b, 0x78, 0xb1, 0x20, 0xfb, 0x2b, 0x7c, 0xb5, 0x20, 0xf3,
-  0xf3, 0x3e, 0x03, 0xcd, 0xc0, 0x7d, 0xc3, 0x5c, 0x02, 0xcd, 0xb3, 0x16,
-  0x21, 0x50, 0x34, 0xcd, 0x8c, 0x13, 0x21, 0x00, 0x00, 0x5d, 0x3e, 0x28,
-  0x57, 0x1a, 0xd3, 0xfe, 0x44, 0x10, 0xfe, 0x23, 0x7c, 0xe6, 0x3f, 0xf6,
-  0x01, 0x67, 0x18, 0xed, 0x3a, 0x41, 0x7c, 0xfe, 0x00, 0x20, 0x08, 0x21,
-  0x73, 0x34, 0xcd, 0x8c, 0x13, 0xf3, 0x76, 0x21, 0xb6, 0x34, 0xcd, 0x8c,
-  0x13, 0x3a, 0x01, 0x7c, 0x4f, 0x06, 0x09, 0xfb, 0xcd, 0xf5, 0x10, 0xca,
-  0x03, 0x19, 0x79, 0x32, 0x01, 0x7c, 0x3e, 0xf6, 0x32, 0x00, 0x7c, 0x78,
-  0xc6, 0x30, 0xcd, 0x4a, 0x15, 0x76, 0x3a, 0x10, 0x7c, 0xfe, 0x32, 0x20,
-  0xe3, 0x3e, 0x00, 0x32, 0x10, 0x7c, 0x05, 0x78, 0xfe, 0xff, 0x20, 0xd8,
-  0xf3, 0x79, 0x32, 0x01, 0x7c, 0x3e, 0xe4, 0x32, 0x00, 0x7c, 0x21, 0x78,
-  0x33, 0xcd, 0x8c, 0x13, 0x3e, 0x02, 0x01, 0x34, 0x12, 0xcd, 0xc0, 0x7d,
-  0x3e, 0x01, 0x06, 0x08, 0xb7, 0x77, 0x4f, 0x7e, 0xb9, 0x20, 0x0c, 0x17,
-  0x10, 0xf7, 0x23, 0x1b, 0x7a, 0xb3, 0xca, 0xbd, 0x09, 0x18, 0xe9, 0xa9,
-  0x57, 0xdd, 0x44, 0xdd, 0x4d, 0xb0, 0x47, 0x3e, 0x01, 0xb1, 0x4f, 0xdd,
-  0x69, 0xdd, 0x60, 0x3e, 0x02, 0xd3, 0xfe, 0x18, 0x00, 0xc9, 0xe5, 0xd5,
-  0xc5, 0x7a, 0x77, 0x54, 0x5d, 0x13, 0xed, 0xb0, 0xc1, 0xd1, 0xe1, 0xe5,
-  0xc5, 0x7a, 0x2f, 0x77, 0x23, 0x23, 0x0b, 0x0b, 0x78, 0xb1, 0x20, 0xf5,
-  0xc1, 0xe1, 0x7a, 0x2f, 0xbe, 0x20, 0x0e, 0x23, 0x0b, 0x2f, 0xbe, 0x20,
-  0x08, 0x23, 0x0b, 0x78, 0xb1, 0x20, 0xef, 0x18, 0x16, 0xae, 0xdd, 0x44,
-  0xdd, 0x4d, 0x57, 0xb0, 0x47, 0x3e, 0x02, 0xb1, 0x4f, 0xdd, 0x69, 0xdd,
-  0x60, 0x3e, 0x02, 0xd3, 0xfe, 0x18, 0x00, 0xc9, 0xe5, 0xd5, 0xc5, 0x7a,
-  0x77, 0x54, 0x5d, 0x13, 0xed, 0xb0, 0xc1, 0xd1, 0xe1, 0xe5, 0xc5, 0x7a,
-  0x2f, 0x23, 0x77, 0x23, 0x0b, 0x0b, 0x78, 0xb1, 0x20, 0xf5, 0xc1, 0xe1,
-  0x7a, 0xbe, 0x20, 0x0e, 0x23, 0x0b, 0x2f, 0xbe, 0x20, 0x08, 0x23, 0x0b,
-  0x78, 0xb1, 0x20, 0xf0, 0x18, 0x16, 0xae, 0xdd, 0x44, 0xdd, 0x4d, 0x57,
-  0xb0, 0x47, 0x3e, 0x02, 0xb1, 0x4f, 0xdd, 0x69, 0xdd, 0x60, 0x3e, 0x02,
-  0xd3, 0xfe, 0x18, 0x00, 0xc9, 0xe5, 0xc5, 0x36, 0x00, 0x23, 0x0b, 0x78,
-  0xb1, 0x20, 0xf8, 0xc1, 0xe1, 0xe5, 0xc5, 0x7e, 0xfe, 0x00, 0x28, 0x03,
-  0xcd, 0x92, 0x0a, 0x3e, 0xff, 0x77, 0x23, 0x0b, 0x78, 0xb1, 0x20, 0xef,
-  0xc1, 0xe1, 0xe5, 0xc5, 0x0b, 0x09, 0x7e, 0xfe, 0xff, 0x28, 0x04, 0xaf,
-  0xcd, 0x92, 0x0a, 0xaf, 0x77, 0x2b, 0x0b, 0x78, 0xb1, 0x20, 0xef, 0xc1,
-  0xe1, 0x0b, 0x09, 0x7e, 0xfe, 0x00, 0x28, 0x03, 0xcd, 0x92, 0x0a, 0x2b,
-  0x0b, 0x78, 0xb1, 0x20, 0xf2, 0xc9, 0xd9, 0x47, 0xdd, 0x7c, 0xb0, 0xdd,
-  0x67, 0x3e, 0x04, 0x4f, 0xdd, 0x7d, 0xb1, 0xdd, 0x6f, 0x3e, 0x02, 0xd3,
-  0xfe, 0xd9, 0xc9, 0x50, 0x59, 0x7a, 0x63, 0x2e, 0xfd, 0xb7, 0xed, 0x52,
-  0xde, 0x00, 0xed, 0x52, 0x16, 0x00, 0x9a, 0x5f, 0xed, 0x52, 0x30, 0x01,
-  0x23, 0x44, 0x4d, 0xc9, 0xed, 0x73, 0x30, 0x7c, 0x22, 0x60, 0x7c, 0xed,
-  0x53, 0x64, 0x7c, 0xed, 0x43, 0x62, 0x7c, 0xed, 0x7b, 0x60, 0x7c, 0xd9,
-  0xed, 0x4b, 0x62, 0x7c, 0x21, 0x00, 0x00, 0xd9, 0xed, 0x4b, 0x64, 0x7c,
-  0xd9, 0x50, 0x59, 0x7a, 0x63, 0x2e, 0xfd, 0xb7, 0xed, 0x52, 0xde, 0x00,
-  0xed, 0x52, 0x16, 0x00, 0x9a, 0x5f, 0xed, 0x52, 0x30, 0x01, 0x23, 0x44,
-  0x4d, 0x54, 0x5d, 0x21, 0x00, 0x00, 0x39, 0x73, 0x23, 0x72, 0x2b, 0x33,
-  0x33, 0xd9, 0x0b, 0x78, 0xb1, 0xc2, 0xe0, 0x0a, 0xfd, 0x7d, 0xfd, 0xb4,
-  0x28, 0x08, 0x01, 0xff, 0xff, 0x0b, 0x79, 0xb0, 0x20, 0xfb, 0xed, 0x7b,
-  0x60, 0x7c, 0xd9, 0xed, 0x4b, 0x62, 0x7c, 0xd9, 0xed, 0x4b, 0x64, 0x7c,
-  0x2e, 0x00, 0xd9, 0x50, 0x59, 0x7a, 0x63, 0x2e, 0xfd, 0xb7, 0xed, 0x52,
-  0xde, 0x00, 0xed, 0x52, 0x16, 0x00, 0x9a, 0x5f, 0xed, 0x52, 0x30, 0x01,
-  0x23, 0x44, 0x4d, 0xd1, 0x7c, 0xaa, 0x20, 0x06, 0x7d, 0xab, 0x20, 0x02,
-  0x18, 0x04, 0xd9, 0xb5, 0x6f, 0xd9, 0xd9, 0x0b, 0x78, 0xb1, 0x20, 0xd2,
-  0x7d, 0xfe, 0x00, 0xca, 0x75, 0x0b, 0xdd, 0x44, 0xdd, 0x4d, 0x57, 0xb0,
-  0x47, 0x3e, 0x08, 0xb1, 0x4f, 0xdd, 0x69, 0xdd, 0x60, 0x4f, 0x3e, 0x02,
-  0xd3, 0xfe, 0xc3, 0x75, 0x0b, 0xed, 0x7b, 0x30, 0x7c, 0xc9, 0xed, 0x73,
-  0x30, 0x7c, 0x22, 0x60, 0x7c, 0xed, 0x53, 0x64, 0x7c, 0xed, 0x43, 0x62,
-  0x7c, 0xed, 0x7b, 0x60, 0x7c, 0xd9, 0xed, 0x4b, 0x62, 0x7c, 0xd9, 0xed,
-  0x4b, 0x64, 0x7c, 0x33, 0x33, 0xd9, 0x50, 0x59, 0x7a, 0x63, 0x2e, 0xfd,
-  0xb7, 0xed, 0x52, 0xde, 0x00, 0xed, 0x52, 0x16, 0x00, 0x9a, 0x5f, 0xed,
-  0x52, 0x30, 0x01, 0x23, 0x44, 0x4d, 0xe5, 0xd9, 0x0b, 0x78, 0xb1, 0xc2,
-  0x99, 0x0b, 0xfd, 0x7d, 0xfd, 0xb4, 0x28, 0x08, 0x01, 0xff, 0xff, 0x0b,
-  0x79, 0xb0, 0x20, 0xfb, 0xed, 0x7b, 0x60, 0x7c, 0xd9, 0xed, 0x4b, 0x62,
-  0x7c, 0xd9, 0xed, 0x4b, 0x64, 0x7c, 0x2e, 0x00, 0xd9, 0x50, 0x59, 0x7a,
-  0x63, 0x2e, 0xfd, 0xb7, 0xed, 0x52, 0xde, 0x00, 0xed, 0x52, 0x16, 0x00,
-  0x9a, 0x5f, 0xed, 0x52, 0x30, 0x01, 0x23, 0x44, 0x4d, 0xd1, 0x3b, 0x3b,
-  0x3b, 0x3b, 0x7c, 0xaa, 0x20, 0x06, 0x7d, 0xab, 0x20, 0x02, 0x18, 0x04,
-  0xd9, 0xb5, 0x6f, 0xd9, 0xd9, 0x0b, 0x78, 0xb1, 0xc2, 0xd8, 0x0b, 0x7d,
-  0xfe, 0x00, 0x20, 0x03, 0xc3, 0x2a, 0x0c, 0xdd, 0x44, 0xdd, 0x4d, 0x57,
-  0xb0, 0x47, 0x3e, 0x04, 0xb1, 0x4f, 0xdd, 0x69, 0xdd, 0x60, 0x4f, 0x3e,
-  0x02, 0xd3, 0xfe, 0xc3, 0x2a, 0x0c, 0xed, 0x7b, 0x30, 0x7c, 0xc9, 0xdd,
-  0x44, 0xdd, 0x4d, 0x78, 0xfe, 0x00, 0x20, 0x0b, 0x21, 0x5e, 0x33, 0xcd,
-  0x8c, 0x13, 0xcd, 0xb3, 0x16, 0x18, 0x10, 0x3a, 0x36, 0x7c, 0xb0, 0x32,
-  0x36, 0x7c, 0x21, 0x6b, 0x33, 0xcd, 0x8c, 0x13, 0xcd, 0xb3, 0x16, 0xc9,
-  0xdd, 0x44, 0xdd, 0x4d, 0x3a, 0x36, 0x7c, 0xb0, 0x32, 0x36, 0x7c, 0xc9,
-  0xd9, 0x3e, 0x00, 0x67, 0xd9, 0xc9, 0xc5, 0xc1, 0xc5, 0x0b, 0x78, 0xb1,
-  0x20, 0xfb, 0x7d, 0xee, 0x10, 0x6f, 0xd3, 0xfe, 0x1b, 0x7a, 0xb3, 0x20,
-  0xee, 0xc1, 0xc9, 0x77, 0x23, 0x77, 0x23, 0x77, 0x23, 0x77, 0xc9, 0x54,
-  0x5d, 0x13, 0x77, 0xed, 0xb0, 0xc9, 0x06, 0xff, 0x21, 0x00, 0x80, 0xaf,
-  0x77, 0x4e, 0xb1, 0x10, 0xfc, 0xfe, 0xff, 0x20, 0x12, 0xaf, 0xdd, 0x26,
-  0x00, 0xcd, 0xb3, 0x16, 0x21, 0xa3, 0x31, 0xcd, 0x8c, 0x13, 0xaf, 0x32,
-  0x36, 0x7c, 0xc9, 0xcd, 0x4f, 0x0d, 0x3a, 0x36, 0x7c, 0xfe, 0x00, 0x28,
-  0x33, 0x21, 0x6e, 0x31, 0xcd, 0x8c, 0x13, 0xdd, 0x7d, 0xfe, 0x0c, 0x20,
-  0x07, 0x3a, 0x36, 0x7c, 0xfe, 0xff, 0x28, 0x13, 0x21, 0x39, 0x35, 0xcd,
-  0x8c, 0x13, 0x3a, 0x36, 0x7c, 0x57, 0xdd, 0x21, 0x20, 0x3b, 0xcd, 0x9e,
-  0x10, 0x18, 0x06, 0x21, 0xf8, 0x0d, 0xcd, 0x8c, 0x13, 0x21, 0x7d, 0x33,
-  0xcd, 0x8c, 0x13, 0xc9, 0x21, 0xa9, 0x33, 0xcd, 0x8c, 0x13, 0xc9, 0xcd,
-  0x4f, 0x0d, 0x3a, 0x36, 0x7c, 0xfe, 0x00, 0x28, 0x4f, 0x21, 0x6e, 0x31,
-  0xcd, 0x8c, 0x13, 0xfe, 0xff, 0x20, 0x0f, 0xaf, 0xdd, 0x26, 0x00, 0x21,
-  0xa3, 0x31, 0xcd, 0x8c, 0x13, 0xaf, 0x32, 0x36, 0x7c, 0xc9, 0x21, 0xda,
-  0x0d, 0xcd, 0x8c, 0x13, 0x3a, 0x36, 0x7c, 0x57, 0xdd, 0x21, 0x00, 0x3b,
-  0x06, 0x00, 0xcb, 0x42, 0x28, 0x16, 0x21, 0xf3, 0x0d, 0xcd, 0x8c, 0x13,
-  0xdd, 0xe5, 0xe1, 0x78, 0x07, 0x07, 0xb5, 0x6f, 0xcd, 0x8c, 0x13, 0x3e,
-  0x05, 0xcd, 0x79, 0x16, 0xcb, 0x1a, 0x04, 0x78, 0xfe, 0x08, 0x20, 0xde,
-  0xcd, 0xb3, 0x16, 0xc9, 0x21, 0xa9, 0x33, 0xcd, 0x8c, 0x13, 0xc9, 0xaf,
-  0x32, 0x36, 0x7c, 0x21, 0x02, 0x31, 0xcd, 0x8c, 0x13, 0xcd, 0x60, 0x0c,
-  0x21, 0x00, 0x80, 0x11, 0x00, 0x80, 0xcd, 0x90, 0x09, 0xcd, 0x2f, 0x0c,
-  0x21, 0x1c, 0x31, 0xcd, 0x8c, 0x13, 0xcd, 0x60, 0x0c, 0x21, 0x00, 0x80,
-  0x01, 0xfe, 0x7f, 0x16, 0x00, 0xcd, 0xbe, 0x09, 0x21, 0x00, 0x80, 0x01,
-  0xfe, 0x7f, 0x16, 0xff, 0xcd, 0xbe, 0x09, 0x21, 0x00, 0x80, 0x01, 0xfe,
-  0x7f, 0x16, 0x00, 0xcd, 0x04, 0x0a, 0x21, 0x00, 0x80, 0x01, 0xfe, 0x7f,
-  0x16, 0xff, 0xcd, 0x04, 0x0a, 0xcd, 0x2f, 0x0c, 0x21, 0x39, 0x31, 0xcd,
-  0x8c, 0x13, 0xcd, 0x60, 0x0c, 0x21, 0x00, 0x80, 0x01, 0x00, 0x80, 0xcd,
-  0x49, 0x0a, 0xcd, 0x2f, 0x0c, 0x21, 0x53, 0x31, 0xcd, 0x8c, 0x13, 0xcd,
-  0x60, 0x0c, 0x21, 0x00, 0x80, 0x11, 0x00, 0x40, 0x01, 0x0b, 0x00, 0xcd,
-  0xc0, 0x0a, 0x21, 0xfe, 0xff, 0x11, 0xff, 0x3f, 0x01, 0x11, 0x00, 0xcd,
-  0x7a, 0x0b, 0xcd, 0x2f, 0x0c, 0xc9, 0x46, 0x61, 0x69, 0x6c, 0x75, 0x72,
-  0x65, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20,
-  0x62, 0x69, 0x74, 0x73, 0x3a, 0x0a, 0x00, 0x42, 0x69, 0x74, 0x20, 0x00,
-  0x55, 0x70, 0x70, 0x65, 0x72, 0x20, 0x52, 0x41, 0x4d, 0x20, 0x6d, 0x75,
-  0x6c, 0x74, 0x69, 0x70, 0x6c, 0x65, 0x78, 0x65, 0x72, 0x28, 0x73, 0x29,
-  0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x79, 0x2e, 0x0a, 0x43, 0x68, 0x65,
-  0x63, 0x6b, 0x20, 0x49, 0x43, 0x32, 0x35, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x49, 0x43, 0x32, 0x36, 0x00, 0xaf, 0x32, 0x3a, 0x7c, 0x18, 0x0e, 0x3e,
-  0x01, 0x32, 0x3a, 0x7c, 0x18, 0x07, 0x3e, 0x02, 0x32, 0x3a, 0x7c, 0x18,
-  0x00, 0x21, 0x7f, 0x33, 0xcd, 0x8c, 0x13, 0x21, 0xa6, 0x33, 0x11, 0x33,
-  0x7c, 0x01, 0x03, 0x00, 0xed, 0xb0, 0x06, 0x00, 0x78, 0xfe, 0x05, 0xca,
-  0x24, 0x0f, 0xcd, 0xe1, 0x18, 0x78, 0xf6, 0x30, 0x32, 0x33, 0x7c, 0x21,
-  0x33, 0x7c, 0xcd, 0x8c, 0x13, 0x21, 0x51, 0x33, 0xcd, 0x8c, 0x13, 0xaf,
-  0x32, 0x36, 0x7c, 0xdd, 0x67, 0xc5, 0x21, 0x00, 0xc0, 0x11, 0x00, 0x40,
-  0xcd, 0x90, 0x09, 0xcd, 0x54, 0x0c, 0x21, 0x00, 0xc0, 0x01, 0xfe, 0x3f,
-  0x16, 0x00, 0xcd, 0xbe, 0x09, 0x21, 0x00, 0xc0, 0x01, 0xfe, 0x3f, 0x16,
-  0xff, 0xcd, 0xbe, 0x09, 0x21, 0x00, 0xc0, 0x01, 0xfe, 0x3f, 0x16, 0x00,
-  0xcd, 0x04, 0x0a, 0x21, 0x00, 0xc0, 0x01, 0xfe, 0x3f, 0x16, 0xff, 0xcd,
-  0x04, 0x0a, 0xcd, 0x54, 0x0c, 0x21, 0x00, 0xc0, 0x01, 0x00, 0x40, 0xcd,
-  0x49, 0x0a, 0xcd, 0x54, 0x0c, 0x21, 0x00, 0xc0, 0x11, 0x00, 0x20, 0x01,
-  0x0b, 0x00, 0xcd, 0xc0, 0x0a, 0x21, 0xfe, 0xff, 0x11, 0xff, 0x1f, 0x01,
-  0x11, 0x00, 0xcd, 0x7a, 0x0b, 0xcd, 0x54, 0x0c, 0xc1, 0xdd, 0xe5, 0xf1,
-  0xfe, 0x00, 0x3e, 0x3c, 0x28, 0x34, 0xdd, 0x4c, 0x3a, 0x3a, 0x7c, 0xfe,
-  0x02, 0x28, 0x02, 0x18, 0x07, 0x78, 0xfe, 0x04, 0x30, 0x16, 0x18, 0x04,
-  0xcb, 0x40, 0x20, 0x10, 0x3a, 0x37, 0x7c, 0xdd, 0xb4, 0xdd, 0x7c, 0x32,
-  0x37, 0x7c, 0xd3, 0x3f, 0x3e, 0x3a, 0x18, 0x0e, 0x3a, 0x38, 0x7c, 0xdd,
-  0xb4, 0xdd, 0x7c, 0x32, 0x38, 0x7c, 0xd3, 0x3f, 0x3e, 0x3a, 0x32, 0x02,
-  0x7c, 0x21, 0x33, 0x7c, 0xcd, 0x8c, 0x13, 0x3e, 0x38, 0x32, 0x02, 0x7c,
-  0x04, 0x78, 0xfe, 0x08, 0xc2, 0x54, 0x0e, 0x3a, 0x38, 0x7c, 0x47, 0x3a,
-  0x37, 0x7c, 0xb0, 0xca, 0xab, 0x0f, 0x21, 0x6b, 0x33, 0xcd, 0x8c, 0x13,
-  0xcd, 0xb3, 0x16, 0x21, 0xe8, 0x31, 0xcd, 0x8c, 0x13, 0xdd, 0x7d, 0xfe,
-  0x0c, 0x28, 0x59, 0x21, 0x39, 0x35, 0xcd, 0x8c, 0x13, 0x3a, 0x3a, 0x7c,
-  0xfe, 0x01, 0x28, 0x1c, 0xfe, 0x02, 0x28, 0x30, 0x3a, 0x38, 0x7c, 0x57,
-  0xdd, 0x21, 0x40, 0x3b, 0xcd, 0x9e, 0x10, 0x3a, 0x37, 0x7c, 0x57, 0xdd,
-  0x21, 0x60, 0x3b, 0xcd, 0x9e, 0x10, 0x18, 0x36, 0x3a, 0x37, 0x7c, 0x57,
-  0xdd, 0x21, 0xa0, 0x3b, 0xcd, 0x9e, 0x10, 0x3a, 0x38, 0x7c, 0x57, 0xdd,
-  0x21, 0x80, 0x3b, 0xcd, 0x9e, 0x10, 0x18, 0x1e, 0x3a, 0x38, 0x7c, 0x57,
-  0xdd, 0x21, 0xc0, 0x3b, 0xcd, 0xcd, 0x10, 0x3a, 0x37, 0x7c, 0x57, 0xdd,
-  0x21, 0xc8, 0x3b, 0xcd, 0xcd, 0x10, 0x18, 0x06, 0x21, 0x8c, 0x10, 0xcd,
-  0x8c, 0x13, 0xc9, 0x21, 0x5e, 0x33, 0xcd, 0x8c, 0x13, 0xcd, 0xb3, 0x16,
-  0x21, 0x93, 0x33, 0xcd, 0x8c, 0x13, 0x06, 0x00, 0x78, 0xfe, 0x05, 0x28,
-  0x11, 0xcd, 0xe1, 0x18, 0xc5, 0x21, 0x00, 0xc0, 0x11, 0x01, 0xc0, 0x01,
-  0xff, 0x3f, 0x77, 0xed, 0xb0, 0xc1, 0x04, 0x78, 0xfe, 0x08, 0x20, 0xe4,
-  0xaf, 0x47, 0x78, 0xfe, 0x05, 0x28, 0x31, 0xcd, 0xe1, 0x18, 0x78, 0xf6,
-  0x30, 0x32, 0x33, 0x7c, 0x21, 0x33, 0x7c, 0xcd, 0x8c, 0x13, 0x21, 0x51,
-  0x33, 0xcd, 0x8c, 0x13, 0x21, 0x00, 0xc0, 0x7e, 0xb8, 0x20, 0x25, 0x23,
-  0x7c, 0xb5, 0x20, 0xf7, 0x3e, 0x3c, 0x32, 0x02, 0x7c, 0x21, 0x33, 0x7c,
-  0xcd, 0x8c, 0x13, 0x3e, 0x38, 0x32, 0x02, 0x7c, 0x04, 0x78, 0xfe, 0x08,
-  0x20, 0xc4, 0xcd, 0xb3, 0x16, 0x21, 0xdf, 0x33, 0xcd, 0x8c, 0x13, 0xc9,
-  0x3e, 0x3a, 0x32, 0x02, 0x7c, 0x21, 0x33, 0x7c, 0xcd, 0x8c, 0x13, 0x3e,
-  0x38, 0x32, 0x02, 0x7c, 0x3e, 0x02, 0xd3, 0xfe, 0x21, 0x6b, 0x33, 0xcd,
-  0x8c, 0x13, 0xcd, 0xb3, 0x16, 0x21, 0x1e, 0x32, 0xcd, 0x8c, 0x13, 0x3a,
-  0x3a, 0x7c, 0xfe, 0x01, 0x28, 0x0b, 0xfe, 0x02, 0x28, 0x0e, 0x21, 0xce,
-  0x34, 0xcd, 0x8c, 0x13, 0xc9, 0x21, 0xf9, 0x34, 0xcd, 0x8c, 0x13, 0xc9,
-  0x21, 0x23, 0x35, 0xcd, 0x8c, 0x13, 0xc9, 0xe5, 0xf5, 0x3a, 0x01, 0x7c,
-  0xcb, 0x3f, 0xcb, 0x3f, 0xcb, 0x3f, 0xe6, 0x03, 0xf6, 0x58, 0x67, 0x3a,
-  0x01, 0x7c, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27,
-  0x6f, 0x3a, 0x00, 0x7c, 0x3d, 0x3d, 0x85, 0x6f, 0xf1, 0x77, 0xe1, 0xc9,
-  0x50, 0x43, 0x46, 0x2f, 0x41, 0x53, 0x49, 0x43, 0x20, 0x46, 0x61, 0x69,
-  0x6c, 0x75, 0x72, 0x65, 0x0a, 0x00, 0x06, 0x00, 0xcb, 0x42, 0x28, 0x20,
-  0x21, 0x54, 0x35, 0x3a, 0x3a, 0x7c, 0xfe, 0x03, 0x20, 0x03, 0x21, 0x57,
-  0x35, 0xcd, 0x8c, 0x13, 0xdd, 0xe5, 0xe1, 0x78, 0x07, 0x07, 0xb5, 0x6f,
-  0xcd, 0x8c, 0x13, 0x3e, 0x1e, 0xcd, 0x79, 0x16, 0xcb, 0x1a, 0x04, 0x78,
-  0xfe, 0x08, 0x20, 0xd4, 0xc9, 0x7a, 0xe6, 0x0f, 0x28, 0x0c, 0x21, 0x54,
-  0x35, 0xcd, 0x8c, 0x13, 0xdd, 0xe5, 0xe1, 0xcd, 0x8c, 0x13, 0x01, 0x04,
-  0x00, 0xdd, 0x09, 0x7a, 0xe6, 0xf0, 0x28, 0x0c, 0x21, 0x54, 0x35, 0xcd,
-  0x8c, 0x13, 0xdd, 0xe5, 0xe1, 0xcd, 0x8c, 0x13, 0xc9, 0x3e, 0x7f, 0xdb,
-  0xfe, 0xcb, 0x47, 0xc9, 0x3e, 0x00, 0x21, 0x00, 0x58, 0x11, 0x01, 0x58,
-  0x01, 0xff, 0x02, 0x77, 0xed, 0xb0, 0x21, 0x00, 0x40, 0x11, 0x01, 0x40,
-  0x01, 0xff, 0x17, 0x77, 0xed, 0xb0, 0xd3, 0xfe, 0x21, 0x00, 0x5b, 0xdd,
-  0x21, 0x00, 0x00, 0xd1, 0x36, 0x00, 0x7e, 0xfe, 0x00, 0xc2, 0xa9, 0x05,
-  0x36, 0xff, 0x7e, 0xfe, 0xff, 0xc2, 0xa9, 0x05, 0x23, 0x7c, 0xfe, 0x80,
-  0x38, 0xea, 0xd5, 0xaf, 0xd3, 0x3f, 0x32, 0x36, 0x7c, 0x32, 0x38, 0x7c,
-  0x32, 0x37, 0x7c, 0x32, 0x39, 0x7c, 0x32, 0x3b, 0x7c, 0x32, 0x00, 0x7c,
-  0x32, 0x01, 0x7c, 0x32, 0x03, 0x7c, 0x3e, 0x38, 0x32, 0x02, 0x7c, 0x3e,
-  0x02, 0x32, 0x05, 0x7c, 0x3e, 0x15, 0x32, 0x06, 0x7c, 0x3e, 0x06, 0x32,
-  0x04, 0x7c, 0x3e, 0xff, 0x32, 0x05, 0x7c, 0x2f, 0x32, 0x06, 0x7c, 0x21,
-  0x00, 0x00, 0x22, 0x33, 0x7c, 0x22, 0x14, 0x7c, 0x22, 0x10, 0x7c, 0x22,
-  0x12, 0x7c, 0xaf, 0x32, 0x16, 0x7c, 0x2f, 0x32, 0x17, 0x7c, 0x06, 0x05,
-  0xaf, 0x21, 0x20, 0x7c, 0x77, 0x23, 0x10, 0xfc, 0x06, 0x06, 0x21, 0x28,
-  0x7c, 0xaf, 0x77, 0x23, 0x10, 0xfc, 0x21, 0xe5, 0x11, 0x11, 0x00, 0x7d,
-  0x01, 0x2e, 0x00, 0xed, 0xb0, 0x21, 0x7e, 0x36, 0x11, 0xc0, 0x7d, 0x01,
-  0x00, 0x02, 0xed, 0xb0, 0xaf, 0x01, 0xfd, 0x7f, 0xed, 0x79, 0x01, 0xfd,
-  0x1f, 0xed, 0x79, 0x3e, 0x1f, 0xed, 0x47, 0xaf, 0xcd, 0xc0, 0x7d, 0xcd,
-  0x48, 0x1a, 0xcd, 0x36, 0x13, 0xc9, 0xaf, 0x01, 0xfd, 0x1f, 0xed, 0x79,
-  0x01, 0xfd, 0x7f, 0xed, 0x79, 0x3a, 0x41, 0x7c, 0xfe, 0x00, 0xca, 0x00,
-  0x00, 0x01, 0x34, 0x12, 0x3e, 0x02, 0xcd, 0xc0, 0x7d, 0x3e, 0x02, 0xcd,
-  0xc0, 0x7d, 0x11, 0x00, 0x00, 0x21, 0xff, 0xff, 0x1a, 0x13, 0xac, 0x67,
-  0x06, 0x08, 0x29, 0x30, 0x08, 0x7c, 0xee, 0x10, 0x67, 0x7d, 0xee, 0x21,
-  0x6f, 0x10, 0xf3, 0x7a, 0xfe, 0x3f, 0x20, 0xe8, 0x7b, 0xfe, 0xc0, 0x20,
-  0xe3, 0x3e, 0x01, 0xcd, 0xc0, 0x7d, 0xc9, 0x20, 0x02, 0x4d, 0x4e, 0x42,
-  0x13, 0x4c, 0x4b, 0x4a, 0x48, 0x50, 0x4f, 0x49, 0x55, 0x59, 0x30, 0x39,
-  0x38, 0x37, 0x36, 0x31, 0x32, 0x33, 0x34, 0x35, 0x51, 0x57, 0x45, 0x52,
-  0x54, 0x41, 0x53, 0x44, 0x46, 0x47, 0x01, 0x5a, 0x58, 0x43, 0x56, 0x20,
-  0x02, 0x6d, 0x6e, 0x62, 0x13, 0x6c, 0x6b, 0x6a, 0x68, 0x70, 0x6f, 0x69,
-  0x75, 0x79, 0x30, 0x39, 0x38, 0x37, 0x36, 0x31, 0x32, 0x33, 0x34, 0x35,
-  0x71, 0x77, 0x65, 0x72, 0x74, 0x61, 0x73, 0x64, 0x66, 0x67, 0x01, 0x7a,
-  0x78, 0x63, 0x76, 0x09, 0x02, 0x4d, 0x4e, 0x42, 0x13, 0x4c, 0x4b, 0x4a,
-  0x48, 0x50, 0x4f, 0x49, 0x55, 0x59, 0x10, 0x39, 0x06, 0x07, 0x08, 0x31,
-  0x32, 0x33, 0x34, 0x05, 0x51, 0x57, 0x45, 0x52, 0x54, 0x41, 0x53, 0x44,
-  0x46, 0x47, 0x01, 0x5a, 0x58, 0x43, 0x56, 0x20, 0x02, 0x2e, 0x2c, 0x2a,
-  0x13, 0x3d, 0x2b, 0x2d, 0x5e, 0x22, 0x3b, 0x69, 0x5d, 0x5b, 0x5f, 0x29,
-  0x28, 0x27, 0x26, 0x21, 0x40, 0x23, 0x24, 0x25, 0x71, 0x77, 0x65, 0x3c,
-  0x3e, 0x7e, 0x7c, 0x5c, 0x7b, 0x7d, 0x01, 0x3a, 0x60, 0x3f, 0x2f, 0xdd,
-  0xe5, 0xe5, 0xc5, 0xf5, 0x01, 0xfe, 0x7f, 0xdd, 0x21, 0x45, 0x7c, 0xed,
-  0x78, 0xe6, 0x1f, 0xdd, 0x77, 0x00, 0xdd, 0x23, 0xcb, 0x08, 0x78, 0xfe,
-  0x7f, 0x20, 0xf0, 0xf1, 0xdd, 0x21, 0x45, 0x7c, 0x21, 0x3b, 0x12, 0xfe,
-  0x01, 0x28, 0x03, 0x21, 0x13, 0x12, 0xdd, 0xcb, 0x07, 0x46, 0x20, 0x03,
-  0x21, 0x63, 0x12, 0xdd, 0xcb, 0x00, 0x4e, 0x20, 0x03, 0x21, 0x8b, 0x12,
-  0x06, 0x08, 0x3e, 0xff, 0x48, 0x06, 0x05, 0xdd, 0xcb, 0x00, 0x46, 0x20,
-  0x0b, 0x7e, 0xfe, 0x03, 0x38, 0x06, 0xc1, 0xe1, 0xdd, 0xe1, 0x37, 0xc9,
-  0x23, 0xdd, 0xcb, 0x00, 0x3e, 0x10, 0xe8, 0xdd, 0x23, 0x41, 0x10, 0xde,
-  0xc1, 0xfe, 0xff, 0x28, 0x05, 0xe1, 0xdd, 0xe1, 0x37, 0xc9, 0xe1, 0xdd,
-  0xe1, 0xa7, 0xc9, 0xc5, 0xcd, 0xb3, 0x12, 0x30, 0xfb, 0x47, 0xaf, 0xdb,
-  0xfe, 0xe6, 0x1f, 0xfe, 0x1f, 0x20, 0xf7, 0x78, 0xc1, 0xc9, 0x21, 0x70,
-  0x7c, 0xaf, 0x77, 0xdb, 0x1f, 0x4f, 0xe6, 0xe0, 0xfe, 0x00, 0xc0, 0x10,
-  0xf6, 0xcb, 0xfe, 0xc9, 0x21, 0x70, 0x7c, 0xcb, 0x7e, 0xc8, 0xdb, 0x1f,
-  0xe6, 0x1f, 0xf6, 0x80, 0x77, 0xc9, 0x53, 0x70, 0x65, 0x63, 0x74, 0x72,
-  0x75, 0x6d, 0x00, 0x52, 0x4f, 0x4d, 0x2e, 0x2e, 0x2e, 0x00, 0x53, 0x70,
-  0x61, 0x6e, 0x69, 0x73, 0x68, 0x00, 0x4d, 0x69, 0x63, 0x72, 0x6f, 0x64,
-  0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x00, 0x3e, 0x02, 0xe5, 0xcd, 0x01,
-  0x16, 0xe1, 0x7e, 0xfe, 0x00, 0xc8, 0xe5, 0xd7, 0xe1, 0x23, 0x18, 0xf6,
-  0xe5, 0xd5, 0xc5, 0xf5, 0x7e, 0x23, 0xfe, 0x00, 0xca, 0x3b, 0x15, 0xfe,
-  0x0a, 0x20, 0x05, 0xcd, 0xb3, 0x16, 0x18, 0xf0, 0xfe, 0xc0, 0x20, 0x0a,
-  0xe5, 0x21, 0x56, 0x13, 0xcd, 0x8c, 0x13, 0xe1, 0x18, 0xe2, 0xfe, 0xc1,
-  0x20, 0x0a, 0xe5, 0x21, 0x5f, 0x13, 0xcd, 0x8c, 0x13, 0xe1, 0x18, 0xd4,
-  0xfe, 0xc2, 0x20, 0x0a, 0xe5, 0x21, 0x66, 0x13, 0xcd, 0x8c, 0x13, 0xe1,
-  0x18, 0xc6, 0xfe, 0xc3, 0x20, 0x0a, 0xe5, 0x21, 0x6e, 0x13, 0xcd, 0x8c,
-  0x13, 0xe1, 0x18, 0xb8, 0xfe, 0x1f, 0xd2, 0xef, 0x14, 0xfe, 0x08, 0x20,
-  0x26, 0x3a, 0x04, 0x7c, 0x47, 0x3a, 0x00, 0x7c, 0x90, 0x32, 0x00, 0x7c,
-  0xfe, 0xff, 0x20, 0xa0, 0x3e, 0x1f, 0x32, 0x00, 0x7c, 0x3a, 0x01, 0x7c,
-  0x3d, 0x32, 0x01, 0x7c, 0xfe, 0xff, 0x20, 0x90, 0x3e, 0x17, 0x32, 0x01,
-  0x7c, 0x18, 0x89, 0xfe, 0x0f, 0xc2, 0x14, 0x14, 0x7e, 0x23, 0x32, 0x02,
-  0x7c, 0xc3, 0x90, 0x13, 0xfe, 0x10, 0x20, 0x11, 0x7e, 0x23, 0xe6, 0x07,
-  0x57, 0x3a, 0x02, 0x7c, 0xe6, 0xf8, 0xb2, 0x32, 0x02, 0x7c, 0xc3, 0x90,
-  0x13, 0xfe, 0x0e, 0x20, 0x08, 0x7e, 0x23, 0x32, 0x00, 0x7c, 0xc3, 0x90,
-  0x13, 0xfe, 0x11, 0x20, 0x14, 0x7e, 0x23, 0xe6, 0x07, 0x17, 0x17, 0x17,
-  0x57, 0x3a, 0x02, 0x7c, 0xe6, 0xc7, 0xb2, 0x32, 0x02, 0x7c, 0xc3, 0x90,
-  0x13, 0xfe, 0x0d, 0x20, 0x07, 0xaf, 0x32, 0x00, 0x7c, 0xc3, 0x90, 0x13,
-  0xfe, 0x13, 0x20, 0x15, 0x7e, 0x23, 0xfe, 0x00, 0x28, 0x02, 0x3e, 0x40,
-  0x57, 0x3a, 0x02, 0x7c, 0xe6, 0xbf, 0xb2, 0x32, 0x02, 0x7c, 0xc3, 0x90,
-  0x13, 0xfe, 0x12, 0x20, 0x15, 0x7e, 0x23, 0xfe, 0x00, 0x28, 0x02, 0x3e,
-  0x80, 0x57, 0x3a, 0x02, 0x7c, 0xe6, 0x7f, 0xb2, 0x32, 0x02, 0x7c, 0xc3,
-  0xa5, 0x14, 0xfe, 0x17, 0x20, 0x17, 0x7e, 0x23, 0xfe, 0x18, 0x38, 0x01,
-  0xaf, 0x32, 0x01, 0x7c, 0x7e, 0x23, 0xfe, 0xf9, 0x38, 0x01, 0xaf, 0x32,
-  0x00, 0x7c, 0xc3, 0x90, 0x13, 0xfe, 0x15, 0x20, 0x0b, 0x3a, 0x03, 0x7c,
-  0xcb, 0xc7, 0x32, 0x03, 0x7c, 0xc3, 0x90, 0x13, 0xfe, 0x16, 0x20, 0x0b,
-  0x3a, 0x03, 0x7c, 0xcb, 0x87, 0x32, 0x03, 0x7c, 0xc3, 0x90, 0x13, 0xfe,
-  0x14, 0x20, 0x1c, 0x7e, 0x23, 0xfe, 0x00, 0x28, 0x0b, 0x3a, 0x03, 0x7c,
-  0xcb, 0xcf, 0x32, 0x03, 0x7c, 0xc3, 0x90, 0x13, 0x3a, 0x03, 0x7c, 0xcb,
-  0x8f, 0x32, 0x03, 0x7c, 0xc3, 0x90, 0x13, 0xfe, 0x18, 0x20, 0x08, 0x7e,
-  0x23, 0x32, 0x04, 0x7c, 0xc3, 0x90, 0x13, 0x47, 0xcd, 0x4a, 0x15, 0x3a,
-  0x04, 0x7c, 0x47, 0x3a, 0x00, 0x7c, 0x80, 0x32, 0x00, 0x7c, 0xfe, 0x00,
-  0xc2, 0x90, 0x13, 0xaf, 0x32, 0x00, 0x7c, 0x3a, 0x01, 0x7c, 0x3c, 0x32,
-  0x01, 0x7c, 0x3a, 0x05, 0x7c, 0xfe, 0xff, 0x20, 0x0c, 0xfe, 0x18, 0xc2,
-  0x90, 0x13, 0xaf, 0x32, 0x01, 0x7c, 0xc3, 0x90, 0x13, 0x3a, 0x05, 0x7c,
-  0x47, 0x3a, 0x06, 0x7c, 0x80, 0x47, 0x3a, 0x01, 0x7c, 0xb8, 0xc2, 0x90,
-  0x13, 0x3d, 0x32, 0x01, 0x7c, 0xcd, 0x87, 0x17, 0xc3, 0x90, 0x13, 0xf1,
-  0xc1, 0xd1, 0xe1, 0xc9, 0xf5, 0x7c, 0x32, 0x01, 0x7c, 0x7d, 0x32, 0x00,
-  0x7c, 0xf1, 0xe5, 0xc5, 0xd5, 0xdd, 0xe5, 0xd6, 0x20, 0x21, 0x00, 0x00,
-  0x6f, 0x29, 0x29, 0x29, 0x01, 0x00, 0x3c, 0x09, 0xeb, 0x3a, 0x01, 0x7c,
-  0xe6, 0x18, 0xf6, 0x40, 0x67, 0x3a, 0x01, 0x7c, 0xe6, 0x07, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x6f, 0x3a, 0x00, 0x7c, 0xe6, 0x07, 0xdd, 0x6f, 0x3a,
-  0x00, 0x7c, 0xcb, 0x3f, 0xcb, 0x3f, 0xcb, 0x3f, 0x85, 0x6f, 0xe5, 0xd5,
-  0xdd, 0x7d, 0x21, 0x79, 0x17, 0x5f, 0xaf, 0x57, 0x19, 0x7e, 0xdd, 0x67,
-  0xd1, 0xe1, 0x06, 0x08, 0x1a, 0xd5, 0x57, 0xdd, 0x5c, 0x3a, 0x03, 0x7c,
-  0xcb, 0x47, 0x28, 0x07, 0x7a, 0x4f, 0xcb, 0x11, 0x7a, 0xb1, 0x57, 0x3a,
-  0x03, 0x7c, 0xcb, 0x4f, 0x28, 0x04, 0x7a, 0xee, 0xff, 0x57, 0xc5, 0x7b,
-  0x46, 0xa0, 0x77, 0xdd, 0x7d, 0xfe, 0x00, 0x28, 0x08, 0x47, 0x7a, 0xcb,
-  0x3f, 0x10, 0xfc, 0x18, 0x01, 0x7a, 0x46, 0xb0, 0x77, 0xc1, 0xdd, 0x7d,
-  0xfe, 0x00, 0x28, 0x18, 0x23, 0xc5, 0x7b, 0x2f, 0x46, 0xa0, 0x77, 0xdd,
-  0x7d, 0x47, 0x3e, 0x08, 0x90, 0x47, 0x7a, 0xcb, 0x27, 0x10, 0xfc, 0x46,
-  0xb0, 0x77, 0xc1, 0x2b, 0xd1, 0x13, 0x24, 0x10, 0xa7, 0x3a, 0x02, 0x7c,
-  0xfe, 0xff, 0x28, 0x36, 0x3a, 0x01, 0x7c, 0xcb, 0x3f, 0xcb, 0x3f, 0xcb,
-  0x3f, 0xe6, 0x03, 0xf6, 0x58, 0x67, 0x3a, 0x01, 0x7c, 0xcb, 0x27, 0xcb,
-  0x27, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0x6f, 0x3a, 0x00, 0x7c, 0xcb,
-  0x3f, 0xcb, 0x3f, 0xcb, 0x3f, 0x85, 0x6f, 0x3a, 0x02, 0x7c, 0x77, 0xdd,
-  0x7d, 0xfe, 0x00, 0x28, 0x05, 0x3a, 0x02, 0x7c, 0x23, 0x77, 0xdd, 0xe1,
-  0xd1, 0xc1, 0xe1, 0xc9, 0x7c, 0x32, 0x01, 0x7c, 0x7d, 0x32, 0x00, 0x7c,
-  0xc9, 0x7c, 0xcd, 0x48, 0x16, 0x7c, 0xcd, 0x4c, 0x16, 0x7d, 0xcd, 0x48,
-  0x16, 0x7d, 0x18, 0x04, 0x1f, 0x1f, 0x1f, 0x1f, 0xf6, 0xf0, 0x27, 0xc6,
-  0xa0, 0xce, 0x40, 0x12, 0x13, 0xc9, 0x01, 0xf0, 0xd8, 0xcd, 0x6e, 0x16,
-  0x01, 0x18, 0xfc, 0xcd, 0x6e, 0x16, 0x01, 0x9c, 0xff, 0xcd, 0x6e, 0x16,
-  0x0e, 0xf6, 0xcd, 0x6e, 0x16, 0x48, 0x3e, 0x2f, 0x3c, 0x09, 0x38, 0xfc,
-  0xed, 0x42, 0x12, 0x13, 0xc9, 0xc5, 0x47, 0x3a, 0x00, 0x7c, 0x80, 0xc1,
-  0xd0, 0xaf, 0x32, 0x00, 0x7c, 0x3a, 0x01, 0x7c, 0x3c, 0x32, 0x01, 0x7c,
-  0xfe, 0x18, 0xc0, 0xaf, 0x32, 0x01, 0x7c, 0xc9, 0xe5, 0xd5, 0xc5, 0xf5,
-  0xaf, 0x21, 0x00, 0x40, 0x77, 0x11, 0x01, 0x40, 0x01, 0x00, 0x18, 0xed,
-  0xb0, 0x3a, 0x02, 0x7c, 0x77, 0x01, 0xff, 0x02, 0xed, 0xb0, 0xf1, 0xc1,
-  0xd1, 0xe1, 0xc9, 0xf5, 0xc5, 0xaf, 0x32, 0x00, 0x7c, 0x3a, 0x01, 0x7c,
-  0x3c, 0x32, 0x01, 0x7c, 0x3a, 0x05, 0x7c, 0xfe, 0xff, 0x20, 0x0a, 0xfe,
-  0x18, 0x20, 0x1c, 0xaf, 0x32, 0x01, 0x7c, 0x18, 0x16, 0x3a, 0x05, 0x7c,
-  0x47, 0x3a, 0x06, 0x7c, 0x80, 0x47, 0x3a, 0x01, 0x7c, 0xb8, 0x38, 0x07,
-  0x3d, 0x32, 0x01, 0x7c, 0xcd, 0x87, 0x17, 0xc1, 0xf1, 0xc9, 0xe5, 0x3e,
-  0x47, 0x21, 0x00, 0x58, 0x11, 0x01, 0x58, 0x01, 0x1f, 0x00, 0x77, 0xed,
-  0xb0, 0xe1, 0x3a, 0x02, 0x7c, 0xf5, 0x3e, 0x47, 0x32, 0x02, 0x7c, 0xaf,
-  0x32, 0x01, 0x7c, 0x3a, 0x04, 0x7c, 0x32, 0x00, 0x7c, 0xcd, 0x8c, 0x13,
-  0xf1, 0x32, 0x02, 0x7c, 0x21, 0x81, 0x17, 0x11, 0x1a, 0x58, 0x01, 0x06,
-  0x00, 0xed, 0xb0, 0x3e, 0x08, 0x47, 0x3e, 0x01, 0x21, 0x1a, 0x40, 0x77,
-  0x23, 0x77, 0x23, 0x77, 0x23, 0x77, 0x23, 0x77, 0x2b, 0x2b, 0x2b, 0x2b,
-  0x24, 0x17, 0xcb, 0xc7, 0x10, 0xed, 0xc9, 0xe5, 0x21, 0x44, 0x17, 0xcd,
-  0x8c, 0x13, 0xe1, 0xc9, 0x17, 0x16, 0x00, 0x0e, 0x30, 0x76, 0x30, 0x2e,
-  0x33, 0x37, 0x20, 0x44, 0x2e, 0x20, 0x53, 0x6d, 0x69, 0x74, 0x68, 0x2c,
-  0x20, 0x42, 0x2e, 0x20, 0x41, 0x6c, 0x66, 0x6f, 0x72, 0x64, 0x17, 0x17,
-  0x42, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x67, 0x69, 0x74, 0x2e,
-  0x69, 0x6f, 0x2f, 0x76, 0x6b, 0x66, 0x31, 0x6f, 0x00, 0x00, 0x80, 0xc0,
-  0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0x42, 0x56, 0x74, 0x65, 0x68, 0x40, 0x3a,
-  0x05, 0x7c, 0x67, 0x3a, 0x06, 0x7c, 0x6f, 0xdd, 0xe5, 0xe5, 0xd5, 0xc5,
-  0xe5, 0xdd, 0xe1, 0xdd, 0x7c, 0xe6, 0x18, 0xf6, 0x40, 0x57, 0xdd, 0x7c,
-  0xe6, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x5f, 0xdd, 0x7d, 0xfe, 0x01,
-  0x20, 0x18, 0x62, 0x6b, 0x13, 0x06, 0x08, 0xe5, 0xd5, 0xc5, 0xaf, 0x01,
-  0x1f, 0x00, 0x77, 0xed, 0xb0, 0xc1, 0xd1, 0xe1, 0x24, 0x14, 0x10, 0xef,
-  0x18, 0x26, 0xdd, 0x24, 0xdd, 0x7c, 0xe6, 0x18, 0xf6, 0x40, 0x67, 0xdd,
-  0x7c, 0xe6, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x6f, 0xdd, 0x25, 0x06,
-  0x08, 0xe5, 0xd5, 0xc5, 0x01, 0x20, 0x00, 0xed, 0xb0, 0xc1, 0xd1, 0xe1,
-  0x24, 0x14, 0x10, 0xf1, 0xdd, 0x7c, 0xcb, 0x3f, 0xcb, 0x3f, 0xcb, 0x3f,
-  0xe6, 0x03, 0xf6, 0x58, 0x67, 0xdd, 0x7c, 0xcb, 0x27, 0xcb, 0x27, 0xcb,
-  0x27, 0xcb, 0x27, 0xcb, 0x27, 0x6f, 0xdd, 0x24, 0xdd, 0x7d, 0xfe, 0x01,
-  0x20, 0x0f, 0x54, 0x5d, 0x13, 0x3a, 0x02, 0x7c, 0x77, 0x01, 0x1f, 0x00,
-  0xed, 0xb0, 0xc3, 0x28, 0x18, 0xe5, 0x11, 0x20, 0x00, 0x19, 0xd1, 0x01,
-  0x1f, 0x00, 0xed, 0xb0, 0xdd, 0x2d, 0xdd, 0x7d, 0xfe, 0x00, 0xc2, 0x97,
-  0x17, 0xc1, 0xd1, 0xe1, 0xdd, 0xe1, 0xc9, 0xdd, 0xe5, 0xe5, 0xd5, 0xc5,
-  0xe5, 0xdd, 0xe1, 0xdd, 0x7c, 0xe6, 0x18, 0xf6, 0x40, 0x57, 0xdd, 0x7c,
-  0xe6, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x5f, 0xdd, 0x7d, 0xfe, 0x01,
-  0x20, 0x18, 0x62, 0x6b, 0x13, 0x06, 0x08, 0xe5, 0xd5, 0xc5, 0xaf, 0x01,
-  0x1f, 0x00, 0x77, 0xed, 0xb0, 0xc1, 0xd1, 0xe1, 0x24, 0x14, 0x10, 0xef,
-  0x18, 0x26, 0xdd, 0x25, 0xdd, 0x7c, 0xe6, 0x18, 0xf6, 0x40, 0x67, 0xdd,
-  0x7c, 0xe6, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x6f, 0xdd, 0x24, 0x06,
-  0x08, 0xe5, 0xd5, 0xc5, 0x01, 0x20, 0x00, 0xed, 0xb0, 0xc1, 0xd1, 0xe1,
-  0x24, 0x14, 0x10, 0xf1, 0xdd, 0x7c, 0xcb, 0x3f, 0xcb, 0x3f, 0xcb, 0x3f,
-  0xe6, 0x03, 0xf6, 0x58, 0x67, 0xdd, 0x7c, 0xcb, 0x27, 0xcb, 0x27, 0xcb,
-  0x27, 0xcb, 0x27, 0xcb, 0x27, 0x6f, 0xdd, 0x25, 0xdd, 0x7d, 0xfe, 0x01,
-  0x20, 0x0f, 0x54, 0x5d, 0x13, 0x3a, 0x02, 0x7c, 0x77, 0x01, 0x1f, 0x00,
-  0xed, 0xb0, 0xc3, 0xd2, 0x18, 0xe5, 0x11, 0x20, 0x00, 0xa7, 0xed, 0x52,
-  0xd1, 0x01, 0x20, 0x00, 0xed, 0xb0, 0xdd, 0x2d, 0xdd, 0x7d, 0xfe, 0x00,
-  0xc2, 0x3f, 0x18, 0xc1, 0xd1, 0xe1, 0xdd, 0xe1, 0xc9, 0xc5, 0xf5, 0x01,
-  0xfd, 0x7f, 0xe6, 0x07, 0xed, 0x79, 0xf1, 0xc1, 0xc9, 0xf5, 0x17, 0xe6,
-  0x04, 0x01, 0xfd, 0x1f, 0xed, 0x79, 0xf1, 0x17, 0x17, 0x17, 0x17, 0xe6,
-  0x10, 0x01, 0xfd, 0x7f, 0xed, 0x79, 0xc9, 0x31, 0xff, 0x7b, 0xcd, 0xfc,
-  0x10, 0x21, 0xf1, 0x1a, 0x11, 0x50, 0x7c, 0x01, 0x05, 0x00, 0xed, 0xb0,
-  0x3e, 0x07, 0xd3, 0xfe, 0xcd, 0x94, 0x16, 0x3e, 0x08, 0x32, 0x04, 0x7c,
-  0x06, 0x18, 0x06, 0x08, 0x78, 0x3d, 0x32, 0x53, 0x7c, 0xc5, 0x06, 0x08,
-  0x78, 0x3d, 0x32, 0x51, 0x7c, 0xc5, 0x21, 0x50, 0x7c, 0xcd, 0x8c, 0x13,
-  0x21, 0xf6, 0x1a, 0xcd, 0x8c, 0x13, 0xc1, 0x10, 0xeb, 0xc1, 0x10, 0xe0,
-  0x21, 0x00, 0x58, 0x11, 0x00, 0x59, 0x01, 0x00, 0x01, 0xed, 0xb0, 0x21,
-  0x00, 0x59, 0x11, 0x00, 0x5a, 0x01, 0x00, 0x01, 0xed, 0xb0, 0x21, 0x9b,
-  0x1b, 0xcd, 0x8c, 0x13, 0x3e, 0x06, 0x32, 0x04, 0x7c, 0x21, 0x4f, 0x1c,
-  0xcd, 0x8c, 0x13, 0x21, 0x3b, 0x7c, 0xcb, 0x46, 0x21, 0xff, 0x1a, 0x20,
-  0x03, 0x21, 0x33, 0x1b, 0xcd, 0x8c, 0x13, 0xcd, 0x10, 0x1a, 0xcd, 0x48,
-  0x13, 0x21, 0x3b, 0x7c, 0xcb, 0x4e, 0x20, 0x05, 0x06, 0x01, 0xcd, 0x22,
-  0x1a, 0x01, 0xfe, 0xfb, 0xed, 0x78, 0xcb, 0x47, 0x28, 0x3a, 0x01, 0xfe,
-  0xef, 0xed, 0x78, 0xcb, 0x5f, 0x28, 0x31, 0x3a, 0x70, 0x7c, 0xcb, 0x7f,
-  0x20, 0x04, 0xcb, 0x47, 0x20, 0x26, 0x21, 0x3b, 0x7c, 0xcb, 0x46, 0x28,
-  0xca, 0x01, 0xfe, 0xfd, 0xed, 0x78, 0xcb, 0x47, 0x28, 0x1e, 0x01, 0xfe,
-  0xef, 0xed, 0x78, 0xcb, 0x47, 0x28, 0x15, 0x3a, 0x70, 0x7c, 0xcb, 0x7f,
-  0x28, 0xb1, 0xcb, 0x67, 0x20, 0x0a, 0x18, 0xab, 0x21, 0x3b, 0x7c, 0xcb,
-  0xce, 0xc3, 0x7b, 0x19, 0x21, 0x67, 0x1b, 0xcd, 0x8c, 0x13, 0xcd, 0x48,
-  0x1a, 0x21, 0x6e, 0x1a, 0xcd, 0x10, 0x1a, 0x7e, 0xfe, 0xf0, 0x20, 0x12,
-  0x23, 0x46, 0x11, 0x00, 0x10, 0x1b, 0x7a, 0xb3, 0x20, 0xfb, 0x11, 0x00,
-  0x10, 0x10, 0xf6, 0x23, 0x18, 0xe6, 0xfe, 0xff, 0x20, 0x05, 0x21, 0x6e,
-  0x1a, 0x18, 0xdd, 0x56, 0x23, 0x5e, 0x23, 0xcd, 0x3d, 0x1a, 0x18, 0xd4,
-  0x3e, 0x7f, 0xdb, 0xfe, 0x1f, 0xd8, 0x3e, 0xfe, 0xdb, 0xfe, 0x1f, 0xd8,
-  0xcd, 0x48, 0x1a, 0xcd, 0xca, 0x11, 0x2e, 0x07, 0x01, 0x98, 0x00, 0x11,
-  0x80, 0x03, 0xcd, 0x66, 0x0c, 0x3e, 0xff, 0x47, 0xaf, 0x4f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0b, 0x78, 0xb1, 0x20, 0xf6, 0xc9, 0x01, 0xfd, 0xff,
-  0xed, 0x51, 0x01, 0xfd, 0xbf, 0xed, 0x59, 0xc9, 0x21, 0x3b, 0x7c, 0xcb,
-  0x86, 0x16, 0x00, 0x01, 0xfd, 0xff, 0xed, 0x51, 0x01, 0xfd, 0xbf, 0xaf,
-  0xed, 0x79, 0x14, 0x7a, 0xfe, 0x0f, 0x20, 0xef, 0x01, 0xfd, 0xff, 0xaf,
-  0xed, 0x79, 0xed, 0x78, 0xfe, 0x00, 0xc0, 0xcb, 0xc6, 0xc9, 0x08, 0x00,
-  0x09, 0x00, 0x0a, 0x00, 0x07, 0x38, 0x00, 0x7e, 0x08, 0x0f, 0xf0, 0x15,
-  0x08, 0x00, 0xf0, 0x05, 0x02, 0x7e, 0x09, 0x0f, 0xf0, 0x15, 0x09, 0x00,
-  0xf0, 0x05, 0x04, 0x54, 0x0a, 0x0f, 0xf0, 0x15, 0x0a, 0x00, 0xf0, 0x20,
-  0x00, 0xa8, 0x08, 0x0f, 0xf0, 0x15, 0x08, 0x00, 0xf0, 0x05, 0x02, 0xa8,
-  0x09, 0x0f, 0xf0, 0x15, 0x09, 0x00, 0xf0, 0x05, 0x00, 0x6f, 0x02, 0x6f,
-  0x04, 0x6f, 0x08, 0x0f, 0x09, 0x0f, 0x0a, 0x0f, 0xf0, 0x28, 0x08, 0x00,
-  0x09, 0x00, 0xf0, 0x08, 0x08, 0x0f, 0x09, 0x0f, 0xf0, 0x08, 0x08, 0x00,
-  0x09, 0x00, 0xf0, 0x08, 0x08, 0x0f, 0x09, 0x0f, 0xf0, 0x08, 0x08, 0x00,
-  0x09, 0x00, 0xf0, 0x08, 0x08, 0x0f, 0x09, 0x0f, 0xf0, 0x08, 0x08, 0x00,
-  0x09, 0x00, 0xf0, 0x08, 0x08, 0x0f, 0x09, 0x0f, 0xf0, 0x08, 0xf0, 0x20,
-  0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0xf0, 0x10, 0xff, 0x11, 0x00, 0x10,
-  0x00, 0x00, 0x13, 0x00, 0x83, 0x81, 0x13, 0x01, 0x82, 0x89, 0x00, 0x17,
-  0x16, 0x00, 0x11, 0x00, 0x10, 0x07, 0x13, 0x01, 0x20, 0x48, 0x6f, 0x6c,
-  0x64, 0x3a, 0x20, 0x27, 0x41, 0x27, 0x2d, 0x41, 0x59, 0x20, 0x74, 0x65,
-  0x73, 0x74, 0x2c, 0x20, 0x27, 0x51, 0x27, 0x2d, 0x71, 0x75, 0x69, 0x65,
-  0x74, 0x2c, 0x20, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x2d, 0x65, 0x78, 0x69,
-  0x74, 0x2e, 0x00, 0x17, 0x16, 0x00, 0x11, 0x00, 0x10, 0x07, 0x13, 0x01,
-  0x20, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x20, 0x41, 0x59, 0x2e, 0x20, 0x48,
-  0x6f, 0x6c, 0x64, 0x3a, 0x20, 0x27, 0x51, 0x27, 0x2d, 0x71, 0x75, 0x69,
-  0x65, 0x74, 0x2c, 0x20, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x2d, 0x65, 0x78,
-  0x69, 0x74, 0x2e, 0x20, 0x20, 0x20, 0x00, 0x17, 0x16, 0x00, 0x11, 0x00,
-  0x10, 0x07, 0x13, 0x01, 0x20, 0x20, 0x20, 0x20, 0x41, 0x59, 0x20, 0x54,
-  0x65, 0x73, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x2c, 0x20,
-  0x68, 0x6f, 0x6c, 0x64, 0x20, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x20, 0x74,
-  0x6f, 0x20, 0x65, 0x78, 0x69, 0x74, 0x2e, 0x20, 0x20, 0x20, 0x00, 0x17,
-  0x12, 0x00, 0x11, 0x00, 0x10, 0x07, 0x13, 0x01, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x16, 0x11,
-  0x00, 0x10, 0x02, 0x80, 0x11, 0x02, 0x10, 0x06, 0x80, 0x11, 0x06, 0x10,
-  0x04, 0x80, 0x11, 0x04, 0x10, 0x05, 0x80, 0x11, 0x05, 0x10, 0x00, 0x80,
-  0x11, 0x00, 0x10, 0x07, 0x20, 0x15, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x16, 0x11, 0x00, 0x10, 0x02,
-  0x80, 0x11, 0x02, 0x10, 0x06, 0x80, 0x11, 0x06, 0x10, 0x04, 0x80, 0x11,
-  0x04, 0x10, 0x05, 0x80, 0x11, 0x05, 0x10, 0x00, 0x80, 0x11, 0x00, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x16, 0x11, 0x00, 0x10, 0x02, 0x80, 0x11, 0x02, 0x10, 0x06, 0x80,
-  0x11, 0x06, 0x10, 0x04, 0x80, 0x11, 0x04, 0x10, 0x05, 0x80, 0x11, 0x05,
-  0x10, 0x00, 0x80, 0x11, 0x00, 0x20, 0x20, 0x20, 0x0f, 0x38, 0x00, 0x17,
-  0x13, 0x0a, 0x15, 0x13, 0x01, 0x10, 0x07, 0x11, 0x00, 0x5a, 0x58, 0x20,
-  0xc0, 0x20, 0x44, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x74, 0x69, 0x63,
-  0x73, 0x20, 0x76, 0x30, 0x2e, 0x33, 0x37, 0x0f, 0x38, 0x00, 0x31, 0xff,
-  0x7b, 0xcd, 0xfc, 0x10, 0x3e, 0x07, 0xcd, 0xe1, 0x18, 0x21, 0x00, 0xc0,
-  0x01, 0x00, 0x18, 0xaf, 0xcd, 0x83, 0x0c, 0x21, 0x00, 0xd8, 0x01, 0x00,
-  0x03, 0x3e, 0x20, 0xcd, 0x83, 0x0c, 0xaf, 0xcd, 0xe1, 0x18, 0xcd, 0xbf,
-  0x1f, 0x21, 0x9f, 0x1f, 0x22, 0x14, 0x7c, 0x21, 0x00, 0x00, 0x22, 0x3c,
-  0x7c, 0x3e, 0x00, 0xfb, 0x76, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc3, 0xa9, 0x1c, 0xaf, 0x32, 0x3e, 0x7c, 0x32, 0x3f, 0x7c, 0x21, 0xff,
-  0x0f, 0x3e, 0xff, 0x57, 0x01, 0xff, 0xff, 0xed, 0x78, 0xa2, 0x57, 0x2b,
-  0x7c, 0xb5, 0x20, 0xf7, 0x7a, 0xfe, 0xff, 0x28, 0x05, 0x3e, 0x01, 0x32,
-  0x3e, 0x7c, 0xaf, 0x01, 0x3b, 0xbf, 0xed, 0x79, 0x01, 0x3b, 0xff, 0xed,
-  0x79, 0x21, 0x00, 0x00, 0x22, 0x14, 0x7c, 0xfb, 0x76, 0xf3, 0xed, 0x78,
-  0xfe, 0x00, 0x20, 0x05, 0x3e, 0x01, 0x32, 0x3f, 0x7c, 0x21, 0x00, 0x00,
-  0xe5, 0xdd, 0xe1, 0xe5, 0xfd, 0xe1, 0xcd, 0x94, 0x16, 0x3e, 0x07, 0xd3,
-  0xfe, 0x21, 0xfc, 0x1f, 0xcd, 0xea, 0x16, 0x21, 0x72, 0x21, 0xcd, 0x8c,
-  0x13, 0x2a, 0x3c, 0x7c, 0x54, 0x5d, 0x3a, 0x3f, 0x7c, 0xfe, 0x00, 0x28,
-  0x06, 0xdd, 0x21, 0xa0, 0x21, 0x18, 0x0f, 0xdd, 0x21, 0x80, 0x21, 0x3a,
-  0x3e, 0x7c, 0xfe, 0x00, 0x20, 0x04, 0xdd, 0x21, 0x96, 0x21, 0xdd, 0x7e,
-  0x00, 0xab, 0x20, 0x11, 0xdd, 0x7e, 0x01, 0xaa, 0x20, 0x0b, 0xdd, 0x6e,
-  0x02, 0xdd, 0x66, 0x03, 0xcd, 0x8c, 0x13, 0x18, 0x27, 0x01, 0x04, 0x00,
-  0xdd, 0x09, 0xdd, 0x7e, 0x00, 0xdd, 0xb6, 0x01, 0x20, 0xdc, 0x21, 0x3f,
-  0x22, 0xcd, 0x8c, 0x13, 0x2a, 0x3c, 0x7c, 0x11, 0x20, 0x7c, 0xcd, 0x39,
-  0x16, 0x21, 0x20, 0x7c, 0xcd, 0x8c, 0x13, 0x3e, 0x29, 0xcd, 0x4a, 0x15,
-  0x21, 0x49, 0x22, 0xcd, 0x8c, 0x13, 0x21, 0x5a, 0x22, 0x3a, 0x3e, 0x7c,
-  0xfe, 0x00, 0x20, 0x03, 0x21, 0x63, 0x22, 0xcd, 0x8c, 0x13, 0x21, 0x6a,
-  0x22, 0xcd, 0x8c, 0x13, 0x3a, 0x40, 0x7c, 0xfe, 0x00, 0x28, 0x08, 0x21,
-  0x88, 0x22, 0xcd, 0x8c, 0x13, 0x18, 0x06, 0x21, 0x78, 0x22, 0xcd, 0x8c,
-  0x13, 0x21, 0x0c, 0x20, 0xcd, 0x8c, 0x13, 0x3e, 0x08, 0x32, 0x04, 0x7c,
-  0x21, 0x30, 0x20, 0xcd, 0x8c, 0x13, 0x3e, 0x06, 0x32, 0x04, 0x7c, 0x21,
-  0x3c, 0x20, 0xcd, 0x8c, 0x13, 0x21, 0x82, 0x20, 0xcd, 0x8c, 0x13, 0x21,
-  0x5a, 0x21, 0xcd, 0x8c, 0x13, 0xcd, 0x3b, 0x17, 0xd9, 0xaf, 0x47, 0x67,
-  0xdb, 0xfe, 0xe6, 0xe0, 0xcb, 0x77, 0x28, 0x02, 0xf6, 0x07, 0x6f, 0xd9,
-  0x21, 0x00, 0x00, 0xe5, 0xdd, 0xe1, 0x22, 0x10, 0x7c, 0x21, 0x54, 0x1f,
-  0x22, 0x14, 0x7c, 0xfb, 0xaf, 0xdb, 0xfe, 0x4f, 0x21, 0xb8, 0x58, 0x11,
-  0x78, 0x47, 0x06, 0x08, 0xcd, 0x88, 0x1e, 0x7a, 0xcb, 0x79, 0x28, 0x01,
-  0x7b, 0x77, 0x23, 0xcb, 0x31, 0x10, 0xf1, 0xcd, 0x88, 0x1e, 0x2a, 0x10,
-  0x7c, 0xdd, 0x54, 0xdd, 0x5d, 0xb7, 0xed, 0x52, 0x7c, 0xb5, 0x20, 0x25,
-  0xfd, 0x23, 0xfd, 0x7c, 0xfe, 0x00, 0xc2, 0x28, 0x1e, 0xfd, 0x7d, 0xfe,
-  0x40, 0xda, 0x53, 0x1e, 0xd9, 0x78, 0xd9, 0xfe, 0x00, 0x20, 0x24, 0x21,
-  0x6a, 0x20, 0xcd, 0x8c, 0x13, 0xd9, 0x3e, 0x01, 0x47, 0xd9, 0xc3, 0x53,
-  0x1e, 0xcd, 0x88, 0x1e, 0x7d, 0xfe, 0x01, 0x28, 0x06, 0x21, 0x6a, 0x20,
-  0xcd, 0x8c, 0x13, 0xdd, 0x2a, 0x10, 0x7c, 0xfd, 0x21, 0x00, 0x00, 0xcd,
-  0x88, 0x1e, 0x01, 0xfe, 0xf7, 0xed, 0x78, 0xcb, 0x47, 0x28, 0x3c, 0xcb,
-  0x4f, 0x28, 0x56, 0xcb, 0x57, 0x28, 0x70, 0xcb, 0x5f, 0xca, 0xf6, 0x1e,
-  0xcb, 0x67, 0xca, 0x22, 0x1f, 0x01, 0xfe, 0x7f, 0xed, 0x78, 0xcb, 0x47,
-  0xc2, 0xec, 0x1d, 0x01, 0xfe, 0xfe, 0xed, 0x78, 0xcb, 0x47, 0xc2, 0xec,
-  0x1d, 0xcd, 0xca, 0x11, 0xf5, 0xd9, 0x65, 0xdb, 0xfe, 0xcb, 0x77, 0x20,
-  0x04, 0x7c, 0xee, 0x07, 0x67, 0x7c, 0xd3, 0xfe, 0xd9, 0xf1, 0xc9, 0xf3,
-  0x0e, 0x0a, 0x79, 0xd3, 0xfe, 0xee, 0x0f, 0x4f, 0x06, 0x30, 0x10, 0xfe,
-  0xaf, 0xdb, 0xfe, 0xe6, 0x1f, 0xfe, 0x1f, 0x20, 0xed, 0x3e, 0x07, 0xd3,
-  0xfe, 0xfb, 0xc3, 0xec, 0x1d, 0xf3, 0x0e, 0x11, 0x79, 0xd3, 0xfe, 0xee,
-  0x17, 0x4f, 0x06, 0x30, 0x10, 0xfe, 0xaf, 0xdb, 0xfe, 0xe6, 0x1f, 0xfe,
-  0x1f, 0x20, 0xed, 0x3e, 0x07, 0xd3, 0xfe, 0xfb, 0xc3, 0xec, 0x1d, 0xf3,
-  0x0e, 0x00, 0x79, 0xd3, 0xfe, 0x3c, 0xe6, 0x07, 0x4f, 0x06, 0xa2, 0x10,
-  0xfe, 0xaf, 0xdb, 0xfe, 0xe6, 0x1f, 0xfe, 0x1f, 0x20, 0xec, 0x3e, 0x07,
-  0xd3, 0xfe, 0xfb, 0xc3, 0xec, 0x1d, 0xf3, 0x3e, 0x9b, 0x67, 0x3e, 0x04,
-  0xd3, 0xfe, 0x01, 0xfd, 0x7f, 0x3e, 0x08, 0xed, 0x79, 0x44, 0x10, 0xfe,
-  0x3e, 0x07, 0xd3, 0xfe, 0x01, 0xfd, 0x7f, 0x3e, 0x00, 0xed, 0x79, 0x44,
-  0x10, 0xfe, 0xdb, 0xfe, 0xe6, 0x1f, 0xfe, 0x1f, 0x20, 0xdc, 0xfb, 0xc3,
-  0xec, 0x1d, 0xf3, 0x06, 0x00, 0x21, 0x04, 0x02, 0xc5, 0x01, 0xff, 0x3f,
-  0x0b, 0x78, 0xb1, 0x20, 0xfb, 0xc1, 0x3e, 0x07, 0xcb, 0x40, 0x28, 0x06,
-  0xd3, 0xfe, 0xd3, 0xff, 0x18, 0x06, 0x7d, 0xd3, 0xfe, 0x7c, 0xd3, 0xff,
-  0x04, 0xdb, 0xfe, 0xe6, 0x1f, 0xfe, 0x1f, 0x20, 0xdb, 0xaf, 0xd3, 0xff,
-  0xfb, 0xc3, 0xec, 0x1d, 0xd9, 0x7d, 0xd9, 0xe6, 0xe0, 0xf6, 0x02, 0xd3,
-  0xfe, 0x21, 0x00, 0x59, 0x06, 0x20, 0x3e, 0x07, 0x4f, 0x7e, 0xfe, 0x38,
-  0x30, 0x01, 0x81, 0x77, 0x23, 0x10, 0xf6, 0x21, 0x00, 0x59, 0x3a, 0x16,
-  0x7c, 0xb5, 0x6f, 0x3e, 0x07, 0x77, 0x3a, 0x17, 0x7c, 0xfe, 0x00, 0x28,
-  0x0c, 0x3a, 0x16, 0x7c, 0x3c, 0x32, 0x16, 0x7c, 0xfe, 0x1f, 0xc0, 0x18,
-  0x0a, 0x3a, 0x16, 0x7c, 0x3d, 0x32, 0x16, 0x7c, 0xfe, 0x00, 0xc0, 0x3a,
-  0x17, 0x7c, 0x2f, 0x32, 0x17, 0x7c, 0xc9, 0x2a, 0x3c, 0x7c, 0x7c, 0xb5,
-  0x20, 0x07, 0x21, 0xff, 0xff, 0x22, 0x3c, 0x7c, 0xc9, 0x21, 0x00, 0x00,
-  0x22, 0x14, 0x7c, 0xc1, 0xc1, 0xc1, 0xe1, 0xc1, 0xc1, 0x22, 0x3c, 0x7c,
-  0xc3, 0xb3, 0x1c, 0xaf, 0x32, 0x40, 0x7c, 0x01, 0xfd, 0xff, 0xaf, 0xed,
-  0x79, 0x01, 0xfd, 0xbf, 0x3e, 0x55, 0xed, 0x79, 0x01, 0xfd, 0xff, 0xed,
-  0x78, 0xfe, 0x55, 0x20, 0x13, 0x01, 0xfd, 0xbf, 0xed, 0x71, 0x01, 0xfd,
-  0xff, 0xed, 0x78, 0xfe, 0x00, 0xc8, 0x3e, 0x01, 0x32, 0x40, 0x7c, 0xc9,
-  0x01, 0xfe, 0x00, 0xed, 0x71, 0xed, 0x78, 0xcb, 0x77, 0xc8, 0x3e, 0x01,
-  0x32, 0x40, 0x7c, 0xc9, 0x15, 0x55, 0x4c, 0x41, 0x2f, 0x41, 0x53, 0x49,
-  0x43, 0x20, 0x54, 0x65, 0x73, 0x74, 0x16, 0x00, 0x17, 0x05, 0x00, 0x55,
-  0x4c, 0x41, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x30, 0x78, 0x46, 0x45,
-  0x20, 0x72, 0x65, 0x61, 0x64, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x20, 0x00, 0x17, 0x05, 0xc0, 0x88,
-  0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x00, 0x17, 0x07, 0x00, 0x49,
-  0x6e, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x74, 0x65, 0x73,
-  0x74, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
-  0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 0x6d,
-  0x6f, 0x6f, 0x74, 0x68, 0x29, 0x00, 0x17, 0x08, 0x4e, 0x0f, 0xff, 0x15,
-  0x46, 0x41, 0x49, 0x4c, 0x20, 0x46, 0x41, 0x49, 0x4c, 0x20, 0x46, 0x41,
-  0x49, 0x4c, 0x16, 0x0f, 0x38, 0x00, 0x17, 0x0a, 0x00, 0x53, 0x65, 0x6c,
-  0x65, 0x63, 0x74, 0x3a, 0x17, 0x0c, 0x00, 0x31, 0x29, 0x20, 0x4f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x20, 0x74, 0x6f, 0x6e, 0x65, 0x20, 0x74, 0x6f,
-  0x20, 0x4d, 0x49, 0x43, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x17, 0x0d, 0x00,
-  0x32, 0x29, 0x20, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x74, 0x6f,
-  0x6e, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x45, 0x41, 0x52, 0x20, 0x70, 0x6f,
-  0x72, 0x74, 0x17, 0x0e, 0x00, 0x33, 0x29, 0x20, 0x54, 0x65, 0x73, 0x74,
-  0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x67, 0x65, 0x6e, 0x65,
-  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x17, 0x0f, 0x00, 0x34, 0x29, 0x20,
-  0x54, 0x65, 0x73, 0x74, 0x20, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x20,
-  0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x28, 0x31,
-  0x32, 0x38, 0x4b, 0x29, 0x17, 0x10, 0x00, 0x35, 0x29, 0x20, 0x54, 0x65,
-  0x73, 0x74, 0x20, 0x55, 0x4c, 0x41, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x20,
-  0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x17, 0x11,
-  0x12, 0x28, 0x46, 0x6c, 0x61, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x67,
-  0x72, 0x65, 0x65, 0x6e, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a,
-  0x20, 0x70, 0x61, 0x73, 0x73, 0x2c, 0x17, 0x12, 0x12, 0x61, 0x6e, 0x79,
-  0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x3a, 0x20,
-  0x66, 0x61, 0x69, 0x6c, 0x29, 0x00, 0x17, 0x14, 0x48, 0x15, 0x48, 0x6f,
-  0x6c, 0x64, 0x20, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x20, 0x74, 0x6f, 0x20,
-  0x65, 0x78, 0x69, 0x74, 0x16, 0x00, 0x17, 0x02, 0x00, 0x55, 0x4c, 0x41,
-  0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x00, 0xcb, 0x06, 0xae, 0x21,
-  0xe4, 0x06, 0xc1, 0x21, 0xbe, 0x05, 0xb4, 0x21, 0xb3, 0x05, 0xdc, 0x21,
-  0xcd, 0x05, 0x2d, 0x22, 0x00, 0x00, 0xcb, 0x06, 0xef, 0x21, 0xe4, 0x06,
-  0xce, 0x21, 0x00, 0x00, 0xcb, 0x06, 0x07, 0x22, 0xe4, 0x06, 0x0f, 0x22,
-  0xcd, 0x05, 0x18, 0x22, 0x00, 0x00, 0xc0, 0x20, 0x34, 0x38, 0x4b, 0x00,
-  0xc0, 0x20, 0x34, 0x38, 0x4b, 0x20, 0x28, 0x4e, 0x54, 0x53, 0x43, 0x29,
-  0x00, 0xc0, 0x20, 0x31, 0x32, 0x38, 0x4b, 0x20, 0x6f, 0x72, 0x20, 0x2b,
-  0x32, 0x00, 0xc0, 0x20, 0x2b, 0x32, 0x41, 0x2f, 0x2b, 0x33, 0x20, 0x41,
-  0x53, 0x49, 0x43, 0x00, 0x54, 0x53, 0x32, 0x30, 0x34, 0x38, 0x2f, 0x54,
-  0x53, 0x32, 0x30, 0x36, 0x38, 0x20, 0x41, 0x53, 0x49, 0x43, 0x00, 0x35,
-  0x43, 0x31, 0x30, 0x32, 0x45, 0x20, 0x28, 0x6f, 0x72, 0x20, 0x54, 0x52,
-  0x36, 0x20, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x29, 0x00, 0x53,
-  0x4c, 0x41, 0x4d, 0x34, 0x38, 0x2b, 0x00, 0x53, 0x4c, 0x41, 0x4d, 0x31,
-  0x32, 0x38, 0x2b, 0x00, 0x53, 0x4c, 0x41, 0x4d, 0x31, 0x32, 0x38, 0x2b,
-  0x20, 0x28, 0x4e, 0x54, 0x53, 0x43, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x29,
-  0x00, 0xc3, 0x20, 0x54, 0x4b, 0x39, 0x30, 0x58, 0x2f, 0x54, 0x4b, 0x39,
-  0x35, 0x20, 0x41, 0x53, 0x49, 0x43, 0x00, 0x55, 0x6e, 0x6b, 0x6e, 0x6f,
-  0x77, 0x6e, 0x20, 0x28, 0x00, 0x17, 0x03, 0x00, 0x46, 0x6c, 0x6f, 0x61,
-  0x74, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x75, 0x73, 0x20, 0x00, 0x64, 0x65,
-  0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x00, 0x61, 0x62, 0x73, 0x65, 0x6e,
-  0x74, 0x00, 0x17, 0x04, 0x00, 0x43, 0x50, 0x55, 0x20, 0x54, 0x79, 0x70,
-  0x65, 0x3a, 0x20, 0x00, 0x4e, 0x4d, 0x4f, 0x53, 0x20, 0x28, 0x6f, 0x72,
-  0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x29, 0x00, 0x43, 0x4d, 0x4f, 0x53,
-  0x20, 0x28, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x69,
-  0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62, 0x69, 0x6c, 0x69,
-  0x74, 0x79, 0x29, 0x00, 0x31, 0xff, 0x7b, 0xfd, 0x21, 0x00, 0x00, 0x7c,
-  0xfe, 0xbe, 0x20, 0x10, 0x7d, 0xfe, 0xee, 0x20, 0x0b, 0x2e, 0x07, 0x01,
-  0x23, 0x00, 0x11, 0x50, 0x01, 0xcd, 0x66, 0x0c, 0xcd, 0xfc, 0x10, 0x3e,
-  0x07, 0xd3, 0xfe, 0xcd, 0x94, 0x16, 0x21, 0xad, 0x23, 0xcd, 0xea, 0x16,
-  0xcd, 0x3b, 0x17, 0x21, 0xbd, 0x23, 0xcd, 0x8c, 0x13, 0xaf, 0x21, 0xa0,
-  0x58, 0x77, 0x11, 0xa1, 0x58, 0x01, 0xdf, 0x01, 0xed, 0xb0, 0x21, 0xeb,
-  0x23, 0xcd, 0x8c, 0x13, 0xdd, 0x21, 0x9a, 0x24, 0x3e, 0x08, 0x32, 0x02,
-  0x7c, 0x3e, 0x01, 0x32, 0x03, 0x7c, 0x3e, 0x08, 0x32, 0x04, 0x7c, 0xdd,
-  0x6e, 0x00, 0xdd, 0x66, 0x01, 0x7e, 0x32, 0x01, 0x7c, 0x23, 0x7e, 0x32,
-  0x00, 0x7c, 0x23, 0xcd, 0x8c, 0x13, 0xdd, 0x23, 0xdd, 0x23, 0xdd, 0x6e,
-  0x00, 0xdd, 0x66, 0x01, 0x7c, 0xb5, 0x20, 0xe5, 0x3e, 0x4f, 0x32, 0x02,
-  0x7c, 0xd9, 0x26, 0x00, 0xd9, 0x06, 0x08, 0x16, 0xfe, 0xdd, 0x21, 0x9a,
-  0x24, 0x7a, 0xdb, 0xfe, 0x5f, 0x0e, 0x05, 0xcb, 0x43, 0x20, 0x17, 0xdd,
-  0x6e, 0x00, 0xdd, 0x66, 0x01, 0x7e, 0x32, 0x01, 0x7c, 0x23, 0x7e, 0x32,
-  0x00, 0x7c, 0x23, 0xcd, 0x8c, 0x13, 0xd9, 0xcb, 0xc4, 0xd9, 0xdd, 0x23,
-  0xdd, 0x23, 0xcb, 0x0b, 0x0d, 0x79, 0xfe, 0x00, 0x20, 0xd9, 0xcb, 0x02,
-  0x10, 0xcf, 0xd9, 0x7c, 0xd9, 0xcb, 0x47, 0x28, 0x13, 0xcb, 0x4f, 0x20,
-  0x0f, 0x2e, 0x07, 0x01, 0x23, 0x00, 0x11, 0x15, 0x00, 0xcd, 0x66, 0x0c,
-  0xd9, 0xcb, 0xcc, 0xd9, 0xaf, 0xdb, 0xfe, 0xe6, 0x1f, 0xfe, 0x1f, 0x20,
-  0x04, 0xd9, 0x26, 0x00, 0xd9, 0x3e, 0x7f, 0xdb, 0xfe, 0x1f, 0x38, 0x12,
-  0x3e, 0xfe, 0xdb, 0xfe, 0x1f, 0x38, 0x0b, 0xfd, 0x23, 0xfd, 0x7d, 0xfe,
-  0x3f, 0x20, 0x8a, 0xcd, 0xca, 0x11, 0xfd, 0x21, 0x00, 0x00, 0xc3, 0x2d,
-  0x23, 0x15, 0x4b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x54,
-  0x65, 0x73, 0x74, 0x16, 0x00, 0x17, 0x02, 0x00, 0x50, 0x72, 0x65, 0x73,
-  0x73, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x74,
-  0x6f, 0x20, 0x74, 0x65, 0x73, 0x74, 0x2c, 0x20, 0x68, 0x6f, 0x6c, 0x64,
-  0x20, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x78,
-  0x69, 0x74, 0x00, 0x17, 0x05, 0x00, 0x18, 0x08, 0x0f, 0x07, 0x8b, 0x0e,
-  0xf8, 0x8c, 0x17, 0x09, 0x00, 0x8d, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8e, 0x17, 0x0d, 0xf8, 0x0f, 0x42, 0x80, 0x0f, 0x07, 0x17, 0x0e, 0xf0,
-  0x0f, 0x42, 0x80, 0x0f, 0x56, 0x80, 0x0f, 0x07, 0x17, 0x0f, 0xe8, 0x0f,
-  0x42, 0x80, 0x0f, 0x56, 0x80, 0x0f, 0x74, 0x80, 0x0f, 0x07, 0x17, 0x10,
-  0xe0, 0x0f, 0x42, 0x80, 0x0f, 0x56, 0x80, 0x0f, 0x74, 0x80, 0x0f, 0x65,
-  0x80, 0x0f, 0x07, 0x17, 0x11, 0xd8, 0x0f, 0x42, 0x80, 0x0f, 0x56, 0x80,
-  0x0f, 0x74, 0x80, 0x0f, 0x65, 0x80, 0x0f, 0x68, 0x80, 0x0f, 0x07, 0x8d,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x90, 0x0e, 0xf8, 0x91, 0x18,
-  0x06, 0x17, 0x06, 0x06, 0x15, 0x13, 0x01, 0x5a, 0x58, 0x20, 0x53, 0x70,
-  0x65, 0x63, 0x74, 0x72, 0x75, 0x6d, 0x16, 0x0f, 0x38, 0x00, 0x66, 0x25,
-  0x6b, 0x25, 0x6f, 0x25, 0x73, 0x25, 0x77, 0x25, 0x3e, 0x25, 0x42, 0x25,
-  0x46, 0x25, 0x4a, 0x25, 0x4e, 0x25, 0x16, 0x25, 0x1a, 0x25, 0x1e, 0x25,
-  0x22, 0x25, 0x26, 0x25, 0xee, 0x24, 0xf2, 0x24, 0xf6, 0x24, 0xfa, 0x24,
-  0xfe, 0x24, 0x12, 0x25, 0x0e, 0x25, 0x0a, 0x25, 0x06, 0x25, 0x02, 0x25,
-  0x3a, 0x25, 0x36, 0x25, 0x32, 0x25, 0x2e, 0x25, 0x2a, 0x25, 0x62, 0x25,
-  0x5e, 0x25, 0x5a, 0x25, 0x56, 0x25, 0x52, 0x25, 0x8b, 0x25, 0x87, 0x25,
-  0x83, 0x25, 0x7f, 0x25, 0x7b, 0x25, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x08,
-  0x31, 0x00, 0x0a, 0x20, 0x32, 0x00, 0x0a, 0x38, 0x33, 0x00, 0x0a, 0x50,
-  0x34, 0x00, 0x0a, 0x68, 0x35, 0x00, 0x0a, 0x80, 0x36, 0x00, 0x0a, 0x98,
-  0x37, 0x00, 0x0a, 0xb0, 0x38, 0x00, 0x0a, 0xc8, 0x39, 0x00, 0x0a, 0xe0,
-  0x30, 0x00, 0x0c, 0x10, 0x51, 0x00, 0x0c, 0x28, 0x57, 0x00, 0x0c, 0x40,
-  0x45, 0x00, 0x0c, 0x58, 0x52, 0x00, 0x0c, 0x70, 0x54, 0x00, 0x0c, 0x88,
-  0x59, 0x00, 0x0c, 0xa0, 0x55, 0x00, 0x0c, 0xb8, 0x49, 0x00, 0x0c, 0xd0,
-  0x4f, 0x00, 0x0c, 0xe8, 0x50, 0x00, 0x0e, 0x18, 0x41, 0x00, 0x0e, 0x30,
-  0x53, 0x00, 0x0e, 0x48, 0x44, 0x00, 0x0e, 0x60, 0x46, 0x00, 0x0e, 0x78,
-  0x47, 0x00, 0x0e, 0x90, 0x48, 0x00, 0x0e, 0xa8, 0x4a, 0x00, 0x0e, 0xc0,
-  0x4b, 0x00, 0x0e, 0xd8, 0x4c, 0x00, 0x0e, 0xf0, 0x65, 0x00, 0x10, 0x08,
-  0x63, 0x73, 0x00, 0x10, 0x28, 0x5a, 0x00, 0x10, 0x40, 0x58, 0x00, 0x10,
-  0x58, 0x43, 0x00, 0x10, 0x70, 0x56, 0x00, 0x10, 0x88, 0x42, 0x00, 0x10,
-  0xa0, 0x4e, 0x00, 0x10, 0xb8, 0x4d, 0x00, 0x10, 0xd0, 0x73, 0x00, 0x10,
-  0xe8, 0x73, 0x70, 0x00, 0x31, 0xff, 0x7b, 0xcd, 0xfc, 0x10, 0x21, 0x12,
-  0x2a, 0x11, 0x30, 0x7d, 0x01, 0x27, 0x00, 0xed, 0xb0, 0x21, 0x39, 0x2a,
-  0x11, 0x70, 0x7d, 0x01, 0x41, 0x00, 0xed, 0xb0, 0x21, 0x11, 0x2a, 0x22,
-  0x14, 0x7c, 0x3e, 0x07, 0xd3, 0xfe, 0xcd, 0x94, 0x16, 0x21, 0x7a, 0x2a,
-  0xcd, 0xea, 0x16, 0x21, 0x8d, 0x2a, 0xcd, 0x8c, 0x13, 0x21, 0x01, 0x2b,
-  0xcd, 0x8c, 0x13, 0x21, 0x00, 0x40, 0xdd, 0x21, 0x00, 0x00, 0xcd, 0xd6,
-  0x28, 0x08, 0x3e, 0x00, 0x08, 0x4f, 0xcd, 0x7d, 0x29, 0xfb, 0x08, 0x47,
-  0x08, 0x78, 0xfe, 0x00, 0x20, 0x03, 0x3e, 0x01, 0x47, 0x76, 0x10, 0xfd,
-  0xaf, 0xcd, 0xb3, 0x12, 0x38, 0x06, 0x08, 0x3e, 0x00, 0x08, 0x18, 0xe6,
-  0x08, 0xfe, 0x00, 0x28, 0x07, 0xfe, 0x01, 0x28, 0x05, 0x3d, 0x18, 0x02,
-  0x3e, 0x0a, 0x08, 0xfe, 0x5a, 0xca, 0xf0, 0x27, 0xfe, 0x58, 0xca, 0xff,
-  0x27, 0xfe, 0x07, 0xca, 0x64, 0x28, 0xfe, 0x08, 0xca, 0x82, 0x28, 0xfe,
-  0x05, 0xca, 0x0c, 0x28, 0xfe, 0x06, 0xca, 0x38, 0x28, 0xfe, 0x50, 0xca,
-  0xac, 0x27, 0xfe, 0x52, 0xca, 0x50, 0x27, 0xfe, 0x47, 0xca, 0xc1, 0x26,
-  0xfe, 0x09, 0x28, 0x7e, 0xfe, 0x48, 0x28, 0x7d, 0xfe, 0x47, 0x30, 0x9e,
-  0xfe, 0x30, 0x38, 0x9a, 0xfe, 0x3a, 0x38, 0x04, 0xfe, 0x41, 0x30, 0x00,
-  0xd6, 0x30, 0xfe, 0x0a, 0x38, 0x02, 0xd6, 0x07, 0xe5, 0xf5, 0xcd, 0xed,
-  0x29, 0x3a, 0x41, 0x7c, 0xfe, 0x03, 0x20, 0x0e, 0x7c, 0xfe, 0x3f, 0x20,
-  0x19, 0x7d, 0xfe, 0xc0, 0x38, 0x14, 0xf1, 0xe1, 0x18, 0x42, 0x3a, 0x41,
-  0x7c, 0xfe, 0x04, 0x20, 0x09, 0x7c, 0xfe, 0x40, 0x30, 0x04, 0xf1, 0xe1,
-  0x18, 0x32, 0xdd, 0x7d, 0xcb, 0x47, 0x28, 0x0b, 0xcd, 0x30, 0x7d, 0xe6,
-  0xf0, 0x47, 0xf1, 0xe6, 0x0f, 0x18, 0x0d, 0xcd, 0x30, 0x7d, 0xe6, 0x0f,
-  0x47, 0xf1, 0x17, 0x17, 0x17, 0x17, 0xe6, 0xf0, 0xb0, 0xe5, 0xf5, 0x3e,
-  0x03, 0xcd, 0xc0, 0x7d, 0xf1, 0xe1, 0x77, 0x3e, 0x04, 0xcd, 0xc0, 0x7d,
-  0xe1, 0xcd, 0xd6, 0x28, 0xcd, 0x38, 0x28, 0xc3, 0xde, 0x25, 0xc3, 0xca,
-  0x11, 0xe5, 0xcd, 0x66, 0x2e, 0xe1, 0xc3, 0xde, 0x25, 0x21, 0x14, 0x2b,
-  0xcd, 0x8c, 0x13, 0x21, 0x23, 0x2b, 0xcd, 0x8c, 0x13, 0x01, 0x00, 0x00,
-  0xcd, 0x16, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xb0,
-  0x47, 0xcd, 0x16, 0x27, 0xb0, 0x47, 0xcd, 0x16, 0x27, 0xcb, 0x27, 0xcb,
-  0x27, 0xcb, 0x27, 0xcb, 0x27, 0xb1, 0x4f, 0xcd, 0x16, 0x27, 0xb1, 0xdd,
-  0x6f, 0xe6, 0xf8, 0x4f, 0x21, 0xe4, 0x2a, 0xcd, 0x8c, 0x13, 0xc5, 0xe1,
-  0xdd, 0x26, 0x00, 0xdd, 0x7d, 0xe6, 0x07, 0xcb, 0x27, 0xdd, 0x6f, 0xcb,
-  0xc1, 0xcd, 0xd6, 0x28, 0xcd, 0x7d, 0x29, 0xc3, 0xde, 0x25, 0xaf, 0xcd,
-  0xb3, 0x12, 0x30, 0xfa, 0xfe, 0x47, 0x30, 0xf6, 0xfe, 0x30, 0x38, 0xf2,
-  0xfe, 0x3a, 0x38, 0x04, 0xfe, 0x41, 0x38, 0xea, 0xf5, 0xaf, 0xcd, 0xb3,
-  0x12, 0x38, 0xfa, 0xf1, 0xf5, 0xcd, 0x4a, 0x15, 0x16, 0x06, 0x3a, 0x00,
-  0x7c, 0x82, 0x32, 0x00, 0x7c, 0x21, 0x23, 0x2b, 0xcd, 0x8c, 0x13, 0xf1,
-  0xd6, 0x30, 0xfe, 0x0a, 0xd8, 0xd6, 0x07, 0xc9, 0xe5, 0x21, 0x30, 0x2b,
-  0xcd, 0xea, 0x16, 0xaf, 0xcd, 0xb3, 0x12, 0x30, 0xfa, 0xfe, 0x20, 0xc2,
-  0x6c, 0x27, 0x21, 0x7a, 0x2a, 0xcd, 0xea, 0x16, 0xe1, 0xc3, 0xde, 0x25,
-  0xfe, 0x30, 0x38, 0xe7, 0xfe, 0x34, 0x30, 0xe3, 0xd6, 0x30, 0xf5, 0xe6,
-  0x02, 0x17, 0x47, 0x3a, 0x34, 0x7c, 0xe6, 0xfb, 0xb0, 0x01, 0xfd, 0x1f,
-  0xed, 0x79, 0x32, 0x34, 0x7c, 0xf1, 0xe6, 0x01, 0x17, 0x17, 0x17, 0x17,
-  0x47, 0x3a, 0x33, 0x7c, 0xe6, 0xef, 0xb0, 0x01, 0xfd, 0x7f, 0xed, 0x79,
-  0x32, 0x33, 0x7c, 0x21, 0x7a, 0x2a, 0xcd, 0xea, 0x16, 0xe1, 0xcd, 0xd6,
-  0x28, 0xc3, 0xde, 0x25, 0xe5, 0x21, 0x42, 0x2b, 0xcd, 0xea, 0x16, 0xaf,
-  0xcd, 0xb3, 0x12, 0x30, 0xfa, 0xfe, 0x20, 0xc2, 0xc8, 0x27, 0x21, 0x7a,
-  0x2a, 0xcd, 0xea, 0x16, 0xe1, 0xc3, 0xde, 0x25, 0xfe, 0x30, 0x38, 0xe7,
-  0xfe, 0x38, 0x30, 0xe3, 0xd6, 0x30, 0xe6, 0x07, 0x47, 0x3a, 0x33, 0x7c,
-  0xe6, 0xf8, 0xb0, 0x01, 0xfd, 0x7f, 0xed, 0x79, 0x32, 0x33, 0x7c, 0x21,
-  0x7a, 0x2a, 0xcd, 0xea, 0x16, 0xe1, 0xcd, 0xd6, 0x28, 0xc3, 0xde, 0x25,
-  0xa7, 0x11, 0x90, 0x00, 0xed, 0x52, 0xcd, 0xd6, 0x28, 0xcd, 0x7d, 0x29,
-  0xc3, 0xde, 0x25, 0x11, 0x90, 0x00, 0x19, 0xcd, 0xd6, 0x28, 0xcd, 0x7d,
-  0x29, 0xc3, 0xde, 0x25, 0x0e, 0x00, 0xcd, 0x7d, 0x29, 0x0e, 0x01, 0xdd,
-  0x7d, 0xfe, 0x00, 0x20, 0x17, 0x3e, 0x0f, 0xdd, 0x6f, 0xdd, 0x7c, 0xfe,
-  0x00, 0x20, 0x05, 0xcd, 0xbc, 0x28, 0xdd, 0x24, 0xdd, 0x25, 0xcd, 0x7d,
-  0x29, 0xc3, 0xde, 0x25, 0xdd, 0x2d, 0xcd, 0x7d, 0x29, 0xc3, 0xde, 0x25,
-  0x0e, 0x00, 0xcd, 0x7d, 0x29, 0x0e, 0x01, 0xdd, 0x7d, 0xfe, 0x0f, 0x20,
-  0x17, 0x3e, 0x00, 0xdd, 0x6f, 0xdd, 0x7c, 0xfe, 0x11, 0x20, 0x05, 0xcd,
-  0xa0, 0x28, 0xdd, 0x25, 0xdd, 0x24, 0xcd, 0x7d, 0x29, 0xc3, 0xde, 0x25,
-  0xdd, 0x2c, 0xcd, 0x7d, 0x29, 0xc3, 0xde, 0x25, 0x0e, 0x00, 0xcd, 0x7d,
-  0x29, 0x0e, 0x01, 0xdd, 0x7c, 0xfe, 0x00, 0x20, 0x09, 0xcd, 0xbc, 0x28,
-  0xcd, 0x7d, 0x29, 0xc3, 0xde, 0x25, 0xdd, 0x25, 0xcd, 0x7d, 0x29, 0xc3,
-  0xde, 0x25, 0x0e, 0x00, 0xcd, 0x7d, 0x29, 0x0e, 0x01, 0xdd, 0x7c, 0xfe,
-  0x11, 0x20, 0x09, 0xcd, 0xa0, 0x28, 0xcd, 0x7d, 0x29, 0xc3, 0xde, 0x25,
-  0xdd, 0x24, 0xcd, 0x7d, 0x29, 0xc3, 0xde, 0x25, 0x11, 0x08, 0x00, 0x19,
-  0xe5, 0x11, 0x88, 0x00, 0x19, 0xe5, 0x21, 0x00, 0x13, 0xcd, 0x30, 0x16,
-  0x21, 0x12, 0x02, 0xcd, 0x8f, 0x17, 0xe1, 0xcd, 0xff, 0x28, 0xe1, 0xc9,
-  0x11, 0x08, 0x00, 0xa7, 0xed, 0x52, 0xe5, 0xe5, 0x21, 0x12, 0x13, 0xcd,
-  0x37, 0x18, 0x21, 0x00, 0x02, 0xcd, 0x30, 0x16, 0xe1, 0xcd, 0xff, 0x28,
-  0xe1, 0xc9, 0xf5, 0xc5, 0x3e, 0x02, 0x32, 0x01, 0x7c, 0xaf, 0x32, 0x00,
-  0x7c, 0x06, 0x12, 0xe5, 0xcd, 0xff, 0x28, 0xcd, 0xb3, 0x16, 0x10, 0xf8,
-  0xe1, 0xc1, 0xf1, 0xc9, 0x3e, 0x39, 0x32, 0x02, 0x7c, 0x7c, 0xfe, 0x40,
-  0xd0, 0x3e, 0x3a, 0x32, 0x02, 0x7c, 0xc9, 0xcd, 0xf0, 0x28, 0x11, 0x20,
-  0x7c, 0xcd, 0x39, 0x16, 0xe5, 0x21, 0x20, 0x7c, 0xcd, 0x8c, 0x13, 0x21,
-  0x2c, 0x2b, 0xcd, 0x8c, 0x13, 0xe1, 0xc5, 0x06, 0x08, 0xcd, 0x70, 0x7d,
-  0xe5, 0x21, 0x71, 0x7c, 0x7e, 0xe5, 0xc5, 0x6f, 0x26, 0x00, 0x11, 0x22,
-  0x7c, 0xcd, 0x41, 0x16, 0x21, 0x22, 0x7c, 0xcd, 0x8c, 0x13, 0x3a, 0x00,
-  0x7c, 0x16, 0x06, 0x82, 0x32, 0x00, 0x7c, 0xc1, 0xe1, 0x23, 0x10, 0xe0,
-  0xe1, 0x3a, 0x00, 0x7c, 0x16, 0x0c, 0x82, 0x32, 0x00, 0x7c, 0x06, 0x08,
-  0xe5, 0x21, 0x71, 0x7c, 0x7e, 0xfe, 0x20, 0x38, 0x09, 0xfe, 0x7f, 0x30,
-  0x05, 0xcd, 0x4a, 0x15, 0x18, 0x05, 0x3e, 0x3f, 0xcd, 0x4a, 0x15, 0x16,
-  0x06, 0x3a, 0x00, 0x7c, 0x82, 0x32, 0x00, 0x7c, 0x23, 0x10, 0xe1, 0xe1,
-  0xc1, 0x11, 0x08, 0x00, 0xa7, 0xed, 0x5a, 0x3e, 0x38, 0x32, 0x02, 0x7c,
-  0xc9, 0xe5, 0xcd, 0xed, 0x29, 0xcd, 0xf0, 0x28, 0xcd, 0x30, 0x7d, 0x47,
-  0x3e, 0x02, 0xdd, 0x5c, 0x83, 0x67, 0xdd, 0x7d, 0xcb, 0x3f, 0x6f, 0x85,
-  0x85, 0x85, 0x85, 0x85, 0x6f, 0xaf, 0x85, 0x85, 0x85, 0x6f, 0x3e, 0x2a,
-  0x85, 0x6f, 0xcd, 0x30, 0x16, 0x78, 0x21, 0x03, 0x7c, 0xcb, 0x8e, 0x1f,
-  0x1f, 0x1f, 0x1f, 0xcd, 0xfd, 0x29, 0xdd, 0x55, 0xcb, 0x42, 0x20, 0x06,
-  0xcb, 0x41, 0x28, 0x02, 0xcb, 0xce, 0xcd, 0x4a, 0x15, 0xcb, 0x8e, 0x3a,
-  0x00, 0x7c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x32, 0x00, 0x7c, 0x78,
-  0xe6, 0x0f, 0xcd, 0xfd, 0x29, 0xdd, 0x55, 0xcb, 0x42, 0x28, 0x06, 0xcb,
-  0x41, 0x28, 0x02, 0xcb, 0xce, 0xcd, 0x4a, 0x15, 0xcb, 0x8e, 0xe1, 0x3e,
-  0x38, 0x32, 0x02, 0x7c, 0xc9, 0xdd, 0x7c, 0x87, 0x87, 0x87, 0x5f, 0x16,
-  0x00, 0x19, 0xdd, 0x7d, 0xcb, 0x3f, 0x5f, 0x19, 0xc9, 0xf6, 0xf0, 0x27,
-  0xc6, 0xa0, 0xce, 0x40, 0xc9, 0xf5, 0xaf, 0xdb, 0xfe, 0xe6, 0x1f, 0xfe,
-  0x1f, 0x20, 0xf7, 0xf1, 0xc9, 0xc9, 0xf3, 0x3a, 0x41, 0x7c, 0xfe, 0x03,
-  0x20, 0x0e, 0x7c, 0xfe, 0x3f, 0x20, 0x09, 0x7d, 0xfe, 0xc0, 0x38, 0x04,
-  0x3e, 0xff, 0xfb, 0xc9, 0xc5, 0x3e, 0x02, 0xcd, 0xc0, 0x7d, 0x7e, 0xf5,
-  0x3e, 0x01, 0xcd, 0xc0, 0x7d, 0xf1, 0xc1, 0xfb, 0xc9, 0xf3, 0x3a, 0x41,
-  0x7c, 0xfe, 0x03, 0x20, 0x20, 0x7c, 0xfe, 0x3f, 0x20, 0x1b, 0x7d, 0xfe,
-  0xc0, 0x38, 0x16, 0xc5, 0xd5, 0xe5, 0x21, 0x71, 0x7c, 0x3e, 0xff, 0x77,
-  0x11, 0x72, 0x7c, 0x01, 0x07, 0x00, 0xed, 0xb0, 0xe1, 0xd1, 0xc1, 0xfb,
-  0xc9, 0xc5, 0xd5, 0xe5, 0x3e, 0x02, 0xcd, 0xc0, 0x7d, 0x11, 0x71, 0x7c,
-  0x01, 0x08, 0x00, 0xed, 0xb0, 0x3e, 0x01, 0xcd, 0xc0, 0x7d, 0xe1, 0xd1,
-  0xc1, 0xc9, 0x15, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x42, 0x72,
-  0x6f, 0x77, 0x73, 0x65, 0x72, 0x20, 0x20, 0x16, 0x00, 0x17, 0x15, 0x00,
-  0x41, 0x72, 0x72, 0x6f, 0x77, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x74,
-  0x6f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x20, 0x30, 0x2d, 0x39, 0x2c,
-  0x20, 0x41, 0x2d, 0x46, 0x3a, 0x20, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x20,
-  0x64, 0x61, 0x74, 0x61, 0x0a, 0x5a, 0x3a, 0x20, 0x50, 0x67, 0x55, 0x70,
-  0x20, 0x58, 0x3a, 0x20, 0x50, 0x67, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x52,
-  0x3a, 0x20, 0x50, 0x61, 0x67, 0x65, 0x20, 0x52, 0x4f, 0x4d, 0x2c, 0x20,
-  0x50, 0x3a, 0x20, 0x50, 0x61, 0x67, 0x65, 0x20, 0x52, 0x41, 0x4d, 0x0a,
-  0x17, 0x17, 0x00, 0x47, 0x3a, 0x20, 0x47, 0x6f, 0x74, 0x6f, 0x20, 0x61,
-  0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x48, 0x3a, 0x20, 0x43, 0x6f,
-  0x70, 0x79, 0x20, 0x20, 0x00, 0x0e, 0xa8, 0x15, 0x42, 0x52, 0x45, 0x41,
-  0x4b, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x78, 0x69, 0x74, 0x2e, 0x16, 0x00,
-  0x17, 0x17, 0x5a, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x17,
-  0x17, 0x66, 0x00, 0x14, 0x01, 0x20, 0x14, 0x00, 0x20, 0x08, 0x08, 0x00,
-  0x3a, 0x20, 0x20, 0x00, 0x15, 0x52, 0x4f, 0x4d, 0x20, 0x50, 0x61, 0x67,
-  0x65, 0x20, 0x28, 0x30, 0x2d, 0x33, 0x29, 0x3f, 0x16, 0x00, 0x15, 0x52,
-  0x41, 0x4d, 0x20, 0x50, 0x61, 0x67, 0x65, 0x20, 0x28, 0x30, 0x2d, 0x37,
-  0x29, 0x3f, 0x16, 0x00, 0xe2, 0x44, 0xd6, 0x2c, 0x8a, 0x0c, 0x00, 0x00,
-  0xb1, 0x5e, 0xe1, 0x2c, 0x8a, 0x0c, 0x00, 0x00, 0xc7, 0x62, 0xed, 0x2c,
-  0x2d, 0x0e, 0x26, 0x2c, 0xaa, 0xdb, 0xf6, 0x2c, 0x33, 0x0e, 0x2c, 0x2c,
-  0x57, 0xe1, 0x04, 0x2d, 0x2d, 0x0e, 0x32, 0x2c, 0x1f, 0x7a, 0x14, 0x2d,
-  0x2d, 0x0e, 0x38, 0x2c, 0x63, 0xc5, 0x24, 0x2d, 0x33, 0x0e, 0x3e, 0x2c,
-  0x64, 0xda, 0x2f, 0x2d, 0x33, 0x0e, 0x44, 0x2c, 0xf5, 0x26, 0x4d, 0x2d,
-  0x3a, 0x0e, 0x66, 0x2c, 0x83, 0x1f, 0x3f, 0x2d, 0x3a, 0x0e, 0x74, 0x2c,
-  0xb8, 0x95, 0x5c, 0x2d, 0x3a, 0x0e, 0x4a, 0x2c, 0xc0, 0x29, 0x70, 0x2d,
-  0x3a, 0x0e, 0x58, 0x2c, 0x29, 0x51, 0x84, 0x2d, 0x2d, 0x0e, 0x82, 0x2c,
-  0xf5, 0xe9, 0x9b, 0x2d, 0x2d, 0x0e, 0x88, 0x2c, 0xa9, 0xdb, 0xb3, 0x2d,
-  0x3a, 0x0e, 0x8e, 0x2c, 0x10, 0x37, 0xc1, 0x2d, 0x3a, 0x0e, 0x9c, 0x2c,
-  0x79, 0x1d, 0xd3, 0x2d, 0x3a, 0x0e, 0xaa, 0x2c, 0xc0, 0xf1, 0xe1, 0x2d,
-  0x3a, 0x0e, 0xb8, 0x2c, 0xf0, 0x26, 0xf3, 0x2d, 0xef, 0x0c, 0x00, 0x00,
-  0x0c, 0x87, 0x00, 0x2e, 0x8a, 0x0c, 0x00, 0x00, 0xb9, 0x55, 0x2a, 0x2e,
-  0xef, 0x0c, 0x00, 0x00, 0xe4, 0xf9, 0x10, 0x2e, 0xef, 0x0c, 0x00, 0x00,
-  0x74, 0x60, 0x1d, 0x2e, 0xef, 0x0c, 0x00, 0x00, 0x0c, 0xac, 0x48, 0x2e,
-  0xef, 0x0c, 0x00, 0x00, 0x46, 0x32, 0x57, 0x2e, 0xef, 0x0c, 0x00, 0x00,
-  0x16, 0x81, 0x33, 0x2e, 0x8a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbe,
-  0xc6, 0x2c, 0x00, 0x00, 0xf9, 0x27, 0xca, 0x2c, 0x00, 0x00, 0x13, 0x84,
-  0xc6, 0x2c, 0x00, 0x00, 0x13, 0x84, 0xc6, 0x2c, 0x00, 0x00, 0xbb, 0xad,
-  0xca, 0x2c, 0x00, 0x00, 0x23, 0x9a, 0xca, 0x2c, 0x00, 0x00, 0x48, 0xba,
-  0xce, 0x2c, 0xc5, 0x05, 0xd2, 0x2c, 0x9d, 0xd4, 0xd2, 0x2c, 0x00, 0x00,
-  0xc8, 0x89, 0xce, 0x2c, 0x79, 0xf5, 0xd2, 0x2c, 0x84, 0x8a, 0xd2, 0x2c,
-  0x00, 0x00, 0x5b, 0x4d, 0xce, 0x2c, 0xe4, 0xb3, 0xd2, 0x2c, 0x75, 0x5d,
-  0xd2, 0x2c, 0x00, 0x00, 0x7b, 0x4e, 0xce, 0x2c, 0x88, 0x33, 0xd2, 0x2c,
-  0x34, 0x4f, 0xd2, 0x2c, 0x00, 0x00, 0x11, 0x8c, 0xc6, 0x2c, 0x00, 0x00,
-  0x09, 0xbe, 0xc6, 0x2c, 0x00, 0x00, 0xe8, 0xa8, 0xce, 0x2c, 0x79, 0xe5,
-  0xd2, 0x2c, 0x34, 0x4f, 0xd2, 0x2c, 0x00, 0x00, 0xd0, 0xa6, 0xce, 0x2c,
-  0x63, 0xff, 0xd2, 0x2c, 0x84, 0x8a, 0xd2, 0x2c, 0x00, 0x00, 0x99, 0x78,
-  0xce, 0x2c, 0x71, 0x85, 0xd2, 0x2c, 0x34, 0x4f, 0xd2, 0x2c, 0x00, 0x00,
-  0x35, 0x90, 0xce, 0x2c, 0x76, 0x28, 0xd2, 0x2c, 0x84, 0x8a, 0xd2, 0x2c,
-  0x00, 0x00, 0x49, 0x43, 0x35, 0x00, 0x49, 0x43, 0x38, 0x00, 0x49, 0x43,
-  0x37, 0x00, 0x49, 0x43, 0x38, 0x00, 0xc0, 0x20, 0x31, 0x36, 0x2f, 0x34,
-  0x38, 0x4b, 0x20, 0xc1, 0x00, 0xc0, 0x20, 0x34, 0x38, 0x4b, 0x20, 0x28,
-  0xc2, 0x29, 0x20, 0xc1, 0x00, 0xc0, 0x20, 0x31, 0x32, 0x38, 0x4b, 0x20,
-  0xc1, 0x00, 0xc0, 0x20, 0x2b, 0x32, 0x20, 0x28, 0x47, 0x72, 0x65, 0x79,
-  0x29, 0x20, 0xc1, 0x00, 0xc0, 0x20, 0x31, 0x32, 0x38, 0x4b, 0x20, 0x28,
-  0xc2, 0x20, 0x76, 0x31, 0x29, 0x20, 0xc1, 0x00, 0xc0, 0x20, 0x31, 0x32,
-  0x38, 0x4b, 0x20, 0x28, 0xc2, 0x20, 0x76, 0x32, 0x29, 0x20, 0xc1, 0x00,
-  0xc0, 0x20, 0x2b, 0x32, 0x20, 0x28, 0xc2, 0x29, 0x20, 0xc1, 0x00, 0xc0,
-  0x20, 0x2b, 0x32, 0x20, 0x28, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x29,
-  0x20, 0xc1, 0x00, 0xc0, 0x20, 0x2b, 0x33, 0x20, 0x28, 0x76, 0x34, 0x2e,
-  0x30, 0x29, 0x20, 0xc1, 0x00, 0xc0, 0x20, 0x2b, 0x32, 0x41, 0x20, 0x28,
-  0x76, 0x34, 0x2e, 0x31, 0x29, 0x20, 0xc1, 0x00, 0xc0, 0x20, 0x2b, 0x32,
-  0x41, 0x2f, 0x2b, 0x33, 0x20, 0x28, 0xc2, 0x20, 0x76, 0x34, 0x2e, 0x30,
-  0x29, 0x20, 0xc1, 0x00, 0xc0, 0x20, 0x2b, 0x32, 0x41, 0x2f, 0x2b, 0x33,
-  0x20, 0x28, 0xc2, 0x20, 0x76, 0x34, 0x2e, 0x31, 0x29, 0x20, 0xc1, 0x00,
-  0xc0, 0x20, 0x31, 0x32, 0x38, 0x20, 0x44, 0x65, 0x76, 0x2c, 0x20, 0x44,
-  0x65, 0x72, 0x62, 0x79, 0x20, 0x31, 0x2e, 0x34, 0x20, 0xc1, 0x00, 0xc0,
-  0x20, 0x31, 0x32, 0x38, 0x20, 0x44, 0x65, 0x76, 0x2c, 0x20, 0x44, 0x65,
-  0x72, 0x62, 0x79, 0x20, 0x34, 0x2e, 0x30, 0x32, 0x20, 0xc1, 0x00, 0xc0,
-  0x20, 0x2b, 0x33, 0x45, 0x20, 0x76, 0x31, 0x2e, 0x33, 0x38, 0x20, 0xc1,
-  0x00, 0xc0, 0x20, 0x2b, 0x33, 0x45, 0x20, 0x76, 0x31, 0x2e, 0x33, 0x38,
-  0x20, 0x28, 0xc2, 0x29, 0x20, 0xc1, 0x00, 0xc0, 0x20, 0x2b, 0x33, 0x45,
-  0x20, 0x76, 0x31, 0x2e, 0x34, 0x33, 0x20, 0xc1, 0x00, 0xc0, 0x20, 0x2b,
-  0x33, 0x45, 0x20, 0x76, 0x31, 0x2e, 0x34, 0x33, 0x20, 0x28, 0xc2, 0x29,
-  0x20, 0xc1, 0x00, 0x4f, 0x72, 0x65, 0x6c, 0x20, 0x42, 0x4b, 0x2d, 0x30,
-  0x38, 0x20, 0xc1, 0x00, 0x42, 0x65, 0x63, 0x6b, 0x6d, 0x61, 0x6e, 0x20,
-  0xc0, 0x20, 0x34, 0x38, 0x4b, 0x20, 0xc1, 0x00, 0xc3, 0x20, 0x54, 0x4b,
-  0x39, 0x30, 0x58, 0x20, 0x76, 0x31, 0x20, 0xc1, 0x00, 0xc3, 0x20, 0x54,
-  0x4b, 0x39, 0x30, 0x58, 0x20, 0x76, 0x32, 0x20, 0xc1, 0x00, 0xc3, 0x20,
-  0x54, 0x4b, 0x39, 0x35, 0x20, 0xc1, 0x00, 0x47, 0x6f, 0x73, 0x68, 0x20,
-  0x57, 0x6f, 0x6e, 0x64, 0x65, 0x72, 0x66, 0x75, 0x6c, 0x20, 0x34, 0x38,
-  0x4b, 0x20, 0xc1, 0x00, 0x54, 0x69, 0x6d, 0x65, 0x78, 0x20, 0x54, 0x53,
-  0x32, 0x30, 0x34, 0x38, 0x20, 0xc1, 0x00, 0x54, 0x69, 0x6d, 0x65, 0x78,
-  0x20, 0x54, 0x53, 0x32, 0x30, 0x36, 0x38, 0x20, 0xc1, 0x00, 0x06, 0xc0,
-  0x21, 0x00, 0x40, 0xf3, 0xdb, 0xfb, 0xcb, 0x77, 0xc2, 0xbf, 0x2e, 0xcb,
-  0x7f, 0xc2, 0xbf, 0x2e, 0xe5, 0xc5, 0xcd, 0x97, 0x2e, 0xc1, 0xe1, 0x24,
-  0x7c, 0xe6, 0x07, 0x20, 0x0a, 0x7d, 0xc6, 0x20, 0x6f, 0x3f, 0x9f, 0xe6,
-  0xf8, 0x84, 0x67, 0x10, 0xe7, 0x3e, 0x04, 0xd3, 0xfb, 0xfb, 0xc9, 0x78,
-  0xfe, 0x03, 0x9f, 0xe6, 0x20, 0xd3, 0xfb, 0x57, 0xdb, 0xfb, 0x87, 0x30,
-  0xfb, 0x0e, 0x20, 0x5e, 0x23, 0x06, 0x08, 0xcb, 0x12, 0xcb, 0x13, 0xcb,
-  0x1a, 0xdb, 0xfb, 0x1f, 0x30, 0xfb, 0x7a, 0xd3, 0xfb, 0x10, 0xf0, 0x0d,
-  0x20, 0xe9, 0xc9, 0x2e, 0x07, 0x01, 0x00, 0x01, 0x11, 0x00, 0x01, 0xcd,
-  0x66, 0x0c, 0xfb, 0xc9, 0x31, 0xff, 0x7b, 0xcd, 0xfc, 0x10, 0x3e, 0x07,
-  0xd3, 0xfe, 0xcd, 0x94, 0x16, 0x21, 0x7a, 0x2f, 0xcd, 0xea, 0x16, 0xcd,
-  0x3b, 0x17, 0x21, 0x91, 0x2f, 0xcd, 0x8c, 0x13, 0x3a, 0x41, 0x7c, 0xfe,
-  0x01, 0x20, 0x05, 0x21, 0x9f, 0x2f, 0x18, 0x27, 0xfe, 0x02, 0x20, 0x05,
-  0x21, 0xb2, 0x2f, 0x18, 0x1e, 0xfe, 0x03, 0x20, 0x05, 0x21, 0xc9, 0x2f,
-  0x18, 0x15, 0xfe, 0x04, 0x20, 0x05, 0x21, 0xe1, 0x2f, 0x18, 0x0c, 0xfe,
-  0x05, 0x20, 0x05, 0x21, 0xf7, 0x2f, 0x18, 0x03, 0x21, 0x0c, 0x30, 0xcd,
-  0x8c, 0x13, 0x21, 0x1c, 0x30, 0xcd, 0x8c, 0x13, 0x21, 0x76, 0x00, 0xcd,
-  0x8c, 0x13, 0xcd, 0xb3, 0x16, 0x21, 0xa7, 0x00, 0xcd, 0x8c, 0x13, 0xcd,
-  0xb3, 0x16, 0x21, 0xbd, 0x00, 0xcd, 0x8c, 0x13, 0xcd, 0xb3, 0x16, 0x21,
-  0xcd, 0x00, 0xcd, 0x8c, 0x13, 0x21, 0x39, 0x30, 0xcd, 0x8c, 0x13, 0x21,
-  0x82, 0x02, 0x11, 0x28, 0x7c, 0xcd, 0x56, 0x16, 0x21, 0x28, 0x7c, 0xcd,
-  0x8c, 0x13, 0x21, 0x63, 0x30, 0xcd, 0x8c, 0x13, 0x3a, 0x41, 0x7c, 0xfe,
-  0x00, 0x20, 0x02, 0xf3, 0x76, 0x21, 0x4c, 0x30, 0xcd, 0x8c, 0x13, 0xcd,
-  0x23, 0x13, 0x3e, 0x02, 0x01, 0x34, 0x12, 0xcd, 0xc0, 0x7d, 0x15, 0x41,
-  0x62, 0x6f, 0x75, 0x74, 0x20, 0x5a, 0x58, 0x20, 0x44, 0x69, 0x61, 0x67,
-  0x6e, 0x6f, 0x73, 0x74, 0x69, 0x63, 0x73, 0x16, 0x00, 0x17, 0x02, 0x00,
-  0x48, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x3a, 0x20, 0x00, 0x41,
-  0x6c, 0x69, 0x6f, 0x74, 0x68, 0x20, 0x44, 0x69, 0x61, 0x67, 0x62, 0x6f,
-  0x61, 0x72, 0x64, 0x0a, 0x0a, 0x00, 0x52, 0x65, 0x74, 0x72, 0x6f, 0x6c,
-  0x65, 0x75, 0x6d, 0x20, 0x53, 0x4d, 0x41, 0x52, 0x54, 0x20, 0x43, 0x61,
-  0x72, 0x64, 0x0a, 0x0a, 0x00, 0x50, 0x61, 0x75, 0x6c, 0x20, 0x46, 0x61,
-  0x72, 0x72, 0x6f, 0x77, 0x20, 0x5a, 0x58, 0x43, 0x33, 0x2f, 0x5a, 0x58,
-  0x43, 0x34, 0x0a, 0x0a, 0x00, 0x5a, 0x58, 0x20, 0x44, 0x61, 0x6e, 0x64,
-  0x61, 0x6e, 0x61, 0x74, 0x6f, 0x72, 0x21, 0x20, 0x4d, 0x69, 0x6e, 0x69,
-  0x0a, 0x0a, 0x00, 0x43, 0x53, 0x53, 0x20, 0x31, 0x32, 0x38, 0x4b, 0x20,
-  0x52, 0x4f, 0x4d, 0x20, 0x42, 0x6f, 0x61, 0x72, 0x64, 0x0a, 0x0a, 0x00,
-  0x4e, 0x6f, 0x6e, 0x65, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65,
-  0x64, 0x0a, 0x0a, 0x00, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x2f, 0x76, 0x65,
-  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x0a, 0x0a, 0x00, 0x0a, 0x0a, 0x46,
-  0x72, 0x65, 0x65, 0x20, 0x52, 0x4f, 0x4d, 0x20, 0x73, 0x70, 0x61, 0x63,
-  0x65, 0x3a, 0x20, 0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x61, 0x6e,
-  0x79, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x78, 0x69,
-  0x74, 0x2e, 0x00, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x0a, 0x0a,
-  0x00, 0x17, 0x04, 0x00, 0x44, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x74,
-  0x69, 0x63, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64,
-  0x20, 0x28, 0x2f, 0x4d, 0x31, 0x20, 0x62, 0x61, 0x64, 0x3f, 0x29, 0x00,
-  0x0a, 0x33, 0xef, 0x0c, 0x1b, 0x33, 0x2d, 0x0e, 0x2d, 0x33, 0x33, 0x0e,
-  0x3d, 0x33, 0x3a, 0x0e, 0x00, 0x00, 0x15, 0x5a, 0x58, 0x20, 0xc0, 0x20,
-  0x44, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x74, 0x69, 0x63, 0x73, 0x16,
-  0x00, 0x17, 0x02, 0x00, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x31, 0x36,
-  0x4b, 0x20, 0x52, 0x41, 0x4d, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x2e,
-  0x2e, 0x2e, 0x0e, 0xe4, 0x15, 0x10, 0x04, 0x50, 0x41, 0x53, 0x53, 0x16,
-  0x10, 0x00, 0x00, 0x17, 0x17, 0x30, 0x53, 0x6f, 0x61, 0x6b, 0x20, 0x74,
-  0x65, 0x73, 0x74, 0x3a, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x10, 0x00, 0x00, 0x0a, 0x55, 0x70, 0x70, 0x65, 0x72,
-  0x20, 0x52, 0x41, 0x4d, 0x20, 0x57, 0x61, 0x6c, 0x6b, 0x20, 0x74, 0x65,
-  0x73, 0x74, 0x2e, 0x2e, 0x2e, 0x0e, 0xa8, 0x00, 0x55, 0x70, 0x70, 0x65,
-  0x72, 0x20, 0x52, 0x41, 0x4d, 0x20, 0x49, 0x6e, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x2e, 0x2e, 0x20,
-  0x00, 0x55, 0x70, 0x70, 0x65, 0x72, 0x20, 0x52, 0x41, 0x4d, 0x20, 0x4d,
-  0x61, 0x72, 0x63, 0x68, 0x20, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x2e, 0x2e,
-  0x0e, 0xa8, 0x00, 0x55, 0x70, 0x70, 0x65, 0x72, 0x20, 0x52, 0x41, 0x4d,
-  0x20, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x20, 0x74, 0x65, 0x73, 0x74,
-  0x2e, 0x2e, 0x2e, 0x0e, 0xa8, 0x00, 0x0a, 0x15, 0x11, 0x02, 0x10, 0x07,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x34, 0x38, 0x4b, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x46,
-  0x41, 0x49, 0x4c, 0x45, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x16, 0x0f, 0x38, 0x00, 0x54,
-  0x68, 0x69, 0x73, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20,
-  0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x31, 0x36, 0x4b, 0x20,
-  0xc0, 0x0a, 0x49, 0x66, 0x20, 0x34, 0x38, 0x4b, 0x2c, 0x20, 0x63, 0x68,
-  0x65, 0x63, 0x6b, 0x20, 0x49, 0x43, 0x32, 0x33, 0x2d, 0x49, 0x43, 0x32,
-  0x36, 0x20, 0x28, 0x37, 0x34, 0x4c, 0x53, 0x31, 0x35, 0x37, 0x2c, 0x20,
-  0x33, 0x32, 0x2c, 0x20, 0x30, 0x30, 0x29, 0x00, 0x0a, 0x15, 0x11, 0x02,
-  0x10, 0x07, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x31, 0x32, 0x38, 0x4b, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73,
-  0x20, 0x46, 0x41, 0x49, 0x4c, 0x45, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x0a, 0x16, 0x0f,
-  0x38, 0x00, 0x0a, 0x15, 0x11, 0x02, 0x10, 0x07, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x32, 0x38, 0x4b, 0x20, 0x50, 0x61,
-  0x67, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x46,
-  0x41, 0x49, 0x4c, 0x45, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x0a, 0x0a, 0x16, 0x0f, 0x38, 0x00, 0x17, 0x04, 0x00, 0x43,
-  0x68, 0x65, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x52, 0x4f, 0x4d, 0x2e,
-  0x2e, 0x2e, 0x00, 0x17, 0x04, 0x00, 0x10, 0x02, 0x15, 0x55, 0x6e, 0x6b,
-  0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x72, 0x72,
-  0x75, 0x70, 0x74, 0x20, 0x52, 0x4f, 0x4d, 0x2e, 0x2e, 0x2e, 0x20, 0x16,
-  0x10, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x0f, 0x38, 0x00, 0x17, 0x05, 0x00, 0x50, 0x72, 0x65, 0x73,
-  0x73, 0x3a, 0x20, 0x31, 0x2e, 0x2e, 0x34, 0x38, 0x4b, 0x20, 0x20, 0x32,
-  0x2e, 0x2e, 0x31, 0x32, 0x38, 0x4b, 0x20, 0x20, 0x33, 0x2e, 0x2e, 0x2b,
-  0x32, 0x20, 0x20, 0x34, 0x2e, 0x2e, 0x2b, 0x32, 0x41, 0x2f, 0x2b, 0x33,
-  0x00, 0x17, 0x06, 0x00, 0x4e, 0x6f, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x2c, 0x20, 0x61,
-  0x73, 0x73, 0x75, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x34, 0x38, 0x4b, 0x20,
-  0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x20, 0x20, 0x20, 0x0a, 0x00, 0x17, 0x05,
-  0x00, 0x41, 0x73, 0x73, 0x75, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x34, 0x38,
-  0x4b, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x2e, 0x2e, 0x00, 0x17, 0x05,
-  0x2a, 0x15, 0x10, 0x04, 0x31, 0x2e, 0x2e, 0x34, 0x38, 0x4b, 0x0a, 0x16,
-  0x0f, 0x38, 0x00, 0x17, 0x05, 0x5a, 0x15, 0x10, 0x04, 0x32, 0x2e, 0x2e,
-  0x31, 0x32, 0x38, 0x4b, 0x0a, 0x16, 0x0f, 0x38, 0x00, 0x17, 0x05, 0x90,
-  0x15, 0x10, 0x04, 0x33, 0x2e, 0x2e, 0x2b, 0x32, 0x0a, 0x16, 0x0f, 0x38,
-  0x00, 0x17, 0x05, 0xba, 0x15, 0x10, 0x04, 0x34, 0x2e, 0x2e, 0x2b, 0x32,
-  0x41, 0x2f, 0x2b, 0x33, 0x0a, 0x16, 0x0f, 0x38, 0x00, 0x08, 0x08, 0x00,
-  0x10, 0x00, 0x0e, 0xe4, 0x16, 0x54, 0x65, 0x73, 0x74, 0x00, 0x10, 0x04,
-  0x0e, 0xe4, 0x15, 0x50, 0x41, 0x53, 0x53, 0x16, 0x10, 0x00, 0x00, 0x10,
-  0x02, 0x0e, 0xe4, 0x15, 0x46, 0x41, 0x49, 0x4c, 0x16, 0x10, 0x00, 0x00,
-  0x57, 0x41, 0x49, 0x54, 0x00, 0x0a, 0x00, 0x0a, 0x54, 0x65, 0x73, 0x74,
-  0x69, 0x6e, 0x67, 0x20, 0x52, 0x41, 0x4d, 0x20, 0x62, 0x61, 0x6e, 0x6b,
-  0x20, 0x20, 0x00, 0x54, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x70,
-  0x61, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x20, 0x20, 0x20, 0x00, 0x78, 0x20,
-  0x00, 0x0a, 0x11, 0x04, 0x10, 0x07, 0x13, 0x01, 0x15, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x34, 0x38, 0x4b, 0x20,
-  0x52, 0x41, 0x4d, 0x20, 0x54, 0x65, 0x73, 0x74, 0x73, 0x20, 0x50, 0x61,
-  0x73, 0x73, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x16, 0x0f, 0x38, 0x00, 0x0a, 0x11, 0x04, 0x10, 0x07,
-  0x13, 0x01, 0x15, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x31, 0x32, 0x38, 0x4b, 0x20, 0x52, 0x41, 0x4d, 0x20, 0x54, 0x65,
-  0x73, 0x74, 0x73, 0x20, 0x50, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x16, 0x0f, 0x38,
-  0x00, 0x0a, 0x0a, 0x54, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69,
-  0x6e, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x73, 0x2e, 0x2e, 0x2e,
-  0x00, 0x0e, 0x1c, 0x00, 0x0a, 0x0e, 0x2a, 0x53, 0x6f, 0x61, 0x6b, 0x20,
-  0x74, 0x65, 0x73, 0x74, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x00,
-  0x0a, 0x0e, 0x21, 0x53, 0x6f, 0x61, 0x6b, 0x20, 0x74, 0x65, 0x73, 0x74,
-  0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65,
-  0x2e, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x77, 0x69, 0x6e, 0x21, 0x00, 0x15,
-  0x0a, 0x0a, 0x0e, 0x30, 0x2a, 0x2a, 0x2a, 0x20, 0x54, 0x65, 0x73, 0x74,
-  0x69, 0x6e, 0x67, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65,
-  0x64, 0x20, 0x2a, 0x2a, 0x2a, 0x16, 0x00, 0x15, 0x0a, 0x0e, 0x24, 0x46,
-  0x61, 0x69, 0x6c, 0x75, 0x72, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e,
-  0x64, 0x2c, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x68, 0x61,
-  0x6c, 0x74, 0x65, 0x64, 0x16, 0x00, 0x0a, 0x0a, 0x50, 0x61, 0x67, 0x69,
-  0x6e, 0x67, 0x20, 0x69, 0x6e, 0x20, 0xc0, 0x20, 0x52, 0x4f, 0x4d, 0x2e,
-  0x2e, 0x2e, 0x00, 0x0e, 0xf6, 0x00, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x20,
-  0x49, 0x43, 0x32, 0x39, 0x20, 0x28, 0x50, 0x41, 0x4c, 0x31, 0x30, 0x48,
-  0x38, 0x43, 0x4e, 0x29, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x49, 0x43, 0x33,
-  0x31, 0x20, 0x28, 0x37, 0x34, 0x4c, 0x53, 0x31, 0x37, 0x34, 0x4e, 0x29,
-  0x00, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x49, 0x43, 0x37, 0x20, 0x28,
-  0x48, 0x41, 0x4c, 0x31, 0x30, 0x48, 0x38, 0x41, 0x43, 0x4e, 0x29, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x49, 0x43, 0x36, 0x20, 0x28, 0x37, 0x34, 0x4c,
-  0x53, 0x31, 0x37, 0x34, 0x4e, 0x29, 0x00, 0x43, 0x68, 0x65, 0x63, 0x6b,
-  0x20, 0x49, 0x43, 0x31, 0x20, 0x28, 0x55, 0x4c, 0x41, 0x20, 0x34, 0x30,
-  0x30, 0x37, 0x37, 0x29, 0x00, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67,
-  0x20, 0x49, 0x43, 0x27, 0x73, 0x3a, 0x0a, 0x00, 0x49, 0x43, 0x00, 0x55,
-  0x00, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x52, 0x4f, 0x4d, 0x20, 0x28,
-  0x00, 0x29, 0x0a, 0x00, 0xf5, 0xed, 0x57, 0xfe, 0x00, 0x20, 0x04, 0xf1,
-  0xc3, 0xfd, 0x05, 0xe5, 0xd5, 0xc5, 0x2a, 0x10, 0x7c, 0x23, 0x22, 0x10,
-  0x7c, 0x7c, 0xb5, 0x20, 0x07, 0x2a, 0x12, 0x7c, 0x23, 0x22, 0x12, 0x7c,
-  0x2a, 0x14, 0x7c, 0x7c, 0xb5, 0x28, 0x08, 0x21, 0x97, 0x35, 0xe5, 0x2a,
-  0x14, 0x7c, 0xe9, 0xc1, 0xd1, 0xe1, 0xf1, 0xfb, 0xed, 0x4d, 0x00, 0x00,
-  0x00, 0x00, 0x62, 0x50, 0xe4, 0xe8, 0x55, 0x70, 0x8a, 0x48, 0x55, 0x70,
-  0xca, 0x48, 0x67, 0x50, 0x8e, 0x48, 0x55, 0x50, 0x8a, 0x48, 0x55, 0x50,
-  0x8a, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4e,
-  0x2e, 0x6e, 0xac, 0xa2, 0xa8, 0x82, 0xa4, 0x24, 0xa4, 0xc4, 0xa4, 0x42,
-  0xe2, 0xa4, 0xa4, 0x8a, 0x2a, 0xa8, 0x4e, 0xe4, 0x24, 0x48, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0x06, 0x44, 0xa0, 0x0a, 0x0a, 0x84, 0x00, 0xa0, 0xae,
-  0xa0, 0x06, 0xc6, 0x0e, 0xe6, 0xe6, 0x4c, 0xc0, 0x0a, 0x0a, 0xea, 0xc4,
-  0x4c, 0xc0, 0x06, 0xaa, 0x6a, 0xee, 0xe0, 0x4c, 0x4a, 0xe0, 0x08, 0x48,
-  0xaa, 0xa0, 0x0a, 0x4a, 0x8a, 0x00, 0xe4, 0xe8, 0xe0, 0x08, 0xa8, 0x44,
-  0x88, 0x48, 0xaa, 0xa0, 0x0a, 0x4a, 0x8a, 0xaa, 0xaa, 0xa0, 0x08, 0xae,
-  0x8a, 0x48, 0x44, 0xaa, 0xaa, 0x40, 0x04, 0x04, 0xae, 0xc0, 0x0a, 0x0a,
-  0x8e, 0x00, 0xe0, 0xec, 0xe0, 0x04, 0xc8, 0x04, 0xc4, 0x48, 0xec, 0xa0,
-  0x0c, 0x0c, 0xc4, 0xca, 0xec, 0xa0, 0x04, 0x4e, 0x4e, 0x4c, 0x40, 0xec,
-  0xaa, 0x40, 0x02, 0x42, 0xaa, 0xa0, 0x0a, 0x4a, 0x8a, 0x00, 0xa4, 0xa8,
-  0xa0, 0x02, 0x88, 0x44, 0x82, 0x48, 0xaa, 0xa0, 0x0a, 0x4a, 0x84, 0xaa,
-  0xaa, 0xa0, 0x02, 0x4a, 0x2a, 0x48, 0x44, 0xaa, 0xaa, 0x40, 0x0c, 0x0c,
-  0x4a, 0xa0, 0x06, 0x06, 0xea, 0x00, 0xa0, 0xae, 0xa0, 0x0c, 0x86, 0x04,
-  0xec, 0x46, 0xaa, 0xc0, 0x0a, 0x0a, 0xe4, 0xc4, 0xaa, 0xc0, 0x0c, 0x4a,
-  0xca, 0xe8, 0x40, 0xac, 0x46, 0x40, 0xfe, 0x00, 0xca, 0xd6, 0x7e, 0xfe,
-  0x01, 0x28, 0x11, 0xfe, 0x02, 0x28, 0x56, 0xfe, 0x03, 0xca, 0x8c, 0x7e,
-  0xfe, 0x04, 0xca, 0xb1, 0x7e, 0x3e, 0xff, 0xc9, 0x3a, 0x41, 0x7c, 0xfe,
-  0x01, 0x28, 0x13, 0xfe, 0x02, 0x28, 0x14, 0xfe, 0x03, 0x28, 0x19, 0xfe,
-  0x04, 0x28, 0x23, 0xfe, 0x05, 0x28, 0x2a, 0x3e, 0xff, 0xc9, 0x3e, 0x00,
-  0xd3, 0x1f, 0xc9, 0x01, 0xfb, 0xfa, 0x3a, 0x42, 0x7c, 0xed, 0x79, 0xc9,
-  0xe5, 0x21, 0xc0, 0x3f, 0x3a, 0x42, 0x7c, 0xe6, 0x07, 0xb5, 0x6f, 0x7e,
-  0xe1, 0xc9, 0xe5, 0x21, 0x01, 0x00, 0x3e, 0x20, 0xcd, 0x8b, 0x7f, 0xe1,
-  0xc9, 0xc5, 0x01, 0xff, 0x5f, 0xed, 0x78, 0xc1, 0xc9, 0x3a, 0x41, 0x7c,
-  0xfe, 0x01, 0x28, 0x13, 0xfe, 0x02, 0x28, 0x16, 0xfe, 0x03, 0x28, 0x21,
-  0xfe, 0x04, 0x28, 0x26, 0xfe, 0x05, 0x28, 0x40, 0x3e, 0xff, 0xc9, 0x3e,
-  0x20, 0xd3, 0x1f, 0xc3, 0x81, 0x7e, 0xc5, 0x01, 0xfb, 0xfa, 0x3a, 0x42,
-  0x7c, 0xf6, 0x80, 0xed, 0x79, 0xc1, 0xc3, 0x81, 0x7e, 0xe5, 0x21, 0xd0,
-  0x3f, 0x7e, 0xe1, 0xc3, 0x81, 0x7e, 0x78, 0xfe, 0x12, 0x20, 0x09, 0x79,
-  0xfe, 0x34, 0x20, 0x04, 0x3e, 0x22, 0x18, 0x02, 0x3e, 0x21, 0xe5, 0x21,
-  0x01, 0x00, 0xcd, 0x8b, 0x7f, 0xe1, 0xfe, 0x22, 0xc0, 0xc3, 0x81, 0x7e,
-  0xc5, 0x01, 0xff, 0x3f, 0xed, 0x78, 0xc1, 0x78, 0xfe, 0x12, 0xc0, 0x79,
-  0xfe, 0x34, 0xc0, 0xc3, 0x00, 0x00, 0x3a, 0x41, 0x7c, 0xfe, 0x04, 0x28,
-  0x03, 0x3e, 0xff, 0xc9, 0x21, 0x01, 0x00, 0x3e, 0x2e, 0xcd, 0x8b, 0x7f,
-  0x23, 0x3e, 0x01, 0xcd, 0x8b, 0x7f, 0x23, 0x3e, 0x01, 0xcd, 0x8b, 0x7f,
-  0x32, 0x00, 0x00, 0x06, 0x00, 0xaf, 0xc9, 0x3a, 0x41, 0x7c, 0xfe, 0x04,
-  0x28, 0x03, 0x3e, 0xff, 0xc9, 0x21, 0x01, 0x00, 0x3e, 0x2e, 0xcd, 0x8b,
-  0x7f, 0x23, 0x3e, 0x10, 0xcd, 0x8b, 0x7f, 0x23, 0x3e, 0x10, 0xcd, 0x8b,
-  0x7f, 0x32, 0x00, 0x00, 0x06, 0x00, 0xaf, 0xc9, 0x3e, 0x20, 0xd3, 0x1f,
-  0xcd, 0x9c, 0x7f, 0x28, 0x09, 0x3e, 0x01, 0x32, 0x41, 0x7c, 0xaf, 0xd3,
-  0x1f, 0xc9, 0x01, 0xfb, 0xfa, 0xed, 0x78, 0xe6, 0x0f, 0x32, 0x42, 0x7c,
-  0x3e, 0x81, 0xed, 0x79, 0xcd, 0x9c, 0x7f, 0x28, 0x0e, 0x3e, 0x02, 0x32,
-  0x41, 0x7c, 0x3a, 0x42, 0x7c, 0x01, 0xfb, 0xfa, 0xed, 0x79, 0xc9, 0x21,
-  0xd0, 0x3f, 0x7e, 0xcd, 0x9c, 0x7f, 0x28, 0x25, 0x11, 0xc0, 0x3f, 0xcd,
-  0x9c, 0x7f, 0x20, 0x02, 0x18, 0x0f, 0x13, 0xcb, 0x5b, 0x28, 0xf4, 0x3e,
-  0xfa, 0xd3, 0xfe, 0x3e, 0x02, 0xd3, 0xfe, 0x18, 0xf6, 0x7b, 0xe6, 0x07,
-  0x32, 0x42, 0x7c, 0x3e, 0x03, 0x32, 0x41, 0x7c, 0xc9, 0x21, 0x01, 0x00,
-  0x3e, 0x2e, 0xcd, 0x8b, 0x7f, 0x23, 0x3e, 0x10, 0xcd, 0x8b, 0x7f, 0x23,
-  0xcd, 0x8b, 0x7f, 0x32, 0x00, 0x00, 0x06, 0x00, 0x10, 0xfe, 0x21, 0x01,
-  0x00, 0x3e, 0x21, 0xcd, 0x8b, 0x7f, 0x62, 0x6b, 0x7e, 0xcd, 0x9c, 0x7f,
-  0x28, 0x0e, 0x3e, 0x04, 0x32, 0x41, 0x7c, 0x21, 0x01, 0x00, 0x3e, 0x20,
-  0xcd, 0x8b, 0x7f, 0xc9, 0x01, 0xff, 0x3f, 0xed, 0x78, 0xcd, 0x9c, 0x7f,
-  0x28, 0x0b, 0x01, 0xff, 0x5f, 0xed, 0x78, 0x3e, 0x05, 0x32, 0x41, 0x7c,
-  0xc9, 0xaf, 0x32, 0x41, 0x7c, 0x32, 0x42, 0x7c, 0xc9, 0xc5, 0xf5, 0x47,
-  0x00, 0x00, 0x00, 0x00, 0x77, 0x10, 0xf9, 0x06, 0x28, 0x10, 0xfe, 0xf1,
-  0xc1, 0xc9, 0x62, 0x6b, 0x7e, 0x21, 0x50, 0x00, 0x7e, 0xfe, 0x54, 0xc0,
-  0x23, 0x7e, 0xfe, 0x52, 0xc0, 0x23, 0x7e, 0xfe, 0x4f, 0xc0, 0x23, 0x7e,
-  0xfe, 0x4d, 0xc0, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x20, 0x00, 0x00,
-  0x31, 0x20, 0x00, 0x00, 0x32, 0x20, 0x00, 0x00, 0x33, 0x20, 0x00, 0x00,
-  0x34, 0x20, 0x00, 0x00, 0x35, 0x20, 0x00, 0x00, 0x36, 0x20, 0x00, 0x00,
-  0x37, 0x20, 0x00, 0x00, 0x31, 0x35, 0x20, 0x00, 0x31, 0x36, 0x20, 0x00,
-  0x31, 0x37, 0x20, 0x00, 0x31, 0x38, 0x20, 0x00, 0x31, 0x39, 0x20, 0x00,
-  0x32, 0x30, 0x20, 0x00, 0x32, 0x31, 0x20, 0x00, 0x32, 0x32, 0x20, 0x00,
-  0x36, 0x20, 0x20, 0x00, 0x37, 0x20, 0x20, 0x00, 0x38, 0x20, 0x20, 0x00,
-  0x39, 0x20, 0x20, 0x00, 0x31, 0x30, 0x20, 0x00, 0x31, 0x31, 0x20, 0x00,
-  0x31, 0x32, 0x20, 0x00, 0x31, 0x33, 0x20, 0x00, 0x31, 0x35, 0x20, 0x00,
-  0x31, 0x36, 0x20, 0x00, 0x31, 0x37, 0x20, 0x00, 0x31, 0x38, 0x20, 0x00,
-  0x31, 0x39, 0x20, 0x00, 0x32, 0x30, 0x20, 0x00, 0x32, 0x31, 0x20, 0x00,
-  0x32, 0x32, 0x20, 0x00, 0x33, 0x32, 0x20, 0x00, 0x33, 0x31, 0x20, 0x00,
-  0x33, 0x30, 0x20, 0x00, 0x32, 0x39, 0x20, 0x00, 0x32, 0x38, 0x20, 0x00,
-  0x32, 0x37, 0x20, 0x00, 0x32, 0x36, 0x20, 0x00, 0x32, 0x35, 0x20, 0x00,
-  0x31, 0x37, 0x20, 0x00, 0x31, 0x38, 0x20, 0x00, 0x31, 0x39, 0x20, 0x00,
-  0x32, 0x30, 0x20, 0x00, 0x32, 0x31, 0x20, 0x00, 0x32, 0x32, 0x20, 0x00,
-  0x32, 0x33, 0x20, 0x00, 0x32, 0x34, 0x20, 0x00, 0x33, 0x20, 0x20, 0x00,
-  0x34, 0x20, 0x20, 0x00, 0x35, 0x20, 0x20, 0x00, 0x36, 0x20, 0x20, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
-  0x20, 0x00, 0x20, 0x00, 0x00, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x28, 0x7c, 0x28, 0x28, 0x7c, 0x28, 0x00, 0x00, 0x10, 0x7c, 0x50,
-  0x7c, 0x14, 0x7c, 0x10, 0x00, 0x64, 0x68, 0x10, 0x10, 0x2c, 0x4c, 0x00,
-  0x00, 0x20, 0x50, 0x20, 0x54, 0x88, 0x74, 0x00, 0x00, 0x10, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x10, 0x10, 0x10, 0x08, 0x00,
-  0x00, 0x20, 0x10, 0x10, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x28, 0x10,
-  0x7c, 0x10, 0x28, 0x00, 0x00, 0x00, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00,
-  0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x38, 0x4c, 0x54,
-  0x54, 0x64, 0x38, 0x00, 0x00, 0x30, 0x50, 0x10, 0x10, 0x10, 0x7c, 0x00,
-  0x00, 0x38, 0x44, 0x04, 0x38, 0x40, 0x7c, 0x00, 0x00, 0x38, 0x44, 0x18,
-  0x04, 0x44, 0x38, 0x00, 0x00, 0x08, 0x18, 0x28, 0x48, 0x7c, 0x08, 0x00,
-  0x00, 0x7c, 0x40, 0x78, 0x04, 0x44, 0x38, 0x00, 0x00, 0x38, 0x40, 0x78,
-  0x44, 0x44, 0x38, 0x00, 0x00, 0x7c, 0x04, 0x08, 0x10, 0x10, 0x10, 0x00,
-  0x00, 0x38, 0x44, 0x38, 0x44, 0x44, 0x38, 0x00, 0x00, 0x38, 0x44, 0x44,
-  0x3c, 0x04, 0x38, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10, 0x20, 0x00, 0x00, 0x08, 0x10,
-  0x20, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x08, 0x04, 0x08, 0x10, 0x00, 0x00, 0x38, 0x44, 0x08,
-  0x10, 0x00, 0x10, 0x00, 0x00, 0x38, 0x4c, 0x5c, 0x5c, 0x40, 0x38, 0x00,
-  0x00, 0x38, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x00, 0x00, 0x78, 0x44, 0x78,
-  0x44, 0x44, 0x78, 0x00, 0x00, 0x38, 0x44, 0x40, 0x40, 0x44, 0x38, 0x00,
-  0x00, 0x70, 0x48, 0x44, 0x44, 0x48, 0x70, 0x00, 0x00, 0x7c, 0x40, 0x78,
-  0x40, 0x40, 0x7c, 0x00, 0x00, 0x7c, 0x40, 0x78, 0x40, 0x40, 0x40, 0x00,
-  0x00, 0x38, 0x44, 0x40, 0x4c, 0x44, 0x38, 0x00, 0x00, 0x44, 0x44, 0x7c,
-  0x44, 0x44, 0x44, 0x00, 0x00, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x00,
-  0x00, 0x04, 0x04, 0x04, 0x44, 0x44, 0x38, 0x00, 0x00, 0x48, 0x50, 0x60,
-  0x50, 0x48, 0x44, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7c, 0x00,
-  0x00, 0x44, 0x6c, 0x54, 0x44, 0x44, 0x44, 0x00, 0x00, 0x44, 0x64, 0x54,
-  0x54, 0x4c, 0x44, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00,
-  0x00, 0x78, 0x44, 0x44, 0x78, 0x40, 0x40, 0x00, 0x00, 0x38, 0x44, 0x44,
-  0x64, 0x54, 0x38, 0x00, 0x00, 0x78, 0x44, 0x44, 0x78, 0x48, 0x44, 0x00,
-  0x00, 0x38, 0x40, 0x38, 0x04, 0x44, 0x38, 0x00, 0x00, 0x7c, 0x10, 0x10,
-  0x10, 0x10, 0x10, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00,
-  0x00, 0x44, 0x44, 0x44, 0x44, 0x28, 0x10, 0x00, 0x00, 0x44, 0x44, 0x44,
-  0x44, 0x54, 0x28, 0x00, 0x00, 0x44, 0x28, 0x10, 0x10, 0x28, 0x44, 0x00,
-  0x00, 0x44, 0x44, 0x28, 0x10, 0x10, 0x10, 0x00, 0x00, 0x7c, 0x08, 0x10,
-  0x10, 0x20, 0x7c, 0x00, 0x00, 0x1c, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x00,
-  0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00, 0x70, 0x10, 0x10,
-  0x10, 0x10, 0x70, 0x00, 0x00, 0x10, 0x38, 0x54, 0x10, 0x10, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x18, 0x24, 0x70,
-  0x20, 0x20, 0x7c, 0x00, 0x00, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00,
-  0x00, 0x40, 0x40, 0x78, 0x44, 0x44, 0x78, 0x00, 0x00, 0x00, 0x1c, 0x20,
-  0x20, 0x20, 0x1c, 0x00, 0x00, 0x04, 0x04, 0x3c, 0x44, 0x44, 0x3c, 0x00,
-  0x00, 0x00, 0x38, 0x44, 0x78, 0x40, 0x3c, 0x00, 0x00, 0x18, 0x20, 0x30,
-  0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x44, 0x44, 0x3c, 0x04, 0x38,
-  0x00, 0x40, 0x40, 0x78, 0x44, 0x44, 0x44, 0x00, 0x00, 0x10, 0x00, 0x30,
-  0x10, 0x10, 0x38, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x24, 0x18,
-  0x00, 0x20, 0x28, 0x30, 0x30, 0x28, 0x24, 0x00, 0x00, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x18, 0x00, 0x00, 0x00, 0x68, 0x54, 0x54, 0x54, 0x54, 0x00,
-  0x00, 0x00, 0x78, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x38, 0x44,
-  0x44, 0x44, 0x38, 0x00, 0x00, 0x00, 0x78, 0x44, 0x44, 0x78, 0x40, 0x40,
-  0x00, 0x00, 0x3c, 0x44, 0x44, 0x3c, 0x04, 0x04, 0x00, 0x00, 0x1c, 0x20,
-  0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x38, 0x40, 0x38, 0x04, 0x78, 0x00,
-  0x00, 0x20, 0x70, 0x20, 0x20, 0x20, 0x18, 0x00, 0x00, 0x00, 0x44, 0x44,
-  0x44, 0x44, 0x38, 0x00, 0x00, 0x00, 0x44, 0x44, 0x28, 0x28, 0x10, 0x00,
-  0x00, 0x00, 0x44, 0x54, 0x54, 0x54, 0x28, 0x00, 0x00, 0x00, 0x44, 0x28,
-  0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x3c, 0x04, 0x38,
-  0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x00, 0x1c, 0x10, 0x60,
-  0x10, 0x10, 0x1c, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00,
-  0x00, 0x70, 0x10, 0x0c, 0x10, 0x10, 0x70, 0x00, 0x00, 0x14, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0xb4, 0xc4, 0xc4, 0xb4, 0x48, 0x30,
-  0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0x00, 0x3c, 0x46, 0x4a,
-  0x52, 0x62, 0x3c, 0x00, 0x00, 0x18, 0x28, 0x08, 0x08, 0x08, 0x3e, 0x00,
-  0x00, 0x3c, 0x42, 0x02, 0x3c, 0x40, 0x7e, 0x00, 0x00, 0x3c, 0x42, 0x0c,
-  0x02, 0x42, 0x3c, 0x00, 0x00, 0x08, 0x18, 0x28, 0x48, 0x7e, 0x08, 0x00,
-  0x00, 0x7e, 0x40, 0x7c, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x3c, 0x40, 0x7c,
-  0x42, 0x42, 0x3c, 0x00, 0x00, 0x7e, 0x02, 0x04, 0x08, 0x10, 0x10, 0x00,
-  0x00, 0x3c, 0x42, 0x3c, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x3c, 0x42, 0x42,
-  0x3e, 0x42, 0x3c, 0x00, 0xfc, 0xf0, 0xe0, 0xc0, 0x80, 0x80, 0x00, 0x00,
-  0x3f, 0x0f, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x03, 0x0c, 0x10, 0x20,
-  0x40, 0x40, 0x80, 0x80, 0xc0, 0x30, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0,
-  0xe0, 0xf0, 0xfc, 0xff, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x3f, 0xff,
-  0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c, 0x3c, 0x4e, 0x8f, 0x8f,
-  0xff, 0xff, 0x7e, 0x3c, 0x3c, 0x4e, 0x8f, 0x8f, 0x8f, 0x8f, 0x4e, 0x3c,
-  0x3c, 0x4e, 0x8f, 0x8f, 0x81, 0x81, 0x42, 0x3c, 0x3c, 0x42, 0x81, 0x81,
-  0x81, 0x81, 0x42, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00
-};
-unsigned int testrom_bin_len = 16384;
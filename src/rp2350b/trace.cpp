@@ -0,0 +1,213 @@
+#include "trace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "screencast.h"
+#include "sram.h"
+#include "utils.h"
+
+__zx_bank TraceEntry TraceRing[TraceEntries];
+__zx_data volatile uint32_t TraceMask = 0;
+__zx_data volatile uint32_t TraceMatch = TraceNever;
+__zx_data std::atomic<uint32_t> TraceHead{0};
+__zx_data std::atomic<uint32_t> TraceTail{0};
+__zx_data volatile uint32_t TraceDropped = 0;
+
+namespace {
+
+const TraceSink *Sink = nullptr;
+int Filter = 0;             // of the trace running or ending
+int Next = 0;               // starts once the one before is sent out
+int Ended = 0;              // to report once its last frame is out
+bool Ending = false;        // the last frame of a trace is still due
+uint32_t DroppedBase = 0;
+uint16_t Seq = 0;
+TraceStats Stats;
+
+// the frame on its way out
+uint8_t Frame[TraceMaxFrame];
+uint32_t FrameSize = 0;
+uint32_t FrameSent = 0;
+
+uint8_t *put16(uint8_t *out, uint16_t value)
+{
+    out[0] = value;
+    out[1] = value >> 8;
+    return out + 2;
+}
+
+uint8_t *put32(uint8_t *out, uint32_t value)
+{
+    out = put16(out, value);
+    return put16(out, value >> 16);
+}
+
+uint8_t *put_leb128(uint8_t *out, uint32_t value)
+{
+    while (value >= 0x80) {
+        *out++ = value | 0x80;
+        value >>= 7;
+    }
+    *out++ = value;
+    return out;
+}
+
+void report()
+{
+    char message[112];
+    snprintf(message, sizeof(message), "Bus trace %s: %lu words in %lu frames, %lu bytes, %lu dropped",
+             TraceFilters[Ended].name, (unsigned long)Stats.entries, (unsigned long)Stats.frames,
+             (unsigned long)Stats.bytes, (unsigned long)Stats.dropped);
+    notice(message);
+}
+
+void start(int filter)
+{
+    Filter = filter;
+    Stats = TraceStats{};
+    Seq = 0;
+    DroppedBase = TraceDropped;
+    // a word the last trace recorded as it was stopped
+    TraceTail.store(TraceHead.load(std::memory_order_acquire), std::memory_order_release);
+    // the mask first: with the old match nothing passes it meanwhile
+    TraceMask = TraceFilters[filter].mask;
+    TraceMatch = TraceFilters[filter].match;
+
+    char message[48];
+    snprintf(message, sizeof(message), "Bus trace %s started", TraceFilters[filter].name);
+    notice(message);
+}
+
+void stop()
+{
+    if (!Filter || Ending)
+        return;
+    TraceMatch = TraceNever;
+    TraceMask = 0;
+    Ending = true;
+}
+
+} // namespace {
+
+void trace_init(const TraceSink *sink)
+{
+    Sink = sink;
+}
+
+uint16_t trace_check(const uint8_t *data, uint32_t size)
+{
+    // Fletcher-16, the sums fit 32 bits for 5802 bytes before the modulo
+    uint32_t a = 0, b = 0;
+    while (size) {
+        const uint32_t block = std::min(size, 5802u);
+        for (uint32_t i = 0; i < block; ++i) {
+            a += data[i];
+            b += a;
+        }
+        a %= 255;
+        b %= 255;
+        data += block;
+        size -= block;
+    }
+    return b << 8 | a;
+}
+
+int trace_filter()
+{
+    return Ending ? 0 : Filter;
+}
+
+bool trace_link_busy()
+{
+    return Filter || Next || FrameSent != FrameSize;
+}
+
+const TraceStats &trace_stats()
+{
+    return Stats;
+}
+
+uint32_t trace_frame(uint8_t *out)
+{
+    const uint32_t tail = TraceTail.load(std::memory_order_relaxed);
+    const uint32_t count = std::min(TraceHead.load(std::memory_order_acquire) - tail, TraceFrameEntries);
+    if (!count && !Ending)
+        return 0;
+
+    uint8_t *p = out + TraceHeaderSize;
+    const uint32_t first = TraceRing[tail % TraceEntries].cycles;
+    uint32_t last = first;
+    for (uint32_t i = 0; i < count; ++i) {
+        const TraceEntry &entry = TraceRing[(tail + i) % TraceEntries];
+        p = put_leb128(p, entry.cycles - last);
+        p = put32(p, entry.bus);
+        last = entry.cycles;
+    }
+    TraceTail.store(tail + count, std::memory_order_release);
+
+    const uint32_t bytes = p - out - TraceHeaderSize;
+    Stats.dropped = TraceDropped - DroppedBase;
+    uint8_t *h = put32(out, TraceMagic);
+    h = put16(h, count);
+    h = put16(h, bytes);
+    h = put32(h, count ? first : 0);
+    h = put32(h, Stats.dropped);
+    h = put16(h, Seq++);
+    put16(h, trace_check(out + TraceHeaderSize, bytes));
+
+    Stats.entries += count;
+    Stats.bytes += TraceHeaderSize + bytes;
+    ++Stats.frames;
+    if (!count) {
+        // that was the last one
+        Ending = false;
+        Ended = Filter;
+        Filter = 0;
+    }
+    return TraceHeaderSize + bytes;
+}
+
+void trace_request(uint8_t filter)
+{
+    if (filter >= TraceFilterCount) {
+        error("No such bus trace filter");
+    } else if (filter && !Sink) {
+        error("Bus trace needs a USB link");
+    } else {
+        stop();
+        Next = filter;
+    }
+}
+
+void trace_task()
+{
+    // as much as the link takes, never waiting on it
+    uint32_t space = Sink ? Sink->space() : 0;
+    while (space) {
+        if (FrameSent == FrameSize) {
+            FrameSize = trace_frame(Frame);
+            FrameSent = 0;
+            if (!FrameSize)
+                break;
+        }
+        const uint32_t size = std::min(space, FrameSize - FrameSent);
+        Sink->write(Frame + FrameSent, size);
+        FrameSent += size;
+        space -= size;
+    }
+
+    // the console only between two frames
+    if (FrameSent != FrameSize)
+        return;
+    if (Ended) {
+        report();
+        Ended = 0;
+    }
+    // and between two frames of the screen stream
+    if (Next && !Filter && !screencast_sending()) {
+        start(Next);
+        Next = 0;
+    }
+}
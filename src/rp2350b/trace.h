@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+
+#include <atomic>
+
+#include "cycles.h"
+#include "zx.pio.h"
+
+// Bus trace: every bus word core1 pops from the PIO, with its cycle stamp.
+//
+// core1 appends the words passing the filter to TraceRing, a single producer
+// ring it never waits on: when core0 falls behind the new words are counted
+// in TraceDropped instead. That is two loads and a compare with the trace
+// off, the cycle counter, two stores and the head store with it on.
+//
+// core0 drains the ring in frames through a TraceSink, the USB CDC in the
+// firmware. All little endian:
+//
+//   u32 TraceMagic
+//   u16 entries     0 for the last frame of a trace
+//   u16 bytes       of the payload
+//   u32 cycles      stamp of the first entry, core1 cycles
+//   u32 dropped     words lost since the trace started
+//   u16 seq         frame number, from 0
+//   u16 check       trace_check() of the payload
+//   payload         for each entry: the cycles since the entry before it
+//                   (LEB128, 0 for the first one) and the u32 bus word
+//
+// The frames share the CDC with the console, the decoder finds them by the
+// magic. A console line in the middle of a frame costs that frame: it fails
+// the check and the gap in seq shows it.
+
+constexpr uint32_t TraceEntries = 2048;     // a power of two, 8 bytes each
+constexpr uint32_t TraceMagic = 0x72744649; // "IFtr"
+constexpr uint32_t TraceHeaderSize = 20;
+constexpr uint32_t TraceFrameEntries = 256;
+constexpr uint32_t TraceMaxFrame = TraceHeaderSize + TraceFrameEntries * (5 + 4);
+constexpr uint32_t TraceNever = 0xffffffff; // TraceMatch of a stopped trace, see trace_record()
+
+// ZPI command 0b0001xxxx starts the trace with filter xxxx, 0 stops it
+struct TraceFilter
+{
+    const char *name;
+    uint32_t mask;      // a word is traced when (bus & mask) == match
+    uint32_t match;
+};
+
+constexpr TraceFilter TraceFilters[] = {
+    {"off", 0, TraceNever},
+    {"all", 0, 0},
+    {"mreq", 1u << I_MREQ_L, 0},
+    {"mreq rd", (1u << I_MREQ_L) | (1u << I_RD_L), 0},
+    {"mreq wr", (1u << I_MREQ_L) | (1u << I_RD_L), 1u << I_RD_L},
+    {"rom rd", (1u << I_MREQ_L) | (1u << I_RD_L) | (0xc000u << I_ADDR_BASE), 0},
+    {"iorq", 1u << I_IORQ_L, 0},
+    {"ula", (1u << I_IORQ_L) | (1u << I_ADDR_BASE), 0},
+};
+constexpr int TraceFilterCount = sizeof(TraceFilters) / sizeof(TraceFilters[0]);
+
+struct TraceEntry
+{
+    uint32_t bus;
+    uint32_t cycles;
+};
+
+// Writes a frame out, space() is how much the link takes without blocking
+struct TraceSink
+{
+    uint32_t (*space)();
+    void (*write)(const uint8_t *data, uint32_t size);
+};
+
+struct TraceStats
+{
+    uint32_t entries = 0;   // sent since the trace started
+    uint32_t dropped = 0;
+    uint32_t frames = 0;
+    uint32_t bytes = 0;
+};
+
+extern TraceEntry TraceRing[TraceEntries];
+extern volatile uint32_t TraceMask;
+extern volatile uint32_t TraceMatch;
+extern std::atomic<uint32_t> TraceHead;    // written by core1
+extern std::atomic<uint32_t> TraceTail;    // written by core0
+extern volatile uint32_t TraceDropped;     // never reset, see TraceStats
+
+// core0, without a sink every trace request is refused
+void trace_init(const TraceSink *sink);
+// the filter of the trace running, 0 for none
+int trace_filter();
+// true while a trace runs, is due to start or has a frame going out: the
+// screen stream of screencast.h shares the link and waits
+bool trace_link_busy();
+const TraceStats &trace_stats();
+
+// core0: encodes the next frame into out, TraceMaxFrame bytes, and returns
+// its size, 0 when nothing is pending. Used by trace_task(), the benches call
+// it directly.
+uint32_t trace_frame(uint8_t *out);
+
+// Fletcher-16 of a frame payload
+uint16_t trace_check(const uint8_t *data, uint32_t size);
+
+// core0: starts filter index, 0 stops. A trace running is stopped and sent
+// out to its last frame before the next one starts.
+void trace_request(uint8_t filter);
+
+// core0: starts the trace requested and sends what the link takes
+void trace_task();
+
+// core1: called with every word popped from the PIO
+__force_inline void trace_record(uint32_t bus)
+{
+    if ((bus & TraceMask) != TraceMatch)
+        return;
+    const uint32_t head = TraceHead.load(std::memory_order_relaxed);
+    if (head - TraceTail.load(std::memory_order_relaxed) >= TraceEntries) {
+        TraceDropped = TraceDropped + 1;
+        return;
+    }
+    TraceEntry &entry = TraceRing[head % TraceEntries];
+    entry.bus = bus;
+    entry.cycles = cycles_now();
+    TraceHead.store(head + 1, std::memory_order_release);
+}
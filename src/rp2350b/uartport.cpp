@@ -0,0 +1,88 @@
+#include "uartport.h"
+
+#include <hardware/dma.h>
+#include <hardware/gpio.h>
+#include <hardware/uart.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+uart_inst_t *const EspUart = uart0;
+constexpr uint EspTx = 0;
+constexpr uint EspRx = 1;
+
+// the DMA ring wraps at an address aligned to its size
+alignas(UartPort::RxRingSize) uint8_t RxRing[UartPort::RxRingSize];
+alignas(UartPort::TxRingSize) uint8_t TxRing[UartPort::TxRingSize];
+} // namespace {
+
+uint32_t UartPort::init(uint32_t baudrate)
+{
+    if (m_rxChan < 0) {
+        m_rxChan = dma_claim_unused_channel(false);
+        m_txChan = dma_claim_unused_channel(false);
+        if (m_rxChan < 0 || m_txChan < 0)
+            return 0;
+    }
+    baudrate = uart_init(EspUart, baudrate);
+    gpio_set_function(EspTx, GPIO_FUNC_UART);
+    gpio_set_function(EspRx, GPIO_FUNC_UART);
+    gpio_pull_up(EspRx);
+
+    dma_channel_config cfg = dma_channel_get_default_config(m_rxChan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_ring(&cfg, true, RxRingBits);
+    channel_config_set_dreq(&cfg, uart_get_dreq(EspUart, false));
+    dma_channel_configure(m_rxChan, &cfg, RxRing, &uart_get_hw(EspUart)->dr,
+                          DMA_CH0_TRANS_COUNT_MODE_VALUE_ENDLESS << DMA_CH0_TRANS_COUNT_MODE_LSB, true);
+    m_rxTail = 0;
+
+    cfg = dma_channel_get_default_config(m_txChan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_ring(&cfg, false, TxRingBits);
+    channel_config_set_dreq(&cfg, uart_get_dreq(EspUart, true));
+    dma_channel_configure(m_txChan, &cfg, &uart_get_hw(EspUart)->dr, TxRing, 0, false);
+    m_txHead = m_txStarted = 0;
+    return baudrate;
+}
+
+uint32_t UartPort::read(uint8_t *data, uint32_t size)
+{
+    const uint32_t head = (dma_hw->ch[m_rxChan].write_addr - uintptr_t(RxRing)) & (RxRingSize - 1);
+    size = std::min(size, (head - m_rxTail) & (RxRingSize - 1));
+    for (uint32_t i = 0; i < size; ++i)
+        data[i] = RxRing[(m_rxTail + i) & (RxRingSize - 1)];
+    m_rxTail = (m_rxTail + size) & (RxRingSize - 1);
+    return size;
+}
+
+void UartPort::startTx()
+{
+    if (m_txHead == m_txStarted || dma_channel_is_busy(m_txChan))
+        return;
+    dma_channel_transfer_from_buffer_now(m_txChan, TxRing + (m_txStarted & (TxRingSize - 1)),
+                                         m_txHead - m_txStarted);
+    m_txStarted = m_txHead;
+}
+
+uint32_t UartPort::space()
+{
+    startTx();
+    const uint32_t sending = dma_hw->ch[m_txChan].transfer_count & DMA_CH0_TRANS_COUNT_COUNT_BITS;
+    return TxRingSize - (m_txHead - m_txStarted) - sending;
+}
+
+void UartPort::write(const uint8_t *data, uint32_t size)
+{
+    const uint32_t at = m_txHead & (TxRingSize - 1);
+    const uint32_t first = std::min(size, TxRingSize - at);
+    memcpy(TxRing + at, data, first);
+    memcpy(TxRing, data + first, size - first);
+    m_txHead += size;
+    startTx();
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "serial.h"
+
+// UART0 to the ESP32-C3 SuperMini: GPIO0 TX to its RX, GPIO1 RX from its TX,
+// EXT pads 4 and 6. No flow control lines.
+//
+// Both directions go through a DMA channel and a ring, core0 only copies
+// bytes in and out. RX runs endless into the RxRingSize ring, its write
+// address is how far it got: a reader more than a ring behind loses bytes,
+// the frames of FrameLink fail their check then. TX starts from the
+// TxRingSize ring, its read address wrapping, with what write() added while
+// the channel was idle.
+class UartPort : public SerialPort
+{
+public:
+    static constexpr uint32_t RxRingBits = 12;
+    // about two frames of FrameLink, more only delays the control messages
+    static constexpr uint32_t TxRingBits = 9;
+    static constexpr uint32_t RxRingSize = 1u << RxRingBits;
+    static constexpr uint32_t TxRingSize = 1u << TxRingBits;
+
+    // the baud rate set, 0 when the DMA channels are taken
+    uint32_t init(uint32_t baudrate);
+
+    uint32_t read(uint8_t *data, uint32_t size) override;
+    uint32_t space() override;
+    void write(const uint8_t *data, uint32_t size) override;
+
+private:
+    void startTx();
+
+    int m_rxChan = -1;
+    int m_txChan = -1;
+    uint32_t m_rxTail = 0;      // in the ring
+    uint32_t m_txHead = 0;      // free running, written
+    uint32_t m_txStarted = 0;   // free running, handed to the DMA
+};
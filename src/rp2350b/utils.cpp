@@ -1,8 +1,11 @@
 #include "utils.h"
 
 #include <cstdio>
+#include <cstring>
 
-void error(std::string_view message)
+#include "fs.h"
+
+void error([[maybe_unused]] std::string_view message)
 {
 #ifdef ENABLE_USB_STDIO
     for (int i = 10; i < 25; ++i)
@@ -15,7 +18,7 @@ void error(std::string_view message)
 #endif
 }
 
-void notice(std::string_view message)
+void notice([[maybe_unused]] std::string_view message)
 {
 #ifdef ENABLE_USB_STDIO
     for (int i = 10; i < 25; ++i)
@@ -27,3 +30,35 @@ void notice(std::string_view message)
     printf("\033[35mNotice: %s\033[37m\n", message.data());
 #endif
 }
+
+uint32_t crc32(const uint8_t *data, uint32_t size, uint32_t crc)
+{
+    // a nibble at a time, the reflected 0x04c11db7 polynomial
+    static constexpr uint32_t Table[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+    };
+    crc = ~crc;
+    for (uint32_t i = 0; i < size; ++i) {
+        crc = Table[(crc ^ data[i]) & 15] ^ (crc >> 4);
+        crc = Table[(crc ^ (data[i] >> 4)) & 15] ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
+int next_file_number(FileSystem &fs, const char *prefix, const char *ext)
+{
+    const size_t prefixSize = strlen(prefix);
+    int next = 0;
+    uint32_t cursor = 0;
+    FsEntry entry;
+    while (fs.list(cursor, entry)) {
+        int number;
+        char found[4];
+        if (!strncmp(entry.name, prefix, prefixSize) && sscanf(entry.name + prefixSize, "%4d.%3s", &number, found) == 2
+            && !strcmp(found, ext) && number >= next) {
+            next = number + 1;
+        }
+    }
+    return next;
+}
@@ -1,6 +1,16 @@
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 
+class FileSystem;
+
 void error(std::string_view message);
 void notice(std::string_view message);
+
+// CRC-32 as zip and PNG use it, crc carries on from an earlier part
+uint32_t crc32(const uint8_t *data, uint32_t size, uint32_t crc = 0);
+
+// the number after the highest PREFIXnnnn.EXT in fs, 0 without any: where
+// numbered files like screenshots go next
+int next_file_number(FileSystem &fs, const char *prefix, const char *ext);
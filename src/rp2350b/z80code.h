@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+// Writes Z80 code into a shadow ROM image, for the Pico generated routines.
+class Z80Code
+{
+public:
+    Z80Code(uint8_t *image, uint16_t org)
+        : m_image(image)
+        , m_pc(org)
+    {}
+
+    uint16_t pc() const { return m_pc; }
+
+    void b(uint8_t value) { m_image[m_pc++] = value; }
+    void w(uint16_t value)
+    {
+        b(value);
+        b(value >> 8);
+    }
+
+    // a word operand filled in later with patch(), returns its address
+    uint16_t later()
+    {
+        w(0);
+        return m_pc - 2;
+    }
+    void patch(uint16_t at, uint16_t value)
+    {
+        m_image[at] = value;
+        m_image[at + 1] = value >> 8;
+    }
+
+    // a relative jump, to target or to a later patchJr()
+    void jr(uint8_t op, uint16_t target)
+    {
+        b(op);
+        b(target - m_pc - 1);
+    }
+    uint16_t jrLater(uint8_t op)
+    {
+        b(op);
+        b(0);
+        return m_pc - 1;
+    }
+    void patchJr(uint16_t at) { m_image[at] = m_pc - at - 1; }
+
+private:
+    uint8_t *m_image;
+    uint16_t m_pc;
+};
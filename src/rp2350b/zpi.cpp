@@ -0,0 +1,447 @@
+#include "zpi.h"
+
+#include <hardware/timer.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include "bdos.h"
+#include "io.h"
+#include "mailbox.h"
+#include "sram.h"
+#include "tape.h"
+#include "utils.h"
+
+namespace {
+
+enum BufferState : uint8_t {
+    Free,       // owned by core1
+    Stored,     // core1 -> core0: holds a page or a screen sent by the Z80
+    Requested,  // core1 -> core0: fill it with what the Z80 asked for
+    Loaded,     // core0 -> core1: ready to be read by the Z80
+    Done,       // core1 -> core0: read by the Z80, only the stats are left
+};
+
+constexpr int BdosPage = -2; // page number used for B4/BDOS calls
+constexpr int TapePage = -3; // page number used for tape requests
+
+struct Buffer
+{
+    uint8_t data[ZpiPageSize];
+    std::atomic<uint8_t> state{Free};
+    int page = 0;
+    uint16_t size = 0;
+    uint32_t seq = 0;       // hand over order, see zpi_task()
+    uint32_t startUs = 0;
+    uint32_t endUs = 0;
+};
+
+Buffer Buffers[2];
+
+enum Mode : uint8_t {
+    Idle,
+    ZxWrite,     // the Z80 is sending a page or a screen
+    ZxReadWait,  // the Z80 asked for a page, a screen or a reply, core0 is fetching it
+    ZxRead,      // the Z80 is reading a page, a screen or a B4/BDOS reply
+    ZxBdos,      // the Z80 is sending a B4/BDOS call
+    ZxTape,      // the Z80 is sending a tape request
+};
+
+// bus side, core1 only; Buffers stay in SRAM0-3, see IFP_SHARED_DATA
+__zx_data Mode CurrentMode = Idle;
+__zx_data Buffer *Current = nullptr;
+__zx_data uint8_t Command = 0;
+__zx_data uint16_t Pos = 0;
+__zx_data uint16_t CurrentSize = 0;
+__zx_data int NextBuffer = 0;
+__zx_data uint32_t Sequence = 0;
+__zx_data uint8_t BdosLeft = 0;    // bytes left in the current argument
+__zx_data uint8_t BdosBlocks = 0;  // BL blocks still to come
+__zx_data bool BdosReply = false;
+__zx_data std::atomic<uint32_t> Overruns{0};
+
+// raw stream of zpi_stream(), core0 arms it, core1 drains it
+__zx_data const uint8_t *StreamEnd = nullptr;
+__zx_data std::atomic<uint32_t> StreamLeft{0};
+
+// core0 only
+const ZpiStore *Store = nullptr;
+ZpiStats Stats;
+uint8_t Screen[ZpiScreenSize];
+
+void default_store(int page, const uint8_t *data, uint16_t size)
+{
+    if (page == ZpiScreen)
+        memcpy(Screen, data, size);
+}
+
+void default_load(int page, uint8_t *data, uint16_t size)
+{
+    if (page == ZpiScreen)
+        memcpy(data, Screen, size);
+    else
+        memset(data, 0, size);
+}
+
+const ZpiStore DefaultStore{default_store, default_load};
+
+Buffer *__zx_code(take_buffer)()
+{
+    Buffer *buf = &Buffers[NextBuffer];
+    const uint8_t state = buf->state.load(std::memory_order_acquire);
+    // a loaded buffer that is not the current one was abandoned by the Z80
+    if (state != Free && (state != Loaded || buf == Current))
+        return nullptr;
+    NextBuffer ^= 1;
+    return buf;
+}
+
+void __zx_code(request_load)()
+{
+    Current->page = (Command & 0x80) ? Command & 0x3f : ZpiScreen;
+    Current->size = CurrentSize;
+    Current->seq = ++Sequence;
+    Current->state.store(Requested, std::memory_order_release);
+}
+
+void __zx_code(abort_transfer)()
+{
+    // a new command aborts the transfer in progress
+    if (CurrentMode == ZxRead)
+        Current->state.store(Free, std::memory_order_release);
+    Current = nullptr;
+}
+
+void __zx_code(start_transfer)(int page, uint16_t size, bool fromZx)
+{
+    abort_transfer();
+    Current = take_buffer();
+    CurrentSize = size;
+    Pos = 0;
+    if (fromZx) {
+        CurrentMode = ZxWrite;
+        if (!Current) {
+            // the bytes are still swallowed, so they are not taken as commands
+            Overruns.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        Current->page = page;
+        Current->size = size;
+        Current->startUs = time_us_32();
+    } else {
+        CurrentMode = ZxReadWait;
+        if (Current)
+            request_load();
+    }
+}
+
+// a B4/BDOS call or a tape request
+void __zx_code(start_request)(Mode mode)
+{
+    abort_transfer();
+    Current = take_buffer();
+    CurrentMode = mode;
+    Pos = 0;
+    if (!Current)
+        Overruns.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Collects a tape request, answered with the handshake of a page read and a
+// stream armed by tape_request()
+void __zx_code(tape_write)(uint8_t data)
+{
+    if (Current)
+        Current->data[Pos] = data;
+    if (++Pos < TapeRequestSize)
+        return;
+
+    CurrentMode = Idle;
+    if (!Current)
+        return; // dropped, the routine reads 0xff and fails
+    Current->page = TapePage;
+    Current->size = Pos;
+    Current->seq = ++Sequence;
+    CurrentMode = ZxReadWait;
+    Current->state.store(Requested, std::memory_order_release);
+}
+
+// Frames a B4/BDOS call: the function number, then its byte or BL arguments
+void __zx_code(bdos_write)(uint8_t data)
+{
+    if (Current)
+        Current->data[Pos] = data;
+    if (!Pos++) {
+        const BdosArgs args = data < BdosFunctions ? BdosRequestArgs[data] : BdosNone;
+        BdosReply = data < BdosFunctions && BdosHasReply[data];
+        BdosLeft = args == BdosByte;
+        BdosBlocks = args == BdosBl ? 1 : args == BdosBlBl ? 2 : 0;
+    } else if (BdosLeft) {
+        --BdosLeft;
+    } else {
+        --BdosBlocks;
+        BdosLeft = data;
+    }
+    if (BdosLeft || BdosBlocks)
+        return;
+
+    CurrentMode = Idle;
+    if (!Current)
+        return; // dropped, the Z80 reads 0xff instead of the reply
+    Current->page = BdosPage;
+    Current->size = Pos;
+    Current->seq = ++Sequence;
+    if (BdosReply) {
+        // same handshake as a page read
+        CurrentMode = ZxReadWait;
+        Current->state.store(Requested, std::memory_order_release);
+        return;
+    }
+    Current->state.store(Stored, std::memory_order_release);
+    Current = nullptr;
+}
+
+void __zx_code(command)(uint8_t data)
+{
+    Command = data;
+    if (data & 0x80) {
+        // 0b1Yxxxxxx - 8k memory paged transfer
+        start_transfer(data & 0x3f, ZpiPageSize, data & 0x40);
+    } else if ((data & 0xdf) == 0x5f) {
+        // 0b01Y11111 - entire screen transfer
+        start_transfer(ZpiScreen, ZpiScreenSize, data & 0x20);
+    } else if ((data & 0xf0) == 0x10) {
+        // 0b0001xxxx - bus trace with filter xxxx, 0 stops it
+        mailbox_post(MailToCore0, MailTag::Trace, data & 0x0f);
+    } else if ((data & 0xf0) == 0x20) {
+        // 0b0010xxxx - select clock profile, 0x0f for auto
+        mailbox_post(MailToCore0, MailTag::Profile, data & 0x0f);
+    } else if ((data & 0xf0) == 0x30) {
+        // 0b0011xxxx - select ROM image
+        mailbox_post(MailToCore0, MailTag::RomImage, data & 0x0f);
+    } else if ((data & 0xf0) == 0x40) {
+        // 0b0100xxxx - load a snapshot of the PSRAM library
+        mailbox_post(MailToCore0, MailTag::Snapshot, data & 0x0f);
+    } else if ((data & 0xf0) == 0x50) {
+        // 0b0101xxxx - capture, 0b01011111 is the screen transfer above
+        mailbox_post(MailToCore0, MailTag::Screen, data & 0x0f);
+    } else if (data == BdosCommand) {
+        // 0b00000010 - B4/BDOS function call
+        start_request(ZxBdos);
+    } else if (data == TapeCommand) {
+        // 0b00000100 - tape request of the LD-BYTES routine, the answer to an
+        // earlier one the routine gave up on is dropped
+        zpi_stream_cancel();
+        start_request(ZxTape);
+    } else if (data == ZpiNmiCommand) {
+        // 0b00001110 - pulse /NMI, core0 owns the pin
+        mailbox_post(MailToCore0, MailTag::Nmi);
+    }
+}
+
+void __zx_code(zpi_write)(uint16_t, uint8_t data)
+{
+    if (CurrentMode == ZxBdos) {
+        bdos_write(data);
+        return;
+    }
+    if (CurrentMode == ZxTape) {
+        tape_write(data);
+        return;
+    }
+    if (CurrentMode != ZxWrite) {
+        command(data);
+        return;
+    }
+
+    if (Current)
+        Current->data[Pos] = data;
+    if (++Pos < CurrentSize)
+        return;
+
+    CurrentMode = Idle;
+    if (Current) {
+        Current->endUs = time_us_32();
+        Current->seq = ++Sequence;
+        Current->state.store(Stored, std::memory_order_release);
+        Current = nullptr;
+    }
+}
+
+uint8_t __zx_code(zpi_read)(uint16_t)
+{
+    uint32_t left = StreamLeft.load(std::memory_order_acquire);
+    // a cancelled stream must not be revived, hence the exchange; a stream
+    // armed as a reply starts after the handshake
+    if (left && CurrentMode != ZxReadWait
+        && StreamLeft.compare_exchange_strong(left, left - 1, std::memory_order_relaxed)) [[unlikely]]
+        return StreamEnd[-int32_t(left)];
+
+    switch (CurrentMode) {
+    case ZxRead: {
+        const uint8_t data = Current->data[Pos];
+        if (++Pos == CurrentSize) {
+            CurrentMode = Idle;
+            Current->endUs = time_us_32();
+            Current->state.store(Done, std::memory_order_release);
+            Current = nullptr;
+        }
+        return data;
+    }
+    case ZxReadWait:
+        // the Z80 polls until it reads something else than the command
+        if (!Current) {
+            Current = take_buffer();
+            if (Current)
+                request_load();
+            return Command;
+        }
+        if (Current->state.load(std::memory_order_acquire) != Loaded)
+            return Command;
+        if (!Current->size) {
+            // answered through zpi_stream()
+            CurrentMode = Idle;
+            Current->state.store(Done, std::memory_order_release);
+            Current = nullptr;
+            return ~Command;
+        }
+        CurrentMode = ZxRead;
+        Pos = 0;
+        CurrentSize = Current->size;
+        Current->startUs = time_us_32();
+        return ~Command;
+    default:
+        return 0xff;
+    }
+}
+
+const IoDevice ZpiPort{"zpi", 0xff, 0x03, zpi_read, zpi_write};
+
+void report(const Buffer &buf, bool fromZx)
+{
+    Stats.transfers++;
+    Stats.bytes += buf.size;
+    Stats.lastBytes = buf.size;
+    Stats.lastUs = buf.endUs - buf.startUs;
+    Stats.lastPage = buf.page;
+    Stats.lastFromZx = fromZx;
+
+    char message[96];
+    char what[16];
+    if (buf.page == ZpiScreen)
+        snprintf(what, sizeof(what), "screen");
+    else
+        snprintf(what, sizeof(what), "page %d", buf.page);
+    snprintf(message, sizeof(message), "%s %s Z80: %u bytes in %.2f frames, %.0f bytes/frame (min %.2f frames)",
+             what, fromZx ? "from" : "to", unsigned(buf.size), double(Stats.lastUs) / ZxFrameUs,
+             double(zpi_bytes_per_frame()), double(zpi_min_frames(buf.size)));
+    notice(message);
+}
+
+void serve(Buffer &buf, uint8_t state)
+{
+    switch (state) {
+    case Stored:
+        if (buf.page == BdosPage) {
+            bdos_call(buf.data, buf.size, buf.data);
+        } else {
+            Store->store(buf.page, buf.data, buf.size);
+            report(buf, true);
+        }
+        buf.state.store(Free, std::memory_order_release);
+        break;
+    case Requested:
+        if (buf.page == BdosPage) {
+            const int size = bdos_call(buf.data, buf.size, buf.data);
+            if (size == BdosPending)
+                break;
+            buf.size = size;
+        } else if (buf.page == TapePage) {
+            tape_request(buf.data, buf.size);
+            buf.size = 0;
+        } else {
+            Store->load(buf.page, buf.data, buf.size);
+        }
+        buf.state.store(Loaded, std::memory_order_release);
+        break;
+    case Done:
+        if (buf.page != BdosPage && buf.page != TapePage)
+            report(buf, false);
+        buf.state.store(Free, std::memory_order_release);
+        break;
+    default:
+        break;
+    }
+}
+
+bool handed_over(uint8_t state)
+{
+    return state == Stored || state == Requested || state == Done;
+}
+
+} // namespace {
+
+void zpi_init(const ZpiStore *store)
+{
+    Store = store ? store : &DefaultStore;
+    io_register(&ZpiPort);
+}
+
+void zpi_task()
+{
+    // serve the buffers in the order core1 handed them over: a B4/BDOS call
+    // without a reply may be followed at once by another call
+    Buffer *first = &Buffers[0];
+    Buffer *second = &Buffers[1];
+    uint8_t firstState = first->state.load(std::memory_order_acquire);
+    uint8_t secondState = second->state.load(std::memory_order_acquire);
+    if (handed_over(firstState) && handed_over(secondState) && int32_t(second->seq - first->seq) < 0) {
+        std::swap(first, second);
+        std::swap(firstState, secondState);
+    }
+    serve(*first, firstState);
+    serve(*second, secondState);
+    Stats.overruns = Overruns.load(std::memory_order_relaxed);
+}
+
+const ZpiStats &zpi_stats()
+{
+    return Stats;
+}
+
+bool zpi_stream(const uint8_t *data, uint32_t size)
+{
+    if (StreamLeft.load(std::memory_order_relaxed))
+        return false;
+    StreamEnd = data + size;
+    StreamLeft.store(size, std::memory_order_release);
+    return true;
+}
+
+void __zx_code(zpi_stream_cancel)()
+{
+    StreamLeft.store(0, std::memory_order_relaxed);
+}
+
+uint32_t zpi_stream_left()
+{
+    return StreamLeft.load(std::memory_order_relaxed);
+}
+
+const uint8_t *zpi_screen()
+{
+    return Screen;
+}
+
+float zpi_bytes_per_frame()
+{
+    if (!Stats.lastUs)
+        return 0;
+    return float(Stats.lastBytes) * ZxFrameUs / Stats.lastUs;
+}
+
+float zpi_min_frames(uint32_t size)
+{
+    return float(size) * ZxBlockIoTStates / ZxFrameTStates;
+}
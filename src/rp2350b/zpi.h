@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+// Zx Programmable Interface, the port 3 protocol described in zpi.md.
+//
+// The bus side runs on core1 inside the IO handlers: it only moves bytes in
+// and out of two 8K transfer buffers. Everything that may take time (storing
+// or fetching a page) is done by zpi_task() on core0, while the Z80 already
+// streams the next transfer through the other buffer.
+
+constexpr uint16_t ZpiPageSize = 8 * 1024;
+constexpr uint16_t ZpiScreenSize = 6144 + 768;
+constexpr int ZpiPages = 64;
+constexpr int ZpiScreen = -1; // page number used for screen transfers
+constexpr uint8_t ZpiNmiCommand = 0x0e; // out 3,14 brings the IFp menu
+
+// Z80 timings used to rate the transfers
+constexpr uint32_t ZxFrameTStates = 69888;
+constexpr uint32_t ZxFrameUs = 19968;
+constexpr uint32_t ZxBlockIoTStates = 16; // unrolled INI/OUTI
+
+// Backing store of the pages and screens, called on core0 only
+struct ZpiStore
+{
+    // a page (0..63) or a screen (ZpiScreen) arrived from the Z80
+    void (*store)(int page, const uint8_t *data, uint16_t size);
+    // fills data with the page or the screen the Z80 asked for
+    void (*load)(int page, uint8_t *data, uint16_t size);
+};
+
+struct ZpiStats
+{
+    uint32_t transfers = 0;
+    uint32_t bytes = 0;
+    uint32_t overruns = 0;  // transfers dropped because both buffers were busy
+    uint32_t lastBytes = 0;
+    uint32_t lastUs = 0;
+    int lastPage = 0;
+    bool lastFromZx = false;
+};
+
+// Registers port 3, call on core0 before core1 starts. A null store keeps the
+// last screen and discards the pages.
+void zpi_init(const ZpiStore *store);
+
+// core0: serves the transfer buffers handed over by the bus side and reports
+// every finished transfer.
+void zpi_task();
+
+const ZpiStats &zpi_stats();
+
+// core0: the next size port 3 reads return data instead of going through the
+// protocol, used by the Pico generated loaders. Armed while the Z80 waits for a
+// reply, the stream starts after the handshake. data must stay valid until the
+// stream is drained or cancelled. False while another stream is in progress.
+bool zpi_stream(const uint8_t *data, uint32_t size);
+void zpi_stream_cancel();
+uint32_t zpi_stream_left();
+
+// the last screen sent by the Z80 when no store was given to zpi_init()
+const uint8_t *zpi_screen();
+
+// sustained rate of the last transfer
+float zpi_bytes_per_frame();
+
+// the fewest frames a transfer of size bytes can take
+float zpi_min_frames(uint32_t size);
@@ -1,29 +1,50 @@
 #include <hardware/clocks.h>
+#ifdef ZX_ROM_DMA
+#include <hardware/dma.h>
+#endif
+#include <hardware/irq.h>
 #include <hardware/pio.h>
 #include <hardware/timer.h>
 #include <hardware/vreg.h>
-#include <pico/multicore.h>
-
+#include <pico/flash.h>
+
+#include <algorithm>
+#include <atomic>
+
+#include "cycles.h"
+#include "io.h"
+#include "joystick.h"
+#include "mailbox.h"
+#include "ramshadow.h"
+#include "rombank.h"
+#include "sram.h"
+#include "trace.h"
 #include "zx.h"
 
-uint8_t *RomPtr = nullptr;
-uint16_t RomSize = 0;
+__zx_data uint8_t *volatile RomPtr = nullptr;
 
 namespace {
 
-constexpr uint32_t O_NMI    = 3;
+constexpr uint32_t O_NMI    = 2;  // EXT pad 8, open drain: only ever driven low
 constexpr uint32_t O_HC_CPM = 13;
+constexpr uint32_t O_ROMCS1 = 15;  // +2A/+3 ROM chip selects
+constexpr uint32_t O_ROMCS2 = 14;
 constexpr uint32_t O_ROMCS = 25;
+constexpr uint32_t RomcsMask = (1u << O_ROMCS) | (1u << O_ROMCS1) | (1u << O_ROMCS2);
 
 
 #define pio pio2
-int mreqSM = 0;
-uint mreqRxEmptyMask = (1u << (PIO_FSTAT_RXEMPTY_LSB));
-uint mreqTxFullMask = (1u << (PIO_FSTAT_TXFULL_LSB));
+__zx_data int mreqSM = 0;
+__zx_data uint mreqRxEmptyMask = (1u << (PIO_FSTAT_RXEMPTY_LSB));
+__zx_data uint mreqTxFullMask = (1u << (PIO_FSTAT_TXFULL_LSB));
+
+__zx_data int iorqSM = 1;
+__zx_data uint iorqRxEmptyMask = (1u << (PIO_FSTAT_RXEMPTY_LSB));
+__zx_data uint iorqTxFullMask = (1u << (PIO_FSTAT_TXFULL_LSB));
 
-int iorqSM = 1;
-uint iorqRxEmptyMask = (1u << (PIO_FSTAT_RXEMPTY_LSB));
-uint iorqTxFullMask = (1u << (PIO_FSTAT_TXFULL_LSB));
+__zx_data int snoopSM = 2;
+__zx_data uint snoopRxEmptyMask = (1u << (PIO_FSTAT_RXEMPTY_LSB));
+uint snoopOffset = 0;
 
 void setup_common_pio()
 {
@@ -39,7 +60,16 @@ void setup_common_pio()
     gpio_pull_up(PIO_BASE + O_WAIT_L);
 }
 
-void setup_common_config(pio_sm_config *c, int offset, int sm)
+// /WAIT forced low at the pad, whatever the state machines drive: the Z80
+// stops in T2 of the cycle it is in, or of the next one when it sampled
+// /WAIT already
+void hold_bus(bool hold)
+{
+    gpio_set_oeover(PIO_BASE + O_WAIT_L, hold ? GPIO_OVERRIDE_HIGH : GPIO_OVERRIDE_NORMAL);
+    gpio_set_outover(PIO_BASE + O_WAIT_L, hold ? GPIO_OVERRIDE_LOW : GPIO_OVERRIDE_NORMAL);
+}
+
+void setup_common_config(pio_sm_config *c, int offset, int sm, uint outBits)
 {
 
     pio_sm_set_consecutive_pindirs(pio, sm, PIO_BASE + B_DATA_BASE, 8, false);
@@ -53,7 +83,7 @@ void setup_common_config(pio_sm_config *c, int offset, int sm)
 
     sm_config_set_out_pin_base(c, PIO_BASE);
     sm_config_set_out_pin_count(c, 8);
-    sm_config_set_out_shift(c, true, true, 24);
+    sm_config_set_out_shift(c, true, true, outBits);
 
     // if /WR is high we have a /RD
     sm_config_set_jmp_pin(c, PIO_BASE + I_WR_L);
@@ -69,9 +99,21 @@ void setup_zx_mreq_pio()
     mreqRxEmptyMask <<= mreqSM;
     mreqTxFullMask <<= mreqSM;
 
+#ifdef ZX_ROM_DMA
+    // only watching for traps, ROM reads are served by zx_rom
+    auto offset = pio_add_program(pio, &zx_mreq_observe_program);
+    pio_sm_config c = zx_mreq_observe_program_get_default_config(offset);
+    sm_config_set_clkdiv(&c, 1);
+    sm_config_set_in_pin_base(&c, PIO_BASE);
+    sm_config_set_in_shift(&c, true, true, 32);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+    pio_sm_init(pio, mreqSM, offset, &c);
+    pio_sm_set_enabled(pio, mreqSM, true);
+#else
     auto offset = pio_add_program(pio, &zx_mreq_program);
     pio_sm_config c = zx_mreq_program_get_default_config(offset);
-    setup_common_config(&c, offset, mreqSM);
+    setup_common_config(&c, offset, mreqSM, 1 + 24);
+#endif
 }
 
 void setup_zx_iorq_pio()
@@ -81,9 +123,129 @@ void setup_zx_iorq_pio()
     iorqTxFullMask <<= iorqSM;
     auto offset = pio_add_program(pio, &zx_iorq_program);
     pio_sm_config c = zx_iorq_program_get_default_config(offset);
-    setup_common_config(&c, offset, iorqSM);
+    setup_common_config(&c, offset, iorqSM, 24);
+}
+
+// memory writes for ramshadow.cpp, running from the start
+void setup_zx_snoop_pio()
+{
+    snoopSM = pio_claim_unused_sm(pio, true);
+    snoopRxEmptyMask <<= snoopSM;
+    snoopOffset = pio_add_program(pio, &zx_snoop_program);
+    pio_sm_config c = zx_snoop_program_get_default_config(snoopOffset);
+    sm_config_set_clkdiv(&c, 1);
+    sm_config_set_in_pin_base(&c, PIO_BASE);
+    sm_config_set_in_shift(&c, true, true, 32);
+    sm_config_set_jmp_pin(&c, PIO_BASE + I_MREQ_L);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+    pio_sm_init(pio, snoopSM, snoopOffset, &c);
+    pio_sm_set_enabled(pio, snoopSM, true);
 }
 
+#ifdef ZX_ROM_DMA
+__zx_data int romSM = 2;
+int romAddrChan = 0;
+int romDataChan = 1;
+__zx_data uint32_t romPinctrlOn = 0;
+__zx_data uint32_t romPinctrlOff = 0;
+
+// One (data, pindirs) entry for each ROM address, a table for each SRAM set
+// of rombank.cpp, written by zx_rom_dma_load(). zx_rom builds the entry
+// address from the bus itself, so each table must be 32K aligned.
+alignas(0x8000) __zx_bank uint16_t RomDmaTables[2][RomBankSize];
+int RomDmaActive = 0;
+bool RomDmaRunning = false;
+
+uint32_t bit_reverse(uint32_t value)
+{
+    uint32_t out = 0;
+    for (int bit = 0; bit < 32; ++bit, value >>= 1)
+        out = out << 1 | (value & 1);
+    return out;
+}
+
+// zx_rom takes the low 17 bits of y as the table address above the entries.
+// The high bits of y are the other table's, bit reversed, so a single
+// "mov y, ::y" switches tables, see zx_rom_dma_select(). An SRAM address
+// shifted right by 15 fits in 15 bits, the two never overlap.
+uint32_t rom_dma_y(int table)
+{
+    const uint32_t on = uint32_t(RomDmaTables[table]) >> 15;
+    const uint32_t off = uint32_t(RomDmaTables[table ^ 1]) >> 15;
+    return (bit_reverse(off) & 0xfffe0000) | on;
+}
+
+void setup_zx_rom_dma()
+{
+    romSM = pio_claim_unused_sm(pio, true);
+    auto offset = pio_add_program(pio, &zx_rom_program);
+    pio_sm_config c = zx_rom_program_get_default_config(offset);
+    sm_config_set_clkdiv(&c, 1);
+    sm_config_set_in_pin_base(&c, PIO_BASE + I_WR_L);
+    sm_config_set_in_shift(&c, false, true, 32);
+    sm_config_set_out_pin_base(&c, PIO_BASE + B_DATA_BASE);
+    sm_config_set_out_pin_count(&c, 8);
+    sm_config_set_out_shift(&c, true, false, 32);
+    pio_sm_init(pio, romSM, offset, &c);
+
+    // paging the shadow rom out just unmaps the output pins of zx_rom
+    romPinctrlOn = pio->sm[romSM].pinctrl;
+    romPinctrlOff = romPinctrlOn & ~PIO_SM0_PINCTRL_OUT_COUNT_BITS;
+
+    // y holds the table address, see rom_dma_y()
+    pio_sm_put(pio, romSM, rom_dma_y(RomDmaActive));
+    pio_sm_exec(pio, romSM, pio_encode_pull(false, true));
+    pio_sm_exec(pio, romSM, pio_encode_mov(pio_y, pio_osr));
+
+    romAddrChan = dma_claim_unused_channel(true);
+    romDataChan = dma_claim_unused_channel(true);
+
+    // RX FIFO -> read address of the data channel, which also triggers it
+    dma_channel_config cfg = dma_channel_get_default_config(romAddrChan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, pio_get_dreq(pio, romSM, false));
+    channel_config_set_high_priority(&cfg, true);
+    dma_channel_configure(romAddrChan, &cfg, &dma_hw->ch[romDataChan].al3_read_addr_trig, &pio->rxf[romSM], 1, false);
+
+    // table entry -> TX FIFO, then re-arm the address channel
+    cfg = dma_channel_get_default_config(romDataChan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_chain_to(&cfg, romAddrChan);
+    channel_config_set_high_priority(&cfg, true);
+    dma_channel_configure(romDataChan, &cfg, &pio->txf[romSM], RomDmaTables[RomDmaActive], 1, false);
+
+    dma_channel_start(romAddrChan);
+    pio_sm_set_enabled(pio, romSM, true);
+    RomDmaRunning = true;
+}
+#endif
+
+} // namespace {
+
+#ifdef ZX_ROM_DMA
+void zx_rom_dma_load(int table, const uint8_t *rom)
+{
+    for (uint32_t addr = 0; addr < RomBankSize; ++addr)
+        RomDmaTables[table][addr] = 0xff00 | rom[addr];
+}
+
+void zx_rom_dma_select(int table)
+{
+    if (table == RomDmaActive)
+        return;
+    RomDmaActive = table;
+    // SMx_INSTR runs between two instructions of zx_rom, a read takes y
+    // with the single "in y, 17": all of it from one table
+    if (RomDmaRunning)
+        pio_sm_exec(pio, romSM, pio_encode_mov_reverse(pio_y, pio_y));
+}
+#endif
+
+namespace {
 
 void setOutGpio(int pos)
 {
@@ -93,113 +255,568 @@ void setOutGpio(int pos)
 }
 
 
+__zx_data uint8_t Border = 7;
+
+uint8_t __zx_code(ula_read)(uint16_t)
+{
+    return 0; // TODO: Sinclair/Cursor joysticks & TAPE
+}
+
+// the ULA takes the write, the border is only noted for snapshot_save()
+void __zx_code(ula_write)(uint16_t, uint8_t data)
+{
+    Border = data & 7;
+}
+
+// Kempston decodes only A5, Fuller is fully decoded
+const IoDevice KempstonJoystick{"kempston", 0x20, 0x00, joystick_kempston_read, nullptr};
+const IoDevice FullerJoystick{"fuller", 0xff, 0x7f, joystick_fuller_read, nullptr};
+const IoDevice UlaPort{"ula", 0x01, 0x00, ula_read, ula_write, true};
+
 constexpr uint32_t ZxRdMask = 1u << I_RD_L;
 constexpr uint32_t ZxWrMask = 1u << I_WR_L;
 constexpr uint32_t MreqMask = 1u << I_MREQ_L;
 constexpr uint32_t IOrqMask = 1u << I_IORQ_L;
 
-bool Romcs = true;
+__zx_data bool Romcs = true;
 constexpr uint32_t RomRead = (0xc000 << I_ADDR_BASE) | MreqMask | ZxRdMask;
+constexpr uint32_t RomDrive = 0xff00;
+
+// mreq TX words, see zx_mreq in zx.pio
+constexpr uint32_t MreqHold = 1;
+constexpr uint32_t MreqDataShift = 1;
+
+constexpr uint16_t NoWatch = 0xffff; // never a ROM address
+constexpr uint32_t ReplySlackUs = 10000; // core1 answers within, on top of the work asked
+constexpr uint32_t HoldSettleUs = 5; // a bus cycle running out, a few T states
+constexpr uint32_t SnoopDrainUs = 10; // a joined snoop FIFO, a loop trip a word
+
+// shadow rom session, see zx_shadow_arm()
+__zx_data std::atomic<ZxShadow> ShadowState{ZxShadow::Idle};
+__zx_data std::atomic<uint16_t> ShadowWatch{NoWatch}; // the next fetch that needs shadow_trap()
+__zx_data const ZxShadowSession *Shadow = nullptr;
+__zx_data bool ShadowRomcs = true;
+__zx_data uint32_t ShadowStartUs = 0;
+__zx_data std::atomic<uint32_t> ShadowUs{0};
+__zx_data std::atomic<uint32_t> ShadowSessions{0};
+
+// zx_wait_read() counters, written by core1 only
+__zx_data std::atomic<uint32_t> WaitCount[int(ZxWaitSource::Count)];
+__zx_data std::atomic<uint32_t> WaitCycles[int(ZxWaitSource::Count)];
+
+void inline __zx_code(set_romcs)(bool romcs)
+{
+    Romcs = romcs;
+    if (Romcs)
+        gpio_set_mask(RomcsMask);
+    else
+        gpio_clr_mask(RomcsMask);
+#ifdef ZX_ROM_DMA
+    pio->sm[romSM].pinctrl = Romcs ? romPinctrlOn : romPinctrlOff;
+#endif
+}
 
-bool inline  __time_critical_func(zx_mreq)()
+// the trap of a fetch of addr, below RomBankSize: one load and a shift
+RomTrap inline __zx_code(rom_trap)(uint16_t addr)
 {
-    if (pio->fstat & mreqRxEmptyMask)
-        return false;
-    const uint32_t bus = pio->rxf[mreqSM];
+    return RomTrap(RomTrapPtr[addr / 16] >> (addr % 16 * 2) & 3);
+}
+
+// A trap taken, after the reply of its fetch. romcs is the paging the fetch
+// was served with, a page in without ZX_ROM_DMA paged in before the reply
+// already.
+void __zx_code(trap_taken)(RomTrap trap, uint16_t addr, bool romcs)
+{
+    if (trap == RomTrap::PageIn) {
+        if (romcs)
+            return;
+        if (!Romcs)
+            set_romcs(true);
+    } else if (trap == RomTrap::PageOut) {
+        if (!romcs)
+            return;
+        set_romcs(false);
+    }
+    const uint32_t action = uint32_t(trap);
+    mailbox_post(MailToCore0, MailTag::Trap, addr, &action, 1);
+}
+
+#ifndef ZX_ROM_DMA
+// a ROM byte, from the image itself while its line is not copied in yet.
+// Inline down to zx_wait_read(): the hold word has to reach the PIO before the
+// Z80 samples /WAIT, a T state after the request.
+__force_inline uint8_t rom_byte(const uint8_t *p)
+{
+    const uint32_t fill = RomFillBytes.load(std::memory_order_relaxed);
+    if (fill) [[unlikely]] {
+        const uint32_t offset = uintptr_t(p) - uintptr_t(RomFillBase);
+        const uint32_t line = offset / RomFillLine;
+        if (offset < fill && !(RomFillValid[line / 32].load(std::memory_order_acquire) & (1u << (line % 32))))
+            return zx_wait_read(RomFillWait, RomFillSource + offset);
+    }
+    return *p;
+}
+
+// Enters or leaves the shadow rom, returns the image addr is served from or
+// nullptr when the session was cancelled meanwhile
+const uint8_t *__zx_code(shadow_trap)(uint16_t addr)
+{
+    const ZxShadow state = ShadowState.load(std::memory_order_acquire);
+    const ZxShadowSession *session = Shadow;
+    if (state == ZxShadow::Armed) {
+        // a ROM we do not know or one that does not have the routine to replace
+        if (session->signatureSize) {
+            if (!Romcs)
+                return nullptr;
+            for (uint8_t i = 0; i < session->signatureSize; ++i) {
+                if (rom_byte(RomPtr + addr + i) != session->signature[i])
+                    return nullptr;
+            }
+        }
+        ZxShadow armed = ZxShadow::Armed;
+        if (!ShadowState.compare_exchange_strong(armed, ZxShadow::Active, std::memory_order_acquire))
+            return nullptr;
+        ShadowStartUs = time_us_32();
+        ShadowRomcs = Romcs;
+        set_romcs(true);
+        RomPtr = const_cast<uint8_t *>(session->image);
+        ShadowWatch.store(session->exit, std::memory_order_relaxed);
+        return session->image;
+    }
+    if (state != ZxShadow::Active)
+        return nullptr;
+
+    // the exit byte still comes from the image, the next fetch does not
+    rombank_page();
+    set_romcs(ShadowRomcs);
+    ShadowUs.store(time_us_32() - ShadowStartUs, std::memory_order_relaxed);
+    ShadowSessions.fetch_add(1, std::memory_order_release);
+    if (session->repeat) {
+        ShadowWatch.store(session->entry, std::memory_order_relaxed);
+        ShadowState.store(ZxShadow::Armed, std::memory_order_release);
+    } else {
+        ShadowWatch.store(NoWatch, std::memory_order_relaxed);
+        ShadowState.store(ZxShadow::Done, std::memory_order_release);
+    }
+    return session->image;
+}
+#endif
 
+// serves the word waiting in the mreq RX FIFO, the caller checked there is one
+void inline __zx_code(zx_mreq)()
+{
+    const uint32_t bus = pio->rxf[mreqSM];
     const uint16_t addr = bus >> 16;
+    const bool romcs = Romcs;
+    RomTrap trap = RomTrap::None;
+#ifdef ZX_ROM_DMA
+    // The shadow rom is served by zx_rom, paging it in here takes effect from
+    // the next bus cycle, the trap fetch itself comes from the Spectrum ROM.
+    if (!(bus & RomRead))
+        trap = rom_trap(addr);
+#else
     uint32_t outData = 0;
-    if (Romcs && !(bus & RomRead)) {
-        outData = RomPtr[addr];
+    if (romcs && !(bus & RomRead)) {
+        const uint8_t *rom = RomPtr;
+        if (addr == ShadowWatch.load(std::memory_order_relaxed)) [[unlikely]] {
+            if (const uint8_t *image = shadow_trap(addr))
+                rom = image;
+        }
+        outData = rom_byte(rom + addr) | RomDrive;
+        trap = rom_trap(addr);
     } else {
         if (!(bus & MreqMask)) {
-            switch(addr) {
-            case 0x0066: // NMI
-            case 0x0008: // shadow rom error handling
-            case 0x1708: // shadow rom error handling
-                Romcs = true;
-                gpio_put(O_ROMCS, Romcs);
-                outData = RomPtr[addr];
-                break;
+            const uint8_t *image = nullptr;
+            if (!(bus & RomRead)) {
+                if (addr == ShadowWatch.load(std::memory_order_relaxed))
+                    image = shadow_trap(addr);
+                trap = rom_trap(addr);
+            }
+            if (image) {
+                outData = image[addr] | RomDrive;
+            } else if (trap == RomTrap::PageIn) {
+                // the trap fetch itself comes from IFp
+                set_romcs(true);
+                outData = rom_byte(RomPtr + addr) | RomDrive;
             }
         } else {
             // IORQ
-            switch (addr & 0xff)
-            {
-            case 0x1f: // Kempston joystick
-            case 0x7F: // Fuller joystick
-                outData = 0; // TODO: handle Kempston joystick
-                break;
-            case 0xFE:
-                outData = 0; // TODO: Sinclair/Cursor joysticks & TAPE
-                break;
-            default:
-                break;
-            }
+            outData = IoReadTable[addr & 0xff](addr);
         }
     }
 
-    pio->txf[mreqSM] = outData;
-    return true;
+    pio->txf[mreqSM] = outData << MreqDataShift;
+#endif
+    // after the answer, the Z80 is waiting for that
+    trace_record(bus);
+    if (trap != RomTrap::None) [[unlikely]]
+        trap_taken(trap, addr, romcs);
 }
 
-void inline  __time_critical_func(zx_iorq)()
+// copies the write waiting in the snoop RX FIFO to the RAM shadow, the caller
+// checked there is one
+void inline __zx_code(zx_snoop_write)()
 {
-    if (pio->fstat & iorqRxEmptyMask)
-        return;
-    const uint32_t bus = pio->rxf[iorqSM];
+    ramshadow_record(pio->rxf[snoopSM]);
+}
 
+// serves the word waiting in the iorq RX FIFO, the caller checked there is one
+void inline __zx_code(zx_iorq)()
+{
+    const uint32_t bus = pio->rxf[iorqSM];
     const uint16_t addr = bus >> 16;
     uint32_t outData = 0;
     if (!(bus&ZxRdMask)) {
-        switch (addr & 0xff)
-        {
-        case 0x1f: // Kempston joystick
-        case 0x7F: // Fuller joystick
-            outData = 0; // TODO: handle Kempston joystick
-            break;
-        case 0xFE:
-            outData = 0; // TODO: Sinclair/Cursor joysticks & TAPE
-            break;
-        default:
-            break;
-        }
-    } else if (addr == 3)  {
-        // TODO Handle
+        outData = IoReadTable[addr & 0xff](addr) | IoReadDrive[addr & 0xff];
+    } else {
+        IoWriteTable[addr & 0xff](addr, bus & 0xff);
     }
 
     pio->txf[iorqSM] = outData;
+    trace_record(bus);
 }
 
-} // namespace {
+// core1, with the bus held: serves the cycle that was in flight as the hold
+// took, the Z80 then waits in T2 with its data out
+void drain()
+{
+    const uint32_t start = time_us_32();
+    while (time_us_32() - start < HoldSettleUs)
+        zx_poll();
+}
 
-void __time_critical_func(zx_main)()
+// core0: posts a request to zx_boot() and waits for the reply to it
+bool boot_request(MailTag tag, const uint32_t *payload, uint8_t words, MailTag reply, MailMessage &message,
+                  uint32_t timeoutUs)
 {
-    // vreg_disable_voltage_limit();
-    // vreg_set_voltage(VREG_VOLTAGE_1_35);
-    // set_sys_clock_khz(300000, true);
+    static uint16_t sequence = 0;
+    const uint16_t seq = ++sequence;
+    if (!mailbox_post(MailToCore1, tag, seq, payload, words))
+        return false;
+    const uint32_t start = time_us_32();
+    while (time_us_32() - start < timeoutUs) {
+        if (!mailbox_fetch(MailToCore0, message)) {
+            busy_wait_us(1);
+            continue;
+        }
+        // anything else is the late reply of a request that timed out
+        if (message.tag == reply && message.arg == seq)
+            return true;
+    }
+    return false;
+}
+
+} // namespace {
 
-    // disable all interrupts
+void zx_init()
+{
+    // disable all interrupts but the one flash_safe_execute() parks core1
+    // with while core0 writes the flash, see profile.cpp
     irq_set_mask_enabled(0xFFFFFFFF, false);
+    flash_safe_execute_core_init();
+
+    io_register(&KempstonJoystick);
+    io_register(&FullerJoystick);
+    io_register(&UlaPort);
+    io_build();
 
     setup_common_pio();
+    // nobody serves the bus before zx_start(), the state machines come up
+    // with the Z80 stopped in a cycle they will see from its start
+    hold_bus(true);
+    busy_wait_us(HoldSettleUs);
 
     setup_zx_mreq_pio();
     setup_zx_iorq_pio();
+    setup_zx_snoop_pio();
+#ifdef ZX_ROM_DMA
+    setup_zx_rom_dma();
+#endif
 
     setOutGpio(O_ROMCS);
+    setOutGpio(O_ROMCS1);
+    setOutGpio(O_ROMCS2);
     setOutGpio(O_HC_CPM);
-    gpio_put(O_ROMCS, Romcs);
+    set_romcs(Romcs);
 
-    // wait for stdio
-    multicore_fifo_pop_blocking();
+    // /NMI is shared with the NMI button, released it is an input
+    gpio_init(O_NMI);
+    gpio_put(O_NMI, false);
+    gpio_set_dir(O_NMI, GPIO_IN);
 
-    for (uint16_t i = 0; i < RomSize; ++RomSize)
-        (void)RomPtr[i];
+    cycles_init();
+}
 
-    while(true) {
-        if (!zx_mreq()) {
-             zx_iorq();
+void zx_boot()
+{
+    // core0 brings up stdio and may have the bus timed at a few clock
+    // profiles first, see zx_measure_request(). The Z80 is held on /WAIT all
+    // along but for the measures.
+    MailMessage message;
+    while (true) {
+        if (!mailbox_fetch(MailToCore1, message))
+            continue;
+        switch (message.tag) {
+        case MailTag::Measure: {
+            hold_bus(false);
+            const ZxMargin margin = zx_measure(message.words ? message.payload[0] : 0);
+            hold_bus(true);
+            drain();
+            const uint32_t reply[] = {margin.worstCycles, margin.reads};
+            mailbox_post(MailToCore0, MailTag::Measured, message.arg, reply, 2);
+            break;
         }
+        case MailTag::Bench: {
+            const MailboxBench bench = mailbox_bench();
+            uint32_t reply[2 * MailboxBench::Sizes];
+            for (int i = 0; i < MailboxBench::Sizes; ++i) {
+                reply[2 * i] = bench.minCycles[i];
+                reply[2 * i + 1] = bench.maxCycles[i];
+            }
+            mailbox_post(MailToCore0, MailTag::Benched, message.arg, reply, 2 * MailboxBench::Sizes);
+            break;
+        }
+        case MailTag::Start:
+            for (uint32_t i = 0; i < RomBankSize; ++i)
+                (void)RomPtr[i];
+            drain();
+            hold_bus(false);
+            return;
+        default:
+            break;
+        }
+    }
+}
+
+bool zx_shadow_arm(const ZxShadowSession *session)
+{
+#ifdef ZX_ROM_DMA
+    (void)session;
+    return false;
+#else
+    if (ShadowState.load(std::memory_order_acquire) != ZxShadow::Idle)
+        return false;
+    Shadow = session;
+    ShadowState.store(ZxShadow::Armed, std::memory_order_release);
+    ShadowWatch.store(session->entry, std::memory_order_release);
+    return true;
+#endif
+}
+
+bool zx_shadow_cancel()
+{
+    ZxShadow armed = ZxShadow::Armed;
+    if (!ShadowState.compare_exchange_strong(armed, ZxShadow::Idle, std::memory_order_acq_rel))
+        return false;
+    ShadowWatch.store(NoWatch, std::memory_order_relaxed);
+    return true;
+}
+
+void zx_shadow_release()
+{
+    ZxShadow done = ZxShadow::Done;
+    ShadowState.compare_exchange_strong(done, ZxShadow::Idle, std::memory_order_acq_rel);
+}
+
+ZxShadow zx_shadow_state()
+{
+    return ShadowState.load(std::memory_order_acquire);
+}
+
+uint32_t zx_shadow_us()
+{
+    return ShadowUs.load(std::memory_order_relaxed);
+}
+
+uint32_t zx_shadow_sessions()
+{
+    return ShadowSessions.load(std::memory_order_acquire);
+}
+
+bool __zx_code(zx_shadow_active)()
+{
+    return ShadowState.load(std::memory_order_relaxed) == ZxShadow::Active;
+}
+
+ZxMargin __zx_code(zx_measure)(uint32_t cycles)
+{
+    // zx_poll() with the cycle counter around the MREQ service. A word may
+    // have been pushed right as the FIFO was last seen empty, its latency
+    // counts from that look. The next MREQ word cannot land before the state
+    // machine took the data of the current one, whether or not the Z80 was
+    // held for it.
+    ZxMargin margin;
+    const uint32_t start = cycles_now();
+    uint32_t emptySince = start;
+    for (uint32_t now = start; now - start < cycles; now = cycles_now()) {
+        const uint32_t fstat = pio->fstat;
+        if (fstat & mreqRxEmptyMask) {
+            emptySince = now;
+            if (!(fstat & iorqRxEmptyMask))
+                zx_iorq();
+            if (!(fstat & snoopRxEmptyMask))
+                zx_snoop_write();
+            continue;
+        }
+        zx_mreq();
+        const uint32_t served = cycles_now();
+        margin.worstCycles = std::max(margin.worstCycles, served - emptySince);
+        ++margin.reads;
+        emptySince = served;
+    }
+    return margin;
+}
+
+ZxMargin zx_measure_request(uint32_t cycles)
+{
+    ZxMargin margin;
+    MailMessage reply;
+    const uint32_t us = uint64_t(cycles) * 2 * 1000000 / clock_get_hz(clk_sys);
+    if (boot_request(MailTag::Measure, &cycles, 1, MailTag::Measured, reply, us + ReplySlackUs) && reply.words == 2) {
+        margin.worstCycles = reply.payload[0];
+        margin.reads = reply.payload[1];
+    }
+    return margin;
+}
+
+bool zx_mail_bench(MailboxBench &bench)
+{
+    MailMessage reply;
+    if (!boot_request(MailTag::Bench, nullptr, 0, MailTag::Benched, reply, ReplySlackUs)
+        || reply.words != 2 * MailboxBench::Sizes)
+        return false;
+    for (int i = 0; i < MailboxBench::Sizes; ++i) {
+        bench.minCycles[i] = reply.payload[2 * i];
+        bench.maxCycles[i] = reply.payload[2 * i + 1];
     }
+    return true;
+}
+
+void zx_start()
+{
+    mailbox_post(MailToCore1, MailTag::Start);
+}
+
+void zx_hold(bool hold)
+{
+    hold_bus(hold);
+    if (hold)
+        busy_wait_us(HoldSettleUs);
+}
+
+uint8_t __zx_code(zx_wait_read)(ZxWaitSource source, const uint8_t *p)
+{
+    pio->txf[mreqSM] = MreqHold;
+    const uint32_t start = cycles_now();
+    const uint8_t data = *p;
+    const int i = int(source);
+    WaitCount[i].store(WaitCount[i].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    WaitCycles[i].store(WaitCycles[i].load(std::memory_order_relaxed) + cycles_now() - start,
+                        std::memory_order_relaxed);
+    return data;
+}
+
+ZxWaitStats zx_wait_stats(ZxWaitSource source)
+{
+    ZxWaitStats stats;
+    stats.waits = WaitCount[int(source)].load(std::memory_order_relaxed);
+    stats.cycles = WaitCycles[int(source)].load(std::memory_order_relaxed);
+    return stats;
+}
+
+void zx_set_pio_clkdiv(uint16_t divInt, uint8_t divFrac)
+{
+    const float div = divInt + divFrac / 256.f;
+    pio_sm_set_clkdiv(pio, mreqSM, div);
+    pio_sm_set_clkdiv(pio, iorqSM, div);
+    pio_sm_set_clkdiv(pio, snoopSM, div);
+#ifdef ZX_ROM_DMA
+    pio_sm_set_clkdiv(pio, romSM, div);
+#endif
+}
+
+void zx_snoop(bool on)
+{
+    pio_sm_set_enabled(pio, snoopSM, false);
+    if (!on) {
+        // core1 takes the words left, then records the last one
+        const uint32_t start = time_us_32();
+        while (!(pio->fstat & snoopRxEmptyMask) && time_us_32() - start < SnoopDrainUs) {
+        }
+        busy_wait_us(1);
+        return;
+    }
+    // from the top, a word of the last run would be stale
+    pio_sm_clear_fifos(pio, snoopSM);
+    pio_sm_restart(pio, snoopSM);
+    pio_sm_exec(pio, snoopSM, pio_encode_jmp(snoopOffset));
+    pio->fdebug = 1u << (PIO_FDEBUG_RXSTALL_LSB + snoopSM);
+    pio_sm_set_enabled(pio, snoopSM, true);
+}
+
+bool zx_snoop_lost()
+{
+    return pio->fdebug & (1u << (PIO_FDEBUG_RXSTALL_LSB + snoopSM));
+}
+
+uint8_t zx_border()
+{
+    return Border;
+}
+
+void zx_nmi()
+{
+    // the Z80 latches the falling edge, a couple of T states are enough
+    gpio_set_dir(O_NMI, GPIO_OUT);
+    busy_wait_us(2);
+    gpio_set_dir(O_NMI, GPIO_IN);
+}
+
+void __zx_code(zx_poll)()
+{
+    // One look at FSTAT covers both state machines. Each one waits for the
+    // answer to its word before it pushes the next, and a transaction is
+    // served well before the next one starts, so both FIFOs only have a word
+    // at once when a refresh, which the Z80 does not wait for, is still
+    // pending as an IORQ comes in. Only core1 pops the FIFOs, the snapshot still holds
+    // for the IORQ after the refresh is served.
+    //
+    // A memory write is snooped last: it shows up with /WR low, after its
+    // MREQ word was served, and its cycle is over before the next MREQ
+    // starts.
+    const uint32_t fstat = pio->fstat;
+    if (!(fstat & mreqRxEmptyMask))
+        zx_mreq();
+    if (!(fstat & iorqRxEmptyMask))
+        zx_iorq();
+    if (!(fstat & snoopRxEmptyMask))
+        zx_snoop_write();
+}
+
+void __zx_code(zx_poll_split)()
+{
+    if (!(pio->fstat & mreqRxEmptyMask)) {
+        zx_mreq();
+        return;
+    }
+    if (!(pio->fstat & iorqRxEmptyMask)) {
+        zx_iorq();
+        return;
+    }
+    if (!(pio->fstat & snoopRxEmptyMask))
+        zx_snoop_write();
+}
+
+void __zx_code(zx_main)()
+{
+    zx_init();
+    zx_boot();
+
+#ifdef ZX_SPLIT_POLL
+    while(true)
+        zx_poll_split();
+#else
+    while(true)
+        zx_poll();
+#endif
 }
@@ -27,6 +27,126 @@ void printBits(const char *str, T num)
 
 constexpr uint32_t dataBitsMask = (0xff << PIO_BASE);
 
-extern uint8_t *RomPtr;
-extern uint16_t RomSize;
+struct MailboxBench;
+
+// the 16K bank served to the Z80, owned by rombank.cpp
+extern uint8_t *volatile RomPtr;
+
+#ifdef ZX_ROM_DMA
+// core0: rebuilds zx_rom lookup table 0 or 1 from a 16K bank, the one not
+// selected
+void zx_rom_dma_load(int table, const uint8_t *rom);
+// core0: switches zx_rom to the table, with a single PIO instruction: every
+// read gets its byte from either the old table or the new one
+void zx_rom_dma_select(int table);
+#endif
+
+// Shadow ROM sessions, used to run Pico generated Z80 routines.
+//
+// An armed session waits for the fetch of its entry address: from that fetch
+// on the Z80 is served image, until it fetches exit, the last image byte it
+// reads. The ROM is paged back and Romcs restored right after it, so the
+// routine ends with a jump out of the shadow ROM.
+struct ZxShadowSession
+{
+    const uint8_t *image;
+    uint16_t entry;
+    uint16_t exit;
+    bool repeat = false;                // armed again after each exit
+    const uint8_t *signature = nullptr; // machine ROM bytes expected at entry
+    uint8_t signatureSize = 0;
+};
+
+enum class ZxShadow : uint8_t {
+    Idle,
+    Armed,      // waiting for the entry fetch
+    Active,     // the Z80 runs the image
+    Done,       // paged out, see zx_shadow_us()
+};
+
+// core0: false if a session is in progress or with ZX_ROM_DMA, where ROM
+// reads never reach the CPU. With a signature the entry fetch is only taken
+// while IFp serves a ROM holding it there.
+bool zx_shadow_arm(const ZxShadowSession *session);
+// core0: drops an armed session which did not start yet
+bool zx_shadow_cancel();
+// core0: Done -> Idle
+void zx_shadow_release();
+ZxShadow zx_shadow_state();
+// time between the entry and the exit fetch of the last session
+uint32_t zx_shadow_us();
+// sessions completed so far
+uint32_t zx_shadow_sessions();
+// core1: true while the Z80 runs a shadow image
+bool zx_shadow_active();
+
+// On-demand wait states.
+//
+// zx_mreq() answers from SRAM well before the Z80 samples /WAIT. A byte that
+// has to come from a slower store is read with the Z80 held on /WAIT, which
+// the mreq program only drives low when asked to, see zx.pio. The counters
+// tell how often and for how long, to size the SRAM copies from.
+enum class ZxWaitSource : uint8_t {
+    Flash,      // lines of a ROM image not copied in yet, see rombank_begin()
+    Psram,      // the same for an image of the PSRAM library, see library.h
+    Count
+};
+
+struct ZxWaitStats
+{
+    uint32_t waits = 0;     // reads the Z80 was held for
+    uint32_t cycles = 0;    // core1 cycles it was held for, wraps
+};
+
+// core1, from zx_mreq() only: reads *p with the Z80 held on /WAIT
+uint8_t zx_wait_read(ZxWaitSource source, const uint8_t *p);
+ZxWaitStats zx_wait_stats(ZxWaitSource source);
+
+// core0: starts or stops the zx_snoop state machine, see ramshadow.h. Once
+// stopped, core1 recorded every write it pushed.
+void zx_snoop(bool on);
+// core0: true when the zx_snoop state machine found its RX FIFO full since it
+// was started, a write went by unseen
+bool zx_snoop_lost();
+
+// the border colour last written to the ULA
+uint8_t zx_border();
+
+// core0: pulses /NMI
+void zx_nmi();
+
+// Bus timing, see zx_measure()
+struct ZxMargin
+{
+    uint32_t worstCycles = 0;   // core1 cycles from the last empty RX FIFO check to the data pushed
+    uint32_t reads = 0;         // MREQ transactions served
+};
+
+// sets up the PIO state machines and the gpios used by the bus engine, the
+// Z80 is held on /WAIT from here until zx_start()
+void zx_init();
+// core1, before the bus loop: answers the requests core0 posts to
+// MailToCore1 until zx_start(), the Z80 only runs for zx_measure()
+void zx_boot();
+// core1: serves the bus for that many cycles timing every MREQ transaction
+ZxMargin zx_measure(uint32_t cycles);
+// core0, before zx_start(): has core1 run zx_measure(), an empty margin when
+// core1 does not answer
+ZxMargin zx_measure_request(uint32_t cycles);
+// core0, before zx_start(): has core1 run mailbox_bench()
+bool zx_mail_bench(MailboxBench &bench);
+// core0: core1 leaves zx_boot() and serves the bus
+void zx_start();
+// core0, with the bus loop running: stops the Z80 on /WAIT in its next bus
+// cycle, or lets it go again. Around what core1 must not run next to, a
+// flash write, see profile.cpp.
+void zx_hold(bool hold);
+// core0, before zx_start(): divider of the bus state machines, in 1/256ths
+void zx_set_pio_clkdiv(uint16_t divInt, uint8_t divFrac);
+// services the pending bus transactions seen by one read of FSTAT
+void zx_poll();
+// services at most one pending bus transaction, reading FSTAT for each
+// state machine in turn: the bus loop of ZX_SPLIT_POLL builds
+void zx_poll_split();
+// core1 entry point: zx_init(), zx_boot(), then zx_poll() forever
 void zx_main();